@@ -26,6 +26,7 @@ public class MultiplayerOnlineSubsystem : ModuleRules
 			"VoiceChat",
 			"SlateCore",
 			"Json",
+			"Sockets",
 
 		});
 		
@@ -0,0 +1,260 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_AvatarCache.h"
+
+#include "Async/Async.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OSS::OnlineAPI
+{
+
+// @note: Identifies our raw avatar files: 'MOSA' followed by a version, the time the avatar was saved, width, height
+// and BGRA8 pixels. The file's modification time is bumped whenever it is read, and orders the files for eviction.
+static constexpr uint32 AvatarFileMagic = 0x41534F4D;
+static constexpr uint32 AvatarFileVersion = 2;
+static constexpr int64 AvatarFileHeaderSize = 24;
+
+static FString GetAvatarCacheDirectory()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MOS"), TEXT("AvatarCache"));
+}
+
+// Deletes the least recently used avatar files until the disk cache fits in BudgetBytes, always keeping KeepPath.
+static void EnforceDiskBudget(int64 BudgetBytes, const FString &KeepPath)
+{
+    struct FAvatarFile
+    {
+        FString Path;
+        int64 Size;
+        FDateTime LastUsed;
+    };
+    TArray<FAvatarFile> Files;
+    int64 TotalBytes = 0;
+    FPlatformFileManager::Get().GetPlatformFile().IterateDirectoryStat(
+        *GetAvatarCacheDirectory(),
+        [&Files, &TotalBytes](const TCHAR *Path, const FFileStatData &Stat) {
+            if (!Stat.bIsDirectory && FPaths::GetExtension(Path) == TEXT("bin"))
+            {
+                Files.Add(FAvatarFile{Path, Stat.FileSize, Stat.ModificationTime});
+                TotalBytes += Stat.FileSize;
+            }
+            return true;
+        });
+    if (TotalBytes <= BudgetBytes)
+    {
+        return;
+    }
+
+    Files.Sort([](const FAvatarFile &A, const FAvatarFile &B) {
+        return A.LastUsed < B.LastUsed;
+    });
+    FString KeepFileName = FPaths::GetCleanFilename(KeepPath);
+    for (const FAvatarFile &File : Files)
+    {
+        if (TotalBytes <= BudgetBytes)
+        {
+            break;
+        }
+        if (FPaths::GetCleanFilename(File.Path) != KeepFileName && IFileManager::Get().Delete(*File.Path, false, false, true))
+        {
+            TotalBytes -= File.Size;
+        }
+    }
+}
+
+UTexture *FAvatarCache::Find(const FUniqueNetIdRepl &UserId)
+{
+    if (auto *Entry = this->Entries.Find(UserId))
+    {
+        // Move this avatar to the front of the LRU list.
+        this->LruList.RemoveNode(Entry->LruNode, false);
+        this->LruList.AddHead(Entry->LruNode);
+        this->HitCount++;
+        return Entry->Texture.Get();
+    }
+
+    if (!this->bPersistToDisk)
+    {
+        this->MissCount++;
+    }
+    return nullptr;
+}
+
+void FAvatarCache::LoadFromDisk(const FUniqueNetIdRepl &UserId, TFunction<void(UTexture *)> OnLoaded)
+{
+    FString Path = this->GetDiskPath(UserId);
+    double MaxAgeSeconds = this->DiskMaxAgeSeconds;
+    TWeakPtr<uint8, ESPMode::ThreadSafe> Lifetime = this->LifetimeToken;
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [this, Lifetime, UserId, Path, MaxAgeSeconds, OnLoaded = MoveTemp(OnLoaded)]() mutable {
+            // Read and check the file here; only the texture has to be created on the game thread.
+            TArray<uint8> Data;
+            int32 Width = 0;
+            int32 Height = 0;
+            bool bUsable = false;
+            if (FFileHelper::LoadFileToArray(Data, *Path, FILEREAD_Silent))
+            {
+                FMemoryReader Reader(Data);
+                uint32 Magic = 0;
+                uint32 Version = 0;
+                int64 SavedAtTicks = 0;
+                Reader << Magic << Version << SavedAtTicks << Width << Height;
+                int64 PixelBytes = static_cast<int64>(Width) * Height * 4;
+                bUsable = !Reader.IsError() && Magic == AvatarFileMagic && Version == AvatarFileVersion &&
+                          Width > 0 && Height > 0 && Data.Num() - AvatarFileHeaderSize == PixelBytes &&
+                          (FDateTime::UtcNow() - FDateTime(SavedAtTicks)).GetTotalSeconds() <= MaxAgeSeconds;
+                if (bUsable)
+                {
+                    // Mark the file as recently used, so the disk budget evicts it last.
+                    IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+                }
+            }
+
+            AsyncTask(
+                ENamedThreads::GameThread,
+                [this, Lifetime, UserId, Data = MoveTemp(Data), Width, Height, bUsable, OnLoaded = MoveTemp(OnLoaded)]() {
+                    if (!Lifetime.IsValid())
+                    {
+                        return;
+                    }
+
+                    UTexture2D *Texture = bUsable ? UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8) : nullptr;
+                    if (Texture != nullptr)
+                    {
+                        auto &Mip = Texture->GetPlatformData()->Mips[0];
+                        void *Pixels = Mip.BulkData.Lock(LOCK_READ_WRITE);
+                        FMemory::Memcpy(Pixels, Data.GetData() + AvatarFileHeaderSize, Data.Num() - AvatarFileHeaderSize);
+                        Mip.BulkData.Unlock();
+                        Texture->UpdateResource();
+                        this->Insert(UserId, Texture);
+                        this->HitCount++;
+                    }
+                    else
+                    {
+                        this->MissCount++;
+                    }
+                    OnLoaded(Texture);
+                });
+        });
+}
+
+void FAvatarCache::Add(const FUniqueNetIdRepl &UserId, UTexture *Texture)
+{
+    if (!UserId.IsValid() || Texture == nullptr)
+    {
+        return;
+    }
+
+    this->Insert(UserId, Texture);
+    if (this->bPersistToDisk)
+    {
+        this->SaveToDisk(UserId, Texture);
+    }
+}
+
+void FAvatarCache::Insert(const FUniqueNetIdRepl &UserId, UTexture *Texture)
+{
+    this->Evict(UserId);
+
+    FEntry &Entry = this->Entries.Add(UserId);
+    Entry.Texture.Reset(Texture);
+    Entry.SizeBytes = static_cast<int64>(Texture->CalcTextureMemorySizeEnum(TMC_ResidentMips));
+    this->LruList.AddHead(UserId);
+    Entry.LruNode = this->LruList.GetHead();
+    this->BytesResident += Entry.SizeBytes;
+    this->EnforceBudget();
+}
+
+void FAvatarCache::Reset()
+{
+    this->Entries.Empty();
+    this->LruList.Empty();
+    this->BytesResident = 0;
+}
+
+void FAvatarCache::Evict(const FUniqueNetIdRepl &UserId)
+{
+    FEntry Entry;
+    if (this->Entries.RemoveAndCopyValue(UserId, Entry))
+    {
+        this->LruList.RemoveNode(Entry.LruNode);
+        this->BytesResident -= Entry.SizeBytes;
+    }
+}
+
+void FAvatarCache::EnforceBudget()
+{
+    // @note: Always keep the most recently added avatar, even if it alone is over budget.
+    while (this->BytesResident > this->BudgetBytes && this->LruList.Num() > 1)
+    {
+        FUniqueNetIdRepl Oldest = this->LruList.GetTail()->GetValue();
+        this->Evict(Oldest);
+    }
+}
+
+FString FAvatarCache::GetDiskPath(const FUniqueNetIdRepl &UserId) const
+{
+    return FPaths::Combine(GetAvatarCacheDirectory(), FMD5::HashAnsiString(*UserId.ToString()) + TEXT(".bin"));
+}
+
+void FAvatarCache::SaveToDisk(const FUniqueNetIdRepl &UserId, UTexture *Texture) const
+{
+    // We can only persist uncompressed BGRA avatars whose pixels are still held on the CPU.
+    UTexture2D *Texture2D = Cast<UTexture2D>(Texture);
+    if (Texture2D == nullptr || Texture2D->GetPlatformData() == nullptr ||
+        Texture2D->GetPlatformData()->Mips.Num() == 0 || Texture2D->GetPixelFormat() != PF_B8G8R8A8)
+    {
+        return;
+    }
+    auto &Mip = Texture2D->GetPlatformData()->Mips[0];
+    if (!Mip.BulkData.IsBulkDataLoaded())
+    {
+        return;
+    }
+
+    int32 Width = Mip.SizeX;
+    int32 Height = Mip.SizeY;
+    int64 PixelBytes = static_cast<int64>(Width) * Height * 4;
+    if (Mip.BulkData.GetBulkDataSize() < PixelBytes)
+    {
+        return;
+    }
+
+    // Copy the pixels here, since the texture may change or go away, and write them out on a worker thread.
+    auto Data = MakeShared<TArray<uint8>, ESPMode::ThreadSafe>();
+    Data->Reserve(AvatarFileHeaderSize + PixelBytes);
+    FMemoryWriter Writer(*Data);
+    uint32 Magic = AvatarFileMagic;
+    uint32 Version = AvatarFileVersion;
+    int64 SavedAtTicks = FDateTime::UtcNow().GetTicks();
+    Writer << Magic << Version << SavedAtTicks << Width << Height;
+    const void *Pixels = Mip.BulkData.LockReadOnly();
+    Writer.Serialize(const_cast<void *>(Pixels), PixelBytes);
+    Mip.BulkData.Unlock();
+
+    FString Path = this->GetDiskPath(UserId);
+    int64 BudgetBytes = this->DiskBudgetBytes;
+    AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Data, Path, BudgetBytes]() {
+        // @note: Write to a uniquely named temporary file and move it into place, so a concurrent read or save of the
+        // same avatar never sees a partial file.
+        FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+        if (!FFileHelper::SaveArrayToFile(*Data, *TempPath) ||
+            !IFileManager::Get().Move(*Path, *TempPath, true, true, false, true))
+        {
+            IFileManager::Get().Delete(*TempPath, false, false, true);
+            return;
+        }
+        EnforceDiskBudget(BudgetBytes, Path);
+    });
+}
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,24 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_FileTransferAsyncResult.h"
+
+void UMOS_FileTransferAsyncResult::OnProgress(float Progress)
+{
+	if (!this->bDidCallback)
+	{
+		this->NativeProgressCallback.ExecuteIfBound(Progress);
+	}
+}
+
+void UMOS_FileTransferAsyncResult::OnResult(bool bWasSuccessful, const FString &ErrorMessage)
+{
+	if (!this->bDidCallback)
+	{
+		this->bDidCallback = true;
+		if (this->NativeCallback.IsBound())
+		{
+			this->NativeCallback.Execute(bWasSuccessful, ErrorMessage);
+		}
+	}
+}
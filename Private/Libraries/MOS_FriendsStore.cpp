@@ -0,0 +1,277 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_FriendsStore.h"
+
+#include "Interfaces/OnlinePresenceInterface.h"
+
+namespace OSS::OnlineAPI
+{
+
+int32 FStringInterner::Intern(const FString &Value)
+{
+    if (Value.IsEmpty())
+    {
+        return 0;
+    }
+    if (const int32 *Existing = this->Indices.Find(Value))
+    {
+        this->RefCounts[*Existing]++;
+        return *Existing;
+    }
+    int32 Index;
+    if (this->FreeIndices.Num() > 0)
+    {
+        Index = this->FreeIndices.Pop();
+        this->Strings[Index] = Value;
+        this->RefCounts[Index] = 1;
+    }
+    else
+    {
+        Index = this->Strings.Add(Value);
+        this->RefCounts.Add(1);
+    }
+    this->Indices.Add(Value, Index);
+    return Index;
+}
+
+void FStringInterner::Release(int32 Index)
+{
+    if (Index <= 0 || !this->RefCounts.IsValidIndex(Index) || this->RefCounts[Index] <= 0)
+    {
+        return;
+    }
+    if (--this->RefCounts[Index] == 0)
+    {
+        this->Indices.Remove(this->Strings[Index]);
+        this->Strings[Index].Empty();
+        this->FreeIndices.Add(Index);
+    }
+}
+
+void FStringInterner::Reset()
+{
+    this->Strings.Reset();
+    this->RefCounts.Reset();
+    this->FreeIndices.Reset();
+    this->Indices.Reset();
+    this->Strings.AddDefaulted();
+    this->RefCounts.Add(0);
+}
+
+EMOSFriendsFriendInvitationStatus FFriendsStore::ConvertInvitationStatus(EInviteStatus::Type Status)
+{
+    switch (Status)
+    {
+    case EInviteStatus::Accepted:
+        return EMOSFriendsFriendInvitationStatus::Accepted;
+    case EInviteStatus::PendingInbound:
+        return EMOSFriendsFriendInvitationStatus::PendingInbound;
+    case EInviteStatus::PendingOutbound:
+        return EMOSFriendsFriendInvitationStatus::PendingOutbound;
+    case EInviteStatus::Blocked:
+        return EMOSFriendsFriendInvitationStatus::Blocked;
+    case EInviteStatus::Suggested:
+        return EMOSFriendsFriendInvitationStatus::Suggested;
+    case EInviteStatus::Unknown:
+    default:
+        return EMOSFriendsFriendInvitationStatus::Unknown;
+    }
+}
+
+EMOSFriendsFriendPresenceStatus FFriendsStore::ConvertPresenceStatus(const FOnlineUserPresence &Presence)
+{
+    switch (Presence.Status.State)
+    {
+    case EOnlinePresenceState::Online:
+        return EMOSFriendsFriendPresenceStatus::Online;
+    case EOnlinePresenceState::Away:
+        return EMOSFriendsFriendPresenceStatus::Away;
+    case EOnlinePresenceState::ExtendedAway:
+        return EMOSFriendsFriendPresenceStatus::ExtendedAway;
+    case EOnlinePresenceState::DoNotDisturb:
+        return EMOSFriendsFriendPresenceStatus::DoNotDisturb;
+    case EOnlinePresenceState::Chat:
+        return EMOSFriendsFriendPresenceStatus::Chat;
+    case EOnlinePresenceState::Offline:
+    default:
+        return EMOSFriendsFriendPresenceStatus::Offline;
+    }
+}
+
+void FFriendsStore::Sync(const TArray<TSharedRef<FOnlineFriend>> &Friends)
+{
+    this->bPopulated = true;
+
+    TBitArray<> Seen(false, this->Ids.Num() + Friends.Num());
+    for (const auto &Friend : Friends)
+    {
+        FUniqueNetIdRepl Id(Friend->GetUserId());
+        int32 Index = this->IndexOf(Id);
+        bool bChanged = false;
+        if (Index == INDEX_NONE)
+        {
+            Index = this->AddFriend(Id);
+            bChanged = true;
+        }
+        Seen[Index] = true;
+
+        EMOSFriendsFriendInvitationStatus InvitationStatus = ConvertInvitationStatus(Friend->GetInviteStatus());
+        if (this->InvitationStates[Index] != InvitationStatus)
+        {
+            this->InvitationStates[Index] = InvitationStatus;
+            bChanged = true;
+        }
+        bChanged |= this->AssignString(this->DisplayNames[Index], Friend->GetDisplayName());
+        bChanged |= this->AssignString(this->RealNames[Index], Friend->GetRealName());
+        bChanged |= this->ApplyPresenceAt(Index, Friend->GetPresence());
+
+        if (bChanged)
+        {
+            this->MarkChanged(Id);
+        }
+    }
+
+    // Remove friends that are no longer in the list. Walk backwards so swapped-in friends have already been checked.
+    for (int32 Index = this->Ids.Num() - 1; Index >= 0; Index--)
+    {
+        if (!Seen[Index])
+        {
+            this->MarkChanged(this->Ids[Index]);
+            this->RemoveFriendAt(Index);
+        }
+    }
+}
+
+bool FFriendsStore::ApplyPresence(const FUniqueNetIdRepl &Id, const FOnlineUserPresence &Presence)
+{
+    int32 Index = this->IndexOf(Id);
+    if (Index == INDEX_NONE || !this->ApplyPresenceAt(Index, Presence))
+    {
+        return false;
+    }
+    this->MarkChanged(Id);
+    return true;
+}
+
+bool FFriendsStore::ApplyPresenceAt(int32 Index, const FOnlineUserPresence &Presence)
+{
+    EFriendPresenceFlags Flags = EFriendPresenceFlags::None;
+    if (Presence.bIsOnline)
+    {
+        Flags |= EFriendPresenceFlags::Online;
+    }
+    if (Presence.bIsPlaying)
+    {
+        Flags |= EFriendPresenceFlags::Playing;
+    }
+    if (Presence.bIsPlayingThisGame)
+    {
+        Flags |= EFriendPresenceFlags::PlayingThisGame;
+    }
+    if (Presence.bIsJoinable)
+    {
+        Flags |= EFriendPresenceFlags::Joinable;
+    }
+    if (Presence.bHasVoiceSupport)
+    {
+        Flags |= EFriendPresenceFlags::HasVoiceSupport;
+    }
+    EMOSFriendsFriendPresenceStatus State = ConvertPresenceStatus(Presence);
+    bool bStatusStringChanged = this->AssignString(this->StatusStrings[Index], Presence.Status.StatusStr);
+
+    if (this->PresenceFlags[Index] == Flags && this->PresenceStates[Index] == State && !bStatusStringChanged &&
+        this->LastOnline[Index] == Presence.LastOnline)
+    {
+        return false;
+    }
+    this->PresenceFlags[Index] = Flags;
+    this->PresenceStates[Index] = State;
+    this->LastOnline[Index] = Presence.LastOnline;
+    return true;
+}
+
+bool FFriendsStore::AssignString(int32 &Slot, const FString &Value)
+{
+    // @note: Intern before releasing the old string, so an unchanged value is never freed and re-added.
+    int32 NewIndex = this->Names.Intern(Value);
+    this->Names.Release(Slot);
+    if (Slot == NewIndex)
+    {
+        return false;
+    }
+    Slot = NewIndex;
+    return true;
+}
+
+int32 FFriendsStore::AddFriend(const FUniqueNetIdRepl &Id)
+{
+    int32 Index = this->Ids.Add(Id);
+    this->PresenceFlags.Add(EFriendPresenceFlags::None);
+    this->PresenceStates.Add(EMOSFriendsFriendPresenceStatus::Offline);
+    this->InvitationStates.Add(EMOSFriendsFriendInvitationStatus::Unknown);
+    this->DisplayNames.Add(0);
+    this->RealNames.Add(0);
+    this->StatusStrings.Add(0);
+    this->LastOnline.Add(FDateTime());
+    this->IndexById.Add(Id, Index);
+    return Index;
+}
+
+void FFriendsStore::RemoveFriendAt(int32 Index)
+{
+    this->IndexById.Remove(this->Ids[Index]);
+    this->Names.Release(this->DisplayNames[Index]);
+    this->Names.Release(this->RealNames[Index]);
+    this->Names.Release(this->StatusStrings[Index]);
+
+    // @note: Swap the last friend into the hole so every column stays dense.
+    this->Ids.RemoveAtSwap(Index);
+    this->PresenceFlags.RemoveAtSwap(Index);
+    this->PresenceStates.RemoveAtSwap(Index);
+    this->InvitationStates.RemoveAtSwap(Index);
+    this->DisplayNames.RemoveAtSwap(Index);
+    this->RealNames.RemoveAtSwap(Index);
+    this->StatusStrings.RemoveAtSwap(Index);
+    this->LastOnline.RemoveAtSwap(Index);
+    if (this->Ids.IsValidIndex(Index))
+    {
+        this->IndexById[this->Ids[Index]] = Index;
+    }
+}
+
+void FFriendsStore::MarkChanged(const FUniqueNetIdRepl &Id)
+{
+    bool bAlreadyChanged = false;
+    this->ChangedIdSet.Add(Id, &bAlreadyChanged);
+    if (!bAlreadyChanged)
+    {
+        this->ChangedIds.Add(Id);
+    }
+}
+
+TArray<FUniqueNetIdRepl> FFriendsStore::TakeChangedIds()
+{
+    TArray<FUniqueNetIdRepl> Changed = MoveTemp(this->ChangedIds);
+    this->ChangedIds.Reset();
+    this->ChangedIdSet.Reset();
+    return Changed;
+}
+
+void FFriendsStore::Reset()
+{
+    this->Ids.Empty();
+    this->PresenceFlags.Empty();
+    this->PresenceStates.Empty();
+    this->InvitationStates.Empty();
+    this->DisplayNames.Empty();
+    this->RealNames.Empty();
+    this->StatusStrings.Empty();
+    this->LastOnline.Empty();
+    this->IndexById.Empty();
+    this->Names.Reset();
+    this->ChangedIds.Empty();
+    this->ChangedIdSet.Empty();
+    this->bPopulated = false;
+}
+
+} // namespace OSS::OnlineAPI
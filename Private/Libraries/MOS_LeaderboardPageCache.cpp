@@ -0,0 +1,74 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_LeaderboardPageCache.h"
+
+namespace OSS::OnlineAPI
+{
+
+TSharedPtr<const TArray<FMOSLeaderboardsLeaderboardEntry>> FLeaderboardPageCache::Find(
+    const FLeaderboardPageKey &Key) const
+{
+    const FPage *Page = this->Pages.Find(Key);
+    if (Page == nullptr || FPlatformTime::Seconds() - Page->FetchedAt >= this->MaxAgeSeconds)
+    {
+        return nullptr;
+    }
+    return Page->Entries;
+}
+
+bool FLeaderboardPageCache::JoinFetch(const FLeaderboardPageKey &Key, FOnPage OnPage)
+{
+    TArray<FOnPage> *Waiters = this->Fetches.Find(Key);
+    bool bMustStart = Waiters == nullptr;
+    if (bMustStart)
+    {
+        Waiters = &this->Fetches.Add(Key);
+    }
+    if (OnPage)
+    {
+        Waiters->Add(MoveTemp(OnPage));
+    }
+    return bMustStart;
+}
+
+void FLeaderboardPageCache::CompleteFetch(
+    const FLeaderboardPageKey &Key,
+    bool bWasSuccessful,
+    const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries,
+    const FString &ErrorMessage)
+{
+    if (bWasSuccessful)
+    {
+        this->Pages.Add(Key, FPage{MakeShared<TArray<FMOSLeaderboardsLeaderboardEntry>>(Entries), FPlatformTime::Seconds()});
+        this->EnforceLimit();
+    }
+
+    // @note: Take the waiters first, since a waiter may immediately request this page again.
+    TArray<FOnPage> Waiters;
+    this->Fetches.RemoveAndCopyValue(Key, Waiters);
+    for (const auto &Waiter : Waiters)
+    {
+        Waiter(bWasSuccessful, Entries, ErrorMessage);
+    }
+}
+
+void FLeaderboardPageCache::EnforceLimit()
+{
+    while (this->MaxPages > 0 && this->Pages.Num() > this->MaxPages)
+    {
+        // @note: The cache only holds a few dozen pages, so a scan for the oldest is cheaper than keeping an LRU list.
+        const FLeaderboardPageKey *Oldest = nullptr;
+        double OldestAt = TNumericLimits<double>::Max();
+        for (const auto &KV : this->Pages)
+        {
+            if (KV.Value.FetchedAt < OldestAt)
+            {
+                Oldest = &KV.Key;
+                OldestAt = KV.Value.FetchedAt;
+            }
+        }
+        this->Pages.Remove(FLeaderboardPageKey(*Oldest));
+    }
+}
+
+} // namespace OSS::OnlineAPI
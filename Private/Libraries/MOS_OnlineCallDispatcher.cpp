@@ -0,0 +1,248 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_OnlineCallDispatcher.h"
+
+#include "DebugPlus/Public/DP_EnhancedLogging.h"
+#include "HAL/IConsoleManager.h"
+#include "MultiplayerOnlineSubsystem/Public/MOS_GameInstanceSubsystem.h"
+
+DECLARE_STATS_GROUP(TEXT("MOS Online Calls"), STATGROUP_MOSOnlineCalls, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Calls In Flight"), STAT_MOSOnlineCallsInFlight, STATGROUP_MOSOnlineCalls);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Calls Queued"), STAT_MOSOnlineCallsQueued, STATGROUP_MOSOnlineCalls);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Calls Completed"), STAT_MOSOnlineCallsCompleted, STATGROUP_MOSOnlineCalls);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Calls Failed"), STAT_MOSOnlineCallsFailed, STATGROUP_MOSOnlineCalls);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Last Call Latency (ms)"), STAT_MOSOnlineCallLastLatency, STATGROUP_MOSOnlineCalls);
+
+static TAutoConsoleVariable<float> CVarMOSFaultLatencyMs(
+    TEXT("MOS.Fault.LatencyMs"),
+    0.0f,
+    TEXT("Delays the start of every dispatched online call by this many milliseconds."));
+static TAutoConsoleVariable<float> CVarMOSFaultJitterMs(
+    TEXT("MOS.Fault.JitterMs"),
+    0.0f,
+    TEXT("Adds up to this many milliseconds of random delay on top of MOS.Fault.LatencyMs."));
+static TAutoConsoleVariable<float> CVarMOSFaultFailureRate(
+    TEXT("MOS.Fault.FailureRate"),
+    0.0f,
+    TEXT("The fraction of dispatched online calls (0 to 1) that fail without reaching the backend."));
+static TAutoConsoleVariable<FString> CVarMOSFaultApi(
+    TEXT("MOS.Fault.Api"),
+    TEXT(""),
+    TEXT("If set, fault injection only applies to calls whose API name starts with this, e.g. \"UserCloud.\"."));
+static TAutoConsoleVariable<int32> CVarMOSFaultSeed(
+    TEXT("MOS.Fault.Seed"),
+    0,
+    TEXT("Seed for injected jitter and failures, so that a run can be repeated exactly."));
+
+namespace OSS::OnlineAPI
+{
+
+FOnlineCallDispatcher::~FOnlineCallDispatcher()
+{
+    for (auto &KV : this->InFlightCalls)
+    {
+        this->RemoveTickers(KV.Value);
+    }
+}
+
+void FOnlineCallDispatcher::RemoveTickers(FPendingCall &Call)
+{
+    if (Call.TimeoutHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Call.TimeoutHandle);
+        Call.TimeoutHandle.Reset();
+    }
+    if (Call.DelayHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(Call.DelayHandle);
+        Call.DelayHandle.Reset();
+    }
+}
+
+bool FOnlineCallDispatcher::RollFault(FName Api, float &OutDelaySeconds)
+{
+    OutDelaySeconds = 0.0f;
+    float LatencyMs = CVarMOSFaultLatencyMs.GetValueOnGameThread();
+    float JitterMs = CVarMOSFaultJitterMs.GetValueOnGameThread();
+    float FailureRate = CVarMOSFaultFailureRate.GetValueOnGameThread();
+    if (LatencyMs <= 0.0f && JitterMs <= 0.0f && FailureRate <= 0.0f)
+    {
+        return false;
+    }
+    FString ApiFilter = CVarMOSFaultApi.GetValueOnGameThread();
+    if (!ApiFilter.IsEmpty() && !Api.ToString().StartsWith(ApiFilter))
+    {
+        return false;
+    }
+
+    // Re-seed whenever the seed changes, so that setting the same seed again replays the same faults.
+    int32 Seed = CVarMOSFaultSeed.GetValueOnGameThread();
+    if (Seed != this->FaultSeed)
+    {
+        this->FaultSeed = Seed;
+        this->FaultRandom.Initialize(Seed);
+    }
+
+    OutDelaySeconds = (LatencyMs + JitterMs * this->FaultRandom.GetFraction()) / 1000.0f;
+    return this->FaultRandom.GetFraction() < FailureRate;
+}
+
+int32 FOnlineCallDispatcher::Enqueue(
+    FName Api,
+    float TimeoutSeconds,
+    TFunction<void(int32)> Start,
+    TFunction<void(const FString &)> Abort)
+{
+    FPendingCall Call;
+    Call.CallId = this->NextCallId++;
+    Call.Api = Api;
+    Call.TimeoutSeconds = TimeoutSeconds;
+    Call.QueuedAt = FPlatformTime::Seconds();
+    Call.StartedAt = Call.QueuedAt;
+    Call.Start = MoveTemp(Start);
+    Call.Abort = MoveTemp(Abort);
+
+    int32 CallId = Call.CallId;
+    this->QueuedCalls.Add(MoveTemp(Call));
+    this->StartQueuedCalls();
+    return CallId;
+}
+
+void FOnlineCallDispatcher::StartQueuedCalls()
+{
+    int32 MaxConcurrentCalls = this->GetMaxConcurrentCalls ? this->GetMaxConcurrentCalls() : 0;
+    while (this->QueuedCalls.Num() > 0 && (MaxConcurrentCalls <= 0 || this->InFlightCalls.Num() < MaxConcurrentCalls))
+    {
+        FPendingCall Call = MoveTemp(this->QueuedCalls[0]);
+        this->QueuedCalls.RemoveAt(0);
+
+        int32 CallId = Call.CallId;
+        Call.StartedAt = FPlatformTime::Seconds();
+        if (Call.TimeoutSeconds > 0.0f)
+        {
+            Call.TimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateLambda([this, CallId](float) {
+                    this->AbortCall(CallId, TEXT("The online call timed out."));
+                    return false;
+                }),
+                Call.TimeoutSeconds);
+        }
+
+        // Simulate backend latency and failures if fault injection is turned on.
+        float DelaySeconds = 0.0f;
+        if (this->RollFault(Call.Api, DelaySeconds))
+        {
+            this->InFlightCalls.Add(CallId, MoveTemp(Call));
+            this->AbortCall(CallId, TEXT("The online call failed (injected fault)."));
+            continue;
+        }
+        if (DelaySeconds > 0.0f)
+        {
+            Call.DelayHandle = FTSTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateLambda([this, CallId](float) {
+                    if (FPendingCall *DelayedCall = this->InFlightCalls.Find(CallId))
+                    {
+                        DelayedCall->DelayHandle.Reset();
+                        TFunction<void(int32)> DelayedStart = MoveTemp(DelayedCall->Start);
+                        DelayedStart(CallId);
+                    }
+                    return false;
+                }),
+                DelaySeconds);
+            this->InFlightCalls.Add(CallId, MoveTemp(Call));
+            continue;
+        }
+
+        // @note: Start may complete synchronously, so the call must be registered as in flight before it runs.
+        TFunction<void(int32)> Start = MoveTemp(Call.Start);
+        this->InFlightCalls.Add(CallId, MoveTemp(Call));
+        Start(CallId);
+    }
+
+    SET_DWORD_STAT(STAT_MOSOnlineCallsInFlight, this->InFlightCalls.Num());
+    SET_DWORD_STAT(STAT_MOSOnlineCallsQueued, this->QueuedCalls.Num());
+}
+
+void FOnlineCallDispatcher::RecordCall(const FPendingCall &Call, bool bWasSuccessful, int64 PayloadBytes)
+{
+    FOnlineCallRecord Record;
+    Record.Id = Call.CallId;
+    Record.Api = Call.Api;
+    Record.QueuedAt = Call.QueuedAt;
+    Record.StartedAt = Call.StartedAt;
+    Record.FinishedAt = FPlatformTime::Seconds();
+    Record.bWasSuccessful = bWasSuccessful;
+    Record.PayloadBytes = PayloadBytes;
+    this->Metrics.Record(Record);
+
+    INC_DWORD_STAT(STAT_MOSOnlineCallsCompleted);
+    if (!bWasSuccessful)
+    {
+        INC_DWORD_STAT(STAT_MOSOnlineCallsFailed);
+    }
+    SET_FLOAT_STAT(STAT_MOSOnlineCallLastLatency, (Record.FinishedAt - Record.StartedAt) * 1000.0);
+}
+
+bool FOnlineCallDispatcher::Complete(int32 CallId, bool bWasSuccessful, int64 PayloadBytes)
+{
+    FPendingCall Call;
+    if (!this->InFlightCalls.RemoveAndCopyValue(CallId, Call))
+    {
+        return false;
+    }
+
+    this->RemoveTickers(Call);
+    this->RecordCall(Call, bWasSuccessful, PayloadBytes);
+    this->StartQueuedCalls();
+    return true;
+}
+
+void FOnlineCallDispatcher::AbortCall(int32 CallId, const FString &Reason)
+{
+    FPendingCall Call;
+    if (this->InFlightCalls.RemoveAndCopyValue(CallId, Call))
+    {
+        this->RemoveTickers(Call);
+    }
+    else
+    {
+        int32 QueuedIndex = this->QueuedCalls.IndexOfByPredicate([CallId](const FPendingCall &Queued) {
+            return Queued.CallId == CallId;
+        });
+        if (QueuedIndex == INDEX_NONE)
+        {
+            return;
+        }
+        Call = MoveTemp(this->QueuedCalls[QueuedIndex]);
+        this->QueuedCalls.RemoveAt(QueuedIndex);
+    }
+
+    DP_LOG(MOSGameInstanceSubsystem, Verbose, "Online call %d (%s) aborted: %s", CallId, *Call.Api.ToString(), *Reason);
+    this->RecordCall(Call, false, 0);
+    Call.Abort(Reason);
+    this->StartQueuedCalls();
+}
+
+void FOnlineCallDispatcher::Cancel(int32 CallId)
+{
+    this->AbortCall(CallId, TEXT("The online call was cancelled."));
+}
+
+void FOnlineCallDispatcher::CancelAll(const FString &Reason)
+{
+    // @note: Drop the queue first so that aborting in-flight calls doesn't start queued ones.
+    TArray<FPendingCall> Queued = MoveTemp(this->QueuedCalls);
+    this->QueuedCalls.Reset();
+    TArray<int32> InFlightIds;
+    this->InFlightCalls.GetKeys(InFlightIds);
+    for (int32 CallId : InFlightIds)
+    {
+        this->AbortCall(CallId, Reason);
+    }
+    for (auto &Call : Queued)
+    {
+        Call.Abort(Reason);
+    }
+}
+
+} // namespace OSS::OnlineAPI
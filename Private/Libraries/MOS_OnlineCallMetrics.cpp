@@ -0,0 +1,211 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_OnlineCallMetrics.h"
+
+#include "Misc/FileHelper.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+namespace OSS::OnlineAPI
+{
+
+FOnlineCallMetrics::FApiMetrics::FApiMetrics()
+{
+    for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+    {
+        this->CurrentWindow[Bucket] = 0;
+        this->PreviousWindow[Bucket] = 0;
+    }
+}
+
+int32 FOnlineCallMetrics::GetBucket(double LatencyMs)
+{
+    if (LatencyMs <= MinBucketMs)
+    {
+        return 0;
+    }
+    int32 Bucket = FMath::CeilToInt32(FMath::Loge(LatencyMs / MinBucketMs) / FMath::Loge(BucketRatio));
+    return FMath::Clamp(Bucket, 0, NumBuckets - 1);
+}
+
+double FOnlineCallMetrics::GetBucketUpperBoundMs(int32 Bucket)
+{
+    return MinBucketMs * FMath::Pow(BucketRatio, static_cast<double>(Bucket));
+}
+
+void FOnlineCallMetrics::RotateWindow(FApiMetrics &Metrics, double Now) const
+{
+    double Elapsed = Now - Metrics.WindowStartedAt;
+    if (Elapsed < this->WindowSeconds)
+    {
+        return;
+    }
+
+    // If more than one whole window has passed, the current window is too old to keep as the previous one.
+    for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+    {
+        Metrics.PreviousWindow[Bucket] = Elapsed < this->WindowSeconds * 2.0 ? Metrics.CurrentWindow[Bucket] : 0;
+        Metrics.CurrentWindow[Bucket] = 0;
+    }
+    Metrics.WindowStartedAt = Now;
+}
+
+void FOnlineCallMetrics::Record(const FOnlineCallRecord &Record)
+{
+    FApiMetrics &Metrics = this->Apis.FindOrAdd(Record.Api);
+    this->RotateWindow(Metrics, Record.FinishedAt);
+
+    double LatencyMs = (Record.FinishedAt - Record.StartedAt) * 1000.0;
+    Metrics.CurrentWindow[GetBucket(LatencyMs)]++;
+    Metrics.CallCount++;
+    Metrics.FailureCount += Record.bWasSuccessful ? 0 : 1;
+    Metrics.PayloadBytes += Record.PayloadBytes;
+    Metrics.MaxMs = FMath::Max(Metrics.MaxMs, LatencyMs);
+
+    if (this->MaxRecords <= 0)
+    {
+        return;
+    }
+    if (this->Records.Num() < this->MaxRecords)
+    {
+        this->Records.Add(Record);
+    }
+    else
+    {
+        this->Records[this->NextRecord] = Record;
+    }
+    this->NextRecord = (this->NextRecord + 1) % this->MaxRecords;
+}
+
+int32 FOnlineCallMetrics::BeginSpan(FName Name)
+{
+    int32 SpanId = this->NextSpanId++;
+    this->OpenSpans.Add(SpanId, FOpenSpan{Name, FPlatformTime::Seconds()});
+#ifdef TRACE_BEGIN_REGION
+    TRACE_BEGIN_REGION(*Name.ToString());
+#else
+    TRACE_BOOKMARK(TEXT("Begin %s"), *Name.ToString());
+#endif
+    return SpanId;
+}
+
+void FOnlineCallMetrics::EndSpan(int32 SpanId, bool bWasSuccessful)
+{
+    FOpenSpan Span;
+    if (!this->OpenSpans.RemoveAndCopyValue(SpanId, Span))
+    {
+        return;
+    }
+#ifdef TRACE_END_REGION
+    TRACE_END_REGION(*Span.Name.ToString());
+#else
+    TRACE_BOOKMARK(TEXT("End %s"), *Span.Name.ToString());
+#endif
+
+    FOnlineCallRecord SpanRecord;
+    SpanRecord.Id = -SpanId;
+    SpanRecord.Api = Span.Name;
+    SpanRecord.QueuedAt = Span.StartedAt;
+    SpanRecord.StartedAt = Span.StartedAt;
+    SpanRecord.FinishedAt = FPlatformTime::Seconds();
+    SpanRecord.bWasSuccessful = bWasSuccessful;
+    this->Record(SpanRecord);
+}
+
+TArray<FMOSOnlineCallStats> FOnlineCallMetrics::GetStats() const
+{
+    double Now = FPlatformTime::Seconds();
+    TArray<FMOSOnlineCallStats> Results;
+    Results.Reserve(this->Apis.Num());
+    for (const auto &KV : this->Apis)
+    {
+        // Combine both windows, ignoring the current window's contents if it has expired without being rotated.
+        FApiMetrics Metrics = KV.Value;
+        this->RotateWindow(Metrics, Now);
+        FBuckets Combined;
+        uint64 Total = 0;
+        for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+        {
+            Combined[Bucket] = Metrics.CurrentWindow[Bucket] + Metrics.PreviousWindow[Bucket];
+            Total += Combined[Bucket];
+        }
+
+        FMOSOnlineCallStats &Stats = Results.AddDefaulted_GetRef();
+        Stats.Api = KV.Key;
+        Stats.CallCount = Metrics.CallCount;
+        Stats.FailureCount = Metrics.FailureCount;
+        Stats.PayloadBytes = Metrics.PayloadBytes;
+        Stats.MaxMs = static_cast<float>(Metrics.MaxMs);
+        Stats.WindowCallCount = static_cast<int32>(Total);
+
+        float *Percentiles[] = {&Stats.P50Ms, &Stats.P95Ms, &Stats.P99Ms};
+        const double Fractions[] = {0.50, 0.95, 0.99};
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(Fractions); Index++)
+        {
+            if (Total == 0)
+            {
+                continue;
+            }
+            uint64 Rank = static_cast<uint64>(FMath::CeilToDouble(Fractions[Index] * Total));
+            uint64 Seen = 0;
+            for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+            {
+                Seen += Combined[Bucket];
+                if (Seen >= Rank)
+                {
+                    *Percentiles[Index] = static_cast<float>(
+                        FMath::Min(GetBucketUpperBoundMs(Bucket), FMath::Max(Metrics.MaxMs, MinBucketMs)));
+                    break;
+                }
+            }
+        }
+    }
+    Results.Sort([](const FMOSOnlineCallStats &A, const FMOSOnlineCallStats &B) {
+        return A.Api.LexicalLess(B.Api);
+    });
+    return Results;
+}
+
+bool FOnlineCallMetrics::ExportChromeTrace(const FString &FilePath) const
+{
+    // @note: Calls overlap freely, so they're written as async begin/end pairs rather than nested complete events.
+    FString Json;
+    Json.Reserve(128 + this->Records.Num() * 192);
+    Json += TEXT("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    bool bFirst = true;
+    int32 Oldest = this->Records.Num() < this->MaxRecords ? 0 : this->NextRecord;
+    for (int32 Offset = 0; Offset < this->Records.Num(); Offset++)
+    {
+        const FOnlineCallRecord &CallRecord = this->Records[(Oldest + Offset) % this->Records.Num()];
+        FString Name = CallRecord.Api.ToString().ReplaceCharWithEscapedChar();
+        const TCHAR *Category = CallRecord.Id < 0 ? TEXT("span") : TEXT("call");
+        Json += FString::Printf(
+            TEXT("%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"b\",\"id\":%d,\"pid\":1,\"tid\":1,\"ts\":%.0f,"
+                 "\"args\":{\"queuedMs\":%.3f}},"
+                 "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"e\",\"id\":%d,\"pid\":1,\"tid\":1,\"ts\":%.0f,"
+                 "\"args\":{\"ok\":%s,\"bytes\":%lld}}"),
+            bFirst ? TEXT("") : TEXT(","),
+            *Name,
+            Category,
+            CallRecord.Id,
+            CallRecord.StartedAt * 1000000.0,
+            (CallRecord.StartedAt - CallRecord.QueuedAt) * 1000.0,
+            *Name,
+            Category,
+            CallRecord.Id,
+            CallRecord.FinishedAt * 1000000.0,
+            CallRecord.bWasSuccessful ? TEXT("true") : TEXT("false"),
+            CallRecord.PayloadBytes);
+        bFirst = false;
+    }
+    Json += TEXT("]}");
+    return FFileHelper::SaveStringToFile(Json, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+void FOnlineCallMetrics::Reset()
+{
+    this->Apis.Empty();
+    this->Records.Empty();
+    this->NextRecord = 0;
+}
+
+} // namespace OSS::OnlineAPI
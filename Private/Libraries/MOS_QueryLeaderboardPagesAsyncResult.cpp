@@ -0,0 +1,23 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_QueryLeaderboardPagesAsyncResult.h"
+
+void UMOS_QueryLeaderboardPagesAsyncResult::OnPage(
+	int32 FirstRank,
+	const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries)
+{
+	if (!this->bDidCallback)
+	{
+		this->NativePageCallback.ExecuteIfBound(FirstRank, Entries);
+	}
+}
+
+void UMOS_QueryLeaderboardPagesAsyncResult::OnResult(bool bWasSuccessful, const FString &ErrorMessage)
+{
+	if (!this->bDidCallback)
+	{
+		this->bDidCallback = true;
+		this->NativeCallback.Execute(bWasSuccessful, ErrorMessage);
+	}
+}
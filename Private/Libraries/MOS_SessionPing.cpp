@@ -0,0 +1,407 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_SessionPing.h"
+
+#include "Containers/Queue.h"
+#include "DebugPlus/Public/DP_EnhancedLogging.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "MultiplayerOnlineSubsystem/Public/MOS_GameInstanceSubsystem.h"
+#include "OnlineSessionSettings.h"
+#include "SocketSubsystem.h"
+#include "Sockets.h"
+
+static TAutoConsoleVariable<FString> CVarMOSSessionPingTarget(
+    TEXT("MOS.SessionPing.Target"),
+    TEXT(""),
+    TEXT("If set, every session host with an IPv4 address is probed at this address:port instead of its own, e.g. a "
+         "local UDP echo server standing in for hosts while testing."));
+
+namespace OSS::OnlineAPI
+{
+
+// @note: A probe is the magic followed by a sequence number; replies must echo it unchanged.
+static constexpr uint8 PingMagic[4] = {'M', 'O', 'S', 'Q'};
+static constexpr int32 PingPacketSize = 8;
+
+static void WritePingPacket(uint8 (&Packet)[PingPacketSize], uint32 Sequence)
+{
+    FMemory::Memcpy(Packet, PingMagic, sizeof(PingMagic));
+    FMemory::Memcpy(Packet + sizeof(PingMagic), &Sequence, sizeof(Sequence));
+}
+
+static bool ReadPingPacket(const uint8 *Packet, int32 Size, uint32 &OutSequence)
+{
+    if (Size != PingPacketSize || FMemory::Memcmp(Packet, PingMagic, sizeof(PingMagic)) != 0)
+    {
+        return false;
+    }
+    FMemory::Memcpy(&OutSequence, Packet + sizeof(PingMagic), sizeof(OutSequence));
+    return true;
+}
+
+// Parses "address:port", returning nullptr unless address is a numeric IPv4 address.
+static TSharedPtr<FInternetAddr> ParseHostAddress(ISocketSubsystem *SocketSubsystem, const FString &HostAndPort)
+{
+    FString Host;
+    FString Port;
+    if (!HostAndPort.Split(TEXT(":"), &Host, &Port) || !Port.IsNumeric())
+    {
+        return nullptr;
+    }
+
+    // @note: Probes are sent from an IPv4 socket, so IPv6 hosts can't be probed.
+    bool bIsValid = false;
+    TSharedRef<FInternetAddr> Address = SocketSubsystem->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+    Address->SetIp(*Host, bIsValid);
+    if (!bIsValid)
+    {
+        return nullptr;
+    }
+    Address->SetPort(FCString::Atoi(*Port));
+    return Address;
+}
+
+static FSocket *OpenPingSocket(ISocketSubsystem *SocketSubsystem, int32 Port, const TCHAR *Description)
+{
+    FSocket *Socket = SocketSubsystem->CreateSocket(NAME_DGram, Description, FNetworkProtocolTypes::IPv4);
+    if (Socket == nullptr)
+    {
+        return nullptr;
+    }
+
+    TSharedRef<FInternetAddr> BindAddress = SocketSubsystem->CreateInternetAddr(FNetworkProtocolTypes::IPv4);
+    BindAddress->SetAnyAddress();
+    BindAddress->SetPort(Port);
+    if (!Socket->SetNonBlocking(true) || !Socket->Bind(*BindAddress))
+    {
+        SocketSubsystem->DestroySocket(Socket);
+        return nullptr;
+    }
+    return Socket;
+}
+
+/**
+ * Receives probe replies on a worker thread and timestamps each one as it arrives; the game thread picks them up from
+ * Replies on its next tick. Without multithreading, Drain is called from the tick instead.
+ */
+class FSessionPingProber::FReceiver : public FRunnable
+{
+public:
+    struct FReply
+    {
+        uint32 Sequence = 0;
+        double ReceivedAt = 0.0;
+    };
+
+    TQueue<FReply, EQueueMode::Spsc> Replies;
+
+private:
+    FSocket *Socket;
+    TAtomic<bool> bStopping;
+    FRunnableThread *Thread;
+
+public:
+    FReceiver(FSocket *InSocket)
+        : Socket(InSocket)
+        , bStopping(false)
+        , Thread(nullptr)
+    {
+        this->Thread = FRunnableThread::Create(this, TEXT("MOS Session Ping"), 0, TPri_AboveNormal);
+    }
+    UE_NONCOPYABLE(FReceiver);
+
+    virtual ~FReceiver() override
+    {
+        if (this->Thread != nullptr)
+        {
+            this->Thread->Kill(true);
+            delete this->Thread;
+        }
+    }
+
+    bool HasThread() const
+    {
+        return this->Thread != nullptr;
+    }
+
+    /** Reads every datagram waiting on the socket. */
+    void Drain()
+    {
+        uint8 Buffer[64];
+        int32 BytesRead = 0;
+        uint32 Sequence;
+        TSharedRef<FInternetAddr> Source = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+        while (this->Socket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *Source))
+        {
+            double ReceivedAt = FPlatformTime::Seconds();
+            if (ReadPingPacket(Buffer, BytesRead, Sequence))
+            {
+                this->Replies.Enqueue(FReply{Sequence, ReceivedAt});
+            }
+        }
+    }
+
+    virtual uint32 Run() override
+    {
+        // @note: The wait is bounded so that Stop is noticed promptly.
+        while (!this->bStopping)
+        {
+            if (this->Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromMilliseconds(10)))
+            {
+                this->Drain();
+            }
+        }
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        this->bStopping = true;
+    }
+};
+
+FSessionPingProber::~FSessionPingProber()
+{
+    this->Cancel();
+}
+
+bool FSessionPingProber::OpenSocket()
+{
+    if (this->Socket == nullptr)
+    {
+        this->Socket = OpenPingSocket(ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM), 0, TEXT("MOS Session Ping"));
+        if (this->Socket != nullptr)
+        {
+            this->Receiver = MakeUnique<FReceiver>(this->Socket);
+        }
+    }
+    return this->Socket != nullptr;
+}
+
+void FSessionPingProber::CloseSocket()
+{
+    // @note: The receiver must stop reading before the socket goes away.
+    this->Receiver.Reset();
+    if (this->Socket != nullptr)
+    {
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(this->Socket);
+        this->Socket = nullptr;
+    }
+}
+
+void FSessionPingProber::Start(const TArray<TPair<FString, FString>> &Hosts, FOnPings InOnPings, FOnComplete InOnComplete)
+{
+    this->Cancel();
+    this->OnPings = MoveTemp(InOnPings);
+    this->OnComplete = MoveTemp(InOnComplete);
+
+    ISocketSubsystem *SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    FString Target = CVarMOSSessionPingTarget.GetValueOnGameThread();
+    TSharedPtr<FInternetAddr> TargetAddress =
+        Target.IsEmpty() || SocketSubsystem == nullptr ? nullptr : ParseHostAddress(SocketSubsystem, Target);
+
+    // @note: Queued in reverse so that hosts can be popped off the end in order.
+    bool bCanProbe = SocketSubsystem != nullptr && this->OpenSocket();
+    this->Queued.Reserve(bCanProbe ? Hosts.Num() : 0);
+    for (int32 Index = Hosts.Num() - 1; Index >= 0 && bCanProbe; Index--)
+    {
+        FProbe Probe;
+        Probe.Address = TargetAddress.IsValid() ? TargetAddress : ParseHostAddress(SocketSubsystem, Hosts[Index].Value);
+        if (!Probe.Address.IsValid())
+        {
+            continue;
+        }
+        Probe.Key = Hosts[Index].Key;
+        Probe.AttemptsLeft = FMath::Max(this->MaxAttempts, 1);
+        this->Queued.Add(MoveTemp(Probe));
+    }
+
+    if (this->Queued.Num() == 0)
+    {
+        this->CloseSocket();
+        this->OnComplete();
+        return;
+    }
+
+    this->TickHandle =
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSessionPingProber::Tick), 0.0f);
+}
+
+bool FSessionPingProber::GetProbeAddress(const FString &ConnectString, int32 PingPort, FString &OutHostAndPort)
+{
+    ISocketSubsystem *SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (SocketSubsystem == nullptr)
+    {
+        return false;
+    }
+
+    // @note: The connect string may or may not carry the game port; either way, only its address is kept.
+    FString Host = ConnectString;
+    int32 PortSeparator;
+    if (ConnectString.FindLastChar(TEXT(':'), PortSeparator))
+    {
+        Host = ConnectString.Left(PortSeparator);
+    }
+    FString HostAndPort = FString::Printf(TEXT("%s:%d"), *Host, PingPort);
+    if (!ParseHostAddress(SocketSubsystem, HostAndPort).IsValid())
+    {
+        return false;
+    }
+    OutHostAndPort = MoveTemp(HostAndPort);
+    return true;
+}
+
+void FSessionPingProber::Cancel()
+{
+    if (this->TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(this->TickHandle);
+        this->TickHandle.Reset();
+    }
+    this->Queued.Empty();
+    this->InFlight.Empty();
+    this->CloseSocket();
+}
+
+bool FSessionPingProber::Send(FProbe &Probe)
+{
+    uint8 Packet[PingPacketSize];
+    Probe.Sequence = this->NextSequence++;
+    Probe.AttemptsLeft--;
+    Probe.SentAt = FPlatformTime::Seconds();
+    WritePingPacket(Packet, Probe.Sequence);
+
+    int32 BytesSent = 0;
+    return this->Socket->SendTo(Packet, PingPacketSize, BytesSent, *Probe.Address) && BytesSent == PingPacketSize;
+}
+
+bool FSessionPingProber::Tick(float DeltaTime)
+{
+    FPingBatch Batch;
+
+    // Collect the replies that arrived since the last tick, timed from when each was received. Replies to an attempt
+    // that was already resent are dropped, since their sequence number is no longer in flight.
+    if (!this->Receiver->HasThread())
+    {
+        this->Receiver->Drain();
+    }
+    FReceiver::FReply Reply;
+    while (this->Receiver->Replies.Dequeue(Reply))
+    {
+        FProbe Probe;
+        if (this->InFlight.RemoveAndCopyValue(Reply.Sequence, Probe))
+        {
+            int32 PingMs = FMath::RoundToInt32((Reply.ReceivedAt - Probe.SentAt) * 1000.0);
+            Batch.Emplace(MoveTemp(Probe.Key), FMath::Clamp(PingMs, 0, MAX_QUERY_PING - 1));
+        }
+    }
+    double Now = FPlatformTime::Seconds();
+
+    // Resend probes that timed out, or give up on them.
+    for (auto It = this->InFlight.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value().SentAt < this->AttemptTimeoutSeconds)
+        {
+            continue;
+        }
+        if (It.Value().AttemptsLeft > 0)
+        {
+            this->Queued.Add(MoveTemp(It.Value()));
+        }
+        else
+        {
+            Batch.Emplace(MoveTemp(It.Value().Key), MAX_QUERY_PING);
+        }
+        It.RemoveCurrent();
+    }
+
+    // Top up the window.
+    while (this->InFlight.Num() < FMath::Max(this->MaxInFlight, 1) && this->Queued.Num() > 0)
+    {
+        FProbe Probe = this->Queued.Pop();
+        if (this->Send(Probe))
+        {
+            this->InFlight.Add(Probe.Sequence, MoveTemp(Probe));
+        }
+        else
+        {
+            Batch.Emplace(MoveTemp(Probe.Key), MAX_QUERY_PING);
+        }
+    }
+
+    bool bIsFinished = this->InFlight.Num() == 0 && this->Queued.Num() == 0;
+    if (bIsFinished)
+    {
+        this->TickHandle.Reset();
+        this->CloseSocket();
+    }
+    if (Batch.Num() > 0)
+    {
+        this->OnPings(Batch);
+    }
+    if (bIsFinished)
+    {
+        this->OnComplete();
+        return false;
+    }
+    return this->TickHandle.IsValid();
+}
+
+FSessionPingResponder::~FSessionPingResponder()
+{
+    this->Stop();
+}
+
+bool FSessionPingResponder::Start(int32 Port)
+{
+    this->Stop();
+    ISocketSubsystem *SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    if (SocketSubsystem == nullptr)
+    {
+        return false;
+    }
+    this->Socket = OpenPingSocket(SocketSubsystem, Port, TEXT("MOS Session Ping Responder"));
+    if (this->Socket == nullptr)
+    {
+        DP_LOG(MOSGameInstanceSubsystem, Warning, "Unable to listen for session pings on UDP port %d.", Port);
+        return false;
+    }
+    this->TickHandle =
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSessionPingResponder::Tick), 0.0f);
+    return true;
+}
+
+void FSessionPingResponder::Stop()
+{
+    if (this->TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(this->TickHandle);
+        this->TickHandle.Reset();
+    }
+    if (this->Socket != nullptr)
+    {
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(this->Socket);
+        this->Socket = nullptr;
+    }
+}
+
+bool FSessionPingResponder::Tick(float DeltaTime)
+{
+    uint8 Buffer[64];
+    int32 BytesRead = 0;
+    uint32 Sequence;
+    TSharedRef<FInternetAddr> Source = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->CreateInternetAddr();
+    while (this->Socket->RecvFrom(Buffer, sizeof(Buffer), BytesRead, *Source))
+    {
+        if (ReadPingPacket(Buffer, BytesRead, Sequence))
+        {
+            int32 BytesSent = 0;
+            this->Socket->SendTo(Buffer, BytesRead, BytesSent, *Source);
+        }
+    }
+    return true;
+}
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,284 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_StatWriteBuffer.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OSS::OnlineAPI
+{
+
+// @note: Identifies our journal files: 'MOSJ' followed by a version, the pending writes, whether the in-flight stats
+// were sent, and the in-flight writes; each batch is its stats and achievements. Version 1 journals held a single
+// batch, with the in-flight writes folded in.
+static constexpr uint32 StatJournalMagic = 0x4A534F4D;
+static constexpr uint32 StatJournalVersion = 2;
+
+static void SerializeBatch(FArchive &Ar, FStatWriteBatch &Batch)
+{
+    int32 StatCount = Batch.Stats.Num();
+    Ar << StatCount;
+    if (Ar.IsLoading())
+    {
+        for (int32 i = 0; i < StatCount && !Ar.IsError(); i++)
+        {
+            FString StatName;
+            FPendingStatWrite Write;
+            uint8 Aggregation = 0;
+            Ar << StatName << Write.Value << Aggregation;
+            Write.Aggregation = static_cast<EMOSStatAggregation>(Aggregation);
+            Batch.Stats.Add(StatName, Write);
+        }
+    }
+    else
+    {
+        for (auto &KV : Batch.Stats)
+        {
+            uint8 Aggregation = static_cast<uint8>(KV.Value.Aggregation);
+            Ar << KV.Key << KV.Value.Value << Aggregation;
+        }
+    }
+
+    TArray<FString> Achievements = Batch.Achievements.Array();
+    Ar << Achievements;
+    if (Ar.IsLoading())
+    {
+        Batch.Achievements.Append(Achievements);
+    }
+}
+
+bool FStatWriteBuffer::Merge(
+    FStatWriteBatch &Into,
+    const FString &StatName,
+    const FPendingStatWrite &Write,
+    bool bIsOlder)
+{
+    FPendingStatWrite *Existing = Into.Stats.Find(StatName);
+    if (Existing == nullptr)
+    {
+        Into.Stats.Add(StatName, Write);
+        return true;
+    }
+    if (Existing->Aggregation != Write.Aggregation)
+    {
+        // @note: Writes with different aggregations can't be folded into one. An older write merged back from a failed
+        // flush or the journal gives way to the one queued since; a new write is rejected.
+        return bIsOlder;
+    }
+
+    switch (Existing->Aggregation)
+    {
+    case EMOSStatAggregation::Sum:
+        Existing->Value += Write.Value;
+        break;
+    case EMOSStatAggregation::Max:
+        Existing->Value = FMath::Max(Existing->Value, Write.Value);
+        break;
+    case EMOSStatAggregation::Latest:
+    default:
+        // @note: When a failed write is merged back, the value queued since is newer and wins.
+        if (!bIsOlder)
+        {
+            Existing->Value = Write.Value;
+        }
+        break;
+    }
+    return true;
+}
+
+void FStatWriteBuffer::SetOwner(const FString &InOwnerId)
+{
+    if (this->OwnerId == InOwnerId)
+    {
+        return;
+    }
+    this->Reset();
+    this->OwnerId = InOwnerId;
+
+    TArray<uint8> Data;
+    if (this->OwnerId.IsEmpty() || !FFileHelper::LoadFileToArray(Data, *this->GetJournalPath()))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Data);
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    Reader << Magic << Version;
+    if (Magic != StatJournalMagic || (Version != 1 && Version != StatJournalVersion))
+    {
+        return;
+    }
+
+    FStatWriteBatch JournaledPending;
+    FStatWriteBatch JournaledInFlight;
+    uint8 bJournaledStatsSent = 0;
+    SerializeBatch(Reader, JournaledPending);
+    if (Version >= 2)
+    {
+        Reader << bJournaledStatsSent;
+        SerializeBatch(Reader, JournaledInFlight);
+    }
+    if (Reader.IsError())
+    {
+        // A truncated journal is treated as empty rather than replaying half of it.
+        return;
+    }
+
+    for (const auto &KV : JournaledPending.Stats)
+    {
+        Merge(this->Pending, KV.Key, KV.Value, true);
+    }
+    this->Pending.Achievements.Append(JournaledPending.Achievements);
+
+    // @note: A flush that was sent when the journal was saved may or may not have reached the backend; one that wasn't
+    // sent definitely didn't.
+    this->MergeUnconfirmed(
+        JournaledInFlight,
+        bJournaledStatsSent != 0 ? EStatFlushResult::Unknown : EStatFlushResult::Failed,
+        false);
+    this->bJournalDirty = !JournaledInFlight.IsEmpty();
+}
+
+bool FStatWriteBuffer::AddStat(const FString &StatName, double Value, EMOSStatAggregation Aggregation)
+{
+    const FPendingStatWrite *InFlightWrite = this->InFlight.Stats.Find(StatName);
+    if (InFlightWrite != nullptr && InFlightWrite->Aggregation != Aggregation)
+    {
+        return false;
+    }
+    if (!Merge(this->Pending, StatName, FPendingStatWrite{Value, Aggregation}, false))
+    {
+        return false;
+    }
+    this->bJournalDirty = true;
+    return true;
+}
+
+void FStatWriteBuffer::AddAchievement(const FString &AchievementId)
+{
+    bool bAlreadyQueued = false;
+    this->Pending.Achievements.Add(AchievementId, &bAlreadyQueued);
+    this->bJournalDirty |= !bAlreadyQueued;
+}
+
+bool FStatWriteBuffer::BeginFlush(FStatWriteBatch &OutBatch, uint64 &OutFlushId)
+{
+    if (this->bFlushing || this->Pending.IsEmpty())
+    {
+        return false;
+    }
+
+    this->bFlushing = true;
+    this->FlushId = this->NextFlushId++;
+    this->InFlight = MoveTemp(this->Pending);
+    this->Pending = FStatWriteBatch();
+    OutBatch = this->InFlight;
+    OutFlushId = this->FlushId;
+    return true;
+}
+
+void FStatWriteBuffer::MarkStatsSent(uint64 InFlushId)
+{
+    if (this->bFlushing && InFlushId == this->FlushId)
+    {
+        this->bInFlightStatsSent = true;
+        this->bJournalDirty = true;
+    }
+}
+
+bool FStatWriteBuffer::EndFlush(uint64 InFlushId, EStatFlushResult StatsResult, bool bAchievementsSucceeded)
+{
+    if (!this->bFlushing || InFlushId != this->FlushId)
+    {
+        return false;
+    }
+
+    this->MergeUnconfirmed(this->InFlight, StatsResult, bAchievementsSucceeded);
+    this->InFlight = FStatWriteBatch();
+    this->bFlushing = false;
+    this->bInFlightStatsSent = false;
+    this->FlushId = 0;
+    this->bJournalDirty = true;
+    return true;
+}
+
+void FStatWriteBuffer::MergeUnconfirmed(
+    const FStatWriteBatch &Unconfirmed,
+    EStatFlushResult StatsResult,
+    bool bAchievementsSucceeded)
+{
+    if (StatsResult != EStatFlushResult::Succeeded)
+    {
+        for (const auto &KV : Unconfirmed.Stats)
+        {
+            // @note: If the backend may have applied the write, sending a sum again could count it twice. Setting a
+            // value or keeping the largest gives the same result however many times it's applied.
+            if (StatsResult == EStatFlushResult::Unknown && KV.Value.Aggregation == EMOSStatAggregation::Sum)
+            {
+                continue;
+            }
+            Merge(this->Pending, KV.Key, KV.Value, true);
+        }
+    }
+    if (!bAchievementsSucceeded)
+    {
+        this->Pending.Achievements.Append(Unconfirmed.Achievements);
+    }
+}
+
+void FStatWriteBuffer::SaveJournal()
+{
+    this->bJournalDirty = false;
+    if (this->OwnerId.IsEmpty())
+    {
+        return;
+    }
+
+    FString Path = this->GetJournalPath();
+    if (this->Pending.IsEmpty() && this->InFlight.IsEmpty())
+    {
+        IFileManager::Get().Delete(*Path, false, false, true);
+        return;
+    }
+
+    // @note: The in-flight writes are kept apart so that a replay can tell the summed stats that may already have been
+    // applied from the ones that were never sent.
+    TArray<uint8> Data;
+    FMemoryWriter Writer(Data);
+    uint32 Magic = StatJournalMagic;
+    uint32 Version = StatJournalVersion;
+    uint8 bStatsSent = this->bInFlightStatsSent ? 1 : 0;
+    Writer << Magic << Version;
+    SerializeBatch(Writer, this->Pending);
+    Writer << bStatsSent;
+    SerializeBatch(Writer, this->InFlight);
+
+    FFileHelper::SaveArrayToFile(Data, *Path);
+}
+
+void FStatWriteBuffer::Reset()
+{
+    this->OwnerId.Empty();
+    this->Pending = FStatWriteBatch();
+    this->InFlight = FStatWriteBatch();
+    this->bFlushing = false;
+    this->bInFlightStatsSent = false;
+    this->FlushId = 0;
+    this->bJournalDirty = false;
+}
+
+FString FStatWriteBuffer::GetJournalPath() const
+{
+    return FPaths::Combine(
+        FPaths::ProjectSavedDir(),
+        TEXT("MOS"),
+        TEXT("StatJournal"),
+        FMD5::HashAnsiString(*this->OwnerId) + TEXT(".bin"));
+}
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,203 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_TitleFileCache.h"
+
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/OnlineTitleFileInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+namespace OSS::OnlineAPI
+{
+
+static FString GetCacheDirectory()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MOS"), TEXT("TitleFileCache"));
+}
+
+void FTitleFileCache::SetListing(const TArray<FCloudFileHeader> &Files)
+{
+    this->ListedFileNames.Reset(Files.Num());
+    this->ListedFiles.Reset();
+    for (const auto &File : Files)
+    {
+        this->ListedFileNames.Add(File.FileName);
+        this->ListedFiles.Add(File.FileName, FListedFile{File.Hash, File.HashType, static_cast<int64>(File.FileSize)});
+    }
+
+    // Unmap anything the listing no longer describes.
+    for (auto It = this->MappedFiles.CreateIterator(); It; ++It)
+    {
+        const FListedFile *Listed = this->ListedFiles.Find(It.Key());
+        if (Listed == nullptr || Listed->Hash != It.Value().Hash)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+bool FTitleFileCache::Find(const FString &FileName, TArrayView<const uint8> &OutView)
+{
+    const FListedFile *Listed = this->ListedFiles.Find(FileName);
+    if (Listed == nullptr || Listed->Hash.IsEmpty() || !CanVerifyHash(Listed->HashType))
+    {
+        return false;
+    }
+
+    // Serve files we've already mapped and verified this run.
+    if (const FMappedFile *Mapped = this->MappedFiles.Find(FileName))
+    {
+        OutView = TArrayView<const uint8>(Mapped->Region->GetMappedPtr(), Mapped->Region->GetMappedSize());
+        return true;
+    }
+
+    FString Path = this->GetCachePath(FileName, Listed->Hash);
+    if (IFileManager::Get().FileSize(*Path) != Listed->Size)
+    {
+        return false;
+    }
+    if (Listed->Size == 0)
+    {
+        OutView = TArrayView<const uint8>();
+        return true;
+    }
+
+    FMappedFile Mapped;
+    Mapped.Hash = Listed->Hash;
+    Mapped.Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+    if (Mapped.Handle.IsValid())
+    {
+        Mapped.Region.Reset(Mapped.Handle->MapRegion(0, Listed->Size));
+    }
+    if (!Mapped.Region.IsValid() || Mapped.Region->GetMappedSize() != Listed->Size ||
+        !VerifyHash(*Listed, Mapped.Region->GetMappedPtr(), Mapped.Region->GetMappedSize()))
+    {
+        // The cached copy is unreadable or damaged; drop it so it's downloaded again.
+        Mapped.Region.Reset();
+        Mapped.Handle.Reset();
+        IFileManager::Get().Delete(*Path, false, false, true);
+        return false;
+    }
+
+    const FMappedFile &Added = this->MappedFiles.Add(FileName, MoveTemp(Mapped));
+    OutView = TArrayView<const uint8>(Added.Region->GetMappedPtr(), Added.Region->GetMappedSize());
+    return true;
+}
+
+void FTitleFileCache::Store(const FString &FileName, const TSharedRef<TArray<uint8>> &Contents)
+{
+    const FListedFile *Listed = this->ListedFiles.Find(FileName);
+    if (Listed == nullptr || Listed->Hash.IsEmpty() || Listed->Size != Contents->Num() ||
+        !CanVerifyHash(Listed->HashType))
+    {
+        return;
+    }
+
+    // @note: Unmap the previous version first; some platforms can't replace a file while it is mapped.
+    this->MappedFiles.Remove(FileName);
+
+    bool bStartWriting;
+    {
+        FScopeLock Lock(&this->PendingWrites->Lock);
+        this->PendingWrites->Queued.Add(FileName, FPendingWrite{this->GetCachePath(FileName, Listed->Hash), Contents});
+        bool bAlreadyWriting;
+        this->PendingWrites->Writing.Add(FileName, &bAlreadyWriting);
+        bStartWriting = !bAlreadyWriting;
+    }
+    if (bStartWriting)
+    {
+        AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [PendingWrites = this->PendingWrites, FileName]() {
+            WritePending(PendingWrites, FileName);
+        });
+    }
+}
+
+void FTitleFileCache::WritePending(
+    const TSharedRef<FPendingWrites, ESPMode::ThreadSafe> &PendingWrites,
+    const FString &FileName)
+{
+    FString VersionPrefix = FMD5::HashAnsiString(*FileName) + TEXT("-");
+    while (true)
+    {
+        FPendingWrite Write;
+        {
+            FScopeLock Lock(&PendingWrites->Lock);
+            if (!PendingWrites->Queued.RemoveAndCopyValue(FileName, Write))
+            {
+                PendingWrites->Writing.Remove(FileName);
+                return;
+            }
+        }
+
+        // Write to a temporary file and move it into place, so a crash never leaves a partial file under the final
+        // name. The temporary name is unique so it can't collide with a write from another process.
+        FString TempPath = Write.Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+        bool bStored = FFileHelper::SaveArrayToFile(*Write.Contents, *TempPath) &&
+                       IFileManager::Get().Move(*Write.Path, *TempPath, true, true, false, true);
+        if (!bStored)
+        {
+            IFileManager::Get().Delete(*TempPath, false, false, true);
+            continue;
+        }
+
+        // Remove the other versions of this file, and temporary files left behind by a crash; this task is the only
+        // writer of this file name, so none of them are in use.
+        FString CurrentVersion = FPaths::GetCleanFilename(Write.Path);
+        TArray<FString> OldVersions;
+        IFileManager::Get().FindFiles(OldVersions, *FPaths::Combine(GetCacheDirectory(), VersionPrefix + TEXT("*")), true, false);
+        for (const FString &OldVersion : OldVersions)
+        {
+            if (!OldVersion.Equals(CurrentVersion, ESearchCase::IgnoreCase))
+            {
+                IFileManager::Get().Delete(*FPaths::Combine(GetCacheDirectory(), OldVersion), false, false, true);
+            }
+        }
+    }
+}
+
+void FTitleFileCache::Reset()
+{
+    this->MappedFiles.Empty();
+    this->ListedFiles.Empty();
+    this->ListedFileNames.Empty();
+}
+
+FString FTitleFileCache::GetCachePath(const FString &FileName, const FString &Hash) const
+{
+    // @note: Both parts are hashed, since file names and backend hashes may contain any characters.
+    return FPaths::Combine(
+        GetCacheDirectory(),
+        FMD5::HashAnsiString(*FileName) + TEXT("-") + FMD5::HashAnsiString(*Hash) + TEXT(".bin"));
+}
+
+bool FTitleFileCache::CanVerifyHash(const FName &HashType)
+{
+    return HashType == FName(TEXT("SHA1")) || HashType == FName(TEXT("MD5"));
+}
+
+bool FTitleFileCache::VerifyHash(const FListedFile &Listed, const uint8 *Data, int64 Size)
+{
+    // @note: Fails closed: content listed with a hash type we can't compute is never served from the cache.
+    if (Listed.HashType == FName(TEXT("SHA1")))
+    {
+        FSHAHash Hash;
+        FSHA1::HashBuffer(Data, static_cast<uint64>(Size), Hash.Hash);
+        return Hash.ToString().Equals(Listed.Hash, ESearchCase::IgnoreCase);
+    }
+    if (Listed.HashType == FName(TEXT("MD5")))
+    {
+        FMD5 Md5;
+        Md5.Update(Data, static_cast<uint64>(Size));
+        uint8 Digest[16];
+        Md5.Final(Digest);
+        return BytesToHex(Digest, 16).Equals(Listed.Hash, ESearchCase::IgnoreCase);
+    }
+    return false;
+}
+
+} // namespace OSS::OnlineAPI
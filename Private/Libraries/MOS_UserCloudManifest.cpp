@@ -0,0 +1,354 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_UserCloudManifest.h"
+
+#include "Interfaces/OnlineUserCloudInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OSS::OnlineAPI
+{
+
+// @note: 'MOSM' for manifests and 'MOSD' for chunk indexes, each followed by a version.
+static constexpr uint32 ManifestMagic = 0x4D534F4D;
+static constexpr uint32 ManifestVersion = 2;
+static constexpr uint32 ChunkIndexMagic = 0x44534F4D;
+static constexpr uint32 ChunkIndexVersion = 1;
+
+// Chunk boundaries fall where the top 16 bits of the rolling hash are zero, giving 64KB chunks on average.
+// @note: Each shift pushes older bytes towards the top, so only the high bits depend on the last 64 bytes; the low bits
+// only see the last few, which makes boundaries cluster on short repeated patterns. FastCDC tests the high bits too.
+static constexpr int32 MinChunkSize = 16 * 1024;
+static constexpr int32 MaxChunkSize = 256 * 1024;
+static constexpr uint64 ChunkBoundaryMask = 0xFFFFull << 48;
+
+// Chunks are stored in cloud files named after their hash.
+static const TCHAR *ChunkFilePrefix = TEXT("mos-chunk-");
+
+static const uint64 *GetGearTable()
+{
+    // @note: The table must never change, or previously uploaded chunks would stop matching. It is generated from a
+    // fixed seed with splitmix64 rather than spelled out.
+    static const struct FGearTable
+    {
+        uint64 Values[256];
+
+        FGearTable()
+        {
+            uint64 State = 0x4D4F53434443ull;
+            for (uint64 &Value : Values)
+            {
+                State += 0x9E3779B97F4A7C15ull;
+                uint64 Z = State;
+                Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+                Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+                Value = Z ^ (Z >> 31);
+            }
+        }
+    } GearTable;
+    return GearTable.Values;
+}
+
+void FUserCloudManifest::SetOwner(const FString &InOwnerId)
+{
+    if (this->OwnerId == InOwnerId)
+    {
+        return;
+    }
+    this->Reset();
+    this->OwnerId = InOwnerId;
+
+    TArray<uint8> Data;
+    if (this->OwnerId.IsEmpty() || !FFileHelper::LoadFileToArray(Data, *this->GetManifestPath()))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(Data);
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    Reader << Magic << Version;
+    if (Magic != ManifestMagic || Version != ManifestVersion)
+    {
+        return;
+    }
+
+    int32 EntryCount = 0;
+    Reader << EntryCount;
+    for (int32 i = 0; i < EntryCount && !Reader.IsError(); i++)
+    {
+        FString FileName;
+        FEntry Entry;
+        Reader << FileName << Entry.ContentHash << Entry.Size << Entry.RemoteHash << Entry.Chunks;
+        this->Entries.Add(FileName, Entry);
+    }
+    TArray<FSHAHash> Chunks;
+    Reader << Chunks;
+    if (Reader.IsError())
+    {
+        // A damaged manifest only costs us redundant transfers, so start over.
+        this->Entries.Empty();
+        return;
+    }
+    this->RemoteChunks.Append(Chunks);
+}
+
+void FUserCloudManifest::Save() const
+{
+    if (this->OwnerId.IsEmpty())
+    {
+        return;
+    }
+
+    TArray<uint8> Data;
+    FMemoryWriter Writer(Data);
+    uint32 Magic = ManifestMagic;
+    uint32 Version = ManifestVersion;
+    int32 EntryCount = this->Entries.Num();
+    Writer << Magic << Version << EntryCount;
+    for (const auto &KV : this->Entries)
+    {
+        FString FileName = KV.Key;
+        FEntry Entry = KV.Value;
+        Writer << FileName << Entry.ContentHash << Entry.Size << Entry.RemoteHash << Entry.Chunks;
+    }
+    TArray<FSHAHash> Chunks = this->RemoteChunks.Array();
+    Writer << Chunks;
+
+    FFileHelper::SaveArrayToFile(Data, *this->GetManifestPath());
+}
+
+void FUserCloudManifest::Reset()
+{
+    this->OwnerId.Empty();
+    this->Entries.Empty();
+    this->RemoteChunks.Empty();
+    this->RemoteFiles.Empty();
+    this->bHasRemoteListing = false;
+}
+
+void FUserCloudManifest::Record(const FString &FileName, const FSHAHash &ContentHash, int64 Size, bool bWasDownload)
+{
+    FEntry &Entry = this->Entries.FindOrAdd(FileName);
+    Entry.ContentHash = ContentHash;
+    Entry.Size = Size;
+    Entry.RemoteHash.Empty();
+    Entry.TransferSerial = ++this->LastTransferSerial;
+
+    const FRemoteFile *Remote = this->RemoteFiles.Find(FileName);
+    if (bWasDownload && Remote != nullptr)
+    {
+        Entry.RemoteHash = Remote->Hash;
+    }
+    else if (!bWasDownload)
+    {
+        // @note: The listed hash describes the file we just replaced.
+        this->RemoteFiles.Remove(FileName);
+    }
+}
+
+TArray<FSHAHash> FUserCloudManifest::SetFileChunks(const FString &FileName, const TArray<FUserCloudChunk> &Chunks)
+{
+    FEntry &Entry = this->Entries.FindOrAdd(FileName);
+    TArray<FSHAHash> PreviousChunks = MoveTemp(Entry.Chunks);
+    Entry.Chunks.Reset(Chunks.Num());
+    for (const auto &Chunk : Chunks)
+    {
+        Entry.Chunks.Add(Chunk.Hash);
+    }
+
+    // The previous index's chunks that no other file shares are no longer needed.
+    TArray<FSHAHash> OrphanedChunks;
+    for (const auto &Hash : PreviousChunks)
+    {
+        if (!this->IsChunkReferenced(Hash))
+        {
+            OrphanedChunks.AddUnique(Hash);
+        }
+    }
+    return OrphanedChunks;
+}
+
+bool FUserCloudManifest::IsChunkReferenced(const FSHAHash &Hash) const
+{
+    for (const auto &KV : this->Entries)
+    {
+        if (KV.Value.Chunks.Contains(Hash))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FUserCloudManifest::UpdateRemoteListing(const TArray<FCloudFileHeader> &Files, uint64 ListingSerial)
+{
+    this->RemoteFiles.Reset();
+    TSet<FString> ListedNames;
+    for (const auto &File : Files)
+    {
+        this->RemoteFiles.Add(File.FileName, FRemoteFile{File.Hash, static_cast<int64>(File.FileSize)});
+        ListedNames.Add(File.FileName);
+    }
+    this->bHasRemoteListing = true;
+
+    // Chunks missing from the listing were deleted remotely and must be uploaded again.
+    for (auto It = this->RemoteChunks.CreateIterator(); It; ++It)
+    {
+        if (!ListedNames.Contains(GetChunkFileName(*It)))
+        {
+            It.RemoveCurrent();
+        }
+    }
+    for (const auto &File : Files)
+    {
+        if (IsChunkFileName(File.FileName))
+        {
+            FSHAHash Hash;
+            Hash.FromString(File.FileName.RightChop(FCString::Strlen(ChunkFilePrefix)));
+            this->RemoteChunks.Add(Hash);
+        }
+    }
+
+    // Entries transferred since the last listing adopt the hash the backend now reports for them.
+    for (auto &KV : this->Entries)
+    {
+        const FRemoteFile *Remote = this->RemoteFiles.Find(KV.Key);
+        if (Remote == nullptr)
+        {
+            KV.Value.RemoteHash.Empty();
+        }
+        else if (KV.Value.RemoteHash.IsEmpty() && KV.Value.TransferSerial <= ListingSerial)
+        {
+            // @note: A listing started before the transfer finished may still describe the previous file.
+            KV.Value.RemoteHash = Remote->Hash;
+        }
+    }
+}
+
+bool FUserCloudManifest::IsRemoteCurrent(const FString &FileName) const
+{
+    const FEntry *Entry = this->Entries.Find(FileName);
+    if (Entry == nullptr || !this->bHasRemoteListing || Entry->RemoteHash.IsEmpty())
+    {
+        return false;
+    }
+    const FRemoteFile *Remote = this->RemoteFiles.Find(FileName);
+    return Remote != nullptr && Remote->Hash == Entry->RemoteHash;
+}
+
+FSHAHash FUserCloudManifest::HashBytes(const uint8 *Data, int64 Size)
+{
+    FSHA1 Sha;
+    Sha.Update(Data, static_cast<uint64>(Size));
+    Sha.Final();
+    FSHAHash Hash;
+    Sha.GetHash(Hash.Hash);
+    return Hash;
+}
+
+void FUserCloudManifest::SplitIntoChunks(const uint8 *Data, int64 Size, TArray<FUserCloudChunk> &OutChunks)
+{
+    const uint64 *Gear = GetGearTable();
+    OutChunks.Reset();
+
+    int64 ChunkStart = 0;
+    while (ChunkStart < Size)
+    {
+        int64 Remaining = Size - ChunkStart;
+        int64 ChunkEnd = ChunkStart + FMath::Min<int64>(Remaining, MaxChunkSize);
+        if (Remaining > MinChunkSize)
+        {
+            uint64 RollingHash = 0;
+            for (int64 i = ChunkStart + MinChunkSize; i < ChunkEnd; i++)
+            {
+                RollingHash = (RollingHash << 1) + Gear[Data[i]];
+                if ((RollingHash & ChunkBoundaryMask) == 0)
+                {
+                    ChunkEnd = i + 1;
+                    break;
+                }
+            }
+        }
+
+        FUserCloudChunk &Chunk = OutChunks.AddDefaulted_GetRef();
+        Chunk.Offset = ChunkStart;
+        Chunk.Size = static_cast<int32>(ChunkEnd - ChunkStart);
+        Chunk.Hash = HashBytes(Data + ChunkStart, Chunk.Size);
+        ChunkStart = ChunkEnd;
+    }
+}
+
+FString FUserCloudManifest::GetChunkFileName(const FSHAHash &Hash)
+{
+    return FString(ChunkFilePrefix) + Hash.ToString();
+}
+
+bool FUserCloudManifest::IsChunkFileName(const FString &FileName)
+{
+    return FileName.StartsWith(ChunkFilePrefix);
+}
+
+void FUserCloudManifest::WriteChunkIndex(
+    int64 TotalSize,
+    const TArray<FUserCloudChunk> &Chunks,
+    TArray<uint8> &OutIndex)
+{
+    FMemoryWriter Writer(OutIndex);
+    uint32 Magic = ChunkIndexMagic;
+    uint32 Version = ChunkIndexVersion;
+    int32 ChunkCount = Chunks.Num();
+    Writer << Magic << Version << TotalSize << ChunkCount;
+    for (const auto &Chunk : Chunks)
+    {
+        FSHAHash Hash = Chunk.Hash;
+        int32 ChunkSize = Chunk.Size;
+        Writer << Hash << ChunkSize;
+    }
+}
+
+bool FUserCloudManifest::ReadChunkIndex(
+    const TArray<uint8> &Data,
+    int64 &OutTotalSize,
+    TArray<FUserCloudChunk> &OutChunks)
+{
+    if (Data.Num() < 8)
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Data);
+    uint32 Magic = 0;
+    uint32 Version = 0;
+    int32 ChunkCount = 0;
+    Reader << Magic << Version;
+    if (Magic != ChunkIndexMagic || Version != ChunkIndexVersion)
+    {
+        return false;
+    }
+    Reader << OutTotalSize << ChunkCount;
+
+    OutChunks.Reset(FMath::Max(ChunkCount, 0));
+    int64 Offset = 0;
+    for (int32 i = 0; i < ChunkCount && !Reader.IsError(); i++)
+    {
+        FUserCloudChunk &Chunk = OutChunks.AddDefaulted_GetRef();
+        Reader << Chunk.Hash << Chunk.Size;
+        Chunk.Offset = Offset;
+        Offset += Chunk.Size;
+    }
+    return !Reader.IsError() && Offset == OutTotalSize;
+}
+
+FString FUserCloudManifest::GetManifestPath() const
+{
+    return FPaths::Combine(
+        FPaths::ProjectSavedDir(),
+        TEXT("MOS"),
+        TEXT("UserCloudManifest"),
+        FMD5::HashAnsiString(*this->OwnerId) + TEXT(".bin"));
+}
+
+} // namespace OSS::OnlineAPI
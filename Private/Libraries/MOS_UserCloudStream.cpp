@@ -0,0 +1,202 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_UserCloudStream.h"
+
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace OSS::OnlineAPI
+{
+
+// @note: Identifies our chunked files: 'MOSC', version, format name, chunk size, total size and chunk count, followed by
+// each chunk as its compressed size, uncompressed size and data. A chunk whose sizes match is stored uncompressed.
+static constexpr uint32 StreamMagic = 0x43534F4D;
+static constexpr uint32 StreamVersion = 1;
+
+struct FStreamHeader
+{
+    uint32 Magic = StreamMagic;
+    uint32 Version = StreamVersion;
+    FString Format;
+    int32 ChunkSize = 0;
+    int64 TotalSize = 0;
+    int32 ChunkCount = 0;
+
+    friend FArchive &operator<<(FArchive &Ar, FStreamHeader &Header)
+    {
+        return Ar << Header.Magic << Header.Version << Header.Format << Header.ChunkSize << Header.TotalSize
+                  << Header.ChunkCount;
+    }
+};
+
+FName FUserCloudStream::GetDefaultCompressionFormat()
+{
+    return FCompression::IsFormatValid(NAME_Oodle) ? NAME_Oodle : NAME_Zlib;
+}
+
+bool FUserCloudStream::Encode(
+    FArchive &Source,
+    FName Format,
+    int32 ChunkSize,
+    TArray<uint8> &OutPayload,
+    FOnProgress OnProgress,
+    FString &OutError)
+{
+    if (ChunkSize <= 0)
+    {
+        OutError = TEXT("Invalid chunk size.");
+        return false;
+    }
+    if (!Format.IsNone() && !FCompression::IsFormatValid(Format))
+    {
+        OutError = FString(TEXT("Unsupported compression format: ")) + Format.ToString();
+        return false;
+    }
+
+    FStreamHeader Header;
+    Header.Format = Format.IsNone() ? FString() : Format.ToString();
+    Header.ChunkSize = ChunkSize;
+    Header.TotalSize = Source.TotalSize() - Source.Tell();
+    int64 ChunkCount = (Header.TotalSize + ChunkSize - 1) / ChunkSize;
+
+    // @note: Reserve for the worst case up front, so the payload is never reallocated and copied while it grows. The
+    // payload is a TArray, so files whose worst case doesn't fit in one are rejected rather than overflowing it.
+    int32 ChunkBound = Format.IsNone() ? ChunkSize : FCompression::CompressMemoryBound(Format, ChunkSize);
+    int64 PayloadBound = OutPayload.Num() + 64 + Header.Format.Len() * sizeof(TCHAR) +
+                         ChunkCount * (8 + ChunkBound);
+    if (Header.TotalSize < 0 || PayloadBound > MAX_int32)
+    {
+        OutError = TEXT("The file is too large to store in user cloud.");
+        return false;
+    }
+    Header.ChunkCount = static_cast<int32>(ChunkCount);
+    OutPayload.Reserve(static_cast<int32>(PayloadBound));
+    {
+        FMemoryWriter HeaderWriter(OutPayload, false, true);
+        HeaderWriter << Header;
+    }
+
+    TArray<uint8> Chunk;
+    Chunk.SetNumUninitialized(ChunkSize);
+    TArray<uint8> Compressed;
+    Compressed.SetNumUninitialized(ChunkBound);
+    int64 BytesDone = 0;
+    while (BytesDone < Header.TotalSize)
+    {
+        int32 ChunkBytes = static_cast<int32>(FMath::Min<int64>(ChunkSize, Header.TotalSize - BytesDone));
+        Source.Serialize(Chunk.GetData(), ChunkBytes);
+        if (Source.IsError())
+        {
+            OutError = TEXT("Failed to read from the source file.");
+            return false;
+        }
+
+        // Store chunks that don't shrink as they are.
+        const uint8 *StoredData = Chunk.GetData();
+        int32 StoredBytes = ChunkBound;
+        if (!Format.IsNone() &&
+            FCompression::CompressMemory(Format, Compressed.GetData(), StoredBytes, Chunk.GetData(), ChunkBytes) &&
+            StoredBytes < ChunkBytes)
+        {
+            StoredData = Compressed.GetData();
+        }
+        else
+        {
+            StoredBytes = ChunkBytes;
+        }
+        OutPayload.Append(reinterpret_cast<const uint8 *>(&StoredBytes), 4);
+        OutPayload.Append(reinterpret_cast<const uint8 *>(&ChunkBytes), 4);
+        OutPayload.Append(StoredData, StoredBytes);
+
+        BytesDone += ChunkBytes;
+        OnProgress(BytesDone, Header.TotalSize);
+    }
+
+    return true;
+}
+
+bool FUserCloudStream::Decode(
+    const TArray<uint8> &Payload,
+    FArchive &Destination,
+    FOnProgress OnProgress,
+    FString &OutError)
+{
+    FMemoryReader Reader(Payload);
+    FStreamHeader Header;
+    if (Payload.Num() >= 8)
+    {
+        Reader << Header.Magic << Header.Version;
+    }
+    if (Payload.Num() < 8 || Header.Magic != StreamMagic)
+    {
+        // Not one of ours; write the plain file out as it is.
+        Destination.Serialize(const_cast<uint8 *>(Payload.GetData()), Payload.Num());
+        OnProgress(Payload.Num(), Payload.Num());
+        return !Destination.IsError();
+    }
+    Reader.Seek(0);
+    Reader << Header;
+    if (Reader.IsError() || Header.Version != StreamVersion || Header.ChunkSize <= 0)
+    {
+        OutError = TEXT("The file has an unsupported header.");
+        return false;
+    }
+    FName Format = Header.Format.IsEmpty() ? NAME_None : FName(*Header.Format);
+    if (!Format.IsNone() && !FCompression::IsFormatValid(Format))
+    {
+        OutError = FString(TEXT("Unsupported compression format: ")) + Header.Format;
+        return false;
+    }
+
+    TArray<uint8> Chunk;
+    Chunk.SetNumUninitialized(Header.ChunkSize);
+    int64 Position = Reader.Tell();
+    int64 BytesDone = 0;
+    for (int32 ChunkIndex = 0; ChunkIndex < Header.ChunkCount; ChunkIndex++)
+    {
+        int32 StoredBytes = 0;
+        int32 ChunkBytes = 0;
+        if (Position + 8 > Payload.Num())
+        {
+            OutError = TEXT("The file is truncated.");
+            return false;
+        }
+        FMemory::Memcpy(&StoredBytes, Payload.GetData() + Position, 4);
+        FMemory::Memcpy(&ChunkBytes, Payload.GetData() + Position + 4, 4);
+        Position += 8;
+        if (StoredBytes < 0 || ChunkBytes < 0 || ChunkBytes > Header.ChunkSize || Position + StoredBytes > Payload.Num())
+        {
+            OutError = TEXT("The file is truncated or corrupt.");
+            return false;
+        }
+
+        const uint8 *StoredData = Payload.GetData() + Position;
+        if (StoredBytes == ChunkBytes)
+        {
+            Destination.Serialize(const_cast<uint8 *>(StoredData), ChunkBytes);
+        }
+        else
+        {
+            if (Format.IsNone() ||
+                !FCompression::UncompressMemory(Format, Chunk.GetData(), ChunkBytes, StoredData, StoredBytes))
+            {
+                OutError = TEXT("Failed to decompress the file.");
+                return false;
+            }
+            Destination.Serialize(Chunk.GetData(), ChunkBytes);
+        }
+        if (Destination.IsError())
+        {
+            OutError = TEXT("Failed to write to the destination file.");
+            return false;
+        }
+
+        Position += StoredBytes;
+        BytesDone += ChunkBytes;
+        OnProgress(BytesDone, Header.TotalSize);
+    }
+    return true;
+}
+
+} // namespace OSS::OnlineAPI
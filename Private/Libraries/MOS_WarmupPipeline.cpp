@@ -0,0 +1,169 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_WarmupPipeline.h"
+
+namespace OSS::OnlineAPI
+{
+
+void FWarmupPipeline::AddStep(FName Name, TArray<FName> DependsOn, FStepStart Start)
+{
+    checkf(!this->bRunning, TEXT("Warm-up steps can't be added while the pipeline is running."));
+    checkf(this->FindStep(Name) == INDEX_NONE, TEXT("Warm-up step names must be unique."));
+
+    FStep &Step = this->Steps.AddDefaulted_GetRef();
+    Step.Name = Name;
+    Step.DependsOn = MoveTemp(DependsOn);
+    Step.Start = MoveTemp(Start);
+}
+
+int32 FWarmupPipeline::FindStep(FName Name) const
+{
+    return this->Steps.IndexOfByPredicate([Name](const FStep &Step) {
+        return Step.Name == Name;
+    });
+}
+
+void FWarmupPipeline::Start(FOnComplete InOnComplete)
+{
+    this->OnComplete = MoveTemp(InOnComplete);
+    this->StartedAt = FPlatformTime::Seconds();
+    this->bRunning = true;
+    this->StartReadySteps();
+}
+
+void FWarmupPipeline::StartReadySteps()
+{
+    // @note: Work out every state change first and only then start steps, since a step may complete synchronously
+    // and re-enter this function.
+    TArray<int32> Ready;
+    bool bChanged = true;
+    while (bChanged)
+    {
+        bChanged = false;
+        for (int32 StepIndex = 0; StepIndex < this->Steps.Num(); StepIndex++)
+        {
+            FStep &Step = this->Steps[StepIndex];
+            if (Step.State != EStepState::Pending || Ready.Contains(StepIndex))
+            {
+                continue;
+            }
+
+            bool bDependenciesDone = true;
+            FName FailedDependency = NAME_None;
+            for (const FName &Dependency : Step.DependsOn)
+            {
+                int32 DependencyIndex = this->FindStep(Dependency);
+                if (DependencyIndex == INDEX_NONE || this->Steps[DependencyIndex].State == EStepState::Failed)
+                {
+                    FailedDependency = Dependency;
+                    break;
+                }
+                if (this->Steps[DependencyIndex].State != EStepState::Succeeded)
+                {
+                    bDependenciesDone = false;
+                }
+            }
+
+            if (!FailedDependency.IsNone())
+            {
+                // Skipping this step may in turn skip the steps that depend on it.
+                Step.State = EStepState::Failed;
+                Step.StartedAt = Step.FinishedAt = FPlatformTime::Seconds();
+                Step.ErrorMessage =
+                    FString::Printf(TEXT("Skipped because %s did not complete."), *FailedDependency.ToString());
+                bChanged = true;
+            }
+            else if (bDependenciesDone)
+            {
+                Ready.Add(StepIndex);
+            }
+        }
+    }
+
+    int32 StartedGeneration = this->Generation;
+    for (int32 StepIndex : Ready)
+    {
+        FStep &Step = this->Steps[StepIndex];
+        Step.State = EStepState::Running;
+        Step.StartedAt = FPlatformTime::Seconds();
+    }
+    for (int32 StepIndex : Ready)
+    {
+        if (this->Generation != StartedGeneration)
+        {
+            return;
+        }
+        FStepStart Start = this->Steps[StepIndex].Start;
+        Start([this, StartedGeneration, StepIndex](bool bWasSuccessful, const FString &ErrorMessage) {
+            this->FinishStep(StartedGeneration, StepIndex, bWasSuccessful, ErrorMessage);
+        });
+    }
+
+    // If nothing is left running, the remaining pending steps can never start (they form a cycle).
+    if (this->Generation == StartedGeneration && this->bRunning &&
+        !this->Steps.ContainsByPredicate([](const FStep &Step) {
+            return Step.State == EStepState::Running;
+        }))
+    {
+        for (FStep &Step : this->Steps)
+        {
+            if (Step.State == EStepState::Pending)
+            {
+                Step.State = EStepState::Failed;
+                Step.ErrorMessage = TEXT("Skipped because its dependencies form a cycle.");
+            }
+        }
+        this->Finish();
+    }
+}
+
+void FWarmupPipeline::FinishStep(int32 StepGeneration, int32 StepIndex, bool bWasSuccessful, const FString &ErrorMessage)
+{
+    if (StepGeneration != this->Generation || !this->Steps.IsValidIndex(StepIndex) ||
+        this->Steps[StepIndex].State != EStepState::Running)
+    {
+        return;
+    }
+
+    FStep &Step = this->Steps[StepIndex];
+    Step.State = bWasSuccessful ? EStepState::Succeeded : EStepState::Failed;
+    Step.FinishedAt = FPlatformTime::Seconds();
+    Step.ErrorMessage = ErrorMessage;
+    this->StartReadySteps();
+}
+
+void FWarmupPipeline::Finish()
+{
+    FMOSWarmupReport Report;
+    Report.bWasSuccessful = true;
+    double FinishedAt = this->StartedAt;
+    for (const FStep &Step : this->Steps)
+    {
+        FMOSWarmupStepReport &StepReport = Report.Steps.AddDefaulted_GetRef();
+        StepReport.Name = Step.Name;
+        StepReport.bWasSuccessful = Step.State == EStepState::Succeeded;
+        StepReport.StartSeconds = static_cast<float>(Step.StartedAt - this->StartedAt);
+        StepReport.DurationSeconds = static_cast<float>(Step.FinishedAt - Step.StartedAt);
+        StepReport.ErrorMessage = Step.ErrorMessage;
+        Report.bWasSuccessful &= StepReport.bWasSuccessful;
+        FinishedAt = FMath::Max(FinishedAt, Step.FinishedAt);
+    }
+    Report.TimeToInteractiveSeconds = static_cast<float>(FinishedAt - this->StartedAt);
+
+    FOnComplete Complete = MoveTemp(this->OnComplete);
+    this->Reset();
+    if (Complete)
+    {
+        Complete(Report);
+    }
+}
+
+void FWarmupPipeline::Reset()
+{
+    this->Steps.Empty();
+    this->OnComplete = nullptr;
+    this->bRunning = false;
+    this->Generation++;
+}
+
+} // namespace OSS::OnlineAPI
@@ -6,6 +6,9 @@
 #include "GameFramework/GameModeBase.h"
 #include "Interfaces/OnlineSessionInterface.h"
 #include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_SessionsFindSessionsAsyncResult.h"
+#include "DebugPlus/Public/DP_EnhancedLogging.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
 
 typedef TMap<FString, int32> TMap_FString_int32;
 
@@ -15,6 +18,12 @@ void UMOS_GameInstanceSubsystem::Initialize(FSubsystemCollectionBase& Collection
 {	
 	Super::Initialize(Collection);
 
+	// @note: Read on demand rather than copied here, so changes made at runtime apply and the limit is in place even
+	// when there's no online subsystem yet (e.g. one set later with SetOnlineSubsystemOverride).
+	CallDispatcher.GetMaxConcurrentCalls = [this]() {
+		return MaxConcurrentOnlineCalls;
+	};
+
 	// Get the online subsystem.
 	auto OSS = Online::GetSubsystem(this->GetWorld());
 	if (OSS == nullptr){return;}
@@ -30,14 +39,140 @@ void UMOS_GameInstanceSubsystem::Initialize(FSubsystemCollectionBase& Collection
 	if (SessionPtr == nullptr){return;}
 
 	SessionPtr->OnCreateSessionCompleteDelegates.AddUObject(this, &ThisClass::OnCreateSessionComplete);
-	SessionPtr->OnFindSessionsCompleteDelegates.AddUObject(this, &ThisClass::OnFindSessionsComplete);
 	SessionPtr->OnJoinSessionCompleteDelegates.AddUObject(this, &ThisClass::OnJoinSessionComplete);
 	SessionPtr->OnRegisterPlayersCompleteDelegates.AddUObject(this, &ThisClass::OnRegisterPlayersComplete);
 
+	StatWriteTickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &ThisClass::TickStatWrites), 1.0f);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ThisClass::OnPostLoadMap);
+
 	FindSessionsAsyncResult = NewObject<UMOS_SessionsFindSessionsAsyncResult>();
 	AsyncResult = NewObject<UMOS_AsyncResult>();
 }
 
+void UMOS_GameInstanceSubsystem::Deinitialize()
+{
+	StopSessionBrowserRefresh();
+	SessionPingProber.Cancel();
+	SessionPingResponder.Stop();
+	FTSTicker::GetCoreTicker().RemoveTicker(StatWriteTickHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	CancelLoginWarmup();
+	UnbindFriendsStoreEvents();
+	CallDispatcher.CancelAll(TEXT("The online subsystem is shutting down."));
+	StatWriteBuffer.SaveJournal();
+	InvalidateOnlineContext();
+
+	Super::Deinitialize();
+}
+
+const FMOSOnlineContext &UMOS_GameInstanceSubsystem::GetOnlineContext() const
+{
+	// Re-resolve the online subsystem if we've never resolved it, or if we've moved to a different world.
+	UWorld *World = this->GetWorld();
+	if (OnlineContext.OSS == nullptr || OnlineContext.World.Get() != World || OnlineContext.LocalUserNum != LocalUserNum)
+	{
+		OnlineContext.Reset();
+		OnlineContext.World = World;
+		OnlineContext.LocalUserNum = LocalUserNum;
+		OnlineContext.OSS = OnlineSubsystemOverride != nullptr ? OnlineSubsystemOverride : Online::GetSubsystem(World);
+		if (OnlineContext.OSS != nullptr)
+		{
+			OnlineContext.Identity = OnlineContext.OSS->GetIdentityInterface();
+		}
+	}
+
+	// @note: We only cache a signed in user; until someone signs in we keep asking so login is picked up immediately.
+	if (!OnlineContext.UserId.IsValid() && OnlineContext.Identity.IsValid())
+	{
+		OnlineContext.UserId = OnlineContext.Identity->GetUniquePlayerId(LocalUserNum);
+	}
+	return OnlineContext;
+}
+
+void UMOS_GameInstanceSubsystem::InvalidateOnlineContext()
+{
+	OnlineContext.Reset();
+}
+
+void UMOS_GameInstanceSubsystem::SetOnlineSubsystemOverride(IOnlineSubsystem *InOnlineSubsystem)
+{
+	OnlineSubsystemOverride = InOnlineSubsystem;
+	InvalidateOnlineContext();
+}
+
+void UMOS_GameInstanceSubsystem::CancelAllOnlineCalls()
+{
+	CallDispatcher.CancelAll(TEXT("The online call was cancelled."));
+}
+
+TArray<FMOSOnlineCallStats> UMOS_GameInstanceSubsystem::GetOnlineCallStats() const
+{
+	return CallDispatcher.Metrics.GetStats();
+}
+
+void UMOS_GameInstanceSubsystem::ResetOnlineCallStats()
+{
+	CallDispatcher.Metrics.Reset();
+}
+
+bool UMOS_GameInstanceSubsystem::ExportOnlineCallTrace(const FString &FilePath)
+{
+	FString Path = FilePath.IsEmpty()
+		? FPaths::Combine(FPaths::ProfilingDir(), TEXT("MOS"), FString::Printf(TEXT("OnlineCalls-%s.json"), *FDateTime::Now().ToString()))
+		: FilePath;
+	bool bWasSuccessful = CallDispatcher.Metrics.ExportChromeTrace(Path);
+	DP_LOG(MOSGameInstanceSubsystem, Log, "Online call trace %hs: %s", bWasSuccessful ? "written" : "failed to write", *Path);
+	return bWasSuccessful;
+}
+
+int32 UMOS_GameInstanceSubsystem::BeginOnlineSpan(FName Name)
+{
+	return CallDispatcher.Metrics.BeginSpan(Name);
+}
+
+void UMOS_GameInstanceSubsystem::EndOnlineSpan(int32 &SpanId, bool bWasSuccessful)
+{
+	CallDispatcher.Metrics.EndSpan(SpanId, bWasSuccessful);
+	SpanId = 0;
+}
+
+void UMOS_GameInstanceSubsystem::OnPostLoadMap(UWorld *LoadedWorld)
+{
+	// @note: Opening the listen level also loads a map, so only a load that follows session travel ends the flows.
+	if (TravelSpan == 0)
+	{
+		return;
+	}
+
+	// Travel has finished, which is the last step of both the host and the join flow.
+	EndOnlineSpan(TravelSpan, true);
+	EndOnlineSpan(HostFlowSpan, true);
+	EndOnlineSpan(JoinFlowSpan, true);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs MOSDumpOnlineCallStatsCommand(
+	TEXT("MOS.DumpOnlineCallStats"),
+	TEXT("Logs latency percentiles for every online call made by the multiplayer online subsystem. Pass a file path as an argument to also write a Chrome trace of recent calls."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString> &Args, UWorld *World)
+	{
+		UGameInstance *GameInstance = World != nullptr ? World->GetGameInstance() : nullptr;
+		UMOS_GameInstanceSubsystem *Subsystem = GameInstance != nullptr ? GameInstance->GetSubsystem<UMOS_GameInstanceSubsystem>() : nullptr;
+		if (Subsystem == nullptr)
+		{
+			return;
+		}
+		for (const auto &Stats : Subsystem->GetOnlineCallStats())
+		{
+			DP_LOG(MOSGameInstanceSubsystem, Display, "%-32s calls=%lld failed=%lld p50=%.1fms p95=%.1fms p99=%.1fms max=%.1fms bytes=%lld",
+				*Stats.Api.ToString(), Stats.CallCount, Stats.FailureCount, Stats.P50Ms, Stats.P95Ms, Stats.P99Ms, Stats.MaxMs, Stats.PayloadBytes);
+		}
+		if (Args.Num() > 0)
+		{
+			Subsystem->ExportOnlineCallTrace(Args[0]);
+		}
+	}));
+
 void UMOS_GameInstanceSubsystem::RaiseFriendsOnFriendsChange()
 {
 }
@@ -9,7 +9,7 @@ void UMOS_GameInstanceSubsystem::ExecuteAchievementsQueryAchievements(
     UMOS_QueryAchievementsAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(
@@ -20,9 +20,9 @@ void UMOS_GameInstanceSubsystem::ExecuteAchievementsQueryAchievements(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the achievements interface, if the online subsystem supports it.
@@ -36,97 +36,102 @@ void UMOS_GameInstanceSubsystem::ExecuteAchievementsQueryAchievements(
         return;
     }
 
-    // Query the achievement descriptions.
-    Achievements->QueryAchievementDescriptions(
-        *UserId,
-        FOnQueryAchievementsCompleteDelegate::CreateWeakLambda(
-            this,
-            [this,
-             Achievements,
-             UserId,
-             ResultWk = TSoftObjectPtr<UMOS_QueryAchievementsAsyncResult>(
-                 Result)](const FUniqueNetId &, const bool bWasDescriptionSuccessful) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // If we couldn't query achievement descriptions, return failure.
-                if (!bWasDescriptionSuccessful)
-                {
-                    ResultWk->OnResult(
-                        false,
-                        TArray<FMOSAchievementsAchievementState>(),
-                        TEXT("QueryAchievementDescriptions call failed."));
-                    return;
-                }
-
-                // Now query the achievement state for this user.
-                Achievements->QueryAchievements(
-                    *UserId,
-                    FOnQueryAchievementsCompleteDelegate::CreateWeakLambda(
-                        this,
-                        [Achievements, UserId, ResultWk](const FUniqueNetId &, const bool bWasSuccessful) {
-                            // Make sure the result callback is still valid.
-                            if (!ResultWk.IsValid())
-                            {
-                                return;
-                            }
-
-                            // If we couldn't query achievement state, return failure.
-                            if (!bWasSuccessful)
-                            {
-                                ResultWk->OnResult(
-                                    false,
-                                    TArray<FMOSAchievementsAchievementState>(),
-                                    TEXT("QueryAchievements call failed."));
-                                return;
-                            }
-
-                            // Get the achievement state for the current user, now that it's been cached.
-                            TArray<FOnlineAchievement> CurrentAchievements;
-                            if (Achievements->GetCachedAchievements(*UserId, CurrentAchievements) ==
-                                EOnlineCachedResult::NotFound)
-                            {
-                                ResultWk->OnResult(
-                                    false,
-                                    TArray<FMOSAchievementsAchievementState>(),
-                                    TEXT("GetCachedAchievements call failed."));
-                                return;
-                            }
-
-                            // Now we have cached both the achievement descriptions and the achievement states, we can
-                            // put both of them together to return a list of achievements and the current user's
-                            // progress.
-                            TArray<FMOSAchievementsAchievementState> States;
-                            for (const auto &CurrentAchievement : CurrentAchievements)
-                            {
-                                FOnlineAchievementDesc AchievementDescription;
-                                if (Achievements->GetCachedAchievementDescription(
-                                        CurrentAchievement.Id,
-                                        AchievementDescription) == EOnlineCachedResult::Success)
-                                {
-                                    FMOSAchievementsAchievementState State;
-                                    State.Id = CurrentAchievement.Id;
-                                    State.DisplayName = AchievementDescription.Title;
-                                    State.Progress = static_cast<float>(CurrentAchievement.Progress);
-                                    State.bUnlocked = CurrentAchievement.Progress > 100.0 ||
-                                                      FMath::IsNearlyEqual(CurrentAchievement.Progress, 100.0);
-                                    States.Add(State);
-                                }
-                            }
-
-                            // Return the results.
-                            ResultWk->OnResult(true, States, TEXT(""));
-                        }));
-            }));
+    CallDispatcher.Run<TArray<FMOSAchievementsAchievementState>>(
+        TEXT("Achievements.QueryAchievements"),
+        OnlineCallTimeoutSeconds,
+        [this, Achievements, UserId](const auto &OnComplete) {
+            // Query the achievement descriptions.
+            Achievements->QueryAchievementDescriptions(
+                *UserId,
+                FOnQueryAchievementsCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [this,
+                     Achievements,
+                     UserId,
+                     OnComplete](const FUniqueNetId &, const bool bWasDescriptionSuccessful) {
+                        // If we couldn't query achievement descriptions, return failure.
+                        if (!bWasDescriptionSuccessful)
+                        {
+                            OnComplete(
+                                false,
+                                TArray<FMOSAchievementsAchievementState>(),
+                                TEXT("QueryAchievementDescriptions call failed."));
+                            return;
+                        }
+
+                        // Now query the achievement state for this user.
+                        Achievements->QueryAchievements(
+                            *UserId,
+                            FOnQueryAchievementsCompleteDelegate::CreateWeakLambda(
+                                this,
+                                [Achievements, UserId, OnComplete](const FUniqueNetId &, const bool bWasSuccessful) {
+                                    // If we couldn't query achievement state, return failure.
+                                    if (!bWasSuccessful)
+                                    {
+                                        OnComplete(
+                                            false,
+                                            TArray<FMOSAchievementsAchievementState>(),
+                                            TEXT("QueryAchievements call failed."));
+                                        return;
+                                    }
+
+                                    // Get the achievement state for the current user, now that it's been cached.
+                                    TArray<FOnlineAchievement> CurrentAchievements;
+                                    if (Achievements->GetCachedAchievements(*UserId, CurrentAchievements) ==
+                                        EOnlineCachedResult::NotFound)
+                                    {
+                                        OnComplete(
+                                            false,
+                                            TArray<FMOSAchievementsAchievementState>(),
+                                            TEXT("GetCachedAchievements call failed."));
+                                        return;
+                                    }
+
+                                    // Now we have cached both the achievement descriptions and the achievement states, we can
+                                    // put both of them together to return a list of achievements and the current user's
+                                    // progress.
+                                    TArray<FMOSAchievementsAchievementState> States;
+                                    for (const auto &CurrentAchievement : CurrentAchievements)
+                                    {
+                                        FOnlineAchievementDesc AchievementDescription;
+                                        if (Achievements->GetCachedAchievementDescription(
+                                                CurrentAchievement.Id,
+                                                AchievementDescription) == EOnlineCachedResult::Success)
+                                        {
+                                            FMOSAchievementsAchievementState State;
+                                            State.Id = CurrentAchievement.Id;
+                                            State.DisplayName = AchievementDescription.Title;
+                                            State.Progress = static_cast<float>(CurrentAchievement.Progress);
+                                            State.bUnlocked = CurrentAchievement.Progress > 100.0 ||
+                                                              FMath::IsNearlyEqual(CurrentAchievement.Progress, 100.0);
+                                            States.Add(State);
+                                        }
+                                    }
+
+                                    // Return the results.
+                                    OnComplete(true, States, TEXT(""));
+                                }));
+                    }));
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_QueryAchievementsAsyncResult>(Result)](
+            bool bWasSuccessful,
+            const TArray<FMOSAchievementsAchievementState> &Payload,
+            const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the result.
+            ResultWk->OnResult(bWasSuccessful, Payload, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteAchievementsUnlockAchievement(const FString &Id, UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -134,9 +139,9 @@ void UMOS_GameInstanceSubsystem::ExecuteAchievementsUnlockAchievement(const FStr
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the achievements interface, if the online subsystem supports it.
@@ -158,19 +163,29 @@ void UMOS_GameInstanceSubsystem::ExecuteAchievementsUnlockAchievement(const FStr
 #endif
 
     // Run the asynchronous call to unlock the achievement.
-    Achievements->WriteAchievements(
-        *UserId,
-        WriteObject,
-        FOnAchievementsWrittenDelegate::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](const FUniqueNetId &, bool bWasSuccessful) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the success status.
-                ResultWk->OnResult(bWasSuccessful, bWasSuccessful ? TEXT("") : TEXT("WriteAchievements call failed."));
-            }));
+    CallDispatcher.Run<>(
+        TEXT("Achievements.UnlockAchievement"),
+        OnlineCallTimeoutSeconds,
+        [this, Achievements, UserId, WriteObject](const auto &OnComplete) {
+            // @note: WriteAchievements takes the write object by non-const reference.
+            FOnlineAchievementsWriteRef Write = WriteObject;
+            Achievements->WriteAchievements(
+                *UserId,
+                Write,
+                FOnAchievementsWrittenDelegate::CreateWeakLambda(
+                    this,
+                    [OnComplete](const FUniqueNetId &, bool bWasSuccessful) {
+                        OnComplete(bWasSuccessful, bWasSuccessful ? TEXT("") : TEXT("WriteAchievements call failed."));
+                    }));
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the success status.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
\ No newline at end of file
@@ -8,28 +8,28 @@
 bool UMOS_GameInstanceSubsystem::GetAuthIsLoggedIn() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return false;
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return false;
     }
 
     // Try to get the user ID to see if there is someone signed in.
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     return UserId.IsValid();
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteAuthAutoLogin(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -37,7 +37,7 @@ void UMOS_GameInstanceSubsystem::ExecuteAuthAutoLogin(UMOS_AsyncResult *Result)
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         Result->OnResult(false, TEXT("Online subsystem does not support identity."));
@@ -91,15 +91,24 @@ void UMOS_GameInstanceSubsystem::ExecuteAuthAutoLogin(UMOS_AsyncResult *Result)
 void UMOS_GameInstanceSubsystem::OnLoginCompleted(int InUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error)
 {
     bIsAttemptingLogin = false;
+    InvalidateOnlineContext();
     DP_LOG(MOSGameInstanceSubsystem, Warning, "User Login: %hs %s", bWasSuccessful ? "Success" : "Failed", *UserId.ToString());
 
     if(!bWasSuccessful)
     {
         DP_LOG(MOSGameInstanceSubsystem, Warning, "Error: %s", *Error);
     }
+    else
+    {
+        // Load the stat write journal and user cloud manifest this user left behind in a previous run.
+        StatWriteBuffer.SetOwner(UserId.ToString());
+        UserCloudManifest.SetOwner(UserId.ToString());
+        StatWriteFailureCount = 0;
+        NextStatWriteFlushTime = 0.0;
+    }
 
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         DP_LOG(MOSGameInstanceSubsystem, Warning,"Online subsystem is not available.");
@@ -107,7 +116,7 @@ void UMOS_GameInstanceSubsystem::OnLoginCompleted(int InUserNum, bool bWasSucces
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         DP_LOG(MOSGameInstanceSubsystem, Warning,"Online subsystem does not support identity.");
@@ -121,12 +130,27 @@ void UMOS_GameInstanceSubsystem::OnLoginCompleted(int InUserNum, bool bWasSucces
         // You can use `Handle` later to call `Friends->ClearOnInviteReceivedDelegate_Handle(Handle)`
         // if you want to unregister the event handler.
     }
+
+    // Keep the friends store up to date with friends list and presence changes.
+    if (bWasSuccessful)
+    {
+        BindFriendsStoreEvents();
+    }
+
+    // Start filling the caches the menus read from, rather than waiting for each screen to ask.
+    if (bWasSuccessful && bWarmupOnLogin)
+    {
+        StartLoginWarmup();
+    }
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteAuthLogout(UMOS_AsyncResult *Result)
 {
+    // Write any queued stats and achievements while the user is still signed in.
+    FlushStatWrites();
+
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -134,9 +158,9 @@ void UMOS_GameInstanceSubsystem::ExecuteAuthLogout(UMOS_AsyncResult *Result)
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Register an event so we can receive the logout outcome.
@@ -182,21 +206,41 @@ void UMOS_GameInstanceSubsystem::ExecuteAuthLogout(UMOS_AsyncResult *Result)
 void UMOS_GameInstanceSubsystem::OnLogoutCompleted(int InUserNum, bool bWasSuccessful)
 {
     DP_LOG(MOSGameInstanceSubsystem, Log, "Logout Successful: %hs", bWasSuccessful ? "Success" : "Failed");
+
+    // Cached state and outstanding calls belong to the user that just signed out.
+    CancelLoginWarmup();
+    UnbindFriendsStoreEvents();
+    InvalidateOnlineContext();
+    CallDispatcher.CancelAll(TEXT("The local user signed out."));
+    StatWriteBuffer.SaveJournal();
+    StatWriteBuffer.Reset();
+    UserCloudManifest.Reset();
+    TitleFileCache.Reset();
+    FriendsStore.Reset();
+    FriendsQueryFriendsFlight.Invalidate();
+    LeaderboardsQueryGlobalFlight.Invalidate();
+    StatsQueryStatsFlight.Invalidate();
+    TitleFileQueryFilesFlight.Invalidate();
+    AvatarCache.Reset();
+    LeaderboardPageCache.Reset();
+    StopSessionBrowserRefresh();
+    SessionPingProber.Cancel();
+    MeasuredSessionPings.Reset();
 }
 
 bool UMOS_GameInstanceSubsystem::GetAuthCanLinkCrossPlatformAccount() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return false;
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return false;
@@ -11,7 +11,7 @@ void UMOS_GameInstanceSubsystem::ExecuteAvatarGetAvatar(
     UMOS_GetAvatarAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, nullptr, TEXT("Online subsystem is not available."));
@@ -19,42 +19,125 @@ void UMOS_GameInstanceSubsystem::ExecuteAvatarGetAvatar(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, nullptr, TEXT("The local user is not signed in."));
         return;
     }
 
-    // Get the avatar interface.
+    // Serve the avatar from memory if we already have it.
+    AvatarCache.BudgetBytes = static_cast<int64>(AvatarCacheBudgetMegabytes) * 1024 * 1024;
+    AvatarCache.bPersistToDisk = bPersistAvatarsToDisk;
+    AvatarCache.DiskBudgetBytes = static_cast<int64>(AvatarDiskCacheBudgetMegabytes) * 1024 * 1024;
+    if (UTexture *CachedTexture = AvatarCache.Find(TargetUserId))
+    {
+        Result->OnResult(true, TSoftObjectPtr<UTexture>(CachedTexture), TEXT(""));
+        return;
+    }
+
+    // Make sure the online subsystem supports avatars.
+    if (!Online::GetAvatarInterface(OSS).IsValid())
+    {
+        Result->OnResult(false, nullptr, TEXT("Online subsystem does not support avatars."));
+        return;
+    }
+
+    // If this user's avatar is already being loaded or downloaded, wait for that instead of starting another.
+    if (!AvatarRequestFlights.FindOrAdd(TargetUserId).Join(Result, 0.0f))
+    {
+        return;
+    }
+
+    // Look for the avatar on disk before downloading it; the file is read on a worker thread.
+    if (AvatarCache.bPersistToDisk)
+    {
+        AvatarCache.LoadFromDisk(TargetUserId, [this, TargetUserId](UTexture *Texture) {
+            if (Texture != nullptr)
+            {
+                CompleteAvatarRequests(TargetUserId, true, TSoftObjectPtr<UTexture>(Texture), TEXT(""));
+                return;
+            }
+            DownloadAvatar(TargetUserId);
+        });
+        return;
+    }
+    DownloadAvatar(TargetUserId);
+}
+
+void UMOS_GameInstanceSubsystem::DownloadAvatar(const FUniqueNetIdRepl &TargetUserId)
+{
+    // @note: Looked up again, since the user may have signed out while the disk cache was being read.
+    auto OSS = this->GetOnlineContext().OSS;
+    auto UserId = this->GetOnlineContext().UserId;
+    if (OSS == nullptr || !UserId.IsValid())
+    {
+        CompleteAvatarRequests(TargetUserId, false, nullptr, TEXT("The local user is not signed in."));
+        return;
+    }
     auto Avatar = Online::GetAvatarInterface(OSS);
     if (!Avatar.IsValid())
     {
-        Result->OnResult(false, nullptr, TEXT("Online subsystem does not support avatars."));
+        CompleteAvatarRequests(TargetUserId, false, nullptr, TEXT("Online subsystem does not support avatars."));
         return;
     }
 
-    // Query for the target avatar.
-    Avatar->GetAvatar(
-        *UserId,
-        *TargetUserId,
-        nullptr,
-        FOnGetAvatarComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_GetAvatarAsyncResult>(
-                 Result)](bool bWasSuccessful, TSoftObjectPtr<UTexture> ResultTexture) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the result.
-                ResultWk->OnResult(
-                    bWasSuccessful,
-                    ResultTexture,
-                    bWasSuccessful ? TEXT("") : TEXT("The GetAvatar call failed."));
-            }));
+    CallDispatcher.Run<TSoftObjectPtr<UTexture>>(
+        TEXT("Avatar.GetAvatar"),
+        OnlineCallTimeoutSeconds,
+        [this, Avatar, UserId, TargetUserId](const auto &OnComplete) {
+            // Query for the target avatar.
+            Avatar->GetAvatar(
+                *UserId,
+                *TargetUserId,
+                nullptr,
+                FOnGetAvatarComplete::CreateWeakLambda(
+                    this,
+                    [OnComplete](bool bWasSuccessful, TSoftObjectPtr<UTexture> ResultTexture) {
+                        // Return the result.
+                        OnComplete(
+                            bWasSuccessful,
+                            ResultTexture,
+                            bWasSuccessful ? TEXT("") : TEXT("The GetAvatar call failed."));
+                    }));
+        },
+        [this, TargetUserId](
+            bool bWasSuccessful,
+            const TSoftObjectPtr<UTexture> &Payload,
+            const FString &ErrorMessage) {
+            // Cache the texture so later requests for this user don't download it again.
+            if (bWasSuccessful && Payload.IsValid())
+            {
+                AvatarCache.Add(TargetUserId, Payload.Get());
+            }
+            CompleteAvatarRequests(TargetUserId, bWasSuccessful, Payload, ErrorMessage);
+        });
+}
+
+void UMOS_GameInstanceSubsystem::CompleteAvatarRequests(
+    const FUniqueNetIdRepl &TargetUserId,
+    bool bWasSuccessful,
+    const TSoftObjectPtr<UTexture> &Texture,
+    const FString &ErrorMessage)
+{
+    // Return the result to everyone waiting on this user's avatar.
+    OSS::OnlineAPI::TSingleFlight<UMOS_GetAvatarAsyncResult, TSoftObjectPtr<UTexture>> Flight;
+    if (AvatarRequestFlights.RemoveAndCopyValue(TargetUserId, Flight))
+    {
+        Flight.Complete(bWasSuccessful, Texture, ErrorMessage);
+    }
+}
+
+FMOSAvatarCacheStats UMOS_GameInstanceSubsystem::GetAvatarCacheStats() const
+{
+    FMOSAvatarCacheStats Stats;
+    Stats.HitCount = AvatarCache.GetHitCount();
+    Stats.MissCount = AvatarCache.GetMissCount();
+    int64 Requests = Stats.HitCount + Stats.MissCount;
+    Stats.HitRate = Requests > 0 ? static_cast<float>(Stats.HitCount) / static_cast<float>(Requests) : 0.0f;
+    Stats.BytesResident = AvatarCache.GetBytesResident();
+    Stats.EntryCount = AvatarCache.GetEntryCount();
+    return Stats;
 }
\ No newline at end of file
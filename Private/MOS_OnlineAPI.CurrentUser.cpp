@@ -7,14 +7,14 @@
 FString UMOS_GameInstanceSubsystem::GetCurrentUserDisplayName() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TEXT("");
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return TEXT("");
@@ -27,21 +27,21 @@ FString UMOS_GameInstanceSubsystem::GetCurrentUserDisplayName() const
 FUniqueNetIdRepl UMOS_GameInstanceSubsystem::GetCurrentUserId() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return FUniqueNetIdRepl();
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return FUniqueNetIdRepl();
     }
 
     // Get the user ID, and if it is valid, return the string representation of it.
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (UserId.IsValid())
     {
         return UserId;
@@ -55,21 +55,21 @@ FUniqueNetIdRepl UMOS_GameInstanceSubsystem::GetCurrentUserId() const
 FString UMOS_GameInstanceSubsystem::GetCurrentUserSecondaryId() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TEXT("");
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return TEXT("");
     }
 
     // Get the user ID if the user is signed in.
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return TEXT("");
@@ -87,21 +87,21 @@ FString UMOS_GameInstanceSubsystem::GetCurrentUserSecondaryId() const
 bool UMOS_GameInstanceSubsystem::ShouldRenderUserSecondaryIdField() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return false;
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return false;
     }
 
     // Get the user ID if the user is signed in.
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return false;
@@ -119,21 +119,21 @@ bool UMOS_GameInstanceSubsystem::ShouldRenderUserSecondaryIdField() const
 FString UMOS_GameInstanceSubsystem::GetCurrentUserAuthAttribute(const FString &Key) const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TEXT("");
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return TEXT("");
     }
 
     // Get the user ID if the user is signed in.
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return TEXT("");
@@ -11,7 +11,7 @@
 void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryOffers(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -19,9 +19,9 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryOffers(UMOS_AsyncResult *R
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the store interface, if the online subsystem supports it.
@@ -54,16 +54,16 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryOffers(UMOS_AsyncResult *R
 TArray<FMOSEcommerceOffer> UMOS_GameInstanceSubsystem::GetEcommerceCachedOffers() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSEcommerceOffer>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the store interface, if the online subsystem supports it.
@@ -93,7 +93,7 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceStartPurchase(
     const TMap<FString, int32> &OfferIdsToQuantities)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -101,9 +101,9 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceStartPurchase(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the purchase interface, if the online subsystem supports it.
@@ -142,7 +142,7 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceStartPurchase(
 void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryEntitlements(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -150,9 +150,9 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryEntitlements(UMOS_AsyncRes
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the entitlements interface, if the online subsystem supports it.
@@ -205,16 +205,16 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryEntitlements(UMOS_AsyncRes
 TArray<FMOSEcommerceEntitlement> UMOS_GameInstanceSubsystem::GetEcommerceCachedEntitlements() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSEcommerceEntitlement>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the entitlements interface, if the online subsystem supports it.
@@ -243,7 +243,7 @@ TArray<FMOSEcommerceEntitlement> UMOS_GameInstanceSubsystem::GetEcommerceCachedE
 void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryReceipts(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -251,9 +251,9 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryReceipts(UMOS_AsyncResult
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the purchase interface, if the online subsystem supports it.
@@ -285,16 +285,16 @@ void UMOS_GameInstanceSubsystem::ExecuteEcommerceQueryReceipts(UMOS_AsyncResult
 TArray<FMOSEcommerceReceipt> UMOS_GameInstanceSubsystem::GetEcommerceCachedReceipts() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSEcommerceReceipt>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the purchase interface, if the online subsystem supports it.
@@ -10,7 +10,7 @@
 void UMOS_GameInstanceSubsystem::RegisterEvents()
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return;
@@ -37,7 +37,7 @@ void UMOS_GameInstanceSubsystem::RegisterEvents()
                 auto Identity = DelegateOSS->GetIdentityInterface();
                 if (Identity.IsValid())
                 {
-                    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+                    auto UserId = this->GetOnlineContext().UserId;
                     if (UserId.IsValid() && *UserId == LocalUserId)
                     {
                         return true;
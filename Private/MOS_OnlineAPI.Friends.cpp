@@ -12,7 +12,7 @@
 void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryFriends(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -20,9 +20,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryFriends(UMOS_AsyncResult *Re
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -33,44 +33,179 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryFriends(UMOS_AsyncResult *Re
         return;
     }
 
-    // Ask the online subsystem to cache the initial list of friends. We don't return friends inside
-    // ExecuteFriendsQueryFriends; we're just getting the online subsystem to cache them so that a later
-    // GetFriendsCurrentFriends can return them.
-    if (!Friends->ReadFriendsList(
+    // Join any read that is already in flight instead of starting another one.
+    if (!FriendsQueryFriendsFlight.Join(Result, FriendsQueryFriendsMemoizeSeconds))
+    {
+        return;
+    }
+
+    CallDispatcher.Run<>(
+        TEXT("Friends.ReadFriendsList"),
+        OnlineCallTimeoutSeconds,
+        [this, Friends](const auto &OnComplete) {
+            // Ask the online subsystem to cache the initial list of friends. We don't return friends inside
+            // ExecuteFriendsQueryFriends; we're just getting the online subsystem to cache them so that a later
+            // GetFriendsCurrentFriends can return them.
+            if (!Friends->ReadFriendsList(
+                    this->LocalUserNum,
+                    TEXT(""),
+                    FOnReadFriendsListComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete](int32, bool bWasSuccessful, const FString &, const FString &ErrorStr) {
+                            // Return the result.
+                            OnComplete(bWasSuccessful, ErrorStr);
+                        })))
+            {
+                OnComplete(false, TEXT("The ReadFriendsList call failed to start."));
+                return;
+            }
+        },
+        [this](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Pick up whatever changed in the list since the last read.
+            if (bWasSuccessful)
+            {
+                SyncFriendsStore();
+            }
+
+            // Return the result to everyone waiting on this read.
+            FriendsQueryFriendsFlight.Complete(bWasSuccessful, ErrorMessage);
+        });
+}
+
+void UMOS_GameInstanceSubsystem::BindFriendsStoreEvents()
+{
+    UnbindFriendsStoreEvents();
+
+    // Get the online subsystem.
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        return;
+    }
+
+    // Re-sync the store whenever the online subsystem reports that the friends list changed.
+    auto Friends = OSS->GetFriendsInterface();
+    if (Friends.IsValid())
+    {
+        FriendsStoreFriendsChangeHandle = Friends->AddOnFriendsChangeDelegate_Handle(
             this->LocalUserNum,
-            TEXT(""),
-            FOnReadFriendsListComplete::CreateWeakLambda(
+            FOnFriendsChangeDelegate::CreateWeakLambda(this, [this]() {
+                SyncFriendsStore();
+            }));
+    }
+
+    // Apply presence updates to the friend they're for, without touching the rest of the list.
+    auto Presence = OSS->GetPresenceInterface();
+    if (Presence.IsValid())
+    {
+        FriendsStorePresenceHandle = Presence->AddOnPresenceReceivedDelegate_Handle(
+            FOnPresenceReceivedDelegate::CreateWeakLambda(
                 this,
-                [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(
-                     Result)](int32, bool bWasSuccessful, const FString &, const FString &ErrorStr) {
-                    // Make sure the result callback is still valid.
-                    if (!ResultWk.IsValid())
+                [this](const FUniqueNetId &PresenceUserId, const TSharedRef<FOnlineUserPresence> &UserPresence) {
+                    if (FriendsStore.ApplyPresence(FUniqueNetIdRepl(PresenceUserId.AsShared()), *UserPresence))
                     {
-                        return;
+                        ScheduleFriendsChangeFeed();
                     }
+                }));
+    }
+}
 
-                    // Return the result.
-                    ResultWk->OnResult(bWasSuccessful, ErrorStr);
-                })))
+void UMOS_GameInstanceSubsystem::UnbindFriendsStoreEvents()
+{
+    if (FriendsChangeFeedHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(FriendsChangeFeedHandle);
+        FriendsChangeFeedHandle.Reset();
+    }
+
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
     {
-        Result->OnResult(false, TEXT("The ReadFriendsList call failed to start."));
         return;
     }
+    auto Friends = OSS->GetFriendsInterface();
+    if (Friends.IsValid() && FriendsStoreFriendsChangeHandle.IsValid())
+    {
+        Friends->ClearOnFriendsChangeDelegate_Handle(this->LocalUserNum, FriendsStoreFriendsChangeHandle);
+    }
+    auto Presence = OSS->GetPresenceInterface();
+    if (Presence.IsValid() && FriendsStorePresenceHandle.IsValid())
+    {
+        Presence->ClearOnPresenceReceivedDelegate_Handle(FriendsStorePresenceHandle);
+    }
+    FriendsStoreFriendsChangeHandle.Reset();
+    FriendsStorePresenceHandle.Reset();
+}
+
+void UMOS_GameInstanceSubsystem::SyncFriendsStore()
+{
+    // Get the online subsystem.
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        return;
+    }
+
+    // Get the friends interface, if the online subsystem supports it.
+    auto Friends = OSS->GetFriendsInterface();
+    if (!Friends.IsValid())
+    {
+        return;
+    }
+
+    // Diff the online subsystem's cached list against the store.
+    TArray<TSharedRef<FOnlineFriend>> CurrentFriends;
+    if (!Friends->GetFriendsList(this->LocalUserNum, TEXT(""), CurrentFriends))
+    {
+        return;
+    }
+    FriendsStore.Sync(CurrentFriends);
+    if (FriendsStore.HasChanges())
+    {
+        ScheduleFriendsChangeFeed();
+    }
+}
+
+void UMOS_GameInstanceSubsystem::ScheduleFriendsChangeFeed()
+{
+    // @note: Presence updates tend to arrive in bursts (e.g. right after login), so changes are batched up and
+    // reported once on the next tick.
+    if (FriendsChangeFeedHandle.IsValid())
+    {
+        return;
+    }
+    FriendsChangeFeedHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateWeakLambda(this, [this](float) {
+            FriendsChangeFeedHandle.Reset();
+            TArray<FUniqueNetIdRepl> ChangedIds = FriendsStore.TakeChangedIds();
+            if (ChangedIds.Num() > 0)
+            {
+                FriendsOnFriendsStateChanged.Broadcast(ChangedIds);
+                FriendsOnFriendsChange.Broadcast();
+            }
+            return false;
+        }));
 }
 
 TArray<FUniqueNetIdRepl> UMOS_GameInstanceSubsystem::GetFriendsCurrentFriends() const
 {
+    // Once the store has been synced it holds the same list, without asking the online subsystem to copy it.
+    if (FriendsStore.IsPopulated())
+    {
+        return FriendsStore.GetIds();
+    }
+
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FUniqueNetIdRepl>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -98,16 +233,16 @@ TArray<FUniqueNetIdRepl> UMOS_GameInstanceSubsystem::GetFriendsCurrentFriends()
 FMOSFriendsFriendState UMOS_GameInstanceSubsystem::GetFriendsFriendState(const FUniqueNetIdRepl &TargetUserId) const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return FMOSFriendsFriendState();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -141,28 +276,7 @@ FMOSFriendsFriendState UMOS_GameInstanceSubsystem::GetFriendsFriendState(const F
     State.Id = TargetFriend->GetUserId();
     State.DisplayName = TargetFriend->GetDisplayName();
     State.RealName = TargetFriend->GetRealName();
-    switch (TargetFriend->GetInviteStatus())
-    {
-    case EInviteStatus::Accepted:
-        State.InvitationStatus = EMOSFriendsFriendInvitationStatus::Accepted;
-        break;
-    case EInviteStatus::PendingInbound:
-        State.InvitationStatus = EMOSFriendsFriendInvitationStatus::PendingInbound;
-        break;
-    case EInviteStatus::PendingOutbound:
-        State.InvitationStatus = EMOSFriendsFriendInvitationStatus::PendingOutbound;
-        break;
-    case EInviteStatus::Blocked:
-        State.InvitationStatus = EMOSFriendsFriendInvitationStatus::Blocked;
-        break;
-    case EInviteStatus::Suggested:
-        State.InvitationStatus = EMOSFriendsFriendInvitationStatus::Suggested;
-        break;
-    case EInviteStatus::Unknown:
-    default:
-        State.InvitationStatus = EMOSFriendsFriendInvitationStatus::Unknown;
-        break;
-    }
+    State.InvitationStatus = OSS::OnlineAPI::FFriendsStore::ConvertInvitationStatus(TargetFriend->GetInviteStatus());
     const auto &Presence = TargetFriend->GetPresence();
     State.PresenceSessionId = Presence.SessionId;
     State.PresencePartyId = PartyId;
@@ -173,28 +287,7 @@ FMOSFriendsFriendState UMOS_GameInstanceSubsystem::GetFriendsFriendState(const F
     State.bPresenceHasVoiceSupport = Presence.bHasVoiceSupport;
     State.PresenceLastOnline = Presence.LastOnline;
     State.PresenceStatusString = Presence.Status.StatusStr;
-    switch (Presence.Status.State)
-    {
-    case EOnlinePresenceState::Online:
-        State.PresenceStatusState = EMOSFriendsFriendPresenceStatus::Online;
-        break;
-    case EOnlinePresenceState::Away:
-        State.PresenceStatusState = EMOSFriendsFriendPresenceStatus::Away;
-        break;
-    case EOnlinePresenceState::ExtendedAway:
-        State.PresenceStatusState = EMOSFriendsFriendPresenceStatus::ExtendedAway;
-        break;
-    case EOnlinePresenceState::DoNotDisturb:
-        State.PresenceStatusState = EMOSFriendsFriendPresenceStatus::DoNotDisturb;
-        break;
-    case EOnlinePresenceState::Chat:
-        State.PresenceStatusState = EMOSFriendsFriendPresenceStatus::Chat;
-        break;
-    case EOnlinePresenceState::Offline:
-    default:
-        State.PresenceStatusState = EMOSFriendsFriendPresenceStatus::Offline;
-        break;
-    }
+    State.PresenceStatusState = OSS::OnlineAPI::FFriendsStore::ConvertPresenceStatus(Presence);
     for (const auto &KV : Presence.Status.Properties)
     {
         State.PresenceStatusProperties.Add(KV.Key, KV.Value.ToString());
@@ -250,13 +343,36 @@ FMOSFriendsFriendState UMOS_GameInstanceSubsystem::GetFriendsFriendState(const F
     return State;
 }
 
+FMOSFriendsFriendSummary UMOS_GameInstanceSubsystem::GetFriendsFriendSummary(const FUniqueNetIdRepl &TargetUserId) const
+{
+    FMOSFriendsFriendSummary Summary;
+    int32 Index = FriendsStore.IndexOf(TargetUserId);
+    if (Index == INDEX_NONE)
+    {
+        return Summary;
+    }
+
+    using OSS::OnlineAPI::EFriendPresenceFlags;
+    EFriendPresenceFlags Flags = FriendsStore.GetPresenceFlags(Index);
+    Summary.Id = TargetUserId;
+    Summary.DisplayName = FriendsStore.GetDisplayName(Index);
+    Summary.InvitationStatus = FriendsStore.GetInvitationStatus(Index);
+    Summary.bPresenceIsOnline = EnumHasAnyFlags(Flags, EFriendPresenceFlags::Online);
+    Summary.bPresenceIsPlaying = EnumHasAnyFlags(Flags, EFriendPresenceFlags::Playing);
+    Summary.bPresenceIsPlayingThisGame = EnumHasAnyFlags(Flags, EFriendPresenceFlags::PlayingThisGame);
+    Summary.bPresenceIsJoinable = EnumHasAnyFlags(Flags, EFriendPresenceFlags::Joinable);
+    Summary.PresenceStatusString = FriendsStore.GetStatusString(Index);
+    Summary.PresenceStatusState = FriendsStore.GetPresenceStatus(Index);
+    return Summary;
+}
+
 void UMOS_GameInstanceSubsystem::ExecuteFriendsSetFriendAlias(
     const FUniqueNetIdRepl &TargetUserId,
     const FString &Alias,
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -264,9 +380,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsSetFriendAlias(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -303,7 +419,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsDeleteFriendAlias(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -311,9 +427,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsDeleteFriendAlias(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -349,7 +465,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsSendInvite(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -357,9 +473,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsSendInvite(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -403,7 +519,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsAcceptInvite(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -411,9 +527,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsAcceptInvite(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -457,7 +573,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsRejectInvite(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -465,9 +581,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsRejectInvite(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -524,7 +640,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsDeleteFriend(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -532,9 +648,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsDeleteFriend(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -589,7 +705,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsDeleteFriend(
 void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryRecentPlayers(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -597,9 +713,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryRecentPlayers(UMOS_AsyncResu
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -654,16 +770,16 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryRecentPlayers(UMOS_AsyncResu
 TArray<FMOSFriendsRecentPlayerState> UMOS_GameInstanceSubsystem::GetFriendsCurrentRecentPlayers() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSFriendsRecentPlayerState>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -694,7 +810,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsBlockPlayer(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -702,9 +818,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsBlockPlayer(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -761,7 +877,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsUnblockPlayer(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -769,9 +885,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsUnblockPlayer(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -826,7 +942,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsUnblockPlayer(
 void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryBlockedPlayers(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -834,9 +950,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryBlockedPlayers(UMOS_AsyncRes
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -890,16 +1006,16 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsQueryBlockedPlayers(UMOS_AsyncRes
 TArray<FMOSFriendsBlockedPlayerState> UMOS_GameInstanceSubsystem::GetFriendsCurrentBlockedPlayers() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSFriendsBlockedPlayerState>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -930,7 +1046,7 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsSendInviteByFriendCode(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -938,9 +1054,9 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsSendInviteByFriendCode(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the friends interface, if the online subsystem supports it.
@@ -997,21 +1113,21 @@ void UMOS_GameInstanceSubsystem::ExecuteFriendsSendInviteByFriendCode(
 FString UMOS_GameInstanceSubsystem::GetFriendsCurrentFriendCode() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TEXT("");
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return TEXT("");
     }
 
     // Get the user ID if the user is signed in.
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return TEXT("");
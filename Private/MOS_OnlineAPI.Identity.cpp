@@ -7,19 +7,19 @@
 FUniqueNetIdRepl UMOS_GameInstanceSubsystem::GetIdentityUniqueNetId(const FString &UniqueNetId)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return FUniqueNetIdRepl();
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     if (!Identity.IsValid())
     {
         return FUniqueNetIdRepl();
     }
 
     // Return the currently signed in user (or an empty FUniqueNetIdRepl if no-one is signed in).
-    return Identity->GetUniquePlayerId(this->LocalUserNum);
+    return this->GetOnlineContext().UserId;
 }
\ No newline at end of file
@@ -5,12 +5,53 @@
 #include "Interfaces/OnlineLeaderboardInterface.h"
 #include "OnlineSubsystemUtils.h"
 
+typedef FStatPropertyArray::KeyType FMOSLeaderboardColumnName;
+
+// Converts the rows of a completed read into entries. The score column is only looked up by name when a row carries more
+// than one column, and player names are concatenated rather than formatted, since pages can hold thousands of rows.
+static void ConvertLeaderboardRows(
+    const FOnlineLeaderboardRead &ReadObject,
+    const FMOSLeaderboardColumnName &ScoreColumn,
+    TArray<FMOSLeaderboardsLeaderboardEntry> &OutEntries)
+{
+    static const FString NameSeparator = TEXT(" - ");
+
+    OutEntries.Reset(ReadObject.Rows.Num());
+    for (const auto &Row : ReadObject.Rows)
+    {
+        const FVariantData *Value = nullptr;
+        if (Row.Columns.Num() == 1)
+        {
+            Value = &FStatPropertyArray::TConstIterator(Row.Columns).Value();
+        }
+        else
+        {
+            Value = Row.Columns.Find(ScoreColumn);
+        }
+
+        int32 Score = 0;
+        if (Value != nullptr)
+        {
+            Value->GetValue(Score);
+        }
+
+        FMOSLeaderboardsLeaderboardEntry &Entry = OutEntries.AddDefaulted_GetRef();
+        Entry.CurrentValue = Score;
+        Entry.Rank = Row.Rank;
+        FString PlayerId = Row.PlayerId.IsValid() ? Row.PlayerId->ToString() : FString();
+        Entry.PlayerName.Reserve(PlayerId.Len() + NameSeparator.Len() + Row.NickName.Len());
+        Entry.PlayerName.Append(PlayerId);
+        Entry.PlayerName.Append(NameSeparator);
+        Entry.PlayerName.Append(Row.NickName);
+    }
+}
+
 
 void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryGlobalLeaderboards(
     UMOS_QueryLeaderboardsAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(
@@ -21,9 +62,9 @@ void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryGlobalLeaderboards(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the leaderboards interface, if the online subsystem supports it.
@@ -37,6 +78,12 @@ void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryGlobalLeaderboards(
         return;
     }
 
+    // Join any read that is already in flight instead of starting another one.
+    if (!LeaderboardsQueryGlobalFlight.Join(Result, LeaderboardsQueryGlobalMemoizeSeconds))
+    {
+        return;
+    }
+
     // Construct the read object, which will be populated with our results.
     auto ReadObject = MakeShared<FOnlineLeaderboardRead>();
 
@@ -47,78 +94,71 @@ void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryGlobalLeaderboards(
     ReadObject->LeaderboardName = FName(TEXT("TestScore"));
 #endif
 
-    // Register an event so we can receive the query outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        Leaderboards->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateWeakLambda(
-            this,
-            [Leaderboards,
-             CallbackHandle,
-             ResultWk = TSoftObjectPtr<UMOS_QueryLeaderboardsAsyncResult>(Result),
-             ReadObject](bool bCallbackWasSuccessful) {
-                // Check if this callback is for us.
-                if (ReadObject->ReadState != EOnlineAsyncTaskState::Failed &&
-                    ReadObject->ReadState != EOnlineAsyncTaskState::Done)
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
+    CallDispatcher.Run<TArray<FMOSLeaderboardsLeaderboardEntry>>(
+        TEXT("Leaderboards.QueryGlobalLeaderboards"),
+        OnlineCallTimeoutSeconds,
+        [this, Leaderboards, ReadObject](const auto &OnComplete) {
+            // Register an event so we can receive the query outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                Leaderboards->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [Leaderboards, CallbackHandle, ReadObject, OnComplete](bool bCallbackWasSuccessful) {
+                        // Check if this callback is for us.
+                        if (ReadObject->ReadState != EOnlineAsyncTaskState::Failed &&
+                            ReadObject->ReadState != EOnlineAsyncTaskState::Done)
+                        {
+                            // This callback isn't for our call.
+                            return;
+                        }
 
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+                        // Return if the read failed.
+                        if (ReadObject->ReadState == EOnlineAsyncTaskState::Failed)
+                        {
+                            OnComplete(
+                                false,
+                                TArray<FMOSLeaderboardsLeaderboardEntry>(),
+                                TEXT("Leaderboard read failed."));
+                            Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+                            return;
+                        }
 
-                // Return if the read failed.
-                if (ReadObject->ReadState == EOnlineAsyncTaskState::Failed)
-                {
-                    ResultWk->OnResult(
-                        false,
-                        TArray<FMOSLeaderboardsLeaderboardEntry>(),
-                        TEXT("Leaderboard read failed."));
-                    Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
-                    return;
-                }
+                        // Otherise, convert the results.
+                        // @note: On EOS, when you perform a ranked search, the value is always in the "Score" column.
+                        TArray<FMOSLeaderboardsLeaderboardEntry> Results;
+                        ConvertLeaderboardRows(*ReadObject, FMOSLeaderboardColumnName(TEXT("Score")), Results);
 
-                // Otherise, convert the results.
-                TArray<FMOSLeaderboardsLeaderboardEntry> Results;
-                for (const auto &Row : ReadObject->Rows)
-                {
-                    // @note: On EOS, when you perform a ranked search, the value is always in the "Score" column.
-                    int Score;
-                    Row.Columns["Score"].GetValue(Score);
-
-                    FMOSLeaderboardsLeaderboardEntry Entry;
-                    Entry.CurrentValue = Score;
-                    Entry.PlayerName = FString::Printf(TEXT("%s - %s"), *Row.PlayerId->ToString(), *Row.NickName);
-                    Entry.Rank = Row.Rank;
-                    Results.Add(Entry);
-                }
+                        // Return the results.
+                        OnComplete(true, Results, TEXT(""));
 
-                // Return the results.
-                ResultWk->OnResult(true, Results, TEXT(""));
+                        // Unregister this callback since we've handled the call we care about.
+                        Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+                    }));
 
-                // Unregister this callback since we've handled the call we care about.
+            // Query the global leaderboard.
+            if (!Leaderboards->ReadLeaderboardsAroundRank(0, 100, ReadObject))
+            {
+                OnComplete(
+                    false,
+                    TArray<FMOSLeaderboardsLeaderboardEntry>(),
+                    TEXT("ReadLeaderboardsAroundRank call failed to start."));
                 Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
-            }));
-
-    // Query the global leaderboard.
-    if (!Leaderboards->ReadLeaderboardsAroundRank(0, 100, ReadObject))
-    {
-        Result->OnResult(
-            false,
-            TArray<FMOSLeaderboardsLeaderboardEntry>(),
-            TEXT("ReadLeaderboardsAroundRank call failed to start."));
-        Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
-    }
+            }
+        },
+        [this](
+            bool bWasSuccessful,
+            const TArray<FMOSLeaderboardsLeaderboardEntry> &Results,
+            const FString &ErrorMessage) {
+            // Return the result to everyone waiting on this read.
+            LeaderboardsQueryGlobalFlight.Complete(bWasSuccessful, Results, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryFriendsLeaderboards(
     UMOS_QueryLeaderboardsAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(
@@ -129,9 +169,9 @@ void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryFriendsLeaderboards(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the leaderboards interface, if the online subsystem supports it.
@@ -155,70 +195,303 @@ void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryFriendsLeaderboards(
     ReadObject->ColumnMetadata.Add(FColumnMetaData(FName(TEXT("TestScore")), EOnlineKeyValuePairDataType::Int32));
 #endif
 
-    // Register an event so we can receive the query outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        Leaderboards->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateWeakLambda(
-            this,
-            [Leaderboards,
-             CallbackHandle,
-             ResultWk = TSoftObjectPtr<UMOS_QueryLeaderboardsAsyncResult>(Result),
-             ReadObject](bool bCallbackWasSuccessful) {
-                // Check if this callback is for us.
-                if (ReadObject->ReadState != EOnlineAsyncTaskState::Failed &&
-                    ReadObject->ReadState != EOnlineAsyncTaskState::Done)
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
+    CallDispatcher.Run<TArray<FMOSLeaderboardsLeaderboardEntry>>(
+        TEXT("Leaderboards.QueryFriendsLeaderboards"),
+        OnlineCallTimeoutSeconds,
+        [this, Leaderboards, ReadObject](const auto &OnComplete) {
+            // Register an event so we can receive the query outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                Leaderboards->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [Leaderboards, CallbackHandle, ReadObject, OnComplete](bool bCallbackWasSuccessful) {
+                        // Check if this callback is for us.
+                        if (ReadObject->ReadState != EOnlineAsyncTaskState::Failed &&
+                            ReadObject->ReadState != EOnlineAsyncTaskState::Done)
+                        {
+                            // This callback isn't for our call.
+                            return;
+                        }
+
+                        // Return if the read failed.
+                        if (ReadObject->ReadState == EOnlineAsyncTaskState::Failed)
+                        {
+                            OnComplete(
+                                false,
+                                TArray<FMOSLeaderboardsLeaderboardEntry>(),
+                                TEXT("Leaderboard read failed."));
+                            Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+                            return;
+                        }
+
+                        // Otherise, convert the results.
+                        // @note: On EOS, when you perform a friend search, the value is in a column that matches the stat
+                        // name.
+                        TArray<FMOSLeaderboardsLeaderboardEntry> Results;
+                        ConvertLeaderboardRows(*ReadObject, FMOSLeaderboardColumnName(TEXT("TestScore")), Results);
+
+                        // Return the results.
+                        OnComplete(true, Results, TEXT(""));
+
+                        // Unregister this callback since we've handled the call we care about.
+                        Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+                    }));
+
+            // Query the stats for our friends.
+            if (!Leaderboards->ReadLeaderboardsForFriends(this->LocalUserNum, ReadObject))
+            {
+                OnComplete(
+                    true,
+                    TArray<FMOSLeaderboardsLeaderboardEntry>(),
+                    TEXT("ReadLeaderboardsForFriends call failed to start."));
+                Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_QueryLeaderboardsAsyncResult>(Result)](
+            bool bWasSuccessful,
+            const TArray<FMOSLeaderboardsLeaderboardEntry> &Results,
+            const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the results.
+            ResultWk->OnResult(bWasSuccessful, Results, ErrorMessage);
+        });
+}
+
+void UMOS_GameInstanceSubsystem::ExecuteLeaderboardsQueryLeaderboardPages(
+    const FString &LeaderboardName,
+    int32 FirstRank,
+    int32 RankCount,
+    int32 PageSize,
+    UMOS_QueryLeaderboardPagesAsyncResult *Result)
+{
+    // Get the online subsystem.
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        Result->OnResult(false, TEXT("Online subsystem is not available."));
+        return;
+    }
 
+    // Make sure the user is signed in.
+    checkf(
+        this->GetOnlineContext().UserId.IsValid(),
+        TEXT("Expected this function to not be called unless the user is signed in."));
+
+    // Make sure the online subsystem supports leaderboards.
+    if (!OSS->GetLeaderboardsInterface().IsValid())
+    {
+        Result->OnResult(false, TEXT("Online subsystem does not support leaderboards."));
+        return;
+    }
+
+    // Validate the window.
+    if (LeaderboardName.IsEmpty() || FirstRank < OSS::OnlineAPI::LeaderboardFirstRank || RankCount <= 0 || PageSize <= 0)
+    {
+        Result->OnResult(false, TEXT("Invalid leaderboard window."));
+        return;
+    }
+
+    LeaderboardPageCache.MaxAgeSeconds = LeaderboardPageCacheSeconds;
+    LeaderboardPageCache.MaxPages = LeaderboardPageCacheMaxPages;
+
+    // Clamp the window and its pages to what one query may read, and work out the end of the window in 64-bit so a
+    // window at the end of the rank range doesn't overflow.
+    RankCount = FMath::Min(RankCount, OSS::OnlineAPI::LeaderboardMaxWindowRanks);
+    PageSize = FMath::Min(PageSize, OSS::OnlineAPI::LeaderboardMaxWindowRanks);
+    FName BoardName(*LeaderboardName);
+    int64 EndRank = FMath::Min(static_cast<int64>(FirstRank) + RankCount, static_cast<int64>(MAX_int32) + 1);
+    int32 FirstPage = (FirstRank - OSS::OnlineAPI::LeaderboardFirstRank) / PageSize;
+    int32 LastPage = static_cast<int32>((EndRank - 1 - OSS::OnlineAPI::LeaderboardFirstRank) / PageSize);
+
+    // Tracks how many pages of this window are still outstanding.
+    struct FWindowState
+    {
+        int32 PagesRemaining;
+        bool bFailed = false;
+        FString ErrorMessage;
+    };
+    auto Window = MakeShared<FWindowState>();
+    Window->PagesRemaining = LastPage - FirstPage + 1;
+
+    for (int32 PageIndex = FirstPage; PageIndex <= LastPage; PageIndex++)
+    {
+        RequestLeaderboardPage(
+            OSS::OnlineAPI::FLeaderboardPageKey{BoardName, PageSize, PageIndex},
+            [ResultWk = TSoftObjectPtr<UMOS_QueryLeaderboardPagesAsyncResult>(Result),
+             Window,
+             FirstRank,
+             EndRank](
+                bool bWasSuccessful,
+                const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries,
+                const FString &ErrorMessage) {
                 // Make sure the result callback is still valid.
                 if (!ResultWk.IsValid())
                 {
                     return;
                 }
 
-                // Return if the read failed.
-                if (ReadObject->ReadState == EOnlineAsyncTaskState::Failed)
+                if (bWasSuccessful)
                 {
-                    ResultWk->OnResult(
-                        false,
-                        TArray<FMOSLeaderboardsLeaderboardEntry>(),
-                        TEXT("Leaderboard read failed."));
-                    Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
-                    return;
+                    // Deliver the entries of this page whose rank falls inside the window.
+                    // @note: Slice by the rank each entry reports rather than its position, since the backend
+                    // can skip or repeat ranks (e.g. for ties).
+                    TArray<FMOSLeaderboardsLeaderboardEntry> Slice;
+                    for (const auto &Entry : Entries)
+                    {
+                        if (Entry.Rank >= FirstRank && Entry.Rank < EndRank)
+                        {
+                            Slice.Add(Entry);
+                        }
+                    }
+                    if (Slice.Num() > 0)
+                    {
+                        int32 SliceFirstRank = Slice[0].Rank;
+                        ResultWk->OnPage(SliceFirstRank, Slice);
+                    }
+                }
+                else if (!Window->bFailed)
+                {
+                    Window->bFailed = true;
+                    Window->ErrorMessage = ErrorMessage;
                 }
 
-                // Otherise, convert the results.
-                TArray<FMOSLeaderboardsLeaderboardEntry> Results;
-                for (const auto &Row : ReadObject->Rows)
+                // Return the overall result once every page has landed.
+                if (--Window->PagesRemaining == 0)
                 {
-                    // @note: On EOS, when you perform a friend search, the value is in a column that matches the stat
-                    // name.
-                    int Score;
-                    Row.Columns["TestScore"].GetValue(Score);
-
-                    FMOSLeaderboardsLeaderboardEntry Entry;
-                    Entry.CurrentValue = Score;
-                    Entry.PlayerName = FString::Printf(TEXT("%s - %s"), *Row.PlayerId->ToString(), *Row.NickName);
-                    Entry.Rank = Row.Rank;
-                    Results.Add(Entry);
+                    ResultWk->OnResult(!Window->bFailed, Window->ErrorMessage);
                 }
+            });
+    }
 
-                // Return the results.
-                ResultWk->OnResult(true, Results, TEXT(""));
+    // Read the neighbouring pages ahead of time, so that scrolling either way is served from the cache.
+    for (int32 Offset = 1; Offset <= LeaderboardPrefetchPages; Offset++)
+    {
+        if (FirstPage - Offset >= 0)
+        {
+            RequestLeaderboardPage(OSS::OnlineAPI::FLeaderboardPageKey{BoardName, PageSize, FirstPage - Offset}, nullptr);
+        }
+        int64 NextPageFirstRank =
+            OSS::OnlineAPI::LeaderboardFirstRank + (static_cast<int64>(LastPage) + Offset) * PageSize;
+        if (NextPageFirstRank <= MAX_int32)
+        {
+            RequestLeaderboardPage(OSS::OnlineAPI::FLeaderboardPageKey{BoardName, PageSize, LastPage + Offset}, nullptr);
+        }
+    }
+}
 
-                // Unregister this callback since we've handled the call we care about.
-                Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
-            }));
+void UMOS_GameInstanceSubsystem::RequestLeaderboardPage(
+    const OSS::OnlineAPI::FLeaderboardPageKey &Key,
+    OSS::OnlineAPI::FLeaderboardPageCache::FOnPage OnPage)
+{
+    // Serve the page from the cache if we have it.
+    if (auto CachedPage = LeaderboardPageCache.Find(Key))
+    {
+        if (OnPage)
+        {
+            OnPage(true, *CachedPage, TEXT(""));
+        }
+        return;
+    }
 
-    // Query the stats for our friends.
-    if (!Leaderboards->ReadLeaderboardsForFriends(this->LocalUserNum, ReadObject))
+    // Join the read of this page if one is already in flight.
+    if (!LeaderboardPageCache.JoinFetch(Key, MoveTemp(OnPage)))
     {
-        Result->OnResult(
-            true,
+        return;
+    }
+
+    auto OSS = this->GetOnlineContext().OSS;
+    IOnlineLeaderboardsPtr Leaderboards;
+    if (OSS != nullptr)
+    {
+        Leaderboards = OSS->GetLeaderboardsInterface();
+    }
+    if (!Leaderboards.IsValid())
+    {
+        LeaderboardPageCache.CompleteFetch(
+            Key,
+            false,
             TArray<FMOSLeaderboardsLeaderboardEntry>(),
-            TEXT("ReadLeaderboardsForFriends call failed to start."));
-        Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+            TEXT("Online subsystem does not support leaderboards."));
+        return;
     }
-}
\ No newline at end of file
+
+    // Construct the read object, which will be populated with our results.
+    auto ReadObject = MakeShared<FOnlineLeaderboardRead>();
+#if REDPOINT_EXAMPLE_UE_5_5_OR_LATER
+    ReadObject->LeaderboardName = Key.LeaderboardName.ToString();
+#else
+    ReadObject->LeaderboardName = Key.LeaderboardName;
+#endif
+
+    CallDispatcher.Run<TArray<FMOSLeaderboardsLeaderboardEntry>>(
+        TEXT("Leaderboards.ReadLeaderboardPage"),
+        OnlineCallTimeoutSeconds,
+        [this, Leaderboards, ReadObject, Key](const auto &OnComplete) {
+            // Register an event so we can receive the query outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                Leaderboards->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [Leaderboards, CallbackHandle, ReadObject, OnComplete, Key](bool bCallbackWasSuccessful) {
+                        // Check if this callback is for us.
+                        if (ReadObject->ReadState != EOnlineAsyncTaskState::Failed &&
+                            ReadObject->ReadState != EOnlineAsyncTaskState::Done)
+                        {
+                            // This callback isn't for our call.
+                            return;
+                        }
+
+                        // Unregister this callback since we've handled the call we care about.
+                        Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+
+                        // Return if the read failed.
+                        if (ReadObject->ReadState == EOnlineAsyncTaskState::Failed)
+                        {
+                            OnComplete(
+                                false,
+                                TArray<FMOSLeaderboardsLeaderboardEntry>(),
+                                TEXT("Leaderboard read failed."));
+                            return;
+                        }
+
+                        // Otherwise, convert the results and keep the rows whose reported rank is on this page.
+                        // @note: On EOS, when you perform a ranked search, the value is always in the "Score" column.
+                        TArray<FMOSLeaderboardsLeaderboardEntry> Results;
+                        ConvertLeaderboardRows(*ReadObject, FMOSLeaderboardColumnName(TEXT("Score")), Results);
+                        Results.RemoveAll([&Key](const FMOSLeaderboardsLeaderboardEntry &Entry) {
+                            return Entry.Rank < Key.GetFirstRank() || Entry.Rank >= Key.GetEndRank();
+                        });
+                        Results.StableSort([](const FMOSLeaderboardsLeaderboardEntry &A, const FMOSLeaderboardsLeaderboardEntry &B) {
+                            return A.Rank < B.Rank;
+                        });
+                        OnComplete(true, Results, TEXT(""));
+                    }));
+
+            // Read the ranks covered by this page.
+            // @note: ReadLeaderboardsAroundRank returns the ranks [Rank - Range, Rank + Range], so centre the read on
+            // the page. With Range = ceil(PageSize / 2) the window always covers the whole page, and the rows
+            // either side of it are dropped above.
+            int32 ReadRange = (Key.PageSize + 1) / 2;
+            int64 ReadRank = FMath::Min(Key.GetFirstRank() + ReadRange, static_cast<int64>(MAX_int32));
+            if (!Leaderboards->ReadLeaderboardsAroundRank(static_cast<int32>(ReadRank), ReadRange, ReadObject))
+            {
+                Leaderboards->ClearOnLeaderboardReadCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(
+                    false,
+                    TArray<FMOSLeaderboardsLeaderboardEntry>(),
+                    TEXT("ReadLeaderboardsAroundRank call failed to start."));
+            }
+        },
+        [this, Key](
+            bool bWasSuccessful,
+            const TArray<FMOSLeaderboardsLeaderboardEntry> &Results,
+            const FString &ErrorMessage) {
+            // Cache the page and return it to everyone waiting on it.
+            LeaderboardPageCache.CompleteFetch(Key, bWasSuccessful, Results, ErrorMessage);
+        });
+}
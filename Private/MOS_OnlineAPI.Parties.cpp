@@ -8,16 +8,16 @@
 TArray<FMOSInterfaceListEntry> UMOS_GameInstanceSubsystem::GetPartiesJoinedParties() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSInterfaceListEntry>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -44,7 +44,7 @@ TArray<FMOSInterfaceListEntry> UMOS_GameInstanceSubsystem::GetPartiesJoinedParti
 void UMOS_GameInstanceSubsystem::ExecutePartiesCreateParty(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -52,9 +52,9 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesCreateParty(UMOS_AsyncResult *Res
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -78,74 +78,86 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesCreateParty(UMOS_AsyncResult *Res
     PartyConfiguration.Nickname = TEXT("");
     PartyConfiguration.Description = TEXT("");
     PartyConfiguration.Password = TEXT("");
-    PartySystem->CreateParty(
-        *UserId,
-        PartySystem->GetPrimaryPartyTypeId(),
-        PartyConfiguration,
-        FOnCreatePartyComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](
-                const FUniqueNetId &,
-                const TSharedPtr<const FOnlinePartyId> &PartyId,
-                const ECreatePartyCompletionResult PartyResult) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the success status.
-                FString ErrorMessage;
-                switch (PartyResult)
-                {
-                case ECreatePartyCompletionResult::UnknownClientFailure:
-                    ErrorMessage = TEXT("UnknownClientFailure");
-                    break;
-                case ECreatePartyCompletionResult::AlreadyInPartyOfSpecifiedType:
-                    ErrorMessage = TEXT("AlreadyInPartyOfSpecifiedType");
-                    break;
-                case ECreatePartyCompletionResult::AlreadyCreatingParty:
-                    ErrorMessage = TEXT("AlreadyCreatingParty");
-                    break;
-                case ECreatePartyCompletionResult::AlreadyInParty:
-                    ErrorMessage = TEXT("AlreadyInParty");
-                    break;
-                case ECreatePartyCompletionResult::FailedToCreateMucRoom:
-                    ErrorMessage = TEXT("FailedToCreateMucRoom");
-                    break;
-                case ECreatePartyCompletionResult::NoResponse:
-                    ErrorMessage = TEXT("NoResponse");
-                    break;
-                case ECreatePartyCompletionResult::LoggedOut:
-                    ErrorMessage = TEXT("LoggedOut");
-                    break;
-                case ECreatePartyCompletionResult::NotPrimaryUser:
-                    ErrorMessage = TEXT("NotPrimaryUser");
-                    break;
-                case ECreatePartyCompletionResult::UnknownInternalFailure:
-                    ErrorMessage = TEXT("UnknownInternalFailure");
-                    break;
-                default:
-                case ECreatePartyCompletionResult::Succeeded:
-                    break;
-                }
-                ResultWk->OnResult(PartyResult == ECreatePartyCompletionResult::Succeeded, ErrorMessage);
-            }));
+    CallDispatcher.Run<>(
+        TEXT("Parties.CreateParty"),
+        OnlineCallTimeoutSeconds,
+        [this, PartySystem, UserId, PartyConfiguration](const auto &OnComplete) {
+            if (!PartySystem->CreateParty(
+                    *UserId,
+                    PartySystem->GetPrimaryPartyTypeId(),
+                    PartyConfiguration,
+                    FOnCreatePartyComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete](
+                            const FUniqueNetId &,
+                            const TSharedPtr<const FOnlinePartyId> &PartyId,
+                            const ECreatePartyCompletionResult PartyResult) {
+                            // Return the success status.
+                            FString ErrorMessage;
+                            switch (PartyResult)
+                            {
+                            case ECreatePartyCompletionResult::UnknownClientFailure:
+                                ErrorMessage = TEXT("UnknownClientFailure");
+                                break;
+                            case ECreatePartyCompletionResult::AlreadyInPartyOfSpecifiedType:
+                                ErrorMessage = TEXT("AlreadyInPartyOfSpecifiedType");
+                                break;
+                            case ECreatePartyCompletionResult::AlreadyCreatingParty:
+                                ErrorMessage = TEXT("AlreadyCreatingParty");
+                                break;
+                            case ECreatePartyCompletionResult::AlreadyInParty:
+                                ErrorMessage = TEXT("AlreadyInParty");
+                                break;
+                            case ECreatePartyCompletionResult::FailedToCreateMucRoom:
+                                ErrorMessage = TEXT("FailedToCreateMucRoom");
+                                break;
+                            case ECreatePartyCompletionResult::NoResponse:
+                                ErrorMessage = TEXT("NoResponse");
+                                break;
+                            case ECreatePartyCompletionResult::LoggedOut:
+                                ErrorMessage = TEXT("LoggedOut");
+                                break;
+                            case ECreatePartyCompletionResult::NotPrimaryUser:
+                                ErrorMessage = TEXT("NotPrimaryUser");
+                                break;
+                            case ECreatePartyCompletionResult::UnknownInternalFailure:
+                                ErrorMessage = TEXT("UnknownInternalFailure");
+                                break;
+                            default:
+                            case ECreatePartyCompletionResult::Succeeded:
+                                break;
+                            }
+                            OnComplete(PartyResult == ECreatePartyCompletionResult::Succeeded, ErrorMessage);
+                        })))
+            {
+                OnComplete(false, TEXT("The CreateParty call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the success status.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 TArray<FMOSInterfaceListEntry> UMOS_GameInstanceSubsystem::GetPartiesCurrentInvites() const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FMOSInterfaceListEntry>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -178,7 +190,7 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesAcceptInvite(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -186,9 +198,9 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesAcceptInvite(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -218,112 +230,124 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesAcceptInvite(
     }
 
     // Join the party.
-    PartySystem->JoinParty(
-        *UserId,
-        *SelectedPartyInvite,
-        FOnJoinPartyComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](
-                const FUniqueNetId &,
-                const FOnlinePartyId &,
-                const EJoinPartyCompletionResult PartyResult,
-                const int32) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the success status.
-                FString ErrorMessage;
-                switch (PartyResult)
-                {
-                case EJoinPartyCompletionResult::UnknownClientFailure:
-                    ErrorMessage = TEXT("UnknownClientFailure");
-                    break;
-                case EJoinPartyCompletionResult::BadBuild:
-                    ErrorMessage = TEXT("BadBuild");
-                    break;
-                case EJoinPartyCompletionResult::InvalidAccessKey:
-                    ErrorMessage = TEXT("InvalidAccessKey");
-                    break;
-                case EJoinPartyCompletionResult::AlreadyInLeadersJoiningList:
-                    ErrorMessage = TEXT("AlreadyInLeadersJoiningList");
-                    break;
-                case EJoinPartyCompletionResult::AlreadyInLeadersPartyRoster:
-                    ErrorMessage = TEXT("AlreadyInLeadersPartyRoster");
-                    break;
-                case EJoinPartyCompletionResult::NoSpace:
-                    ErrorMessage = TEXT("NoSpace");
-                    break;
-                case EJoinPartyCompletionResult::NotApproved:
-                    ErrorMessage = TEXT("NotApproved");
-                    break;
-                case EJoinPartyCompletionResult::RequesteeNotMember:
-                    ErrorMessage = TEXT("RequesteeNotMember");
-                    break;
-                case EJoinPartyCompletionResult::RequesteeNotLeader:
-                    ErrorMessage = TEXT("RequesteeNotLeader");
-                    break;
-                case EJoinPartyCompletionResult::NoResponse:
-                    ErrorMessage = TEXT("NoResponse");
-                    break;
-                case EJoinPartyCompletionResult::LoggedOut:
-                    ErrorMessage = TEXT("LoggedOut");
-                    break;
+    CallDispatcher.Run<>(
+        TEXT("Parties.JoinParty"),
+        OnlineCallTimeoutSeconds,
+        [this, PartySystem, UserId, SelectedPartyInvite](const auto &OnComplete) {
+            if (!PartySystem->JoinParty(
+                    *UserId,
+                    *SelectedPartyInvite,
+                    FOnJoinPartyComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete](
+                            const FUniqueNetId &,
+                            const FOnlinePartyId &,
+                            const EJoinPartyCompletionResult PartyResult,
+                            const int32) {
+                            // Return the success status.
+                            FString ErrorMessage;
+                            switch (PartyResult)
+                            {
+                            case EJoinPartyCompletionResult::UnknownClientFailure:
+                                ErrorMessage = TEXT("UnknownClientFailure");
+                                break;
+                            case EJoinPartyCompletionResult::BadBuild:
+                                ErrorMessage = TEXT("BadBuild");
+                                break;
+                            case EJoinPartyCompletionResult::InvalidAccessKey:
+                                ErrorMessage = TEXT("InvalidAccessKey");
+                                break;
+                            case EJoinPartyCompletionResult::AlreadyInLeadersJoiningList:
+                                ErrorMessage = TEXT("AlreadyInLeadersJoiningList");
+                                break;
+                            case EJoinPartyCompletionResult::AlreadyInLeadersPartyRoster:
+                                ErrorMessage = TEXT("AlreadyInLeadersPartyRoster");
+                                break;
+                            case EJoinPartyCompletionResult::NoSpace:
+                                ErrorMessage = TEXT("NoSpace");
+                                break;
+                            case EJoinPartyCompletionResult::NotApproved:
+                                ErrorMessage = TEXT("NotApproved");
+                                break;
+                            case EJoinPartyCompletionResult::RequesteeNotMember:
+                                ErrorMessage = TEXT("RequesteeNotMember");
+                                break;
+                            case EJoinPartyCompletionResult::RequesteeNotLeader:
+                                ErrorMessage = TEXT("RequesteeNotLeader");
+                                break;
+                            case EJoinPartyCompletionResult::NoResponse:
+                                ErrorMessage = TEXT("NoResponse");
+                                break;
+                            case EJoinPartyCompletionResult::LoggedOut:
+                                ErrorMessage = TEXT("LoggedOut");
+                                break;
 #if !REDPOINT_EXAMPLE_UE_5_5_OR_LATER
-                case EJoinPartyCompletionResult::UnableToRejoin:
-                    ErrorMessage = TEXT("UnableToRejoin");
-                    break;
+                            case EJoinPartyCompletionResult::UnableToRejoin:
+                                ErrorMessage = TEXT("UnableToRejoin");
+                                break;
 #endif
-                case EJoinPartyCompletionResult::IncompatiblePlatform:
-                    ErrorMessage = TEXT("IncompatiblePlatform");
-                    break;
-                case EJoinPartyCompletionResult::AlreadyJoiningParty:
-                    ErrorMessage = TEXT("AlreadyJoiningParty");
-                    break;
-                case EJoinPartyCompletionResult::AlreadyInParty:
-                    ErrorMessage = TEXT("AlreadyInParty");
-                    break;
-                case EJoinPartyCompletionResult::JoinInfoInvalid:
-                    ErrorMessage = TEXT("JoinInfoInvalid");
-                    break;
-                case EJoinPartyCompletionResult::AlreadyInPartyOfSpecifiedType:
-                    ErrorMessage = TEXT("AlreadyInPartyOfSpecifiedType");
-                    break;
-                case EJoinPartyCompletionResult::MessagingFailure:
-                    ErrorMessage = TEXT("MessagingFailure");
-                    break;
-                case EJoinPartyCompletionResult::GameSpecificReason:
-                    ErrorMessage = TEXT("GameSpecificReason");
-                    break;
-                case EJoinPartyCompletionResult::MismatchedApp:
-                    ErrorMessage = TEXT("MismatchedApp");
-                    break;
-                case EJoinPartyCompletionResult::UnknownInternalFailure:
-                    ErrorMessage = TEXT("UnknownInternalFailure");
-                    break;
-                default:
-                case EJoinPartyCompletionResult::Succeeded:
-                    break;
-                }
-                ResultWk->OnResult(PartyResult == EJoinPartyCompletionResult::Succeeded, ErrorMessage);
-            }));
+                            case EJoinPartyCompletionResult::IncompatiblePlatform:
+                                ErrorMessage = TEXT("IncompatiblePlatform");
+                                break;
+                            case EJoinPartyCompletionResult::AlreadyJoiningParty:
+                                ErrorMessage = TEXT("AlreadyJoiningParty");
+                                break;
+                            case EJoinPartyCompletionResult::AlreadyInParty:
+                                ErrorMessage = TEXT("AlreadyInParty");
+                                break;
+                            case EJoinPartyCompletionResult::JoinInfoInvalid:
+                                ErrorMessage = TEXT("JoinInfoInvalid");
+                                break;
+                            case EJoinPartyCompletionResult::AlreadyInPartyOfSpecifiedType:
+                                ErrorMessage = TEXT("AlreadyInPartyOfSpecifiedType");
+                                break;
+                            case EJoinPartyCompletionResult::MessagingFailure:
+                                ErrorMessage = TEXT("MessagingFailure");
+                                break;
+                            case EJoinPartyCompletionResult::GameSpecificReason:
+                                ErrorMessage = TEXT("GameSpecificReason");
+                                break;
+                            case EJoinPartyCompletionResult::MismatchedApp:
+                                ErrorMessage = TEXT("MismatchedApp");
+                                break;
+                            case EJoinPartyCompletionResult::UnknownInternalFailure:
+                                ErrorMessage = TEXT("UnknownInternalFailure");
+                                break;
+                            default:
+                            case EJoinPartyCompletionResult::Succeeded:
+                                break;
+                            }
+                            OnComplete(PartyResult == EJoinPartyCompletionResult::Succeeded, ErrorMessage);
+                        })))
+            {
+                OnComplete(false, TEXT("The JoinParty call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the success status.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 TArray<FUniqueNetIdRepl> UMOS_GameInstanceSubsystem::GetPartiesCurrentMembers(const FString &PartyIdStr) const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FUniqueNetIdRepl>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -364,7 +388,7 @@ TArray<FUniqueNetIdRepl> UMOS_GameInstanceSubsystem::GetPartiesCurrentMembers(co
 void UMOS_GameInstanceSubsystem::ExecutePartiesLeaveParty(const FString &PartyIdStr, UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -372,9 +396,9 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesLeaveParty(const FString &PartyId
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -404,60 +428,71 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesLeaveParty(const FString &PartyId
     }
 
     // Leave the party.
-    PartySystem->LeaveParty(
-        *UserId,
-        *SelectedPartyId,
-        true,
-        FOnLeavePartyComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(
-                 Result)](const FUniqueNetId &, const FOnlinePartyId &, const ELeavePartyCompletionResult PartyResult) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the success status.
-                FString ErrorMessage;
-                switch (PartyResult)
-                {
-                case ELeavePartyCompletionResult::UnknownClientFailure:
-                    ErrorMessage = TEXT("UnknownClientFailure");
-                    break;
-                case ELeavePartyCompletionResult::NoResponse:
-                    ErrorMessage = TEXT("NoResponse");
-                    break;
-                case ELeavePartyCompletionResult::LoggedOut:
-                    ErrorMessage = TEXT("LoggedOut");
-                    break;
-                case ELeavePartyCompletionResult::UnknownParty:
-                    ErrorMessage = TEXT("UnknownParty");
-                    break;
-                case ELeavePartyCompletionResult::LeavePending:
-                    ErrorMessage = TEXT("LeavePending");
-                    break;
-                case ELeavePartyCompletionResult::UnknownLocalUser:
-                    ErrorMessage = TEXT("UnknownLocalUser");
-                    break;
-                case ELeavePartyCompletionResult::NotMember:
-                    ErrorMessage = TEXT("NotMember");
-                    break;
-                case ELeavePartyCompletionResult::MessagingFailure:
-                    ErrorMessage = TEXT("MessagingFailure");
-                    break;
-                case ELeavePartyCompletionResult::UnknownTransportFailure:
-                    ErrorMessage = TEXT("UnknownTransportFailure");
-                    break;
-                case ELeavePartyCompletionResult::UnknownInternalFailure:
-                    ErrorMessage = TEXT("UnknownInternalFailure");
-                    break;
-                default:
-                case ELeavePartyCompletionResult::Succeeded:
-                    break;
-                }
-                ResultWk->OnResult(PartyResult == ELeavePartyCompletionResult::Succeeded, ErrorMessage);
-            }));
+    CallDispatcher.Run<>(
+        TEXT("Parties.LeaveParty"),
+        OnlineCallTimeoutSeconds,
+        [this, PartySystem, UserId, SelectedPartyId](const auto &OnComplete) {
+            if (!PartySystem->LeaveParty(
+                    *UserId,
+                    *SelectedPartyId,
+                    true,
+                    FOnLeavePartyComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete](const FUniqueNetId &, const FOnlinePartyId &, const ELeavePartyCompletionResult PartyResult) {
+                            // Return the success status.
+                            FString ErrorMessage;
+                            switch (PartyResult)
+                            {
+                            case ELeavePartyCompletionResult::UnknownClientFailure:
+                                ErrorMessage = TEXT("UnknownClientFailure");
+                                break;
+                            case ELeavePartyCompletionResult::NoResponse:
+                                ErrorMessage = TEXT("NoResponse");
+                                break;
+                            case ELeavePartyCompletionResult::LoggedOut:
+                                ErrorMessage = TEXT("LoggedOut");
+                                break;
+                            case ELeavePartyCompletionResult::UnknownParty:
+                                ErrorMessage = TEXT("UnknownParty");
+                                break;
+                            case ELeavePartyCompletionResult::LeavePending:
+                                ErrorMessage = TEXT("LeavePending");
+                                break;
+                            case ELeavePartyCompletionResult::UnknownLocalUser:
+                                ErrorMessage = TEXT("UnknownLocalUser");
+                                break;
+                            case ELeavePartyCompletionResult::NotMember:
+                                ErrorMessage = TEXT("NotMember");
+                                break;
+                            case ELeavePartyCompletionResult::MessagingFailure:
+                                ErrorMessage = TEXT("MessagingFailure");
+                                break;
+                            case ELeavePartyCompletionResult::UnknownTransportFailure:
+                                ErrorMessage = TEXT("UnknownTransportFailure");
+                                break;
+                            case ELeavePartyCompletionResult::UnknownInternalFailure:
+                                ErrorMessage = TEXT("UnknownInternalFailure");
+                                break;
+                            default:
+                            case ELeavePartyCompletionResult::Succeeded:
+                                break;
+                            }
+                            OnComplete(PartyResult == ELeavePartyCompletionResult::Succeeded, ErrorMessage);
+                        })))
+            {
+                OnComplete(false, TEXT("The LeaveParty call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the success status.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecutePartiesKickMember(
@@ -466,7 +501,7 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesKickMember(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -474,9 +509,9 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesKickMember(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -506,60 +541,72 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesKickMember(
     }
 
     // Kick the member from the party.
-    PartySystem->KickMember(
-        *UserId,
-        *SelectedPartyId,
-        *MemberId,
-        FOnKickPartyMemberComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](
-                const FUniqueNetId &,
-                const FOnlinePartyId &,
-                const FUniqueNetId &,
-                const EKickMemberCompletionResult PartyResult) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the success status.
-                FString ErrorMessage;
-                switch (PartyResult)
-                {
-                case EKickMemberCompletionResult::UnknownClientFailure:
-                    ErrorMessage = TEXT("UnknownClientFailure");
-                    break;
-                case EKickMemberCompletionResult::UnknownParty:
-                    ErrorMessage = TEXT("UnknownParty");
-                    break;
-                case EKickMemberCompletionResult::LocalMemberNotMember:
-                    ErrorMessage = TEXT("LocalMemberNotMember");
-                    break;
-                case EKickMemberCompletionResult::LocalMemberNotLeader:
-                    ErrorMessage = TEXT("LocalMemberNotLeader");
-                    break;
-                case EKickMemberCompletionResult::RemoteMemberNotMember:
-                    ErrorMessage = TEXT("RemoteMemberNotMember");
-                    break;
-                case EKickMemberCompletionResult::MessagingFailure:
-                    ErrorMessage = TEXT("MessagingFailure");
-                    break;
-                case EKickMemberCompletionResult::NoResponse:
-                    ErrorMessage = TEXT("NoResponse");
-                    break;
-                case EKickMemberCompletionResult::LoggedOut:
-                    ErrorMessage = TEXT("LoggedOut");
-                    break;
-                case EKickMemberCompletionResult::UnknownInternalFailure:
-                    ErrorMessage = TEXT("UnknownInternalFailure");
-                    break;
-                default:
-                case EKickMemberCompletionResult::Succeeded:
-                    break;
-                }
-                ResultWk->OnResult(PartyResult == EKickMemberCompletionResult::Succeeded, ErrorMessage);
-            }));
+    CallDispatcher.Run<>(
+        TEXT("Parties.KickMember"),
+        OnlineCallTimeoutSeconds,
+        [this, PartySystem, UserId, SelectedPartyId, MemberId](const auto &OnComplete) {
+            if (!PartySystem->KickMember(
+                    *UserId,
+                    *SelectedPartyId,
+                    *MemberId,
+                    FOnKickPartyMemberComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete](
+                            const FUniqueNetId &,
+                            const FOnlinePartyId &,
+                            const FUniqueNetId &,
+                            const EKickMemberCompletionResult PartyResult) {
+                            // Return the success status.
+                            FString ErrorMessage;
+                            switch (PartyResult)
+                            {
+                            case EKickMemberCompletionResult::UnknownClientFailure:
+                                ErrorMessage = TEXT("UnknownClientFailure");
+                                break;
+                            case EKickMemberCompletionResult::UnknownParty:
+                                ErrorMessage = TEXT("UnknownParty");
+                                break;
+                            case EKickMemberCompletionResult::LocalMemberNotMember:
+                                ErrorMessage = TEXT("LocalMemberNotMember");
+                                break;
+                            case EKickMemberCompletionResult::LocalMemberNotLeader:
+                                ErrorMessage = TEXT("LocalMemberNotLeader");
+                                break;
+                            case EKickMemberCompletionResult::RemoteMemberNotMember:
+                                ErrorMessage = TEXT("RemoteMemberNotMember");
+                                break;
+                            case EKickMemberCompletionResult::MessagingFailure:
+                                ErrorMessage = TEXT("MessagingFailure");
+                                break;
+                            case EKickMemberCompletionResult::NoResponse:
+                                ErrorMessage = TEXT("NoResponse");
+                                break;
+                            case EKickMemberCompletionResult::LoggedOut:
+                                ErrorMessage = TEXT("LoggedOut");
+                                break;
+                            case EKickMemberCompletionResult::UnknownInternalFailure:
+                                ErrorMessage = TEXT("UnknownInternalFailure");
+                                break;
+                            default:
+                            case EKickMemberCompletionResult::Succeeded:
+                                break;
+                            }
+                            OnComplete(PartyResult == EKickMemberCompletionResult::Succeeded, ErrorMessage);
+                        })))
+            {
+                OnComplete(false, TEXT("The KickMember call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the success status.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecutePartiesInviteFriend(
@@ -568,7 +615,7 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesInviteFriend(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -576,9 +623,9 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesInviteFriend(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the party interface, if the online subsystem supports it.
@@ -608,52 +655,64 @@ void UMOS_GameInstanceSubsystem::ExecutePartiesInviteFriend(
     }
 
     // Send the invitation to the friend.
-    PartySystem->SendInvitation(
-        *UserId,
-        *SelectedPartyId,
-        FPartyInvitationRecipient(*MemberId),
-        FOnSendPartyInvitationComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](
-                const FUniqueNetId &,
-                const FOnlinePartyId &,
-                const FUniqueNetId &,
-                const ESendPartyInvitationCompletionResult PartyResult) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return the success status.
-                FString ErrorMessage;
-                switch (PartyResult)
-                {
-                case ESendPartyInvitationCompletionResult::NotLoggedIn:
-                    ErrorMessage = TEXT("NotLoggedIn");
-                    break;
-                case ESendPartyInvitationCompletionResult::InvitePending:
-                    ErrorMessage = TEXT("InvitePending");
-                    break;
-                case ESendPartyInvitationCompletionResult::AlreadyInParty:
-                    ErrorMessage = TEXT("AlreadyInParty");
-                    break;
-                case ESendPartyInvitationCompletionResult::PartyFull:
-                    ErrorMessage = TEXT("PartyFull");
-                    break;
-                case ESendPartyInvitationCompletionResult::NoPermission:
-                    ErrorMessage = TEXT("NoPermission");
-                    break;
-                case ESendPartyInvitationCompletionResult::RateLimited:
-                    ErrorMessage = TEXT("RateLimited");
-                    break;
-                case ESendPartyInvitationCompletionResult::UnknownInternalFailure:
-                    ErrorMessage = TEXT("UnknownInternalFailure");
-                    break;
-                default:
-                case ESendPartyInvitationCompletionResult::Succeeded:
-                    break;
-                }
-                ResultWk->OnResult(PartyResult == ESendPartyInvitationCompletionResult::Succeeded, ErrorMessage);
-            }));
+    CallDispatcher.Run<>(
+        TEXT("Parties.SendInvitation"),
+        OnlineCallTimeoutSeconds,
+        [this, PartySystem, UserId, SelectedPartyId, MemberId](const auto &OnComplete) {
+            if (!PartySystem->SendInvitation(
+                    *UserId,
+                    *SelectedPartyId,
+                    FPartyInvitationRecipient(*MemberId),
+                    FOnSendPartyInvitationComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete](
+                            const FUniqueNetId &,
+                            const FOnlinePartyId &,
+                            const FUniqueNetId &,
+                            const ESendPartyInvitationCompletionResult PartyResult) {
+                            // Return the success status.
+                            FString ErrorMessage;
+                            switch (PartyResult)
+                            {
+                            case ESendPartyInvitationCompletionResult::NotLoggedIn:
+                                ErrorMessage = TEXT("NotLoggedIn");
+                                break;
+                            case ESendPartyInvitationCompletionResult::InvitePending:
+                                ErrorMessage = TEXT("InvitePending");
+                                break;
+                            case ESendPartyInvitationCompletionResult::AlreadyInParty:
+                                ErrorMessage = TEXT("AlreadyInParty");
+                                break;
+                            case ESendPartyInvitationCompletionResult::PartyFull:
+                                ErrorMessage = TEXT("PartyFull");
+                                break;
+                            case ESendPartyInvitationCompletionResult::NoPermission:
+                                ErrorMessage = TEXT("NoPermission");
+                                break;
+                            case ESendPartyInvitationCompletionResult::RateLimited:
+                                ErrorMessage = TEXT("RateLimited");
+                                break;
+                            case ESendPartyInvitationCompletionResult::UnknownInternalFailure:
+                                ErrorMessage = TEXT("UnknownInternalFailure");
+                                break;
+                            default:
+                            case ESendPartyInvitationCompletionResult::Succeeded:
+                                break;
+                            }
+                            OnComplete(PartyResult == ESendPartyInvitationCompletionResult::Succeeded, ErrorMessage);
+                        })))
+            {
+                OnComplete(false, TEXT("The SendInvitation call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the success status.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
\ No newline at end of file
@@ -13,6 +13,26 @@
 #include "Kismet/GameplayStatics.h"
 
 
+static FString GetJoinSessionErrorMessage(EOnJoinSessionCompleteResult::Type Result)
+{
+    switch (Result)
+    {
+    case EOnJoinSessionCompleteResult::SessionIsFull:
+        return TEXT("SessionIsFull");
+    case EOnJoinSessionCompleteResult::SessionDoesNotExist:
+        return TEXT("SessionDoesNotExist");
+    case EOnJoinSessionCompleteResult::CouldNotRetrieveAddress:
+        return TEXT("CouldNotRetrieveAddress");
+    case EOnJoinSessionCompleteResult::AlreadyInSession:
+        return TEXT("AlreadyInSession");
+    case EOnJoinSessionCompleteResult::UnknownError:
+        return TEXT("UnknownError");
+    case EOnJoinSessionCompleteResult::Success:
+    default:
+        return TEXT("");
+    }
+}
+
 void UMOS_GameInstanceSubsystem::GetSessionInfo(const FMOSSessionsSearchResult& SearchResult)
 {
     PingInMs = SearchResult.PingInMs;
@@ -23,21 +43,43 @@ void UMOS_GameInstanceSubsystem::GetSessionInfo(const FMOSSessionsSearchResult&
 
 void UMOS_GameInstanceSubsystem::ExecuteSessionsFindSessions(UMOS_SessionsFindSessionsAsyncResult *Result)
 {
+    // If the browser list is still fresh, return it without another round-trip to the backend.
+    if (LastFindSessionsTime > 0.0 &&
+        FPlatformTime::Seconds() - LastFindSessionsTime < SessionBrowserCacheTTLSeconds)
+    {
+        Result->OnResult(true, CachedFindSessionResults, TEXT(""));
+        UpdateSessionListCompleteDelegate.Broadcast();
+        return;
+    }
+
+    FindSessionsInternal(Result);
+}
+
+void UMOS_GameInstanceSubsystem::FindSessionsInternal(UMOS_SessionsFindSessionsAsyncResult *Result)
+{
+    // @note: Result is nullptr when the background refresh ticker calls us, in which case we only update the cache.
+
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
-        Result->OnResult(false, TArray<FMOSSessionsSearchResult>(), TEXT("Online subsystem is not available."));
+        if (Result != nullptr)
+        {
+            Result->OnResult(false, TArray<FMOSSessionsSearchResult>(), TEXT("Online subsystem is not available."));
+        }
         return;
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
-        Result->OnResult(false, TArray<FMOSSessionsSearchResult>(), TEXT("The local user is not signed in."));
+        if (Result != nullptr)
+        {
+            Result->OnResult(false, TArray<FMOSSessionsSearchResult>(), TEXT("The local user is not signed in."));
+        }
         return;
     }
 
@@ -45,10 +87,13 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsFindSessions(UMOS_SessionsFindSe
     auto Session = OSS->GetSessionInterface();
     if (!Session.IsValid())
     {
-        Result->OnResult(
-            false,
-            TArray<FMOSSessionsSearchResult>(),
-            TEXT("Online subsystem does not support sessions."));
+        if (Result != nullptr)
+        {
+            Result->OnResult(
+                false,
+                TArray<FMOSSessionsSearchResult>(),
+                TEXT("Online subsystem does not support sessions."));
+        }
         return;
     }
 
@@ -63,87 +108,335 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsFindSessions(UMOS_SessionsFindSe
     /*Show lobbies that are full*/
     SearchObject->QuerySettings.SearchParams.Add(FName(TEXT("minslotsavailable")), FOnlineSessionSearchParam((int64)0L, EOnlineComparisonOp::GreaterThanEquals));
     
-    // Register an event so we can receive the query outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle = Session->AddOnFindSessionsCompleteDelegate_Handle(FOnFindSessionsCompleteDelegate::CreateWeakLambda(
-            this, [this, Session, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_SessionsFindSessionsAsyncResult>(Result), SearchObject](bool bCallbackWasSuccessful)
-            {
-                // Check if this callback is for us.
-                if (SearchObject->SearchState != EOnlineAsyncTaskState::Failed && SearchObject->SearchState != EOnlineAsyncTaskState::Done)
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
-
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+    // Search for all sessions.
+    FindSessionsInFlight++;
+    CallDispatcher.Run<>(
+        TEXT("Sessions.FindSessions"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SearchObject](const auto &OnComplete) {
+            // Register an event so we can receive the query outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnFindSessionsCompleteDelegate_Handle(FOnFindSessionsCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SearchObject, OnComplete](bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (SearchObject->SearchState != EOnlineAsyncTaskState::Failed &&
+                        SearchObject->SearchState != EOnlineAsyncTaskState::Done)
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
 
-                // Return if the read failed.
-                if (SearchObject->SearchState == EOnlineAsyncTaskState::Failed)
-                {
-                    ResultWk->OnResult(false, TArray<FMOSSessionsSearchResult>(), TEXT("Session search failed."));
+                    // Unregister this callback since we've handled the call we care about.
                     Session->ClearOnFindSessionsCompleteDelegate_Handle(*CallbackHandle);
-                    return;
-                }
-                
-                SessionResults.Empty();
-                CachedFindSessionResults.Empty();
-                
-                for (const auto &Row : SearchObject->SearchResults)
-                {
-                    if (Row.Session.SessionInfo.IsValid())
+                    if (SearchObject->SearchState == EOnlineAsyncTaskState::Failed)
                     {
-                        FOnlineSessionSearchResult Entry;
-                        Entry.Session = Row.Session;
-                        Entry.PingInMs = Row.PingInMs;
-
-                        SessionResults.Add(Entry);
-                        
-                        FMOSSessionsSearchResult CachedEntry;
-                        CachedEntry.SessionSearchResult = Row;
-                        CachedEntry.PingInMs = Row.PingInMs;
-                        
-                        CachedFindSessionResults.Add(CachedEntry);
+                        OnComplete(false, TEXT("Session search failed."));
+                        return;
                     }
+                    OnComplete(true, TEXT(""));
+                }));
+
+            if (!Session->FindSessions(this->LocalUserNum, SearchObject))
+            {
+                Session->ClearOnFindSessionsCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, TEXT("FindSessions call failed to start."));
+            }
+        },
+        [this, ResultWk = TSoftObjectPtr<UMOS_SessionsFindSessionsAsyncResult>(Result), SearchObject](
+            bool bWasSuccessful,
+            const FString &ErrorMessage) {
+            FindSessionsInFlight--;
+
+            // Return if the read failed.
+            if (!bWasSuccessful)
+            {
+                if (ResultWk.IsValid())
+                {
+                    ResultWk->OnResult(false, TArray<FMOSSessionsSearchResult>(), ErrorMessage);
                 }
+                return;
+            }
 
-                // Return the results.
+            // Update the browser cache even if the caller has gone away, so the next caller can use it.
+            ApplyFindSessionsResults(SearchObject->SearchResults);
+
+            // Return the results.
+            if (ResultWk.IsValid())
+            {
                 ResultWk->OnResult(true, CachedFindSessionResults, TEXT(""));
+            }
 
-                // Unregister this callback since we've handled the call we care about.
-                Session->ClearOnFindSessionsCompleteDelegate_Handle(*CallbackHandle);
-            }));
+            // Notify listeners of the rows that changed.
+            OnFindSessionsComplete(true);
 
-    // Search for all sessions.
-    if (!Session->FindSessions(this->LocalUserNum, SearchObject))
+            // Measure the pings the backend didn't, streaming each batch to listeners as it arrives.
+            StartSessionPings();
+        });
+}
+
+void UMOS_GameInstanceSubsystem::ApplyFindSessionsResults(const TArray<FOnlineSessionSearchResult> &SearchResults)
+{
+    TArray<FMOSSessionsSearchResult> NewResults;
+    TMap<FString, int32> NewIndexById;
+    NewResults.Reserve(SearchResults.Num());
+    NewIndexById.Reserve(SearchResults.Num());
+    PendingFindSessionChangedRows.Reset();
+    PendingFindSessionRemovedIds.Reset();
+
+    for (const auto &Row : SearchResults)
     {
-        Result->OnResult(true, TArray<FMOSSessionsSearchResult>(), TEXT("FindSessions call failed to start."));
-        Session->ClearOnFindSessionsCompleteDelegate_Handle(*CallbackHandle);
+        if (!Row.Session.SessionInfo.IsValid())
+        {
+            continue;
+        }
+
+        FString SessionId = Row.GetSessionIdStr();
+        if (NewIndexById.Contains(SessionId))
+        {
+            continue;
+        }
+
+        // Keep the last measured ping until the row is probed again; the backend often doesn't report one.
+        const int32 *MeasuredPing = MeasuredSessionPings.Find(SessionId);
+        int32 PingInMs = MeasuredPing != nullptr ? *MeasuredPing : Row.PingInMs;
+
+        // Only rows that are new, or whose visible columns differ from the cached row, get broadcast.
+        bool bChanged = true;
+        if (const auto *ExistingIndex = CachedFindSessionIndexById.Find(SessionId))
+        {
+            const auto &Existing = CachedFindSessionResults[*ExistingIndex];
+            const auto &ExistingSession = Existing.SessionSearchResult.Session;
+            bChanged = Existing.PingInMs != PingInMs ||
+                       ExistingSession.NumOpenPublicConnections != Row.Session.NumOpenPublicConnections ||
+                       ExistingSession.OwningUserName != Row.Session.OwningUserName ||
+                       ExistingSession.SessionSettings.SessionIdOverride != Row.Session.SessionSettings.SessionIdOverride;
+        }
+
+        FMOSSessionsSearchResult &Entry = NewResults.AddDefaulted_GetRef();
+        Entry.SessionSearchResult = Row;
+        Entry.SessionSearchResult.PingInMs = PingInMs;
+        Entry.PingInMs = PingInMs;
+        int32 NewIndex = NewResults.Num() - 1;
+        NewIndexById.Add(MoveTemp(SessionId), NewIndex);
+        if (bChanged)
+        {
+            PendingFindSessionChangedRows.Add(NewIndex);
+        }
+    }
+
+    for (const auto &KV : CachedFindSessionIndexById)
+    {
+        if (!NewIndexById.Contains(KV.Key))
+        {
+            PendingFindSessionRemovedIds.Add(KV.Key);
+            MeasuredSessionPings.Remove(KV.Key);
+        }
+    }
+
+    CachedFindSessionResults = MoveTemp(NewResults);
+    CachedFindSessionIndexById = MoveTemp(NewIndexById);
+    SortCachedFindSessionResults();
+    LastFindSessionsTime = FPlatformTime::Seconds();
+}
+
+void UMOS_GameInstanceSubsystem::SortCachedFindSessionResults()
+{
+    // @note: Stable, so rows with the same ping (including unreachable ones) stay in the backend's order.
+    TArray<int32> Order;
+    Order.Reserve(CachedFindSessionResults.Num());
+    for (int32 Index = 0; Index < CachedFindSessionResults.Num(); Index++)
+    {
+        Order.Add(Index);
+    }
+    Order.StableSort([this](int32 A, int32 B) {
+        return CachedFindSessionResults[A].PingInMs < CachedFindSessionResults[B].PingInMs;
+    });
+
+    TArray<FMOSSessionsSearchResult> Sorted;
+    TArray<int32> NewIndexOf;
+    Sorted.Reserve(Order.Num());
+    NewIndexOf.SetNumUninitialized(Order.Num());
+    for (int32 NewIndex = 0; NewIndex < Order.Num(); NewIndex++)
+    {
+        NewIndexOf[Order[NewIndex]] = NewIndex;
+        Sorted.Add(MoveTemp(CachedFindSessionResults[Order[NewIndex]]));
+    }
+    CachedFindSessionResults = MoveTemp(Sorted);
+
+    // Row indices held elsewhere have to follow their rows.
+    for (auto &KV : CachedFindSessionIndexById)
+    {
+        KV.Value = NewIndexOf[KV.Value];
+    }
+    for (int32 &RowIndex : PendingFindSessionChangedRows)
+    {
+        RowIndex = NewIndexOf[RowIndex];
     }
 }
 
+void UMOS_GameInstanceSubsystem::StartSessionPings()
+{
+    SessionPingProber.Cancel();
+    EndOnlineSpan(SessionPingSpan, false);
+    if (!bProbeSessionPings || CachedFindSessionResults.Num() == 0)
+    {
+        return;
+    }
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        return;
+    }
+    auto Session = OSS->GetSessionInterface();
+    if (!Session.IsValid())
+    {
+        return;
+    }
+
+    // Probe each host at its game address, but on the ping port.
+    // @note: Only hosts with an IPv4 address can be probed. EOS P2P sessions have no IP address, since their connect
+    // string names the host's product user and socket, and a UDP probe can't reach them; they're skipped and keep
+    // the ping the search reported.
+    TArray<TPair<FString, FString>> Hosts;
+    Hosts.Reserve(CachedFindSessionResults.Num());
+    int32 SkippedHosts = 0;
+    for (const auto &Row : CachedFindSessionResults)
+    {
+        FString ConnectString;
+        FString ProbeAddress;
+        if (!Session->GetResolvedConnectString(Row.SessionSearchResult, NAME_GamePort, ConnectString) ||
+            !OSS::OnlineAPI::FSessionPingProber::GetProbeAddress(ConnectString, SessionPingPort, ProbeAddress))
+        {
+            SkippedHosts++;
+            continue;
+        }
+        Hosts.Emplace(Row.SessionSearchResult.GetSessionIdStr(), MoveTemp(ProbeAddress));
+    }
+    if (SkippedHosts > 0)
+    {
+        DP_LOG(
+            MOSGameInstanceSubsystem,
+            Verbose,
+            "Not probing the ping of %d session hosts without an IPv4 address (e.g. P2P sessions).",
+            SkippedHosts);
+    }
+
+    SessionPingSpan = BeginOnlineSpan(TEXT("Sessions.Ping"));
+    SessionPingProber.MaxInFlight = MaxConcurrentSessionPings;
+    SessionPingProber.AttemptTimeoutSeconds = SessionPingTimeoutSeconds;
+    SessionPingProber.Start(
+        Hosts,
+        [this](const OSS::OnlineAPI::FSessionPingProber::FPingBatch &Pings) {
+            ApplySessionPings(Pings);
+        },
+        [this]() {
+            EndOnlineSpan(SessionPingSpan, true);
+        });
+}
+
+void UMOS_GameInstanceSubsystem::ApplySessionPings(const OSS::OnlineAPI::FSessionPingProber::FPingBatch &Pings)
+{
+    TArray<FString> ChangedIds;
+    for (const auto &Ping : Pings)
+    {
+        MeasuredSessionPings.Add(Ping.Key, Ping.Value);
+        const int32 *Index = CachedFindSessionIndexById.Find(Ping.Key);
+        if (Index == nullptr || CachedFindSessionResults[*Index].PingInMs == Ping.Value)
+        {
+            continue;
+        }
+        auto &Row = CachedFindSessionResults[*Index];
+        Row.PingInMs = Ping.Value;
+        Row.SessionSearchResult.PingInMs = Ping.Value;
+        ChangedIds.Add(Ping.Key);
+    }
+    if (ChangedIds.Num() == 0)
+    {
+        return;
+    }
+
+    // Re-sort once per batch, then let listeners update the changed rows and re-read the list in its new order.
+    SortCachedFindSessionResults();
+    for (const FString &SessionId : ChangedIds)
+    {
+        const auto &SessionResult = CachedFindSessionResults[CachedFindSessionIndexById[SessionId]];
+        const auto &Session = SessionResult.SessionSearchResult.Session;
+        UpdateFindSessionListDelegate.Broadcast(
+            SessionResult,
+            Session.SessionSettings.SessionIdOverride,
+            Session.OwningUserName,
+            SessionResult.PingInMs,
+            Session.NumOpenPublicConnections);
+    }
+    UpdateSessionListCompleteDelegate.Broadcast();
+}
+
+const FMOSSessionsSearchResult *UMOS_GameInstanceSubsystem::FindCachedSessionResult(const FString &SessionId) const
+{
+    const auto *Index = CachedFindSessionIndexById.Find(SessionId);
+    return Index != nullptr ? &CachedFindSessionResults[*Index] : nullptr;
+}
+
 void UMOS_GameInstanceSubsystem::OnFindSessionsComplete(bool bWasSuccessful)
 {
-    int32 Ping = 999;
-    FString OwningUserName = "Blank User";
-    int32 NumOpenPublicConnections = 0;
-    FString SessionIdOverride = "MOS_Session";
-    
-    for (auto SessionResult : CachedFindSessionResults)
+    for (const FString &SessionId : PendingFindSessionRemovedIds)
     {
-        Ping = SessionResult.PingInMs;
-        OwningUserName = SessionResult.SessionSearchResult.Session.OwningUserName;
-        NumOpenPublicConnections = SessionResult.SessionSearchResult.Session.NumOpenPublicConnections;
-        SessionIdOverride = SessionResult.SessionSearchResult.Session.SessionSettings.SessionIdOverride;
-        
-        UpdateFindSessionListDelegate.Broadcast(SessionResult, SessionIdOverride, OwningUserName, Ping, NumOpenPublicConnections);
+        RemoveFindSessionListDelegate.Broadcast(SessionId);
     }
+
+    for (int32 RowIndex : PendingFindSessionChangedRows)
+    {
+        const auto &SessionResult = CachedFindSessionResults[RowIndex];
+        const auto &Session = SessionResult.SessionSearchResult.Session;
+        UpdateFindSessionListDelegate.Broadcast(
+            SessionResult,
+            Session.SessionSettings.SessionIdOverride,
+            Session.OwningUserName,
+            SessionResult.PingInMs,
+            Session.NumOpenPublicConnections);
+    }
+
+    PendingFindSessionChangedRows.Reset();
+    PendingFindSessionRemovedIds.Reset();
     UpdateSessionListCompleteDelegate.Broadcast();
 }
 
+void UMOS_GameInstanceSubsystem::InvalidateSessionBrowserCache()
+{
+    LastFindSessionsTime = 0.0;
+}
+
+void UMOS_GameInstanceSubsystem::StartSessionBrowserRefresh()
+{
+    if (SessionBrowserRefreshHandle.IsValid() || SessionBrowserRefreshIntervalSeconds <= 0.0f)
+    {
+        return;
+    }
+
+    SessionBrowserRefreshHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateWeakLambda(
+            this,
+            [this](float) {
+                // @note: Skip this tick if a search is still running, rather than stacking another one behind it.
+                if (FindSessionsInFlight == 0)
+                {
+                    FindSessionsInternal(nullptr);
+                }
+                return true;
+            }),
+        SessionBrowserRefreshIntervalSeconds);
+}
+
+void UMOS_GameInstanceSubsystem::StopSessionBrowserRefresh()
+{
+    if (SessionBrowserRefreshHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SessionBrowserRefreshHandle);
+        SessionBrowserRefreshHandle.Reset();
+    }
+}
+
 void UMOS_GameInstanceSubsystem::ExecuteSessionsStartListenServer(int32 InAvailableSlots)
 {
     // We need somewhere to store session settings between the main menu and multiplayer map, so that when CreateSession
@@ -165,7 +458,10 @@ void UMOS_GameInstanceSubsystem::StartListenServer(int32 InAvailableSlots)
         return;
     }
     // Listen for the map start.
-
+    EndOnlineSpan(HostFlowSpan, false);
+    EndOnlineSpan(ListenSpan, false);
+    HostFlowSpan = BeginOnlineSpan(TEXT("Flow.Host"));
+    ListenSpan = BeginOnlineSpan(TEXT("Sessions.OpenListenLevel"));
     WorldInitHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UMOS_GameInstanceSubsystem::OnMapListening);
 
     // Figure out the world context from the online subsystem.
@@ -194,16 +490,25 @@ void UMOS_GameInstanceSubsystem::OnMapListening(const UWorld::FActorsInitialized
     if (!IsValid(NetDriver))
     {
         FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitHandle);
+        EndOnlineSpan(ListenSpan, false);
+        EndOnlineSpan(HostFlowSpan, false);
         return;
     }
 
     if (NetDriver->GetNetMode() != ENetMode::NM_ListenServer)
     {
         FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitHandle);
+        EndOnlineSpan(ListenSpan, false);
+        EndOnlineSpan(HostFlowSpan, false);
         return;
     }
 
     DP_LOG(MOSGameInstanceSubsystem, Log, "Successfully started listen server");
+    EndOnlineSpan(ListenSpan, true);
+    if (bProbeSessionPings)
+    {
+        SessionPingResponder.Start(SessionPingPort);
+    }
     FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitHandle);
     WorldInitHandle.Reset();
 
@@ -213,7 +518,7 @@ void UMOS_GameInstanceSubsystem::OnMapListening(const UWorld::FActorsInitialized
 void UMOS_GameInstanceSubsystem::ExecuteSessionsCreateSession(FName SessionName, UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -221,9 +526,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsCreateSession(FName SessionName,
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -258,48 +563,63 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsCreateSession(FName SessionName,
     SessionSettings.Settings.Add(FName(TEXT("CustomSessionID")), FOnlineSessionSetting(CustomSessionName, EOnlineDataAdvertisementType::ViaOnlineService));
     SessionSettings.Set(SEARCH_KEYWORDS, FString("MOSSession"), EOnlineDataAdvertisementType::ViaOnlineService);
     
-    // Register an event so we can receive the create outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle = Session->AddOnCreateSessionCompleteDelegate_Handle(FOnCreateSessionCompleteDelegate::CreateWeakLambda(
-            this, [Session, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName]
-            (FName CallbackSessionName, bool bCallbackWasSuccessful)
-            {
-                // Check if this callback is for us.
-                if (!SessionName.IsEqual(CallbackSessionName))
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
-
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+    // Create the session.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.CreateSession"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName, SessionSettings](const auto &OnComplete) {
+            // Register an event so we can receive the create outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnCreateSessionCompleteDelegate_Handle(FOnCreateSessionCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](FName CallbackSessionName, bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
 
-                // Return the results.
-                ResultWk->OnResult(
-                    bCallbackWasSuccessful,
-                    bCallbackWasSuccessful ? TEXT("") : TEXT("Create session operation failed."));
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnCreateSessionCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(
+                        bCallbackWasSuccessful,
+                        bCallbackWasSuccessful ? TEXT("") : TEXT("Create session operation failed."));
+                }));
 
-                // Unregister this callback since we've handled the call we care about.
+            if (!Session->CreateSession(this->LocalUserNum, SessionName, SessionSettings))
+            {
                 Session->ClearOnCreateSessionCompleteDelegate_Handle(*CallbackHandle);
-            }));
+                OnComplete(false, TEXT("CreateSession call failed to start."));
+            }
+        },
+        [this, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            if (!bWasSuccessful)
+            {
+                EndOnlineSpan(HostFlowSpan, false);
+            }
 
-    // Create the session.
-    if (!Session->CreateSession(this->LocalUserNum, SessionName, SessionSettings))
-    {
-        Result->OnResult(true, TEXT("CreateSession call failed to start."));
-        Session->ClearOnCreateSessionCompleteDelegate_Handle(*CallbackHandle);
-    }
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the results.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::OnCreateSessionComplete(const FName InSessionName, const bool bWasSuccessful)
 {
     DP_LOG(MOSGameInstanceSubsystem, Log, "Create Session: %hs", bWasSuccessful ? "Success" : "Failed");
     DP_LOG(MOSGameInstanceSubsystem, Log, "Session Name: %s", *InSessionName.ToString());
+    if (!bWasSuccessful)
+    {
+        EndOnlineSpan(HostFlowSpan, false);
+    }
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
          DP_LOG(MOSGameInstanceSubsystem, Warning, "Online subsystem is not available.");
@@ -307,9 +627,9 @@ void UMOS_GameInstanceSubsystem::OnCreateSessionComplete(const FName InSessionNa
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
          DP_LOG(MOSGameInstanceSubsystem, Warning, "The local user is not signed in.");
@@ -338,6 +658,8 @@ void UMOS_GameInstanceSubsystem::OnCreateSessionComplete(const FName InSessionNa
             //Get the level path
             FString LevelPath = TravelLevel.ToString();
             
+            EndOnlineSpan(TravelSpan, false);
+            TravelSpan = BeginOnlineSpan(TEXT("Sessions.Travel"));
             GetWorld()->ServerTravel(LevelPath, true);
         }
     }
@@ -350,7 +672,7 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSession(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -358,9 +680,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSession(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -375,92 +697,83 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSession(
         return;
     }
 
-    FOnlineSessionSearchResult SelectedSession;
-     for (auto CurrentSession : SessionResults)
-     {
-         if (SearchResult.SessionSearchResult.GetSessionIdStr() == CurrentSession.Session.GetSessionIdStr())
-         {
-             SelectedSession.Session = SearchResult.SessionSearchResult.Session;
-             SelectedSession = SearchResult.SessionSearchResult;
-             SelectedSession.PingInMs = SearchResult.PingInMs;
-             break;
-         }
-     }
-
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle = Session->AddOnJoinSessionCompleteDelegate_Handle(FOnJoinSessionCompleteDelegate::CreateWeakLambda(
-        this,
-        [this, Session, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName](
-            FName CallbackSessionName,
-            EOnJoinSessionCompleteResult::Type CallbackResult) {
-            // Check if this callback is for us.
-            if (!SessionName.IsEqual(CallbackSessionName))
-            {
-                // This callback isn't for our call.
-                return;
-            }
+    // Look up the session in the browser cache.
+    const auto *CachedSession = FindCachedSessionResult(SearchResult.SessionSearchResult.GetSessionIdStr());
+    if (CachedSession == nullptr)
+    {
+        Result->OnResult(false, TEXT("No such search result exists."));
+        return;
+    }
+    FOnlineSessionSearchResult SelectedSession = CachedSession->SessionSearchResult;
 
-            // Make sure the result callback is still valid.
-            if (!ResultWk.IsValid())
+    // Join the session.
+    EndOnlineSpan(JoinFlowSpan, false);
+    JoinFlowSpan = BeginOnlineSpan(TEXT("Flow.Join"));
+    CallDispatcher.Run<>(
+        TEXT("Sessions.JoinSession"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName, SelectedSession](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnJoinSessionCompleteDelegate_Handle(FOnJoinSessionCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](
+                    FName CallbackSessionName,
+                    EOnJoinSessionCompleteResult::Type CallbackResult) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
+
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(CallbackResult == EOnJoinSessionCompleteResult::Success, GetJoinSessionErrorMessage(CallbackResult));
+                }));
+
+            if (!Session->JoinSession(this->LocalUserNum, SessionName, SelectedSession))
             {
-                return;
+                Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, TEXT("JoinSession call failed to start."));
             }
-
+        },
+        [this, Session, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName](
+            bool bWasSuccessful,
+            const FString &ErrorMessage) {
             // If we're not successful, return now.
-            if (CallbackResult != EOnJoinSessionCompleteResult::Success)
+            if (!bWasSuccessful)
             {
-                FString ErrorMessage;
-                switch (CallbackResult)
+                EndOnlineSpan(JoinFlowSpan, false);
+                if (ResultWk.IsValid())
                 {
-                case EOnJoinSessionCompleteResult::SessionIsFull:
-                    ErrorMessage = TEXT("SessionIsFull");
-                    break;
-                case EOnJoinSessionCompleteResult::SessionDoesNotExist:
-                    ErrorMessage = TEXT("SessionDoesNotExist");
-                    break;
-                case EOnJoinSessionCompleteResult::CouldNotRetrieveAddress:
-                    ErrorMessage = TEXT("CouldNotRetrieveAddress");
-                    break;
-                case EOnJoinSessionCompleteResult::AlreadyInSession:
-                    ErrorMessage = TEXT("AlreadyInSession");
-                    break;
-                case EOnJoinSessionCompleteResult::UnknownError:
-                    ErrorMessage = TEXT("UnknownError");
-                    break;
-                case EOnJoinSessionCompleteResult::Success:
-                default:
-                    break;
+                    ResultWk->OnResult(false, ErrorMessage);
                 }
-                ResultWk->OnResult(false, ErrorMessage);
-                Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
+                return;
+            }
+
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
                 return;
             }
 
             // @note: Not all subsystems require this, but after we join the session, now connect to the game server.
             FString ConnectInfo;
             Session->GetResolvedConnectString(SessionName, ConnectInfo);
+            EndOnlineSpan(TravelSpan, false);
+            TravelSpan = BeginOnlineSpan(TEXT("Sessions.Travel"));
             GEngine->SetClientTravel(this->GetWorld(), *ConnectInfo, TRAVEL_Absolute);
 
             // Return the results.
             ResultWk->OnResult(true, TEXT(""));
-
-            // Unregister this callback since we've handled the call we care about.
-            Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
-        }));
-
-    // Join the session.
-    if (!Session->JoinSession(this->LocalUserNum, SessionName, SelectedSession))
-    {
-        Result->OnResult(true, TEXT("JoinSession call failed to start."));
-        Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
-    }
+        });
 }
 
 void UMOS_GameInstanceSubsystem::OnJoinSessionComplete(FName InSessionName, EOnJoinSessionCompleteResult::Type Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr){return;}
     // Get the session interface, if the online subsystem supports it.
     auto Session = OSS->GetSessionInterface();
@@ -477,7 +790,7 @@ void UMOS_GameInstanceSubsystem::OnJoinSessionComplete(FName InSessionName, EOnJ
 void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSSessionsSearchResult &SearchResult, FName SessionName, UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -485,9 +798,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSS
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -508,35 +821,48 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSS
         return;
     }
 
-    FOnlineSessionSearchResult SelectedSession;
-    for (auto CurrentSession : SessionResults)
+    // Look up the session in the browser cache.
+    const auto *CachedSession = FindCachedSessionResult(SearchResult.SessionSearchResult.Session.GetSessionIdStr());
+    if (CachedSession == nullptr)
     {
-        if (SearchResult.SessionSearchResult.Session.GetSessionIdStr() == CurrentSession.Session.GetSessionIdStr())
-        {
-            SelectedSession.Session = SearchResult.SessionSearchResult.Session;
-            SelectedSession.PingInMs = SearchResult.PingInMs;
-            break;
-        }
+        Result->OnResult(false, TEXT("No such search result exists."));
+        return;
     }
+    FOnlineSessionSearchResult SelectedSession = CachedSession->SessionSearchResult;
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle = Session->AddOnJoinSessionCompleteDelegate_Handle(FOnJoinSessionCompleteDelegate::CreateWeakLambda(
-        this,
-        [this,
-         Session,
-         Identity,
-         UserId,
-         CallbackHandle,
-         ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result),
-         SessionName](FName CallbackSessionName, EOnJoinSessionCompleteResult::Type CallbackResult) {
-            // Check if this callback is for us.
-            if (!SessionName.IsEqual(CallbackSessionName))
+    // Join the session.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.JoinSession"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName, SelectedSession](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnJoinSessionCompleteDelegate_Handle(FOnJoinSessionCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](
+                    FName CallbackSessionName,
+                    EOnJoinSessionCompleteResult::Type CallbackResult) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
+
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(CallbackResult == EOnJoinSessionCompleteResult::Success, GetJoinSessionErrorMessage(CallbackResult));
+                }));
+
+            if (!Session->JoinSession(this->LocalUserNum, SessionName, SelectedSession))
             {
-                // This callback isn't for our call.
-                return;
+                Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, TEXT("JoinSession call failed to start."));
             }
-
+        },
+        [this, Session, UserId, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName](
+            bool bWasSuccessful,
+            const FString &ErrorMessage) {
             // Make sure the result callback is still valid.
             if (!ResultWk.IsValid())
             {
@@ -544,37 +870,14 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSS
             }
 
             // If we're not successful, return now.
-            if (CallbackResult != EOnJoinSessionCompleteResult::Success)
+            if (!bWasSuccessful)
             {
-                FString ErrorMessage;
-                switch (CallbackResult)
-                {
-                case EOnJoinSessionCompleteResult::SessionIsFull:
-                    ErrorMessage = TEXT("SessionIsFull");
-                    break;
-                case EOnJoinSessionCompleteResult::SessionDoesNotExist:
-                    ErrorMessage = TEXT("SessionDoesNotExist");
-                    break;
-                case EOnJoinSessionCompleteResult::CouldNotRetrieveAddress:
-                    ErrorMessage = TEXT("CouldNotRetrieveAddress");
-                    break;
-                case EOnJoinSessionCompleteResult::AlreadyInSession:
-                    ErrorMessage = TEXT("AlreadyInSession");
-                    break;
-                case EOnJoinSessionCompleteResult::UnknownError:
-                    ErrorMessage = TEXT("UnknownError");
-                    break;
-                case EOnJoinSessionCompleteResult::Success:
-                default:
-                    break;
-                }
                 ResultWk->OnResult(false, ErrorMessage);
-                Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
                 return;
             }
 
             // Get the online subsystem.
-            auto CallbackOSS = Online::GetSubsystem(this->GetWorld());
+            auto CallbackOSS = this->GetOnlineContext().OSS;
             if (CallbackOSS == nullptr)
             {
                 ResultWk->OnResult(false, TEXT("Online subsystem is not available."));
@@ -591,7 +894,7 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSS
 
             // Get the session ID.
             FString SessionId;
-            auto *CurrentSession = Session->GetNamedSession(CallbackSessionName);
+            auto *CurrentSession = Session->GetNamedSession(SessionName);
             if (CurrentSession != nullptr)
             {
                 SessionId = CurrentSession->GetSessionIdStr();
@@ -609,23 +912,16 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSS
                     break;
                 }
             }
-            if (!SelectedPartyId.IsValid())
+
+            // Update the party data, unless there's no party and we just join the game server.
+            if (SelectedPartyId.IsValid())
             {
-                // Just join the game server - there's no party.
-                FString ConnectInfo;
-                Session->GetResolvedConnectString(SessionName, ConnectInfo);
-                GEngine->SetClientTravel(this->GetWorld(), *ConnectInfo, TRAVEL_Absolute);
-                ResultWk->OnResult(true, TEXT(""));
-                Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
-                return;
+                CachedLastPartySessionId = SessionId;
+                auto PartyData = MakeShared<FOnlinePartyData>(*PartySystem->GetPartyData(*UserId, *SelectedPartyId, NAME_None));
+                PartyData->SetAttribute(TEXT("JoinSessionIdFromParty"), FVariantData(SessionId));
+                PartySystem->UpdatePartyData(*UserId, *SelectedPartyId, NAME_None, *PartyData);
             }
 
-            // Update the party data.
-            CachedLastPartySessionId = SessionId;
-            auto PartyData = MakeShared<FOnlinePartyData>(*PartySystem->GetPartyData(*UserId, *SelectedPartyId, NAME_None));
-            PartyData->SetAttribute(TEXT("JoinSessionIdFromParty"), FVariantData(SessionId));
-            PartySystem->UpdatePartyData(*UserId, *SelectedPartyId, NAME_None, *PartyData);
-
             // @note: Not all subsystems require this, but after we join the session, now connect to the game server.
             FString ConnectInfo;
             Session->GetResolvedConnectString(SessionName, ConnectInfo);
@@ -633,32 +929,22 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsJoinSessionWithParty(const FMOSS
 
             // Return the results.
             ResultWk->OnResult(true, TEXT(""));
-
-            // Unregister this callback since we've handled the call we care about.
-            Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
-        }));
-
-    // Join the session.
-    if (!Session->JoinSession(this->LocalUserNum, SessionName, SelectedSession))
-    {
-        Result->OnResult(true, TEXT("JoinSession call failed to start."));
-        Session->ClearOnJoinSessionCompleteDelegate_Handle(*CallbackHandle);
-    }
+        });
 }
 
 FString UMOS_GameInstanceSubsystem::GetSessionId(FName SessionName) const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TEXT("");
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return TEXT("");
@@ -683,16 +969,16 @@ FString UMOS_GameInstanceSubsystem::GetSessionId(FName SessionName) const
 TArray<FUniqueNetIdRepl> UMOS_GameInstanceSubsystem::GetSessionRegisteredPlayerIds(FName SessionName) const
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return TArray<FUniqueNetIdRepl>();
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         return TArray<FUniqueNetIdRepl>();
@@ -724,7 +1010,7 @@ TArray<FUniqueNetIdRepl> UMOS_GameInstanceSubsystem::GetSessionRegisteredPlayerI
 void UMOS_GameInstanceSubsystem::ExecuteSessionsStartSession(FName SessionName, UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -732,9 +1018,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsStartSession(FName SessionName,
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -749,48 +1035,55 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsStartSession(FName SessionName,
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        Session->AddOnStartSessionCompleteDelegate_Handle(FOnStartSessionCompleteDelegate::CreateWeakLambda(
-            this,
-            [Session, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName](
-                FName CallbackSessionName,
-                bool bCallbackWasSuccessful) {
-                // Check if this callback is for us.
-                if (!SessionName.IsEqual(CallbackSessionName))
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
-
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+    // Start the session.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.StartSession"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnStartSessionCompleteDelegate_Handle(FOnStartSessionCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](FName CallbackSessionName, bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
 
-                // Return the results.
-                ResultWk->OnResult(
-                    bCallbackWasSuccessful,
-                    bCallbackWasSuccessful ? TEXT("") : TEXT("Start session operation failed."));
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnStartSessionCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(
+                        bCallbackWasSuccessful,
+                        bCallbackWasSuccessful ? TEXT("") : TEXT("Start session operation failed."));
+                }));
 
-                // Unregister this callback since we've handled the call we care about.
+            if (!Session->StartSession(SessionName))
+            {
                 Session->ClearOnStartSessionCompleteDelegate_Handle(*CallbackHandle);
-            }));
+                OnComplete(false, TEXT("StartSession call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
 
-    // Start the session.
-    if (!Session->StartSession(SessionName))
-    {
-        Result->OnResult(true, TEXT("StartSession call failed to start."));
-        Session->ClearOnStartSessionCompleteDelegate_Handle(*CallbackHandle);
-    }
+            // Return the results.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteSessionsEndSession(FName SessionName, UMOS_AsyncResult *Result)
 {
+    // Write any queued stats and achievements now that the match is over.
+    FlushStatWrites();
+
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -798,9 +1091,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsEndSession(FName SessionName, UM
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -815,20 +1108,37 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsEndSession(FName SessionName, UM
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle = Session->AddOnEndSessionCompleteDelegate_Handle(FOnEndSessionCompleteDelegate::CreateWeakLambda(
-        this,
-        [Session, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName](
-            FName CallbackSessionName,
-            bool bCallbackWasSuccessful) {
-            // Check if this callback is for us.
-            if (!SessionName.IsEqual(CallbackSessionName))
+    // End the session.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.EndSession"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnEndSessionCompleteDelegate_Handle(FOnEndSessionCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](FName CallbackSessionName, bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
+
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnEndSessionCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(
+                        bCallbackWasSuccessful,
+                        bCallbackWasSuccessful ? TEXT("") : TEXT("End session operation failed."));
+                }));
+
+            if (!Session->EndSession(SessionName))
             {
-                // This callback isn't for our call.
-                return;
+                Session->ClearOnEndSessionCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, TEXT("EndSession call failed to start."));
             }
-
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
             // Make sure the result callback is still valid.
             if (!ResultWk.IsValid())
             {
@@ -836,26 +1146,14 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsEndSession(FName SessionName, UM
             }
 
             // Return the results.
-            ResultWk->OnResult(
-                bCallbackWasSuccessful,
-                bCallbackWasSuccessful ? TEXT("") : TEXT("End session operation failed."));
-
-            // Unregister this callback since we've handled the call we care about.
-            Session->ClearOnEndSessionCompleteDelegate_Handle(*CallbackHandle);
-        }));
-
-    // End the session.
-    if (!Session->EndSession(SessionName))
-    {
-        Result->OnResult(true, TEXT("EndSession call failed to start."));
-        Session->ClearOnEndSessionCompleteDelegate_Handle(*CallbackHandle);
-    }
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteSessionsOpenInviteUI(FName SessionName)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         return;
@@ -874,8 +1172,12 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsOpenInviteUI(FName SessionName)
 
 void UMOS_GameInstanceSubsystem::ExecuteSessionsDestroySession(FName SessionName, UMOS_AsyncResult *Result)
 {
+    // Write any queued stats and achievements now that the match is over.
+    FlushStatWrites();
+    SessionPingResponder.Stop();
+
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -883,9 +1185,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsDestroySession(FName SessionName
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -900,42 +1202,46 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsDestroySession(FName SessionName
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        Session->AddOnDestroySessionCompleteDelegate_Handle(FOnDestroySessionCompleteDelegate::CreateWeakLambda(
-            this,
-            [Session, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), SessionName](
-                FName CallbackSessionName,
-                bool bCallbackWasSuccessful) {
-                // Check if this callback is for us.
-                if (!SessionName.IsEqual(CallbackSessionName))
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
-
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+    // Destroy the session.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.DestroySession"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnDestroySessionCompleteDelegate_Handle(FOnDestroySessionCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](FName CallbackSessionName, bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
 
-                // Return the results.
-                ResultWk->OnResult(
-                    bCallbackWasSuccessful,
-                    bCallbackWasSuccessful ? TEXT("") : TEXT("Destroy session operation failed."));
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnDestroySessionCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(
+                        bCallbackWasSuccessful,
+                        bCallbackWasSuccessful ? TEXT("") : TEXT("Destroy session operation failed."));
+                }));
 
-                // Unregister this callback since we've handled the call we care about.
+            if (!Session->DestroySession(SessionName))
+            {
                 Session->ClearOnDestroySessionCompleteDelegate_Handle(*CallbackHandle);
-            }));
+                OnComplete(false, TEXT("DestroySession call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
 
-    // Destroy the session.
-    if (!Session->DestroySession(SessionName))
-    {
-        Result->OnResult(true, TEXT("DestroySession call failed to start."));
-        Session->ClearOnDestroySessionCompleteDelegate_Handle(*CallbackHandle);
-    }
+            // Return the results.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteSessionsRegisterPlayer(
@@ -945,7 +1251,7 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsRegisterPlayer(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -953,9 +1259,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsRegisterPlayer(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -970,43 +1276,49 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsRegisterPlayer(
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        Session->AddOnRegisterPlayersCompleteDelegate_Handle(FOnRegisterPlayersCompleteDelegate::CreateWeakLambda(
-            this,
-            [Session,
-             CallbackHandle,
-             ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result),
-             SessionName](FName CallbackSessionName, const TArray<FUniqueNetIdRef> &, bool bCallbackWasSuccessful) {
-                // Check if this callback is for us.
-                if (!SessionName.IsEqual(CallbackSessionName))
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
-
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+    // Register the player.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.RegisterPlayer"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName, PlayerId, bWasFromInvite](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnRegisterPlayersCompleteDelegate_Handle(FOnRegisterPlayersCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](
+                    FName CallbackSessionName,
+                    const TArray<FUniqueNetIdRef> &,
+                    bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
 
-                // Return the results.
-                ResultWk->OnResult(
-                    bCallbackWasSuccessful,
-                    bCallbackWasSuccessful ? TEXT("") : TEXT("RegisterPlayer operation failed."));
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnRegisterPlayersCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(
+                        bCallbackWasSuccessful,
+                        bCallbackWasSuccessful ? TEXT("") : TEXT("RegisterPlayer operation failed."));
+                }));
 
-                // Unregister this callback since we've handled the call we care about.
+            if (!Session->RegisterPlayer(SessionName, *PlayerId, bWasFromInvite))
+            {
                 Session->ClearOnRegisterPlayersCompleteDelegate_Handle(*CallbackHandle);
-            }));
+                OnComplete(false, TEXT("RegisterPlayer call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
 
-    // Register the player.
-    if (!Session->RegisterPlayer(SessionName, *PlayerId, bWasFromInvite))
-    {
-        Result->OnResult(true, TEXT("RegisterPlayer call failed to start."));
-        Session->ClearOnRegisterPlayersCompleteDelegate_Handle(*CallbackHandle);
-    }
+            // Return the results.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::OnRegisterPlayersComplete(FName SessionName, const TArray<FUniqueNetIdRef> &PlayerIds, bool bWasSuccessful)
@@ -1023,7 +1335,7 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsUnregisterPlayer(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -1031,9 +1343,9 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsUnregisterPlayer(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     if (!UserId.IsValid())
     {
         Result->OnResult(false, TEXT("The local user is not signed in."));
@@ -1048,43 +1360,49 @@ void UMOS_GameInstanceSubsystem::ExecuteSessionsUnregisterPlayer(
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        Session->AddOnUnregisterPlayersCompleteDelegate_Handle(FOnUnregisterPlayersCompleteDelegate::CreateWeakLambda(
-            this,
-            [Session,
-             CallbackHandle,
-             ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result),
-             SessionName](FName CallbackSessionName, const TArray<FUniqueNetIdRef> &, bool bCallbackWasSuccessful) {
-                // Check if this callback is for us.
-                if (!SessionName.IsEqual(CallbackSessionName))
-                {
-                    // This callback isn't for our call.
-                    return;
-                }
-
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
+    // Unregister the player.
+    CallDispatcher.Run<>(
+        TEXT("Sessions.UnregisterPlayer"),
+        OnlineCallTimeoutSeconds,
+        [this, Session, SessionName, PlayerId](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = Session->AddOnUnregisterPlayersCompleteDelegate_Handle(FOnUnregisterPlayersCompleteDelegate::CreateWeakLambda(
+                this,
+                [Session, CallbackHandle, SessionName, OnComplete](
+                    FName CallbackSessionName,
+                    const TArray<FUniqueNetIdRef> &,
+                    bool bCallbackWasSuccessful) {
+                    // Check if this callback is for us.
+                    if (!SessionName.IsEqual(CallbackSessionName))
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
 
-                // Return the results.
-                ResultWk->OnResult(
-                    bCallbackWasSuccessful,
-                    bCallbackWasSuccessful ? TEXT("") : TEXT("UnregisterPlayer operation failed."));
+                    // Unregister this callback since we've handled the call we care about.
+                    Session->ClearOnUnregisterPlayersCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(
+                        bCallbackWasSuccessful,
+                        bCallbackWasSuccessful ? TEXT("") : TEXT("UnregisterPlayer operation failed."));
+                }));
 
-                // Unregister this callback since we've handled the call we care about.
+            if (!Session->UnregisterPlayer(SessionName, *PlayerId))
+            {
                 Session->ClearOnUnregisterPlayersCompleteDelegate_Handle(*CallbackHandle);
-            }));
+                OnComplete(false, TEXT("UnregisterPlayer call failed to start."));
+            }
+        },
+        [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
 
-    // Register the player.
-    if (!Session->UnregisterPlayer(SessionName, *PlayerId))
-    {
-        Result->OnResult(true, TEXT("UnregisterPlayer call failed to start."));
-        Session->ClearOnUnregisterPlayersCompleteDelegate_Handle(*CallbackHandle);
-    }
+            // Return the results.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteSessionsReturnToMainMenu()
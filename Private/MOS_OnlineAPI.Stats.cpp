@@ -2,6 +2,7 @@
 
 #include "MultiplayerOnlineSubsystem/Public/MOS_GameInstanceSubsystem.h"
 
+#include "Interfaces/OnlineAchievementsInterface.h"
 #include "Interfaces/OnlineStatsInterface.h"
 #include "OnlineSubsystemUtils.h"
 
@@ -9,7 +10,7 @@
 void UMOS_GameInstanceSubsystem::ExecuteStatsQueryStats(UMOS_QueryStatsAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TArray<FMOSStatsStatState>(), TEXT("Online subsystem is not available."));
@@ -17,9 +18,9 @@ void UMOS_GameInstanceSubsystem::ExecuteStatsQueryStats(UMOS_QueryStatsAsyncResu
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the stats interface, if the online subsystem supports it.
@@ -30,47 +31,56 @@ void UMOS_GameInstanceSubsystem::ExecuteStatsQueryStats(UMOS_QueryStatsAsyncResu
         return;
     }
 
+    // Join any query that is already in flight instead of starting another one.
+    if (!StatsQueryStatsFlight.Join(Result, StatsQueryStatsMemoizeSeconds))
+    {
+        return;
+    }
+
     // Set the stat names we want to query.
     TArray<FString> StatNames;
     StatNames.Add(TEXT("TestLatest"));
     StatNames.Add(TEXT("TestScore"));
 
     // Query the stats.
-    Stats->QueryStats(
-        UserId.ToSharedRef(),
-        TArray<FUniqueNetIdRef>{UserId.ToSharedRef()},
-        StatNames,
-        FOnlineStatsQueryUsersStatsComplete::CreateWeakLambda(
-            this,
-            [UserId, ResultWk = TSoftObjectPtr<UMOS_QueryStatsAsyncResult>(Result)](
-                const FOnlineError &CallbackResult,
-                const TArray<TSharedRef<const FOnlineStatsUserStats>> &CallbackUsersStats) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return if the call failed.
-                if (!CallbackResult.bSucceeded || CallbackUsersStats.Num() == 0)
-                {
-                    ResultWk->OnResult(false, TArray<FMOSStatsStatState>(), TEXT("QueryStats call failed."));
-                    return;
-                }
+    CallDispatcher.Run<TArray<FMOSStatsStatState>>(
+        TEXT("Stats.QueryStats"),
+        OnlineCallTimeoutSeconds,
+        [this, Stats, UserId, StatNames](const auto &OnComplete) {
+            Stats->QueryStats(
+                UserId.ToSharedRef(),
+                TArray<FUniqueNetIdRef>{UserId.ToSharedRef()},
+                StatNames,
+                FOnlineStatsQueryUsersStatsComplete::CreateWeakLambda(
+                    this,
+                    [OnComplete](
+                        const FOnlineError &CallbackResult,
+                        const TArray<TSharedRef<const FOnlineStatsUserStats>> &CallbackUsersStats) {
+                        // Return if the call failed.
+                        if (!CallbackResult.bSucceeded || CallbackUsersStats.Num() == 0)
+                        {
+                            OnComplete(false, TArray<FMOSStatsStatState>(), TEXT("QueryStats call failed."));
+                            return;
+                        }
 
-                // Convert the results.
-                TArray<FMOSStatsStatState> Entries;
-                for (const auto &StatKV : CallbackUsersStats[0]->Stats)
-                {
-                    FMOSStatsStatState Entry;
-                    Entry.Name = StatKV.Key;
-                    int32 Value;
-                    StatKV.Value.GetValue(Value);
-                    Entry.CurrentValue = Value;
-                    Entries.Add(Entry);
-                }
-                ResultWk->OnResult(true, Entries, TEXT(""));
-            }));
+                        // Convert the results.
+                        TArray<FMOSStatsStatState> Entries;
+                        for (const auto &StatKV : CallbackUsersStats[0]->Stats)
+                        {
+                            FMOSStatsStatState Entry;
+                            Entry.Name = StatKV.Key;
+                            int32 Value;
+                            StatKV.Value.GetValue(Value);
+                            Entry.CurrentValue = Value;
+                            Entries.Add(Entry);
+                        }
+                        OnComplete(true, Entries, TEXT(""));
+                    }));
+        },
+        [this](bool bWasSuccessful, const TArray<FMOSStatsStatState> &Entries, const FString &ErrorMessage) {
+            // Return the result to everyone waiting on this query.
+            StatsQueryStatsFlight.Complete(bWasSuccessful, Entries, ErrorMessage);
+        });
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteStatsIngestStat(
@@ -79,7 +89,7 @@ void UMOS_GameInstanceSubsystem::ExecuteStatsIngestStat(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -87,9 +97,9 @@ void UMOS_GameInstanceSubsystem::ExecuteStatsIngestStat(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the stats interface, if the online subsystem supports it.
@@ -108,19 +118,258 @@ void UMOS_GameInstanceSubsystem::ExecuteStatsIngestStat(
             {StatName, FOnlineStatUpdate((int32)StatValue, FOnlineStatUpdate::EOnlineStatModificationType::Set)}}));
 
     // Update the stat.
-    Stats->UpdateStats(
-        UserId.ToSharedRef(),
-        NewStats,
-        FOnlineStatsUpdateStatsComplete::CreateWeakLambda(
-            this,
-            [ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](const FOnlineError &ResultState) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
+    CallDispatcher.Run<>(
+        TEXT("Stats.IngestStat"),
+        OnlineCallTimeoutSeconds,
+        [this, Stats, UserId, NewStats](const auto &OnComplete) {
+            Stats->UpdateStats(
+                UserId.ToSharedRef(),
+                NewStats,
+                FOnlineStatsUpdateStatsComplete::CreateWeakLambda(this, [OnComplete](const FOnlineError &ResultState) {
+                    OnComplete(ResultState.bSucceeded, ResultState.ToLogString());
+                }));
+        },
+        [this, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result)](bool bWasSuccessful, const FString &ErrorMessage) {
+            // The memoized stats no longer describe the backend, even if the write's outcome is unknown.
+            StatsQueryStatsFlight.Invalidate();
+
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the result.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
+}
+
+void UMOS_GameInstanceSubsystem::QueueStatsIngestStat(
+    const FString &StatName,
+    double StatValue,
+    EMOSStatAggregation Aggregation)
+{
+    if (!StatWriteBuffer.AddStat(StatName, StatValue, Aggregation))
+    {
+        DP_LOG(
+            MOSGameInstanceSubsystem,
+            Warning,
+            "Stat '%s' is already queued with a different aggregation; the write was dropped.",
+            *StatName);
+        return;
+    }
+
+    // Flush early if enough writes have piled up, unless we're backing off after a failure.
+    if (StatWriteBuffer.GetPendingCount() >= StatWriteFlushThreshold &&
+        (StatWriteFailureCount == 0 || FPlatformTime::Seconds() >= NextStatWriteFlushTime))
+    {
+        FlushStatWrites();
+    }
+}
+
+void UMOS_GameInstanceSubsystem::QueueAchievementsUnlockAchievement(const FString &Id)
+{
+    StatWriteBuffer.AddAchievement(Id);
+
+    // Flush early if enough writes have piled up, unless we're backing off after a failure.
+    if (StatWriteBuffer.GetPendingCount() >= StatWriteFlushThreshold &&
+        (StatWriteFailureCount == 0 || FPlatformTime::Seconds() >= NextStatWriteFlushTime))
+    {
+        FlushStatWrites();
+    }
+}
+
+bool UMOS_GameInstanceSubsystem::TickStatWrites(float DeltaTime)
+{
+    if (StatWriteBuffer.GetPendingCount() > 0 && FPlatformTime::Seconds() >= NextStatWriteFlushTime)
+    {
+        FlushStatWrites();
+    }
+
+    // @note: Journal at most once per tick, so that per-frame writes don't hit the disk every frame.
+    if (StatWriteBuffer.IsJournalDirty())
+    {
+        StatWriteBuffer.SaveJournal();
+    }
+    return true;
+}
+
+void UMOS_GameInstanceSubsystem::FlushStatWrites()
+{
+    // Get the online subsystem and the currently signed in user.
+    auto OSS = this->GetOnlineContext().OSS;
+    auto UserId = this->GetOnlineContext().UserId;
+    if (OSS == nullptr || !UserId.IsValid())
+    {
+        return;
+    }
+
+    // Take everything that's pending; if a flush is already running, the next tick picks up the rest.
+    OSS::OnlineAPI::FStatWriteBatch Batch;
+    uint64 FlushId = 0;
+    if (!StatWriteBuffer.BeginFlush(Batch, FlushId))
+    {
+        return;
+    }
+    StatWriteBuffer.SaveJournal();
+    NextStatWriteFlushTime = FPlatformTime::Seconds() + StatWriteFlushIntervalSeconds;
+
+    // Tracks the stats and achievements writes of this flush.
+    struct FFlushState
+    {
+        uint64 FlushId = 0;
+        int32 WritesRemaining = 0;
+        OSS::OnlineAPI::EStatFlushResult StatsResult = OSS::OnlineAPI::EStatFlushResult::Succeeded;
+        bool bStatsSent = false;
+        bool bStatsAnswered = false;
+        bool bAchievementsSucceeded = true;
+    };
+    auto Flush = MakeShared<FFlushState>();
+    Flush->FlushId = FlushId;
+    auto OnWriteComplete = [this, Flush]() {
+        if (--Flush->WritesRemaining > 0)
+        {
+            return;
+        }
+
+        if (!StatWriteBuffer.EndFlush(Flush->FlushId, Flush->StatsResult, Flush->bAchievementsSucceeded))
+        {
+            // @note: The buffer was reset since this flush began, e.g. by a logout; its writes were journaled for
+            // their owner, and this result must not touch the flush or backoff of whoever is signed in now.
+            return;
+        }
+        if (Flush->bStatsSent)
+        {
+            // The memoized stats no longer describe the backend, even if the write's outcome is unknown.
+            StatsQueryStatsFlight.Invalidate();
+        }
+        if (Flush->StatsResult == OSS::OnlineAPI::EStatFlushResult::Succeeded && Flush->bAchievementsSucceeded)
+        {
+            StatWriteFailureCount = 0;
+        }
+        else
+        {
+            // Back off before retrying the failed writes.
+            StatWriteFailureCount++;
+            float RetryDelay = FMath::Min(
+                StatWriteFlushIntervalSeconds * FMath::Pow(2.0f, static_cast<float>(FMath::Min(StatWriteFailureCount, 16))),
+                StatWriteMaxRetryDelaySeconds);
+            NextStatWriteFlushTime = FPlatformTime::Seconds() + RetryDelay;
+            DP_LOG(MOSGameInstanceSubsystem, Warning, "Stat write flush failed, retrying in %.0f seconds.", RetryDelay);
+        }
+        StatWriteBuffer.SaveJournal();
+    };
+
+    // @note: If the online subsystem doesn't support stats or achievements, those writes can never succeed, so they
+    // are dropped rather than retried forever.
+    auto Stats = OSS->GetStatsInterface();
+    auto Achievements = OSS->GetAchievementsInterface();
+    bool bWriteStats = Batch.Stats.Num() > 0 && Stats.IsValid();
+    bool bWriteAchievements = Batch.Achievements.Num() > 0 && Achievements.IsValid();
+    Flush->WritesRemaining = (bWriteStats ? 1 : 0) + (bWriteAchievements ? 1 : 0) + 1;
+
+    if (bWriteStats)
+    {
+        // Create one stat update map for the whole batch.
+        TMap<FString, FOnlineStatUpdate> Updates;
+        Updates.Reserve(Batch.Stats.Num());
+        for (const auto &KV : Batch.Stats)
+        {
+            FOnlineStatUpdate::EOnlineStatModificationType ModificationType;
+            switch (KV.Value.Aggregation)
+            {
+            case EMOSStatAggregation::Sum:
+                ModificationType = FOnlineStatUpdate::EOnlineStatModificationType::Sum;
+                break;
+            case EMOSStatAggregation::Max:
+                ModificationType = FOnlineStatUpdate::EOnlineStatModificationType::Largest;
+                break;
+            case EMOSStatAggregation::Latest:
+            default:
+                ModificationType = FOnlineStatUpdate::EOnlineStatModificationType::Set;
+                break;
+            }
+            Updates.Add(KV.Key, FOnlineStatUpdate((int32)KV.Value.Value, ModificationType));
+        }
+        TArray<FOnlineStatsUserUpdatedStats> NewStats;
+        NewStats.Add(FOnlineStatsUserUpdatedStats(UserId.ToSharedRef(), MoveTemp(Updates)));
+
+        CallDispatcher.Run<>(
+            TEXT("Stats.FlushStatWrites"),
+            OnlineCallTimeoutSeconds,
+            [this, Stats, UserId, NewStats, Flush](const auto &OnComplete) {
+                // Journal that the stats are sent before sending them, so a replay never counts a sum twice.
+                StatWriteBuffer.MarkStatsSent(Flush->FlushId);
+                StatWriteBuffer.SaveJournal();
+
+                // Update the stats.
+                Flush->bStatsSent = true;
+                Stats->UpdateStats(
+                    UserId.ToSharedRef(),
+                    NewStats,
+                    FOnlineStatsUpdateStatsComplete::CreateWeakLambda(
+                        this,
+                        [OnComplete, Flush](const FOnlineError &ResultState) {
+                            Flush->bStatsAnswered = true;
+                            OnComplete(ResultState.bSucceeded, ResultState.ToLogString());
+                        }));
+            },
+            [Flush, OnWriteComplete](bool bWasSuccessful, const FString &ErrorMessage) {
+                // @note: A timeout or a cancellation after the write was sent doesn't mean the backend didn't apply
+                // it, so the buffer is told the outcome is unknown rather than that it failed.
+                if (bWasSuccessful)
+                {
+                    Flush->StatsResult = OSS::OnlineAPI::EStatFlushResult::Succeeded;
+                }
+                else if (Flush->bStatsSent && !Flush->bStatsAnswered)
                 {
-                    return;
+                    Flush->StatsResult = OSS::OnlineAPI::EStatFlushResult::Unknown;
                 }
+                else
+                {
+                    Flush->StatsResult = OSS::OnlineAPI::EStatFlushResult::Failed;
+                }
+                OnWriteComplete();
+            });
+    }
+
+    if (bWriteAchievements)
+    {
+        // Create one "achievement write" object that unlocks every achievement in the batch.
+        auto WriteObject = MakeShared<FOnlineAchievementsWrite>();
+        for (const auto &Id : Batch.Achievements)
+        {
+#if REDPOINT_EXAMPLE_UE_5_5_OR_LATER
+            WriteObject->SetFloatStat(Id, 100.0f);
+#else
+            WriteObject->SetFloatStat(FName(*Id), 100.0f);
+#endif
+        }
 
-                // Return the result.
-                ResultWk->OnResult(ResultState.bSucceeded, ResultState.ToLogString());
-            }));
-}
\ No newline at end of file
+        CallDispatcher.Run<>(
+            TEXT("Achievements.FlushStatWrites"),
+            OnlineCallTimeoutSeconds,
+            [this, Achievements, UserId, WriteObject](const auto &OnComplete) {
+                // @note: WriteAchievements takes the write object by non-const reference.
+                FOnlineAchievementsWriteRef Write = WriteObject;
+
+                // Run the asynchronous call to unlock the achievements.
+                Achievements->WriteAchievements(
+                    *UserId,
+                    Write,
+                    FOnAchievementsWrittenDelegate::CreateWeakLambda(
+                        this,
+                        [OnComplete](const FUniqueNetId &, bool bWasSuccessful) {
+                            OnComplete(bWasSuccessful, bWasSuccessful ? TEXT("") : TEXT("WriteAchievements call failed."));
+                        }));
+            },
+            [Flush, OnWriteComplete](bool bWasSuccessful, const FString &ErrorMessage) {
+                Flush->bAchievementsSucceeded = bWasSuccessful;
+                OnWriteComplete();
+            });
+    }
+
+    // @note: Release the hold taken above, so the flush finishes here if neither write was started or both completed
+    // synchronously.
+    OnWriteComplete();
+}
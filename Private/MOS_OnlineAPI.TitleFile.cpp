@@ -9,7 +9,7 @@
 void UMOS_GameInstanceSubsystem::ExecuteTitleFileQueryFiles(UMOS_ListAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TArray<FMOSInterfaceListEntry>(), TEXT("Online subsystem is not available."));
@@ -17,9 +17,9 @@ void UMOS_GameInstanceSubsystem::ExecuteTitleFileQueryFiles(UMOS_ListAsyncResult
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the title file interface, if the online subsystem supports it.
@@ -33,49 +33,137 @@ void UMOS_GameInstanceSubsystem::ExecuteTitleFileQueryFiles(UMOS_ListAsyncResult
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle =
-        TitleFile->AddOnEnumerateFilesCompleteDelegate_Handle(FOnEnumerateFilesCompleteDelegate::CreateWeakLambda(
-            this,
-            [TitleFile, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_ListAsyncResult>(Result), UserId](
-                bool bCallbackWasSuccessful,
-                const FString &CallbackErrorMessage) {
-                // Make sure the result callback is still valid.
-                if (!ResultWk.IsValid())
-                {
-                    return;
-                }
-
-                // Return if the read failed.
-                if (!bCallbackWasSuccessful)
-                {
-                    ResultWk->OnResult(false, TArray<FMOSInterfaceListEntry>(), CallbackErrorMessage);
-                    TitleFile->ClearOnEnumerateFilesCompleteDelegate_Handle(*CallbackHandle);
-                    return;
-                }
-
-                // Otherwise, convert the results.
-                TArray<FMOSInterfaceListEntry> Entries;
-                TArray<FCloudFileHeader> TitleFileFiles;
-                TitleFile->GetFileList(TitleFileFiles);
-                for (const auto &TitleFileFile : TitleFileFiles)
-                {
-                    FMOSInterfaceListEntry Entry;
-                    Entry.Id = TitleFileFile.FileName;
-                    Entry.DisplayName = FText::FromString(TitleFileFile.FileName);
-                    Entries.Add(Entry);
-                }
-
-                // Return the results.
-                ResultWk->OnResult(true, Entries, TEXT(""));
-
-                // Unregister this callback since we've handled the call we care about.
-                TitleFile->ClearOnEnumerateFilesCompleteDelegate_Handle(*CallbackHandle);
-            }));
-
-    // Start the enumeration of title files.
-    TitleFile->EnumerateFiles(FPagedQuery(0, -1));
+    // Join any enumeration that is already in flight instead of starting another one.
+    if (!TitleFileQueryFilesFlight.Join(Result, TitleFileQueryFilesMemoizeSeconds))
+    {
+        return;
+    }
+
+    EnumerateTitleFiles([this](bool bWasSuccessful, const FString &ErrorMessage) {
+        // Convert the listing.
+        TArray<FMOSInterfaceListEntry> Entries;
+        if (bWasSuccessful)
+        {
+            Entries.Reserve(TitleFileCache.GetListedFileNames().Num());
+            for (const auto &FileName : TitleFileCache.GetListedFileNames())
+            {
+                FMOSInterfaceListEntry &Entry = Entries.AddDefaulted_GetRef();
+                Entry.Id = FileName;
+                Entry.DisplayName = FText::FromString(FileName);
+            }
+        }
+
+        // Return the result to everyone waiting on this enumeration.
+        TitleFileQueryFilesFlight.Complete(bWasSuccessful, Entries, ErrorMessage);
+    });
+}
+
+void UMOS_GameInstanceSubsystem::EnumerateTitleFiles(TFunction<void(bool, const FString &)> OnDone)
+{
+    auto OSS = this->GetOnlineContext().OSS;
+    auto TitleFile = OSS != nullptr ? OSS->GetTitleFileInterface() : IOnlineTitleFilePtr();
+    if (!TitleFile.IsValid())
+    {
+        OnDone(false, TEXT("Online subsystem does not support title file."));
+        return;
+    }
+
+    CallDispatcher.Run<>(
+        TEXT("TitleFile.QueryFiles"),
+        OnlineCallTimeoutSeconds,
+        [this, TitleFile](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                TitleFile->AddOnEnumerateFilesCompleteDelegate_Handle(FOnEnumerateFilesCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [this, TitleFile, CallbackHandle, OnComplete](bool bCallbackWasSuccessful, const FString &CallbackErrorMessage) {
+                        // Unregister this callback since we've handled the call we care about.
+                        TitleFile->ClearOnEnumerateFilesCompleteDelegate_Handle(*CallbackHandle);
+
+                        // Return if the read failed.
+                        if (!bCallbackWasSuccessful)
+                        {
+                            OnComplete(false, CallbackErrorMessage);
+                            return;
+                        }
+
+                        // Otherwise, keep the listing; its hashes decide which cached files are still current.
+                        TArray<FCloudFileHeader> TitleFileFiles;
+                        TitleFile->GetFileList(TitleFileFiles);
+                        TitleFileCache.SetListing(TitleFileFiles);
+                        OnComplete(true, TEXT(""));
+                    }));
+
+            // Start the enumeration of title files.
+            TitleFile->EnumerateFiles(FPagedQuery(0, -1));
+        },
+        MoveTemp(OnDone));
+}
+
+void UMOS_GameInstanceSubsystem::ReadTitleFile(
+    const FString &FileName,
+    TFunction<void(bool, const TSharedPtr<TArray<uint8>> &, const FString &)> OnDone)
+{
+    auto OSS = this->GetOnlineContext().OSS;
+    auto TitleFile = OSS != nullptr ? OSS->GetTitleFileInterface() : IOnlineTitleFilePtr();
+    if (!TitleFile.IsValid())
+    {
+        OnDone(false, nullptr, TEXT("Online subsystem does not support title file."));
+        return;
+    }
+
+    CallDispatcher.Run<TSharedPtr<TArray<uint8>>>(
+        TEXT("TitleFile.ReadFile"),
+        OnlineCallTimeoutSeconds,
+        [this, TitleFile, FileName](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle = TitleFile->AddOnReadFileCompleteDelegate_Handle(FOnReadFileCompleteDelegate::CreateWeakLambda(
+                this,
+                [this, TitleFile, CallbackHandle, OnComplete, FileName](
+                    bool bCallbackWasSuccessful,
+                    const FString &CallbackFileName) {
+                    // Check if this callback is for us.
+                    if (FileName != CallbackFileName)
+                    {
+                        // This callback isn't for our call.
+                        return;
+                    }
+
+                    // Unregister this callback since we've handled the call we care about.
+                    TitleFile->ClearOnReadFileCompleteDelegate_Handle(*CallbackHandle);
+
+                    // If the read failed, return now.
+                    if (!bCallbackWasSuccessful)
+                    {
+                        OnComplete(false, nullptr, TEXT("ReadFile call failed."));
+                        return;
+                    }
+
+                    // Take the file contents, then let the online subsystem free its own copy.
+                    auto Contents = MakeShared<TArray<uint8>>();
+                    bool bGotContents = TitleFile->GetFileContents(FileName, *Contents);
+                    TitleFile->ClearFile(FileName);
+                    if (!bGotContents)
+                    {
+                        OnComplete(false, nullptr, TEXT("GetFileContents call failed."));
+                        return;
+                    }
+
+                    // Cache the file for the next read.
+                    TitleFileCache.Store(FileName, Contents);
+                    OnComplete(true, Contents, TEXT(""));
+                }));
+
+            // Start reading the file.
+            if (!TitleFile->ReadFile(FileName))
+            {
+                TitleFile->ClearOnReadFileCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, nullptr, TEXT("ReadFile call failed to start."));
+            }
+        },
+        MoveTemp(OnDone));
 }
 
 void UMOS_GameInstanceSubsystem::ExecuteTitleFileReadStringFromFile(
@@ -83,7 +171,7 @@ void UMOS_GameInstanceSubsystem::ExecuteTitleFileReadStringFromFile(
     UMOS_ReadFileStringAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT(""), TEXT("Online subsystem is not available."));
@@ -91,9 +179,9 @@ void UMOS_GameInstanceSubsystem::ExecuteTitleFileReadStringFromFile(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the title file interface, if the online subsystem supports it.
@@ -104,57 +192,126 @@ void UMOS_GameInstanceSubsystem::ExecuteTitleFileReadStringFromFile(
         return;
     }
 
-    // Register an event so we can receive the outcome.
-    auto CallbackHandle = MakeShared<FDelegateHandle>();
-    *CallbackHandle = TitleFile->AddOnReadFileCompleteDelegate_Handle(FOnReadFileCompleteDelegate::CreateWeakLambda(
-        this,
-        [TitleFile,
-         CallbackHandle,
-         ResultWk = TSoftObjectPtr<UMOS_ReadFileStringAsyncResult>(Result),
-         FileName,
-         UserId](bool bCallbackWasSuccessful, const FString &CallbackFileName) {
-            // Check if this callback is for us.
-            if (FileName != CallbackFileName)
-            {
-                // This callback isn't for our call.
-                return;
-            }
+    // Serve the file from the cache if it holds the currently listed version.
+    TArrayView<const uint8> CachedContents;
+    if (TitleFileCache.Find(FileName, CachedContents))
+    {
+        Result->OnResult(
+            true,
+            FString(CachedContents.Num(), reinterpret_cast<const UTF8CHAR *>(CachedContents.GetData())),
+            TEXT(""));
+        return;
+    }
 
+    ReadTitleFile(
+        FileName,
+        [ResultWk = TSoftObjectPtr<UMOS_ReadFileStringAsyncResult>(Result)](
+            bool bWasSuccessful,
+            const TSharedPtr<TArray<uint8>> &Contents,
+            const FString &ErrorMessage) {
             // Make sure the result callback is still valid.
             if (!ResultWk.IsValid())
             {
                 return;
             }
 
-            // If the read failed, retur now.
-            if (!bCallbackWasSuccessful)
+            // Return the result, converting the UTF8 bytes straight into the string.
+            if (!bWasSuccessful)
             {
-                ResultWk->OnResult(false, TEXT(""), TEXT("ReadFile call failed."));
-                TitleFile->ClearOnReadFileCompleteDelegate_Handle(*CallbackHandle);
+                ResultWk->OnResult(false, TEXT(""), ErrorMessage);
                 return;
             }
+            ResultWk->OnResult(
+                true,
+                FString(Contents->Num(), reinterpret_cast<const UTF8CHAR *>(Contents->GetData())),
+                TEXT(""));
+        });
+}
+
+bool UMOS_GameInstanceSubsystem::GetTitleFileCachedContents(const FString &FileName, TArrayView<const uint8> &OutContents)
+{
+    return TitleFileCache.Find(FileName, OutContents);
+}
+
+void UMOS_GameInstanceSubsystem::ExecuteTitleFilePrefetchAll(UMOS_FileTransferAsyncResult *Result)
+{
+    // Get the online subsystem.
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        Result->OnResult(false, TEXT("Online subsystem is not available."));
+        return;
+    }
 
-            // Get the file contents.
-            TArray<uint8> FileContents;
-            if (!TitleFile->GetFileContents(FileName, FileContents))
+    // Refresh the listing first, so we know which cached files are still current.
+    EnumerateTitleFiles([this, ResultWk = TWeakObjectPtr<UMOS_FileTransferAsyncResult>(Result)](
+                            bool bWasSuccessful,
+                            const FString &ErrorMessage) {
+        if (!bWasSuccessful)
+        {
+            if (ResultWk.IsValid())
             {
-                ResultWk->OnResult(false, TEXT(""), TEXT("GetFileContents call failed."));
-                TitleFile->ClearOnReadFileCompleteDelegate_Handle(*CallbackHandle);
-                return;
+                ResultWk->OnResult(false, ErrorMessage);
             }
+            return;
+        }
 
-            // Return the result.
-            FUTF8ToTCHAR Data(reinterpret_cast<const ANSICHAR *>(FileContents.GetData()), FileContents.Num());
-            ResultWk->OnResult(true, FString(Data.Length(), Data.Get()), TEXT(""));
-
-            // Unregister this callback since we've handled the call we care about.
-            TitleFile->ClearOnReadFileCompleteDelegate_Handle(*CallbackHandle);
-        }));
+        // Work out which files aren't cached yet.
+        TArray<FString> Missing;
+        for (const auto &FileName : TitleFileCache.GetListedFileNames())
+        {
+            TArrayView<const uint8> CachedContents;
+            if (!TitleFileCache.Find(FileName, CachedContents))
+            {
+                Missing.Add(FileName);
+            }
+        }
+        if (Missing.Num() == 0)
+        {
+            if (ResultWk.IsValid())
+            {
+                ResultWk->OnProgress(1.0f);
+                ResultWk->OnResult(true, TEXT(""));
+            }
+            return;
+        }
 
-    // Start reading the file.
-    if (!TitleFile->ReadFile(FileName))
-    {
-        Result->OnResult(false, TEXT(""), TEXT("ReadFile call failed to start."));
-        TitleFile->ClearOnReadFileCompleteDelegate_Handle(*CallbackHandle);
-    }
-}
\ No newline at end of file
+        // Read them all at once; the call dispatcher bounds how many are actually in flight.
+        struct FPrefetchState
+        {
+            int32 FilesTotal = 0;
+            int32 FilesRemaining = 0;
+            bool bFailed = false;
+            FString ErrorMessage;
+        };
+        auto Prefetch = MakeShared<FPrefetchState>();
+        Prefetch->FilesTotal = Missing.Num();
+        Prefetch->FilesRemaining = Missing.Num();
+        for (const auto &FileName : Missing)
+        {
+            ReadTitleFile(
+                FileName,
+                [ResultWk, Prefetch](
+                    bool bReadWasSuccessful,
+                    const TSharedPtr<TArray<uint8>> &Contents,
+                    const FString &ReadErrorMessage) {
+                    if (!bReadWasSuccessful && !Prefetch->bFailed)
+                    {
+                        Prefetch->bFailed = true;
+                        Prefetch->ErrorMessage = ReadErrorMessage;
+                    }
+                    Prefetch->FilesRemaining--;
+                    if (!ResultWk.IsValid())
+                    {
+                        return;
+                    }
+                    ResultWk->OnProgress(
+                        static_cast<float>(Prefetch->FilesTotal - Prefetch->FilesRemaining) / Prefetch->FilesTotal);
+                    if (Prefetch->FilesRemaining == 0)
+                    {
+                        ResultWk->OnResult(!Prefetch->bFailed, Prefetch->ErrorMessage);
+                    }
+                });
+        }
+    });
+}
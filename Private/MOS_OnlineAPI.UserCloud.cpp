@@ -3,6 +3,12 @@
 #include "MultiplayerOnlineSubsystem/Public/MOS_GameInstanceSubsystem.h"
 
 #include "MultiplayerOnlineSubsystem/Public/MOS_SaveGame.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_UserCloudManifest.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_UserCloudStream.h"
+#include "DebugPlus/Public/DP_EnhancedLogging.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
 #include "Interfaces/OnlineUserCloudInterface.h"
 #include "Kismet/GameplayStatics.h"
 #include "OnlineSubsystemUtils.h"
@@ -11,7 +17,7 @@
 void UMOS_GameInstanceSubsystem::ExecuteUserCloudQueryFiles(UMOS_ListAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TArray<FMOSInterfaceListEntry>(), TEXT("Online subsystem is not available."));
@@ -19,9 +25,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudQueryFiles(UMOS_ListAsyncResult
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user cloud interface, if the online subsystem supports it.
@@ -36,11 +42,17 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudQueryFiles(UMOS_ListAsyncResult
     }
 
     // Register an event so we can receive the outcome.
+    uint64 ListingSerial = UserCloudManifest.BeginRemoteListing();
     auto CallbackHandle = MakeShared<FDelegateHandle>();
     *CallbackHandle = UserCloud->AddOnEnumerateUserFilesCompleteDelegate_Handle(
         FOnEnumerateUserFilesCompleteDelegate::CreateWeakLambda(
             this,
-            [UserCloud, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_ListAsyncResult>(Result), UserId](
+            [this,
+             UserCloud,
+             CallbackHandle,
+             ResultWk = TSoftObjectPtr<UMOS_ListAsyncResult>(Result),
+             UserId,
+             ListingSerial](
                 bool bCallbackWasSuccessful,
                 const FUniqueNetId &CallbackUserId) {
                 // Check if this callback is for us.
@@ -71,8 +83,19 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudQueryFiles(UMOS_ListAsyncResult
                 TArray<FMOSInterfaceListEntry> Entries;
                 TArray<FCloudFileHeader> UserCloudFiles;
                 UserCloud->GetUserFileList(*UserId, UserCloudFiles);
+
+                // Keep the remote hashes and sizes, so that sync can tell which files changed.
+                UserCloudManifest.UpdateRemoteListing(UserCloudFiles, ListingSerial);
+                UserCloudManifest.Save();
+
                 for (const auto &UserCloudFile : UserCloudFiles)
                 {
+                    // @note: Chunks of files uploaded by sync are an implementation detail.
+                    if (OSS::OnlineAPI::FUserCloudManifest::IsChunkFileName(UserCloudFile.FileName))
+                    {
+                        continue;
+                    }
+
                     FMOSInterfaceListEntry Entry;
                     Entry.Id = UserCloudFile.FileName;
                     Entry.DisplayName = FText::FromString(UserCloudFile.FileName);
@@ -96,7 +119,7 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteStringToFile(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -104,9 +127,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteStringToFile(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user cloud interface, if the online subsystem supports it.
@@ -117,16 +140,37 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteStringToFile(
         return;
     }
 
-    // Convert UTF8 string data to bytes.
-    FTCHARToUTF8 Data(*FileContents);
-    TArray<uint8> Bytes(reinterpret_cast<const uint8 *>(Data.Get()), Data.Length());
+    // Convert the string straight into UTF8 bytes, without an intermediate conversion buffer.
+    int32 Utf8Length = FPlatformString::ConvertedLength<UTF8CHAR>(*FileContents, FileContents.Len());
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(Utf8Length);
+    FPlatformString::Convert(
+        reinterpret_cast<UTF8CHAR *>(Bytes.GetData()),
+        Utf8Length,
+        *FileContents,
+        FileContents.Len());
+
+    // Skip the upload if a file listing confirms the cloud already holds exactly this content.
+    FSHAHash ContentHash = OSS::OnlineAPI::FUserCloudManifest::HashBytes(Bytes.GetData(), Bytes.Num());
+    if (this->IsUserCloudFileUnchanged(FileName, ContentHash))
+    {
+        Result->OnResult(true, TEXT(""));
+        return;
+    }
 
     // Register an event so we can receive the outcome.
     auto CallbackHandle = MakeShared<FDelegateHandle>();
     *CallbackHandle =
         UserCloud->AddOnWriteUserFileCompleteDelegate_Handle(FOnWriteUserFileCompleteDelegate::CreateWeakLambda(
             this,
-            [UserCloud, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), FileName, UserId](
+            [this,
+             UserCloud,
+             CallbackHandle,
+             ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result),
+             FileName,
+             UserId,
+             ContentHash,
+             ContentSize = Bytes.Num()](
                 bool bCallbackWasSuccessful,
                 const FUniqueNetId &CallbackUserId,
                 const FString &CallbackFileName) {
@@ -137,6 +181,14 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteStringToFile(
                     return;
                 }
 
+                // Remember what we uploaded, so the same content isn't uploaded again.
+                if (bCallbackWasSuccessful)
+                {
+                    UserCloudManifest.Record(FileName, ContentHash, ContentSize, false);
+                    DeleteUserCloudChunks(UserCloudManifest.SetFileChunks(FileName, {}));
+                    UserCloudManifest.Save();
+                }
+
                 // Make sure the result callback is still valid.
                 if (!ResultWk.IsValid())
                 {
@@ -166,7 +218,7 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteSaveGameToFile(
     UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -174,9 +226,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteSaveGameToFile(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user cloud interface, if the online subsystem supports it.
@@ -197,12 +249,27 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteSaveGameToFile(
         return;
     }
 
+    // Skip the upload if a file listing confirms the cloud already holds exactly this save.
+    FSHAHash ContentHash = OSS::OnlineAPI::FUserCloudManifest::HashBytes(SaveData.GetData(), SaveData.Num());
+    if (this->IsUserCloudFileUnchanged(FileName, ContentHash))
+    {
+        Result->OnResult(true, TEXT(""));
+        return;
+    }
+
     // Register an event so we can receive the outcome.
     auto CallbackHandle = MakeShared<FDelegateHandle>();
     *CallbackHandle =
         UserCloud->AddOnWriteUserFileCompleteDelegate_Handle(FOnWriteUserFileCompleteDelegate::CreateWeakLambda(
             this,
-            [UserCloud, CallbackHandle, ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result), FileName, UserId](
+            [this,
+             UserCloud,
+             CallbackHandle,
+             ResultWk = TSoftObjectPtr<UMOS_AsyncResult>(Result),
+             FileName,
+             UserId,
+             ContentHash,
+             ContentSize = SaveData.Num()](
                 bool bCallbackWasSuccessful,
                 const FUniqueNetId &CallbackUserId,
                 const FString &CallbackFileName) {
@@ -213,6 +280,14 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteSaveGameToFile(
                     return;
                 }
 
+                // Remember what we uploaded, so the same content isn't uploaded again.
+                if (bCallbackWasSuccessful)
+                {
+                    UserCloudManifest.Record(FileName, ContentHash, ContentSize, false);
+                    DeleteUserCloudChunks(UserCloudManifest.SetFileChunks(FileName, {}));
+                    UserCloudManifest.Save();
+                }
+
                 // Make sure the result callback is still valid.
                 if (!ResultWk.IsValid())
                 {
@@ -241,7 +316,7 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadStringFromFile(
     UMOS_ReadFileStringAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT(""), TEXT("Online subsystem is not available."));
@@ -249,9 +324,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadStringFromFile(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user cloud interface, if the online subsystem supports it.
@@ -302,9 +377,14 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadStringFromFile(
                     return;
                 }
 
-                // Return the result.
-                FUTF8ToTCHAR Data(reinterpret_cast<const ANSICHAR *>(FileContents.GetData()), FileContents.Num());
-                ResultWk->OnResult(true, FString(Data.Length(), Data.Get()), TEXT(""));
+                // Let the online subsystem free its own copy of the file.
+                UserCloud->ClearFile(*UserId, FileName);
+
+                // Return the result, converting the UTF8 bytes straight into the string.
+                ResultWk->OnResult(
+                    true,
+                    FString(FileContents.Num(), reinterpret_cast<const UTF8CHAR *>(FileContents.GetData())),
+                    TEXT(""));
 
                 // Unregister this callback since we've handled the call we care about.
                 UserCloud->ClearOnReadUserFileCompleteDelegate_Handle(*CallbackHandle);
@@ -323,7 +403,7 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadSaveGameFromFile(
     UMOS_ReadFileSaveGameAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, 0.0, TEXT("Online subsystem is not available."));
@@ -331,9 +411,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadSaveGameFromFile(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user cloud interface, if the online subsystem supports it.
@@ -405,4 +485,940 @@ void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadSaveGameFromFile(
         Result->OnResult(false, 0.0, TEXT("ReadUserFile call failed to start."));
         UserCloud->ClearOnReadUserFileCompleteDelegate_Handle(*CallbackHandle);
     }
-}
\ No newline at end of file
+}
+
+// Reports progress from a worker thread on the game thread.
+static void PostFileTransferProgress(const TWeakObjectPtr<UMOS_FileTransferAsyncResult> &ResultWk, float Progress)
+{
+    AsyncTask(ENamedThreads::GameThread, [ResultWk, Progress]() {
+        if (ResultWk.IsValid())
+        {
+            ResultWk->OnProgress(Progress);
+        }
+    });
+}
+
+void UMOS_GameInstanceSubsystem::ExecuteUserCloudWriteFileStreamed(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    bool bCompress,
+    UMOS_FileTransferAsyncResult *Result)
+{
+    // Get the online subsystem.
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        Result->OnResult(false, TEXT("Online subsystem is not available."));
+        return;
+    }
+
+    // Make sure the online subsystem supports user cloud.
+    if (!OSS->GetUserCloudInterface().IsValid())
+    {
+        Result->OnResult(false, TEXT("Online subsystem does not support user cloud."));
+        return;
+    }
+
+    int32 ChunkSize = FMath::Max(UserCloudStreamChunkSizeKB, 1) * 1024;
+    FName Format = bCompress ? OSS::OnlineAPI::FUserCloudStream::GetDefaultCompressionFormat() : NAME_None;
+
+    // Read and compress the local file on a worker thread; this is the first half of the progress.
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [WeakThis = TWeakObjectPtr<UMOS_GameInstanceSubsystem>(this),
+         ResultWk = TWeakObjectPtr<UMOS_FileTransferAsyncResult>(Result),
+         FileName,
+         LocalFilePath,
+         Format,
+         ChunkSize]() {
+            auto Payload = MakeShared<TArray<uint8>>();
+            FString ErrorMessage;
+            bool bEncoded = false;
+            TUniquePtr<FArchive> Source(IFileManager::Get().CreateFileReader(*LocalFilePath));
+            if (!Source.IsValid())
+            {
+                ErrorMessage = TEXT("Unable to open the local file.");
+            }
+            else
+            {
+                bEncoded = OSS::OnlineAPI::FUserCloudStream::Encode(
+                    *Source,
+                    Format,
+                    ChunkSize,
+                    *Payload,
+                    [&ResultWk](int64 BytesDone, int64 BytesTotal) {
+                        PostFileTransferProgress(ResultWk, 0.5f * BytesDone / FMath::Max<int64>(BytesTotal, 1));
+                    },
+                    ErrorMessage);
+                Source->Close();
+            }
+
+            // Upload the encoded file from the game thread.
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, ResultWk, FileName, Payload, bEncoded, ErrorMessage]() {
+                if (!WeakThis.IsValid() || !ResultWk.IsValid())
+                {
+                    return;
+                }
+                if (!bEncoded)
+                {
+                    ResultWk->OnResult(false, ErrorMessage);
+                    return;
+                }
+                WeakThis->UploadUserCloudPayload(FileName, Payload, ResultWk.Get());
+            });
+        });
+}
+
+void UMOS_GameInstanceSubsystem::UploadUserCloudPayload(
+    const FString &FileName,
+    const TSharedRef<TArray<uint8>> &Payload,
+    UMOS_FileTransferAsyncResult *Result)
+{
+    // The user may have signed out while the file was being encoded.
+    auto OSS = this->GetOnlineContext().OSS;
+    auto UserId = this->GetOnlineContext().UserId;
+    auto UserCloud = OSS != nullptr ? OSS->GetUserCloudInterface() : IOnlineUserCloudPtr();
+    if (!UserId.IsValid() || !UserCloud.IsValid())
+    {
+        Result->OnResult(false, TEXT("The local user is not signed in."));
+        return;
+    }
+
+    CallDispatcher.Run<>(
+        TEXT("UserCloud.WriteFileStreamed"),
+        GetUserCloudTransferTimeout(Payload->Num()),
+        [this, UserCloud, UserId, FileName, Payload, ResultWk = TWeakObjectPtr<UMOS_FileTransferAsyncResult>(Result)](
+            const auto &OnComplete) {
+            // Register events so we can receive the upload progress and outcome.
+            int32 PayloadSize = FMath::Max(Payload->Num(), 1);
+            auto ProgressHandle = MakeShared<FDelegateHandle>();
+            *ProgressHandle =
+                UserCloud->AddOnWriteUserFileProgressDelegate_Handle(FOnWriteUserFileProgressDelegate::CreateWeakLambda(
+                    this,
+                    [ResultWk, FileName, UserId, PayloadSize](
+                        int32 BytesWritten,
+                        const FUniqueNetId &CallbackUserId,
+                        const FString &CallbackFileName) {
+                        // Check if this callback is for us.
+                        if (*UserId != CallbackUserId || FileName != CallbackFileName || !ResultWk.IsValid())
+                        {
+                            return;
+                        }
+
+                        // The upload is the second half of the progress.
+                        ResultWk->OnProgress(0.5f + 0.5f * BytesWritten / PayloadSize);
+                    }));
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                UserCloud->AddOnWriteUserFileCompleteDelegate_Handle(FOnWriteUserFileCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [UserCloud, CallbackHandle, ProgressHandle, FileName, UserId, OnComplete](
+                        bool bCallbackWasSuccessful,
+                        const FUniqueNetId &CallbackUserId,
+                        const FString &CallbackFileName) {
+                        // Check if this callback is for us.
+                        if (*UserId != CallbackUserId || FileName != CallbackFileName)
+                        {
+                            // This callback isn't for our call.
+                            return;
+                        }
+
+                        // Unregister these callbacks since we've handled the call we care about.
+                        UserCloud->ClearOnWriteUserFileProgressDelegate_Handle(*ProgressHandle);
+                        UserCloud->ClearOnWriteUserFileCompleteDelegate_Handle(*CallbackHandle);
+
+                        // Return the result.
+                        OnComplete(
+                            bCallbackWasSuccessful,
+                            bCallbackWasSuccessful ? TEXT("") : TEXT("WriteUserFile call failed."));
+                    }));
+
+            // Start writing the file.
+            if (!UserCloud->WriteUserFile(*UserId, FileName, *Payload, false))
+            {
+                UserCloud->ClearOnWriteUserFileProgressDelegate_Handle(*ProgressHandle);
+                UserCloud->ClearOnWriteUserFileCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, TEXT("WriteUserFile call failed to start."));
+            }
+        },
+        [ResultWk = TWeakObjectPtr<UMOS_FileTransferAsyncResult>(Result)](
+            bool bWasSuccessful,
+            const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+
+            // Return the result.
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        });
+}
+
+void UMOS_GameInstanceSubsystem::ExecuteUserCloudReadFileStreamed(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    UMOS_FileTransferAsyncResult *Result)
+{
+    // Get the online subsystem.
+    auto OSS = this->GetOnlineContext().OSS;
+    if (OSS == nullptr)
+    {
+        Result->OnResult(false, TEXT("Online subsystem is not available."));
+        return;
+    }
+
+    // Get the identity interface and the currently signed in user.
+    auto Identity = this->GetOnlineContext().Identity;
+    checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
+    auto UserId = this->GetOnlineContext().UserId;
+    checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
+
+    // Get the user cloud interface, if the online subsystem supports it.
+    auto UserCloud = OSS->GetUserCloudInterface();
+    if (!UserCloud.IsValid())
+    {
+        Result->OnResult(false, TEXT("Online subsystem does not support user cloud."));
+        return;
+    }
+
+    ReadUserCloudFile(
+        FileName,
+        [ResultWk = TWeakObjectPtr<UMOS_FileTransferAsyncResult>(Result), LocalFilePath](
+            bool bWasSuccessful,
+            const TSharedPtr<TArray<uint8>> &Contents,
+            const FString &ErrorMessage) {
+            // Make sure the result callback is still valid.
+            if (!ResultWk.IsValid())
+            {
+                return;
+            }
+            if (!bWasSuccessful)
+            {
+                ResultWk->OnResult(false, ErrorMessage);
+                return;
+            }
+
+            // The download is the first half of the progress; decompress into the local file on a worker thread.
+            ResultWk->OnProgress(0.5f);
+            AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [ResultWk, LocalFilePath, Contents]() {
+                FString DecodeError;
+                bool bDecoded = false;
+                TUniquePtr<FArchive> Destination(IFileManager::Get().CreateFileWriter(*LocalFilePath));
+                if (!Destination.IsValid())
+                {
+                    DecodeError = TEXT("Unable to open the local file for writing.");
+                }
+                else
+                {
+                    bDecoded = OSS::OnlineAPI::FUserCloudStream::Decode(
+                        *Contents,
+                        *Destination,
+                        [&ResultWk](int64 BytesDone, int64 BytesTotal) {
+                            PostFileTransferProgress(
+                                ResultWk,
+                                0.5f + 0.5f * BytesDone / FMath::Max<int64>(BytesTotal, 1));
+                        },
+                        DecodeError);
+                    bDecoded &= Destination->Close();
+                }
+
+                // Return the result on the game thread.
+                AsyncTask(ENamedThreads::GameThread, [ResultWk, bDecoded, DecodeError]() {
+                    if (ResultWk.IsValid())
+                    {
+                        ResultWk->OnResult(bDecoded, DecodeError);
+                    }
+                });
+            });
+        });
+}
+
+bool UMOS_GameInstanceSubsystem::IsUserCloudFileUnchanged(const FString &FileName, const FSHAHash &ContentHash) const
+{
+    const auto *Entry = UserCloudManifest.Find(FileName);
+    return Entry != nullptr && Entry->ContentHash == ContentHash && UserCloudManifest.IsRemoteCurrent(FileName);
+}
+
+float UMOS_GameInstanceSubsystem::GetUserCloudTransferTimeout(int64 Bytes) const
+{
+    // Large files can legitimately take minutes to move, so scale the timeout with the size instead of using the one
+    // for ordinary online calls.
+    if (UserCloudTransferMinKBPerSecond <= 0.0f || OnlineCallTimeoutSeconds <= 0.0f)
+    {
+        return 0.0f;
+    }
+    return OnlineCallTimeoutSeconds + static_cast<float>(Bytes / 1024.0 / UserCloudTransferMinKBPerSecond);
+}
+
+void UMOS_GameInstanceSubsystem::ReadUserCloudFile(
+    const FString &FileName,
+    TFunction<void(bool, const TSharedPtr<TArray<uint8>> &, const FString &)> OnDone)
+{
+    auto OSS = this->GetOnlineContext().OSS;
+    auto UserId = this->GetOnlineContext().UserId;
+    auto UserCloud = OSS != nullptr ? OSS->GetUserCloudInterface() : IOnlineUserCloudPtr();
+    if (!UserId.IsValid() || !UserCloud.IsValid())
+    {
+        OnDone(false, nullptr, TEXT("Online subsystem does not support user cloud."));
+        return;
+    }
+
+    // @note: The size comes from the last file listing; without one we can't tell how long the read may take.
+    int64 ExpectedSize = UserCloudManifest.GetRemoteSize(FileName);
+    CallDispatcher.Run<TSharedPtr<TArray<uint8>>>(
+        TEXT("UserCloud.ReadUserFile"),
+        ExpectedSize != INDEX_NONE ? GetUserCloudTransferTimeout(ExpectedSize) : 0.0f,
+        [this, UserCloud, UserId, FileName](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                UserCloud->AddOnReadUserFileCompleteDelegate_Handle(FOnReadUserFileCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [UserCloud, CallbackHandle, FileName, UserId, OnComplete](
+                        bool bCallbackWasSuccessful,
+                        const FUniqueNetId &CallbackUserId,
+                        const FString &CallbackFileName) {
+                        // Check if this callback is for us.
+                        if (*UserId != CallbackUserId || FileName != CallbackFileName)
+                        {
+                            // This callback isn't for our call.
+                            return;
+                        }
+
+                        // Unregister this callback since we've handled the call we care about.
+                        UserCloud->ClearOnReadUserFileCompleteDelegate_Handle(*CallbackHandle);
+
+                        // If the read failed, return now.
+                        if (!bCallbackWasSuccessful)
+                        {
+                            OnComplete(false, nullptr, TEXT("ReadUserFile call failed."));
+                            return;
+                        }
+
+                        // Take the file contents, then let the online subsystem free its own copy.
+                        auto Contents = MakeShared<TArray<uint8>>();
+                        bool bGotContents = UserCloud->GetFileContents(*UserId, FileName, *Contents);
+                        UserCloud->ClearFile(*UserId, FileName);
+                        if (!bGotContents)
+                        {
+                            OnComplete(false, nullptr, TEXT("GetFileContents call failed."));
+                            return;
+                        }
+                        OnComplete(true, Contents, TEXT(""));
+                    }));
+
+            // Start reading the file.
+            if (!UserCloud->ReadUserFile(*UserId, FileName))
+            {
+                UserCloud->ClearOnReadUserFileCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, nullptr, TEXT("ReadUserFile call failed to start."));
+            }
+        },
+        MoveTemp(OnDone));
+}
+
+void UMOS_GameInstanceSubsystem::WriteUserCloudFile(
+    const FString &FileName,
+    const TSharedRef<TArray<uint8>> &Contents,
+    TFunction<void(bool, const FString &)> OnDone)
+{
+    auto OSS = this->GetOnlineContext().OSS;
+    auto UserId = this->GetOnlineContext().UserId;
+    auto UserCloud = OSS != nullptr ? OSS->GetUserCloudInterface() : IOnlineUserCloudPtr();
+    if (!UserId.IsValid() || !UserCloud.IsValid())
+    {
+        OnDone(false, TEXT("Online subsystem does not support user cloud."));
+        return;
+    }
+
+    CallDispatcher.Run<>(
+        TEXT("UserCloud.WriteUserFile"),
+        GetUserCloudTransferTimeout(Contents->Num()),
+        [this, UserCloud, UserId, FileName, Contents](const auto &OnComplete) {
+            // Register an event so we can receive the outcome.
+            auto CallbackHandle = MakeShared<FDelegateHandle>();
+            *CallbackHandle =
+                UserCloud->AddOnWriteUserFileCompleteDelegate_Handle(FOnWriteUserFileCompleteDelegate::CreateWeakLambda(
+                    this,
+                    [UserCloud, CallbackHandle, FileName, UserId, OnComplete](
+                        bool bCallbackWasSuccessful,
+                        const FUniqueNetId &CallbackUserId,
+                        const FString &CallbackFileName) {
+                        // Check if this callback is for us.
+                        if (*UserId != CallbackUserId || FileName != CallbackFileName)
+                        {
+                            // This callback isn't for our call.
+                            return;
+                        }
+
+                        // Unregister this callback since we've handled the call we care about.
+                        UserCloud->ClearOnWriteUserFileCompleteDelegate_Handle(*CallbackHandle);
+
+                        // Return the result.
+                        OnComplete(
+                            bCallbackWasSuccessful,
+                            bCallbackWasSuccessful ? TEXT("") : TEXT("WriteUserFile call failed."));
+                    }));
+
+            // Start writing the file.
+            if (!UserCloud->WriteUserFile(*UserId, FileName, *Contents, false))
+            {
+                UserCloud->ClearOnWriteUserFileCompleteDelegate_Handle(*CallbackHandle);
+                OnComplete(false, TEXT("WriteUserFile call failed to start."));
+            }
+        },
+        MoveTemp(OnDone));
+}
+
+void UMOS_GameInstanceSubsystem::ExecuteUserCloudSyncFileUp(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    UMOS_AsyncResult *Result)
+{
+    // Make sure the user is signed in.
+    if (this->GetOnlineContext().OSS == nullptr || !this->GetOnlineContext().UserId.IsValid())
+    {
+        Result->OnResult(false, TEXT("The local user is not signed in."));
+        return;
+    }
+
+    // Hash and chunk the local file on a worker thread.
+    int64 ChunkThreshold = static_cast<int64>(FMath::Max(UserCloudChunkedSyncThresholdKB, 0)) * 1024;
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [WeakThis = TWeakObjectPtr<UMOS_GameInstanceSubsystem>(this),
+         ResultWk = TWeakObjectPtr<UMOS_AsyncResult>(Result),
+         FileName,
+         LocalFilePath,
+         ChunkThreshold]() {
+            auto Data = MakeShared<TArray<uint8>>();
+            auto Chunks = MakeShared<TArray<OSS::OnlineAPI::FUserCloudChunk>>();
+            bool bLoaded = FFileHelper::LoadFileToArray(*Data, *LocalFilePath);
+            FSHAHash ContentHash;
+            if (bLoaded)
+            {
+                ContentHash = OSS::OnlineAPI::FUserCloudManifest::HashBytes(Data->GetData(), Data->Num());
+                if (ChunkThreshold > 0 && Data->Num() >= ChunkThreshold)
+                {
+                    OSS::OnlineAPI::FUserCloudManifest::SplitIntoChunks(Data->GetData(), Data->Num(), *Chunks);
+                }
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, ResultWk, FileName, Data, Chunks, ContentHash, bLoaded]() {
+                if (!WeakThis.IsValid() || !ResultWk.IsValid())
+                {
+                    return;
+                }
+                if (!bLoaded)
+                {
+                    ResultWk->OnResult(false, TEXT("Unable to read the local file."));
+                    return;
+                }
+                WeakThis->UploadUserCloudSync(FileName, Data, Chunks, ContentHash, ResultWk.Get());
+            });
+        });
+}
+
+void UMOS_GameInstanceSubsystem::UploadUserCloudSync(
+    const FString &FileName,
+    const TSharedRef<TArray<uint8>> &Data,
+    const TSharedRef<TArray<OSS::OnlineAPI::FUserCloudChunk>> &Chunks,
+    const FSHAHash &ContentHash,
+    UMOS_AsyncResult *Result)
+{
+    // Skip the upload if a file listing confirms the cloud already holds exactly this content.
+    if (this->IsUserCloudFileUnchanged(FileName, ContentHash))
+    {
+        Result->OnResult(true, TEXT(""));
+        return;
+    }
+
+    auto OnUploaded = [this, ResultWk = TWeakObjectPtr<UMOS_AsyncResult>(Result), FileName, Chunks, ContentHash, Size = Data->Num()](
+                          bool bWasSuccessful,
+                          const FString &ErrorMessage) {
+        for (const auto &Chunk : *Chunks)
+        {
+            if (--UploadingUserCloudChunks.FindChecked(Chunk.Hash) == 0)
+            {
+                UploadingUserCloudChunks.Remove(Chunk.Hash);
+            }
+        }
+
+        // Remember what we uploaded, so the same content isn't uploaded again, and delete the chunks that only the
+        // replaced index used now that nothing can read them anymore.
+        if (bWasSuccessful)
+        {
+            UserCloudManifest.Record(FileName, ContentHash, Size, false);
+            DeleteUserCloudChunks(UserCloudManifest.SetFileChunks(FileName, *Chunks));
+        }
+        UserCloudManifest.Save();
+
+        // Make sure the result callback is still valid.
+        if (ResultWk.IsValid())
+        {
+            ResultWk->OnResult(bWasSuccessful, ErrorMessage);
+        }
+    };
+
+    // Keep every chunk this upload's index will reference, including the ones already in the cloud, from being deleted
+    // as an orphan until the upload has finished.
+    for (const auto &Chunk : *Chunks)
+    {
+        UploadingUserCloudChunks.FindOrAdd(Chunk.Hash)++;
+    }
+
+    // Small files are uploaded whole.
+    if (Chunks->Num() == 0)
+    {
+        WriteUserCloudFile(FileName, Data, OnUploaded);
+        return;
+    }
+
+    // Upload the chunks the cloud doesn't have yet, then the index that ties them together.
+    auto Index = MakeShared<TArray<uint8>>();
+    OSS::OnlineAPI::FUserCloudManifest::WriteChunkIndex(Data->Num(), *Chunks, *Index);
+
+    struct FUploadState
+    {
+        int32 ChunksRemaining = 0;
+        bool bFailed = false;
+        FString ErrorMessage;
+    };
+    auto Upload = MakeShared<FUploadState>();
+    auto OnChunksUploaded = [this, Upload, FileName, Index, OnUploaded]() {
+        if (Upload->bFailed)
+        {
+            OnUploaded(false, Upload->ErrorMessage);
+            return;
+        }
+        WriteUserCloudFile(FileName, Index, OnUploaded);
+    };
+
+    TSet<FSHAHash> Queued;
+    for (const auto &Chunk : *Chunks)
+    {
+        if (UserCloudManifest.HasRemoteChunk(Chunk.Hash) || Queued.Contains(Chunk.Hash))
+        {
+            continue;
+        }
+        Queued.Add(Chunk.Hash);
+        Upload->ChunksRemaining++;
+    }
+    if (Upload->ChunksRemaining == 0)
+    {
+        OnChunksUploaded();
+        return;
+    }
+
+    for (const auto &Chunk : *Chunks)
+    {
+        if (Queued.Remove(Chunk.Hash) == 0)
+        {
+            continue;
+        }
+        auto WriteChunk = [this, Upload, OnChunksUploaded, ChunkHash = Chunk.Hash, ChunkData = MakeShared<TArray<uint8>>(Data->GetData() + Chunk.Offset, Chunk.Size)]() {
+            WriteUserCloudFile(
+                OSS::OnlineAPI::FUserCloudManifest::GetChunkFileName(ChunkHash),
+                ChunkData,
+                [this, Upload, OnChunksUploaded, ChunkHash](bool bWasSuccessful, const FString &ErrorMessage) {
+                    if (bWasSuccessful)
+                    {
+                        UserCloudManifest.AddRemoteChunk(ChunkHash);
+                    }
+                    else if (!Upload->bFailed)
+                    {
+                        Upload->bFailed = true;
+                        Upload->ErrorMessage = ErrorMessage;
+                    }
+                    if (--Upload->ChunksRemaining == 0)
+                    {
+                        OnChunksUploaded();
+                    }
+                });
+        };
+
+        // A chunk that is being deleted as an orphan is uploaded again once the delete has finished.
+        if (auto *Waiting = DeletingUserCloudChunks.Find(Chunk.Hash))
+        {
+            Waiting->Add(MoveTemp(WriteChunk));
+        }
+        else
+        {
+            WriteChunk();
+        }
+    }
+}
+
+void UMOS_GameInstanceSubsystem::DeleteUserCloudChunks(const TArray<FSHAHash> &Hashes)
+{
+    auto OSS = this->GetOnlineContext().OSS;
+    auto UserId = this->GetOnlineContext().UserId;
+    auto UserCloud = OSS != nullptr ? OSS->GetUserCloudInterface() : IOnlineUserCloudPtr();
+    if (!UserId.IsValid() || !UserCloud.IsValid())
+    {
+        return;
+    }
+
+    for (const auto &Hash : Hashes)
+    {
+        if (UserCloudManifest.IsChunkReferenced(Hash) || UploadingUserCloudChunks.Contains(Hash) ||
+            DeletingUserCloudChunks.Contains(Hash))
+        {
+            continue;
+        }
+
+        // @note: Forget the chunk before it's gone, so that uploads from here on write it again instead of skipping it.
+        UserCloudManifest.RemoveRemoteChunk(Hash);
+        DeletingUserCloudChunks.Add(Hash);
+
+        FString ChunkFileName = OSS::OnlineAPI::FUserCloudManifest::GetChunkFileName(Hash);
+        CallDispatcher.Run<>(
+            TEXT("UserCloud.DeleteUserFile"),
+            OnlineCallTimeoutSeconds,
+            [this, UserCloud, UserId, ChunkFileName](const auto &OnComplete) {
+                // Register an event so we can receive the outcome.
+                auto CallbackHandle = MakeShared<FDelegateHandle>();
+                *CallbackHandle = UserCloud->AddOnDeleteUserFileCompleteDelegate_Handle(
+                    FOnDeleteUserFileCompleteDelegate::CreateWeakLambda(
+                        this,
+                        [UserCloud, CallbackHandle, ChunkFileName, UserId, OnComplete](
+                            bool bCallbackWasSuccessful,
+                            const FUniqueNetId &CallbackUserId,
+                            const FString &CallbackFileName) {
+                            // Check if this callback is for us.
+                            if (*UserId != CallbackUserId || ChunkFileName != CallbackFileName)
+                            {
+                                // This callback isn't for our call.
+                                return;
+                            }
+
+                            // Unregister this callback since we've handled the call we care about.
+                            UserCloud->ClearOnDeleteUserFileCompleteDelegate_Handle(*CallbackHandle);
+
+                            // Return the result.
+                            OnComplete(
+                                bCallbackWasSuccessful,
+                                bCallbackWasSuccessful ? TEXT("") : TEXT("DeleteUserFile call failed."));
+                        }));
+
+                // Start deleting the file.
+                if (!UserCloud->DeleteUserFile(*UserId, ChunkFileName, true, false))
+                {
+                    UserCloud->ClearOnDeleteUserFileCompleteDelegate_Handle(*CallbackHandle);
+                    OnComplete(false, TEXT("DeleteUserFile call failed to start."));
+                }
+            },
+            [WeakThis = TWeakObjectPtr<UMOS_GameInstanceSubsystem>(this), Hash, ChunkFileName](
+                bool bWasSuccessful,
+                const FString &ErrorMessage) {
+                if (!bWasSuccessful)
+                {
+                    // @note: The chunk is only leaked; the next file listing reports it again if it's still there.
+                    DP_LOG(MOSGameInstanceSubsystem, Warning, "Unable to delete orphaned user cloud chunk %s: %s", *ChunkFileName, *ErrorMessage);
+                }
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                // Start the uploads of the chunk that were waiting for the delete.
+                TArray<TFunction<void()>> Waiting;
+                WeakThis->DeletingUserCloudChunks.RemoveAndCopyValue(Hash, Waiting);
+                for (auto &WriteChunk : Waiting)
+                {
+                    WriteChunk();
+                }
+            });
+    }
+}
+
+void UMOS_GameInstanceSubsystem::ExecuteUserCloudSyncFileDown(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    UMOS_AsyncResult *Result)
+{
+    // Make sure the user is signed in.
+    if (this->GetOnlineContext().OSS == nullptr || !this->GetOnlineContext().UserId.IsValid())
+    {
+        Result->OnResult(false, TEXT("The local user is not signed in."));
+        return;
+    }
+
+    // Download unless the last file listing shows the cloud copy is the one we last transferred.
+    const auto *Entry = UserCloudManifest.Find(FileName);
+    if (Entry == nullptr || !UserCloudManifest.IsRemoteCurrent(FileName) ||
+        IFileManager::Get().FileSize(*LocalFilePath) != Entry->Size)
+    {
+        DownloadUserCloudSync(FileName, LocalFilePath, Result);
+        return;
+    }
+
+    // The local file can have been edited since without changing its size, so only skip the download if its content
+    // still hashes to what we transferred. Hash it on a worker thread.
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [WeakThis = TWeakObjectPtr<UMOS_GameInstanceSubsystem>(this),
+         ResultWk = TWeakObjectPtr<UMOS_AsyncResult>(Result),
+         FileName,
+         LocalFilePath,
+         ExpectedHash = Entry->ContentHash]() {
+            TArray<uint8> LocalData;
+            bool bUnchanged = FFileHelper::LoadFileToArray(LocalData, *LocalFilePath, FILEREAD_Silent) &&
+                              OSS::OnlineAPI::FUserCloudManifest::HashBytes(LocalData.GetData(), LocalData.Num()) ==
+                                  ExpectedHash;
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, ResultWk, FileName, LocalFilePath, bUnchanged]() {
+                if (!WeakThis.IsValid() || !ResultWk.IsValid())
+                {
+                    return;
+                }
+                if (bUnchanged)
+                {
+                    ResultWk->OnResult(true, TEXT(""));
+                    return;
+                }
+                WeakThis->DownloadUserCloudSync(FileName, LocalFilePath, ResultWk.Get());
+            });
+        });
+}
+
+void UMOS_GameInstanceSubsystem::DownloadUserCloudSync(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    UMOS_AsyncResult *Result)
+{
+    ReadUserCloudFile(
+        FileName,
+        [this, ResultWk = TWeakObjectPtr<UMOS_AsyncResult>(Result), FileName, LocalFilePath](
+            bool bWasSuccessful,
+            const TSharedPtr<TArray<uint8>> &Contents,
+            const FString &ErrorMessage) {
+            if (!bWasSuccessful)
+            {
+                if (ResultWk.IsValid())
+                {
+                    ResultWk->OnResult(false, ErrorMessage);
+                }
+                return;
+            }
+
+            // A file uploaded whole is written out as it is.
+            int64 TotalSize = 0;
+            auto Chunks = MakeShared<TArray<OSS::OnlineAPI::FUserCloudChunk>>();
+            if (!OSS::OnlineAPI::FUserCloudManifest::ReadChunkIndex(*Contents, TotalSize, *Chunks))
+            {
+                AssembleUserCloudSync(FileName, LocalFilePath, Contents, nullptr, nullptr, ResultWk.Get());
+                return;
+            }
+
+            // Otherwise, work out which chunks the local copy already has on a worker thread.
+            AsyncTask(
+                ENamedThreads::AnyBackgroundThreadNormalTask,
+                [WeakThis = TWeakObjectPtr<UMOS_GameInstanceSubsystem>(this), ResultWk, FileName, LocalFilePath, Chunks]() {
+                    auto LocalData = MakeShared<TArray<uint8>>();
+                    TArray<OSS::OnlineAPI::FUserCloudChunk> LocalChunks;
+                    if (FFileHelper::LoadFileToArray(*LocalData, *LocalFilePath, FILEREAD_Silent))
+                    {
+                        OSS::OnlineAPI::FUserCloudManifest::SplitIntoChunks(
+                            LocalData->GetData(),
+                            LocalData->Num(),
+                            LocalChunks);
+                    }
+                    TSet<FSHAHash> LocalHashes;
+                    for (const auto &LocalChunk : LocalChunks)
+                    {
+                        LocalHashes.Add(LocalChunk.Hash);
+                    }
+                    auto MissingHashes = MakeShared<TArray<FSHAHash>>();
+                    for (const auto &Chunk : *Chunks)
+                    {
+                        if (!LocalHashes.Contains(Chunk.Hash))
+                        {
+                            MissingHashes->AddUnique(Chunk.Hash);
+                        }
+                    }
+
+                    AsyncTask(
+                        ENamedThreads::GameThread,
+                        [WeakThis, ResultWk, FileName, LocalFilePath, Chunks, LocalData, MissingHashes]() {
+                            if (WeakThis.IsValid() && ResultWk.IsValid())
+                            {
+                                WeakThis->DownloadUserCloudChunks(
+                                    FileName,
+                                    LocalFilePath,
+                                    Chunks,
+                                    LocalData,
+                                    MissingHashes,
+                                    ResultWk.Get());
+                            }
+                        });
+                });
+        });
+}
+
+void UMOS_GameInstanceSubsystem::DownloadUserCloudChunks(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    const TSharedRef<TArray<OSS::OnlineAPI::FUserCloudChunk>> &Chunks,
+    const TSharedRef<TArray<uint8>> &LocalData,
+    const TSharedRef<TArray<FSHAHash>> &MissingHashes,
+    UMOS_AsyncResult *Result)
+{
+    struct FDownloadState
+    {
+        int32 ChunksRemaining = 0;
+        bool bFailed = false;
+        FString ErrorMessage;
+        TMap<FSHAHash, TSharedPtr<TArray<uint8>>> Downloaded;
+    };
+    auto Download = MakeShared<FDownloadState>();
+    Download->ChunksRemaining = MissingHashes->Num();
+    auto OnChunksDownloaded = [this, Download, FileName, LocalFilePath, Chunks, LocalData, ResultWk = TWeakObjectPtr<UMOS_AsyncResult>(Result)]() {
+        if (!ResultWk.IsValid())
+        {
+            return;
+        }
+        if (Download->bFailed)
+        {
+            ResultWk->OnResult(false, Download->ErrorMessage);
+            return;
+        }
+        AssembleUserCloudSync(
+            FileName,
+            LocalFilePath,
+            LocalData,
+            Chunks,
+            MakeShared<TMap<FSHAHash, TSharedPtr<TArray<uint8>>>>(MoveTemp(Download->Downloaded)),
+            ResultWk.Get());
+    };
+    if (Download->ChunksRemaining == 0)
+    {
+        OnChunksDownloaded();
+        return;
+    }
+
+    // Only the chunks the local copy doesn't already have are downloaded.
+    for (const FSHAHash &Hash : *MissingHashes)
+    {
+        ReadUserCloudFile(
+            OSS::OnlineAPI::FUserCloudManifest::GetChunkFileName(Hash),
+            [Download, OnChunksDownloaded, Hash](
+                bool bWasSuccessful,
+                const TSharedPtr<TArray<uint8>> &Contents,
+                const FString &ErrorMessage) {
+                if (bWasSuccessful)
+                {
+                    Download->Downloaded.Add(Hash, Contents);
+                }
+                else if (!Download->bFailed)
+                {
+                    Download->bFailed = true;
+                    Download->ErrorMessage = ErrorMessage;
+                }
+                if (--Download->ChunksRemaining == 0)
+                {
+                    OnChunksDownloaded();
+                }
+            });
+    }
+}
+
+void UMOS_GameInstanceSubsystem::AssembleUserCloudSync(
+    const FString &FileName,
+    const FString &LocalFilePath,
+    const TSharedPtr<TArray<uint8>> &Source,
+    const TSharedPtr<TArray<OSS::OnlineAPI::FUserCloudChunk>> &Chunks,
+    const TSharedPtr<TMap<FSHAHash, TSharedPtr<TArray<uint8>>>> &Downloaded,
+    UMOS_AsyncResult *Result)
+{
+    // Write the local file on a worker thread. Without a chunk list, Source is the whole file; otherwise each chunk is
+    // taken from the downloaded chunks or, if it didn't change, from the previous local copy in Source.
+    AsyncTask(
+        ENamedThreads::AnyBackgroundThreadNormalTask,
+        [WeakThis = TWeakObjectPtr<UMOS_GameInstanceSubsystem>(this),
+         ResultWk = TWeakObjectPtr<UMOS_AsyncResult>(Result),
+         FileName,
+         LocalFilePath,
+         Source,
+         Chunks,
+         Downloaded]() {
+            FString ErrorMessage;
+            FSHAHash ContentHash;
+            int64 Size = 0;
+            if (!Chunks.IsValid())
+            {
+                Size = Source->Num();
+                ContentHash = OSS::OnlineAPI::FUserCloudManifest::HashBytes(Source->GetData(), Size);
+                if (!FFileHelper::SaveArrayToFile(*Source, *LocalFilePath))
+                {
+                    ErrorMessage = TEXT("Unable to write the local file.");
+                }
+            }
+            else
+            {
+                // Index the chunks of the previous local copy by hash.
+                TArray<OSS::OnlineAPI::FUserCloudChunk> LocalChunks;
+                OSS::OnlineAPI::FUserCloudManifest::SplitIntoChunks(Source->GetData(), Source->Num(), LocalChunks);
+                TMap<FSHAHash, const OSS::OnlineAPI::FUserCloudChunk *> LocalChunksByHash;
+                for (const auto &LocalChunk : LocalChunks)
+                {
+                    LocalChunksByHash.Add(LocalChunk.Hash, &LocalChunk);
+                }
+
+                // @note: Assemble into memory first, since the previous local copy is still being read from.
+                TArray<uint8> Assembled;
+                Assembled.Reserve(Chunks->Num() > 0 ? Chunks->Last().Offset + Chunks->Last().Size : 0);
+                for (const auto &Chunk : *Chunks)
+                {
+                    const uint8 *ChunkData = nullptr;
+                    if (const auto *LocalChunk = LocalChunksByHash.FindRef(Chunk.Hash))
+                    {
+                        ChunkData = Source->GetData() + LocalChunk->Offset;
+                    }
+                    else if (const auto *DownloadedChunk = Downloaded->Find(Chunk.Hash))
+                    {
+                        if ((*DownloadedChunk)->Num() == Chunk.Size)
+                        {
+                            ChunkData = (*DownloadedChunk)->GetData();
+                        }
+                    }
+                    if (ChunkData == nullptr)
+                    {
+                        ErrorMessage = TEXT("A chunk of the file is missing or corrupt.");
+                        break;
+                    }
+                    Assembled.Append(ChunkData, Chunk.Size);
+                }
+
+                if (ErrorMessage.IsEmpty())
+                {
+                    Size = Assembled.Num();
+                    ContentHash = OSS::OnlineAPI::FUserCloudManifest::HashBytes(Assembled.GetData(), Size);
+                    if (!FFileHelper::SaveArrayToFile(Assembled, *LocalFilePath))
+                    {
+                        ErrorMessage = TEXT("Unable to write the local file.");
+                    }
+                }
+            }
+
+            // Record the download and return the result on the game thread.
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, ResultWk, FileName, Chunks, ErrorMessage, ContentHash, Size]() {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+                if (ErrorMessage.IsEmpty())
+                {
+                    // @note: Whoever replaced the file is responsible for the chunks of its previous index.
+                    WeakThis->UserCloudManifest.Record(FileName, ContentHash, Size, true);
+                    WeakThis->UserCloudManifest.SetFileChunks(FileName, Chunks.IsValid() ? *Chunks : TArray<OSS::OnlineAPI::FUserCloudChunk>());
+                    WeakThis->UserCloudManifest.Save();
+                }
+                if (ResultWk.IsValid())
+                {
+                    ResultWk->OnResult(ErrorMessage.IsEmpty(), ErrorMessage);
+                }
+            });
+        });
+}
@@ -9,7 +9,7 @@
 void UMOS_GameInstanceSubsystem::ExecuteUsersQueryUserInfo(const FString &UserIdStr, UMOS_TextAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT(""), TEXT("Online subsystem is not available."));
@@ -17,9 +17,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUsersQueryUserInfo(const FString &UserId
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user interface, if the online subsystem supports it.
@@ -107,7 +107,7 @@ void UMOS_GameInstanceSubsystem::ExecuteUsersQueryUserByDisplayName(
     UMOS_TextAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT(""), TEXT("Online subsystem is not available."));
@@ -115,9 +115,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUsersQueryUserByDisplayName(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user interface, if the online subsystem supports it.
@@ -163,7 +163,7 @@ void UMOS_GameInstanceSubsystem::ExecuteUsersQueryExternalIds(
     UMOS_TextAsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT(""), TEXT("Online subsystem is not available."));
@@ -171,9 +171,9 @@ void UMOS_GameInstanceSubsystem::ExecuteUsersQueryExternalIds(
     }
 
     // Get the identity interface and the currently signed in user.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
-    auto UserId = Identity->GetUniquePlayerId(this->LocalUserNum);
+    auto UserId = this->GetOnlineContext().UserId;
     checkf(UserId.IsValid(), TEXT("Expected this function to not be called unless the user is signed in."));
 
     // Get the user interface, if the online subsystem supports it.
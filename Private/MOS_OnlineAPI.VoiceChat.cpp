@@ -39,7 +39,7 @@ FString UMOS_GameInstanceSubsystem::GetVoiceChatLoggedInPlayerName() const
 void UMOS_GameInstanceSubsystem::ExecuteVoiceChatLogin(UMOS_AsyncResult *Result)
 {
     // Get the online subsystem.
-    auto OSS = Online::GetSubsystem(this->GetWorld());
+    auto OSS = this->GetOnlineContext().OSS;
     if (OSS == nullptr)
     {
         Result->OnResult(false, TEXT("Online subsystem is not available."));
@@ -47,7 +47,7 @@ void UMOS_GameInstanceSubsystem::ExecuteVoiceChatLogin(UMOS_AsyncResult *Result)
     }
 
     // Get the identity interface.
-    auto Identity = OSS->GetIdentityInterface();
+    auto Identity = this->GetOnlineContext().Identity;
     checkf(Identity.IsValid(), TEXT("Expected all online subsystems to implement the identity interface."));
 
     // Get the cross-call storage.
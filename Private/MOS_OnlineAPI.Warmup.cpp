@@ -0,0 +1,84 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Public/MOS_GameInstanceSubsystem.h"
+
+#include "DebugPlus/Public/DP_EnhancedLogging.h"
+
+using OSS::OnlineAPI::FWarmupPipeline;
+
+// Creates a result object whose native callback completes a warm-up step, and keeps it alive until the warm-up ends.
+template <typename TResult, typename... TPayload>
+static TResult *NewWarmupResult(
+    UMOS_GameInstanceSubsystem *Outer,
+    TArray<UObject *> &KeepAlive,
+    const FWarmupPipeline::FStepComplete &OnComplete)
+{
+    TResult *Result = NewObject<TResult>(Outer);
+    KeepAlive.Add(Result);
+    Result->NativeCallback =
+        TResult::FNativeCallback::CreateLambda([OnComplete](bool bWasSuccessful, const TPayload &..., FString Error) {
+            OnComplete(bWasSuccessful, Error);
+        });
+    return Result;
+}
+
+void UMOS_GameInstanceSubsystem::StartLoginWarmup()
+{
+    WarmupPipeline.Reset();
+    WarmupResults.Empty();
+    bIsWarmupComplete = false;
+
+    // @note: Steps with no dependencies all start at once; the call dispatcher bounds how many actually hit the
+    // backend at the same time. Screens that issue the same query while it's running join it instead of repeating it.
+    WarmupPipeline.AddStep(TEXT("Friends"), {}, [this](const FWarmupPipeline::FStepComplete &OnComplete) {
+        ExecuteFriendsQueryFriends(NewWarmupResult<UMOS_AsyncResult>(this, WarmupResults, OnComplete));
+    });
+    WarmupPipeline.AddStep(TEXT("Entitlements"), {}, [this](const FWarmupPipeline::FStepComplete &OnComplete) {
+        ExecuteEcommerceQueryEntitlements(NewWarmupResult<UMOS_AsyncResult>(this, WarmupResults, OnComplete));
+    });
+    WarmupPipeline.AddStep(
+        TEXT("Offers"),
+        {TEXT("Entitlements")},
+        [this](const FWarmupPipeline::FStepComplete &OnComplete) {
+            ExecuteEcommerceQueryOffers(NewWarmupResult<UMOS_AsyncResult>(this, WarmupResults, OnComplete));
+        });
+    WarmupPipeline.AddStep(TEXT("Stats"), {}, [this](const FWarmupPipeline::FStepComplete &OnComplete) {
+        ExecuteStatsQueryStats(
+            NewWarmupResult<UMOS_QueryStatsAsyncResult, TArray<FMOSStatsStatState>>(this, WarmupResults, OnComplete));
+    });
+    WarmupPipeline.AddStep(TEXT("Achievements"), {}, [this](const FWarmupPipeline::FStepComplete &OnComplete) {
+        ExecuteAchievementsQueryAchievements(
+            NewWarmupResult<UMOS_QueryAchievementsAsyncResult, TArray<FMOSAchievementsAchievementState>>(
+                this,
+                WarmupResults,
+                OnComplete));
+    });
+    WarmupPipeline.AddStep(TEXT("UserCloudFiles"), {}, [this](const FWarmupPipeline::FStepComplete &OnComplete) {
+        ExecuteUserCloudQueryFiles(
+            NewWarmupResult<UMOS_ListAsyncResult, TArray<FMOSInterfaceListEntry>>(this, WarmupResults, OnComplete));
+    });
+
+    // Let the game add its own steps, e.g. ones that depend on the queries above.
+    OnConfigureWarmup.Broadcast(WarmupPipeline);
+
+    WarmupPipeline.Start([this](const FMOSWarmupReport &Report) {
+        WarmupResults.Empty();
+        LastWarmupReport = Report;
+        bIsWarmupComplete = true;
+
+        DP_LOG(MOSGameInstanceSubsystem, Log, "Warm-up finished in %.3fs (%s)", Report.TimeToInteractiveSeconds, ANSI_TO_TCHAR(Report.bWasSuccessful ? "Success" : "Failed"));
+        for (const auto &Step : Report.Steps)
+        {
+            DP_LOG(MOSGameInstanceSubsystem, Verbose, "  %s: +%.3fs, %.3fs %s", *Step.Name.ToString(), Step.StartSeconds, Step.DurationSeconds, *Step.ErrorMessage);
+        }
+
+        OnWarmupComplete.Broadcast(Report);
+    });
+}
+
+void UMOS_GameInstanceSubsystem::CancelLoginWarmup()
+{
+    WarmupPipeline.Reset();
+    WarmupResults.Empty();
+    bIsWarmupComplete = false;
+}
@@ -0,0 +1,187 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_AsyncResult.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_CallScopedOjectPtr.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace OSS::OnlineAPI::Tests
+{
+
+constexpr auto CallScopedObjectPtrTestFlags =
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSCallScopedObjectPtrMoveTest,
+    "MOS.CallScopedObjectPtr.Move",
+    CallScopedObjectPtrTestFlags)
+bool FMOSCallScopedObjectPtrMoveTest::RunTest(const FString &Parameters)
+{
+    TSharedRef<FCallManagerBase> Owner = MakeShared<FCallManagerBase>();
+    TStrongObjectPtr<UMOS_AsyncResult> ObjectA(NewObject<UMOS_AsyncResult>(GetTransientPackage()));
+    TStrongObjectPtr<UMOS_AsyncResult> ObjectB(NewObject<UMOS_AsyncResult>(GetTransientPackage()));
+
+    TCallScopedObjectPtr<UMOS_AsyncResult> First(Owner, ObjectA.Get());
+    TCallScopedObjectPtr<UMOS_AsyncResult> Middle(Owner, ObjectB.Get());
+    TCallScopedObjectPtr<UMOS_AsyncResult> Last(Owner, ObjectA.Get());
+    TestEqual(TEXT("Each pointer is held by the owner"), Owner->GetCallScopedObjectCount(), 3);
+
+    // Moving takes over the source's place in the list and leaves it empty.
+    TCallScopedObjectPtr<UMOS_AsyncResult> Moved(MoveTemp(Middle));
+    TestFalse(TEXT("A moved-from pointer is empty"), Middle.IsValid());
+    TestNull(TEXT("A moved-from pointer points to nothing"), Middle.Get());
+    TestTrue(TEXT("The moved-to pointer holds the object"), Moved.Get() == ObjectB.Get());
+    TestEqual(TEXT("Moving doesn't change the number held"), Owner->GetCallScopedObjectCount(), 3);
+
+    // Move assignment releases the destination's object first.
+    First = MoveTemp(Last);
+    TestFalse(TEXT("A move-assigned-from pointer is empty"), Last.IsValid());
+    TestTrue(TEXT("The move-assigned pointer holds the object"), First.Get() == ObjectA.Get());
+    TestEqual(TEXT("Move assignment releases the replaced object"), Owner->GetCallScopedObjectCount(), 2);
+
+    // Converting moves behave the same.
+    TCallScopedObjectPtr<UObject> Converted(MoveTemp(Moved));
+    TestFalse(TEXT("A converted-from pointer is empty"), Moved.IsValid());
+    TestTrue(TEXT("The converted pointer holds the object"), Converted.Get() == ObjectB.Get());
+    TestEqual(TEXT("Converting doesn't change the number held"), Owner->GetCallScopedObjectCount(), 2);
+
+    // Moving an empty pointer, or a pointer onto itself, leaves the list alone.
+    TCallScopedObjectPtr<UMOS_AsyncResult> Empty(MoveTemp(Middle));
+    TestFalse(TEXT("Moving an empty pointer gives an empty pointer"), Empty.IsValid());
+    TCallScopedObjectPtr<UMOS_AsyncResult> &Self = First;
+    First = MoveTemp(Self);
+    TestTrue(TEXT("Self-move keeps the object"), First.Get() == ObjectA.Get());
+    TestEqual(TEXT("Self-move doesn't change the number held"), Owner->GetCallScopedObjectCount(), 2);
+
+    // Moved-from pointers can be reused.
+    Middle = First;
+    TestTrue(TEXT("A moved-from pointer can be assigned again"), Middle.Get() == ObjectA.Get());
+    TestEqual(TEXT("The reused pointer is held again"), Owner->GetCallScopedObjectCount(), 3);
+
+    // Releasing the owner's objects empties every pointer.
+    Owner->ReleaseCallScopedObjects();
+    TestEqual(TEXT("The owner holds nothing once released"), Owner->GetCallScopedObjectCount(), 0);
+    TestFalse(TEXT("Pointers are empty once the owner releases them"), First.IsValid() || Middle.IsValid() || Converted.IsValid());
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSCallScopedObjectPtrRelocationTest,
+    "MOS.CallScopedObjectPtr.Relocation",
+    CallScopedObjectPtrTestFlags)
+bool FMOSCallScopedObjectPtrRelocationTest::RunTest(const FString &Parameters)
+{
+    TSharedRef<FCallManagerBase> Owner = MakeShared<FCallManagerBase>();
+    TStrongObjectPtr<UMOS_AsyncResult> Object(NewObject<UMOS_AsyncResult>(GetTransientPackage()));
+
+    // TArray relocates its elements bitwise as it grows and when elements are removed from the middle.
+    TArray<TCallScopedObjectPtr<UMOS_AsyncResult>> Pointers;
+    for (int32 i = 0; i < 1000; i++)
+    {
+        Pointers.Emplace(Owner, Object.Get());
+    }
+    Pointers.RemoveAt(0, 500);
+    Pointers.Shrink();
+    TestEqual(TEXT("Removed pointers are no longer held"), Owner->GetCallScopedObjectCount(), 500);
+    TestFalse(TEXT("Relocated pointers still hold their object"), Pointers.ContainsByPredicate([&Object](const auto &Pointer) {
+        return Pointer.Get() != Object.Get();
+    }));
+
+    // Slots freed by the removed pointers are reused, and stale handles never see the objects that reuse them.
+    TCallScopedObjectPtr<UMOS_AsyncResult> Released(Owner, Object.Get());
+    TCallScopedObjectPtr<UMOS_AsyncResult> Copy(Released);
+    Released.Reset();
+    TCallScopedObjectPtr<UMOS_AsyncResult> Reused(Owner, Object.Get());
+    TestFalse(TEXT("A reset pointer stays empty when its slot is reused"), Released.IsValid());
+    TestTrue(TEXT("A copy keeps its own slot"), Copy.Get() == Object.Get());
+    TestEqual(TEXT("Reused slots don't grow the registry's count"), Owner->GetCallScopedObjectCount(), 502);
+
+    Owner->ReleaseCallScopedObjects();
+    TestFalse(TEXT("Relocated pointers are empty once the owner releases them"), Pointers.ContainsByPredicate([](const auto &Pointer) {
+        return Pointer.IsValid();
+    }));
+    TestEqual(TEXT("The owner holds nothing once released"), Owner->GetCallScopedObjectCount(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSCallScopedObjectPtrBenchmarkTest,
+    "MOS.CallScopedObjectPtr.Benchmark",
+    CallScopedObjectPtrTestFlags)
+bool FMOSCallScopedObjectPtrBenchmarkTest::RunTest(const FString &Parameters)
+{
+    constexpr int32 PointerCount = 10000;
+    TStrongObjectPtr<UMOS_AsyncResult> Object(NewObject<UMOS_AsyncResult>(GetTransientPackage()));
+    TSharedPtr<FCallManagerBase> Owner = MakeShared<FCallManagerBase>();
+
+    TArray<TCallScopedObjectPtr<UMOS_AsyncResult>> Pointers;
+
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < PointerCount; i++)
+    {
+        Pointers.Emplace(Owner.ToSharedRef(), Object.Get());
+    }
+    double CreateMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("Every created pointer is held"), Owner->GetCallScopedObjectCount(), PointerCount);
+
+    StartTime = FPlatformTime::Seconds();
+    TArray<TCallScopedObjectPtr<UMOS_AsyncResult>> Copies(Pointers);
+    double CopyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("Every copy is held"), Owner->GetCallScopedObjectCount(), PointerCount * 2);
+
+    StartTime = FPlatformTime::Seconds();
+    TArray<TCallScopedObjectPtr<UMOS_AsyncResult>> Moved;
+    for (auto &Pointer : Pointers)
+    {
+        Moved.Add(MoveTemp(Pointer));
+    }
+    double MoveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("Moving doesn't change the number held"), Owner->GetCallScopedObjectCount(), PointerCount * 2);
+    TestFalse(TEXT("Moved-from pointers are empty"), Pointers.ContainsByPredicate([](const auto &Pointer) {
+        return Pointer.IsValid();
+    }));
+
+    // Destroy every other copy, so that unlinking happens from the middle of the list.
+    StartTime = FPlatformTime::Seconds();
+    for (int32 i = 0; i < Copies.Num(); i += 2)
+    {
+        Copies[i].Reset();
+    }
+    Pointers.Empty();
+    double DestroyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(
+        TEXT("Destroyed pointers are no longer held"),
+        Owner->GetCallScopedObjectCount(),
+        PointerCount + PointerCount / 2);
+
+    // Destroying the owner releases whatever is still held.
+    StartTime = FPlatformTime::Seconds();
+    Owner.Reset();
+    double OwnerMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestFalse(TEXT("Pointers are empty once the owner is destroyed"), Moved.ContainsByPredicate([](const auto &Pointer) {
+        return Pointer.IsValid();
+    }) || Copies.ContainsByPredicate([](const auto &Pointer) {
+        return Pointer.IsValid();
+    }));
+    Moved.Empty();
+    Copies.Empty();
+
+    AddInfo(FString::Printf(
+        TEXT("%d call-scoped pointers: create %.3f ms, copy %.3f ms, move %.3f ms, destroy %.3f ms, owner %.3f ms."),
+        PointerCount,
+        CreateMs,
+        CopyMs,
+        MoveMs,
+        DestroyMs,
+        OwnerMs));
+    return true;
+}
+
+} // namespace OSS::OnlineAPI::Tests
+
+#endif
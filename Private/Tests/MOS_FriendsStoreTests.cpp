@@ -0,0 +1,70 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "MultiplayerOnlineSubsystem/Private/Tests/MOS_MockOnlineSubsystem.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_FriendsStore.h"
+
+namespace OSS::OnlineAPI::Tests
+{
+
+constexpr auto FriendsStoreTestFlags =
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter;
+
+static TArray<TSharedRef<FOnlineFriend>> MakeFriends(int32 Count, const TCHAR *NamePrefix, const TCHAR *Status)
+{
+    TArray<TSharedRef<FOnlineFriend>> Friends;
+    Friends.Reserve(Count);
+    for (int32 Index = 0; Index < Count; Index++)
+    {
+        auto Friend =
+            MakeShared<FMockOnlineFriend>(FMockOnlineSubsystem::MakeUserId(FString::Printf(TEXT("friend-%d"), Index)));
+        Friend->DisplayName = FString::Printf(TEXT("%s %d"), NamePrefix, Index);
+        Friend->Presence.bIsOnline = true;
+        Friend->Presence.Status.State = EOnlinePresenceState::Online;
+        Friend->Presence.Status.StatusStr = Status;
+        Friends.Add(Friend);
+    }
+    return Friends;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSFriendsStoreStringsTest, "MOS.FriendsStore.ReleasesStrings", FriendsStoreTestFlags)
+bool FMOSFriendsStoreStringsTest::RunTest(const FString &Parameters)
+{
+    FFriendsStore Store;
+
+    // The empty string, one name per friend (display and real names match) and the shared status.
+    Store.Sync(MakeFriends(100, TEXT("Friend"), TEXT("In the menus")));
+    TestEqual(TEXT("Shared strings are held once"), Store.GetStringCount(), 102);
+
+    // Renaming everyone frees the old names instead of keeping them alongside the new ones.
+    Store.Sync(MakeFriends(100, TEXT("Renamed"), TEXT("In a match")));
+    TestEqual(TEXT("Replaced strings are freed"), Store.GetStringCount(), 102);
+    TestEqual(TEXT("The new names are read back"), Store.GetDisplayName(Store.IndexOf(FUniqueNetIdRepl(
+        FMockOnlineSubsystem::MakeUserId(TEXT("friend-7"))))), FString(TEXT("Renamed 7")));
+
+    // Syncing the same list again changes nothing.
+    Store.TakeChangedIds();
+    Store.Sync(MakeFriends(100, TEXT("Renamed"), TEXT("In a match")));
+    TestFalse(TEXT("An unchanged sync reports no changes"), Store.HasChanges());
+    TestEqual(TEXT("An unchanged sync keeps every string"), Store.GetStringCount(), 102);
+
+    // Removed friends release their names, and freed slots are reused.
+    Store.Sync(MakeFriends(50, TEXT("Renamed"), TEXT("In a match")));
+    TestEqual(TEXT("Removed friends release their strings"), Store.GetStringCount(), 52);
+    Store.Sync(MakeFriends(60, TEXT("Renamed"), TEXT("In a match")));
+    TestEqual(TEXT("Added friends intern their strings"), Store.GetStringCount(), 62);
+    TestEqual(TEXT("Reused slots hold the new strings"), Store.GetDisplayName(Store.IndexOf(FUniqueNetIdRepl(
+        FMockOnlineSubsystem::MakeUserId(TEXT("friend-55"))))), FString(TEXT("Renamed 55")));
+
+    Store.Sync(TArray<TSharedRef<FOnlineFriend>>());
+    TestEqual(TEXT("Only the empty string is left"), Store.GetStringCount(), 1);
+    return true;
+}
+
+} // namespace OSS::OnlineAPI::Tests
+
+#endif
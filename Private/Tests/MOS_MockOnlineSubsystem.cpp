@@ -0,0 +1,2029 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "MultiplayerOnlineSubsystem/Private/Tests/MOS_MockOnlineSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/SecureHash.h"
+#include "Online/OnlineSessionNames.h"
+
+namespace OSS::OnlineAPI::Tests
+{
+
+static FVariantData MakeIntValue(int32 Value)
+{
+    FVariantData Data;
+    Data.SetValue(Value);
+    return Data;
+}
+
+static FString HashContents(const TArray<uint8> &Contents)
+{
+    FSHAHash Hash;
+    FSHA1::HashBuffer(Contents.GetData(), Contents.Num(), Hash.Hash);
+    return Hash.ToString();
+}
+
+static void ListFiles(const TMap<FString, TArray<uint8>> &Files, TArray<FCloudFileHeader> &OutFiles)
+{
+    OutFiles.Reset(Files.Num());
+    for (const auto &KV : Files)
+    {
+        FCloudFileHeader &Header = OutFiles.Emplace_GetRef(KV.Key, KV.Key, KV.Value.Num());
+        Header.Hash = HashContents(KV.Value);
+        Header.HashType = TEXT("SHA1");
+    }
+}
+
+static FString GetLeaderboardName(const FOnlineLeaderboardRead &ReadObject)
+{
+#if REDPOINT_EXAMPLE_UE_5_5_OR_LATER
+    return ReadObject.LeaderboardName;
+#else
+    return ReadObject.LeaderboardName.ToString();
+#endif
+}
+
+//
+// FMockOnlineIdentity
+//
+
+bool FMockOnlineIdentity::Login(int32 LocalUserNum, const FOnlineAccountCredentials &AccountCredentials)
+{
+    bool bSucceeded = LocalUserNum == 0 && this->Subsystem.BeginCall(TEXT("Identity.Login"));
+    this->Subsystem.Defer([this, LocalUserNum, bSucceeded]() {
+        this->bLoggedIn = this->bLoggedIn || bSucceeded;
+        this->TriggerOnLoginCompleteDelegates(
+            LocalUserNum,
+            bSucceeded,
+            *this->Subsystem.GetLocalUserId(),
+            bSucceeded ? FString() : TEXT("Login failed."));
+    });
+    return true;
+}
+
+bool FMockOnlineIdentity::Logout(int32 LocalUserNum)
+{
+    if (LocalUserNum != 0 || !this->bLoggedIn)
+    {
+        return false;
+    }
+    this->Subsystem.Defer([this, LocalUserNum]() {
+        this->bLoggedIn = false;
+        this->TriggerOnLogoutCompleteDelegates(LocalUserNum, true);
+    });
+    return true;
+}
+
+bool FMockOnlineIdentity::AutoLogin(int32 LocalUserNum)
+{
+    return this->Login(LocalUserNum, FOnlineAccountCredentials());
+}
+
+TSharedPtr<FUserOnlineAccount> FMockOnlineIdentity::GetUserAccount(const FUniqueNetId &UserId) const
+{
+    return nullptr;
+}
+
+TArray<TSharedPtr<FUserOnlineAccount>> FMockOnlineIdentity::GetAllUserAccounts() const
+{
+    return TArray<TSharedPtr<FUserOnlineAccount>>();
+}
+
+FUniqueNetIdPtr FMockOnlineIdentity::GetUniquePlayerId(int32 LocalUserNum) const
+{
+    if (LocalUserNum != 0 || !this->bLoggedIn)
+    {
+        return nullptr;
+    }
+    return this->Subsystem.GetLocalUserId();
+}
+
+FUniqueNetIdPtr FMockOnlineIdentity::CreateUniquePlayerId(uint8 *Bytes, int32 Size)
+{
+    return nullptr;
+}
+
+FUniqueNetIdPtr FMockOnlineIdentity::CreateUniquePlayerId(const FString &Str)
+{
+    return FMockOnlineSubsystem::MakeUserId(Str);
+}
+
+ELoginStatus::Type FMockOnlineIdentity::GetLoginStatus(int32 LocalUserNum) const
+{
+    return LocalUserNum == 0 && this->bLoggedIn ? ELoginStatus::LoggedIn : ELoginStatus::NotLoggedIn;
+}
+
+ELoginStatus::Type FMockOnlineIdentity::GetLoginStatus(const FUniqueNetId &UserId) const
+{
+    return UserId == *this->Subsystem.GetLocalUserId() ? this->GetLoginStatus(0) : ELoginStatus::NotLoggedIn;
+}
+
+FString FMockOnlineIdentity::GetPlayerNickname(int32 LocalUserNum) const
+{
+    return TEXT("Mock Player");
+}
+
+FString FMockOnlineIdentity::GetPlayerNickname(const FUniqueNetId &UserId) const
+{
+    return TEXT("Mock Player");
+}
+
+FString FMockOnlineIdentity::GetAuthToken(int32 LocalUserNum) const
+{
+    return FString();
+}
+
+void FMockOnlineIdentity::RevokeAuthToken(const FUniqueNetId &LocalUserId, const FOnRevokeAuthTokenCompleteDelegate &Delegate)
+{
+    Delegate.ExecuteIfBound(LocalUserId, FOnlineError(false));
+}
+
+void FMockOnlineIdentity::GetUserPrivilege(
+    const FUniqueNetId &LocalUserId,
+    EUserPrivileges::Type Privilege,
+    const FOnGetUserPrivilegeCompleteDelegate &Delegate,
+    EShowPrivilegeResolveUI ShowResolveUI)
+{
+    Delegate.ExecuteIfBound(LocalUserId, Privilege, static_cast<uint32>(EPrivilegeResults::NoFailures));
+}
+
+FPlatformUserId FMockOnlineIdentity::GetPlatformUserIdFromUniqueNetId(const FUniqueNetId &UniqueNetId) const
+{
+    return FPlatformMisc::GetPlatformUserForUserIndex(0);
+}
+
+FString FMockOnlineIdentity::GetAuthType() const
+{
+    return FString();
+}
+
+//
+// FMockOnlineSession
+//
+
+FUniqueNetIdPtr FMockOnlineSession::CreateSessionIdFromString(const FString &SessionIdStr)
+{
+    return FMockOnlineSubsystem::MakeUserId(SessionIdStr);
+}
+
+FNamedOnlineSession *FMockOnlineSession::GetNamedSession(FName SessionName)
+{
+    for (auto &Session : this->Sessions)
+    {
+        if (Session.SessionName == SessionName)
+        {
+            return &Session;
+        }
+    }
+    return nullptr;
+}
+
+void FMockOnlineSession::RemoveNamedSession(FName SessionName)
+{
+    this->Sessions.RemoveAll([SessionName](const FNamedOnlineSession &Session) {
+        return Session.SessionName == SessionName;
+    });
+}
+
+bool FMockOnlineSession::HasPresenceSession()
+{
+    for (const auto &Session : this->Sessions)
+    {
+        if (Session.SessionSettings.bUsesPresence)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+EOnlineSessionState::Type FMockOnlineSession::GetSessionState(FName SessionName) const
+{
+    for (const auto &Session : this->Sessions)
+    {
+        if (Session.SessionName == SessionName)
+        {
+            return Session.SessionState;
+        }
+    }
+    return EOnlineSessionState::NoSession;
+}
+
+bool FMockOnlineSession::CreateSession(
+    int32 HostingPlayerNum,
+    FName SessionName,
+    const FOnlineSessionSettings &NewSessionSettings)
+{
+    if (this->GetNamedSession(SessionName) != nullptr)
+    {
+        return false;
+    }
+
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Session.CreateSession"));
+    this->Subsystem.Defer([this, HostingPlayerNum, SessionName, NewSessionSettings, bSucceeded]() {
+        if (bSucceeded)
+        {
+            FNamedOnlineSession *Session = this->AddNamedSession(SessionName, NewSessionSettings);
+            Session->HostingPlayerNum = HostingPlayerNum;
+            Session->OwningUserId = this->Subsystem.GetLocalUserId();
+            Session->OwningUserName = TEXT("Mock Player");
+            Session->SessionInfo = MakeShared<FMockSessionInfo>(
+                FMockOnlineSubsystem::MakeUserId(FString::Printf(TEXT("local-%s"), *SessionName.ToString())));
+            Session->NumOpenPublicConnections = NewSessionSettings.NumPublicConnections;
+            Session->SessionState = EOnlineSessionState::Pending;
+        }
+        this->TriggerOnCreateSessionCompleteDelegates(SessionName, bSucceeded);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::CreateSession(
+    const FUniqueNetId &HostingPlayerId,
+    FName SessionName,
+    const FOnlineSessionSettings &NewSessionSettings)
+{
+    return this->CreateSession(0, SessionName, NewSessionSettings);
+}
+
+bool FMockOnlineSession::StartSession(FName SessionName)
+{
+    FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+    if (Session == nullptr ||
+        (Session->SessionState != EOnlineSessionState::Pending && Session->SessionState != EOnlineSessionState::Ended))
+    {
+        return false;
+    }
+
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Session.StartSession"));
+    this->Subsystem.Defer([this, SessionName, bSucceeded]() {
+        FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+        if (bSucceeded && Session != nullptr)
+        {
+            Session->SessionState = EOnlineSessionState::InProgress;
+        }
+        this->TriggerOnStartSessionCompleteDelegates(SessionName, bSucceeded && Session != nullptr);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::UpdateSession(
+    FName SessionName,
+    FOnlineSessionSettings &UpdatedSessionSettings,
+    bool bShouldRefreshOnlineData)
+{
+    FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+    if (Session == nullptr)
+    {
+        return false;
+    }
+    Session->SessionSettings = UpdatedSessionSettings;
+    this->Subsystem.Defer([this, SessionName]() {
+        this->TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::EndSession(FName SessionName)
+{
+    FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+    if (Session == nullptr || Session->SessionState != EOnlineSessionState::InProgress)
+    {
+        return false;
+    }
+
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Session.EndSession"));
+    this->Subsystem.Defer([this, SessionName, bSucceeded]() {
+        FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+        if (bSucceeded && Session != nullptr)
+        {
+            Session->SessionState = EOnlineSessionState::Ended;
+        }
+        this->TriggerOnEndSessionCompleteDelegates(SessionName, bSucceeded && Session != nullptr);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::DestroySession(FName SessionName, const FOnDestroySessionCompleteDelegate &CompletionDelegate)
+{
+    if (this->GetNamedSession(SessionName) == nullptr)
+    {
+        return false;
+    }
+
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Session.DestroySession"));
+    this->Subsystem.Defer([this, SessionName, CompletionDelegate, bSucceeded]() {
+        if (bSucceeded)
+        {
+            this->RemoveNamedSession(SessionName);
+        }
+        CompletionDelegate.ExecuteIfBound(SessionName, bSucceeded);
+        this->TriggerOnDestroySessionCompleteDelegates(SessionName, bSucceeded);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::IsPlayerInSession(FName SessionName, const FUniqueNetId &UniqueId)
+{
+    FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+    if (Session == nullptr)
+    {
+        return false;
+    }
+    return Session->RegisteredPlayers.ContainsByPredicate([&UniqueId](const FUniqueNetIdRef &PlayerId) {
+        return *PlayerId == UniqueId;
+    });
+}
+
+bool FMockOnlineSession::StartMatchmaking(
+    const TArray<FUniqueNetIdRef> &LocalPlayers,
+    FName SessionName,
+    const FOnlineSessionSettings &NewSessionSettings,
+    TSharedRef<FOnlineSessionSearch> &SearchSettings)
+{
+    return false;
+}
+
+bool FMockOnlineSession::CancelMatchmaking(int32 SearchingPlayerNum, FName SessionName)
+{
+    return false;
+}
+
+bool FMockOnlineSession::CancelMatchmaking(const FUniqueNetId &SearchingPlayerId, FName SessionName)
+{
+    return false;
+}
+
+bool FMockOnlineSession::FindSessions(int32 SearchingPlayerNum, const TSharedRef<FOnlineSessionSearch> &SearchSettings)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Session.FindSessions"));
+    SearchSettings->SearchState = EOnlineAsyncTaskState::InProgress;
+    this->Subsystem.Defer([this, SearchSettings, bSucceeded]() {
+        if (bSucceeded)
+        {
+            SearchSettings->SearchResults = this->AdvertisedSessions;
+            SearchSettings->SearchState = EOnlineAsyncTaskState::Done;
+        }
+        else
+        {
+            SearchSettings->SearchResults.Reset();
+            SearchSettings->SearchState = EOnlineAsyncTaskState::Failed;
+        }
+        this->TriggerOnFindSessionsCompleteDelegates(bSucceeded);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::FindSessions(
+    const FUniqueNetId &SearchingPlayerId,
+    const TSharedRef<FOnlineSessionSearch> &SearchSettings)
+{
+    return this->FindSessions(0, SearchSettings);
+}
+
+bool FMockOnlineSession::FindSessionById(
+    const FUniqueNetId &SearchingUserId,
+    const FUniqueNetId &SessionId,
+    const FUniqueNetId &FriendId,
+    const FOnSingleSessionResultCompleteDelegate &CompletionDelegate)
+{
+    return false;
+}
+
+bool FMockOnlineSession::CancelFindSessions()
+{
+    this->Subsystem.Defer([this]() {
+        this->TriggerOnCancelFindSessionsCompleteDelegates(true);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::PingSearchResults(const FOnlineSessionSearchResult &SearchResult)
+{
+    return false;
+}
+
+bool FMockOnlineSession::JoinSession(int32 LocalUserNum, FName SessionName, const FOnlineSessionSearchResult &DesiredSession)
+{
+    bool bAlreadyInSession = this->GetNamedSession(SessionName) != nullptr;
+    bool bSucceeded = !bAlreadyInSession && this->Subsystem.BeginCall(TEXT("Session.JoinSession"));
+    this->Subsystem.Defer([this, LocalUserNum, SessionName, DesiredSession, bAlreadyInSession, bSucceeded]() {
+        EOnJoinSessionCompleteResult::Type Result = EOnJoinSessionCompleteResult::Success;
+        if (bAlreadyInSession)
+        {
+            Result = EOnJoinSessionCompleteResult::AlreadyInSession;
+        }
+        else if (!bSucceeded)
+        {
+            Result = EOnJoinSessionCompleteResult::UnknownError;
+        }
+        else if (DesiredSession.Session.NumOpenPublicConnections <= 0)
+        {
+            Result = EOnJoinSessionCompleteResult::SessionIsFull;
+        }
+
+        if (Result == EOnJoinSessionCompleteResult::Success)
+        {
+            FNamedOnlineSession *Session = this->AddNamedSession(SessionName, DesiredSession.Session);
+            Session->HostingPlayerNum = LocalUserNum;
+            Session->SessionState = EOnlineSessionState::Pending;
+        }
+        this->TriggerOnJoinSessionCompleteDelegates(SessionName, Result);
+    });
+    return true;
+}
+
+bool FMockOnlineSession::JoinSession(
+    const FUniqueNetId &LocalUserId,
+    FName SessionName,
+    const FOnlineSessionSearchResult &DesiredSession)
+{
+    return this->JoinSession(0, SessionName, DesiredSession);
+}
+
+bool FMockOnlineSession::FindFriendSession(int32 LocalUserNum, const FUniqueNetId &Friend)
+{
+    return false;
+}
+
+bool FMockOnlineSession::FindFriendSession(const FUniqueNetId &LocalUserId, const FUniqueNetId &Friend)
+{
+    return false;
+}
+
+bool FMockOnlineSession::FindFriendSession(const FUniqueNetId &LocalUserId, const TArray<FUniqueNetIdRef> &FriendList)
+{
+    return false;
+}
+
+bool FMockOnlineSession::SendSessionInviteToFriend(int32 LocalUserNum, FName SessionName, const FUniqueNetId &Friend)
+{
+    return this->GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMockOnlineSession::SendSessionInviteToFriend(
+    const FUniqueNetId &LocalUserId,
+    FName SessionName,
+    const FUniqueNetId &Friend)
+{
+    return this->GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMockOnlineSession::SendSessionInviteToFriends(
+    int32 LocalUserNum,
+    FName SessionName,
+    const TArray<FUniqueNetIdRef> &Friends)
+{
+    return this->GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMockOnlineSession::SendSessionInviteToFriends(
+    const FUniqueNetId &LocalUserId,
+    FName SessionName,
+    const TArray<FUniqueNetIdRef> &Friends)
+{
+    return this->GetNamedSession(SessionName) != nullptr;
+}
+
+bool FMockOnlineSession::GetResolvedConnectString(FName SessionName, FString &ConnectInfo, FName PortType)
+{
+    if (this->GetNamedSession(SessionName) == nullptr)
+    {
+        return false;
+    }
+    ConnectInfo = TEXT("127.0.0.1:7777");
+    return true;
+}
+
+bool FMockOnlineSession::GetResolvedConnectString(
+    const FOnlineSessionSearchResult &SearchResult,
+    FName PortType,
+    FString &ConnectInfo)
+{
+    if (!SearchResult.Session.SessionInfo.IsValid())
+    {
+        return false;
+    }
+    ConnectInfo = TEXT("127.0.0.1:7777");
+    return true;
+}
+
+FOnlineSessionSettings *FMockOnlineSession::GetSessionSettings(FName SessionName)
+{
+    FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+    return Session != nullptr ? &Session->SessionSettings : nullptr;
+}
+
+bool FMockOnlineSession::UpdateRegisteredPlayers(FName SessionName, const TArray<FUniqueNetIdRef> &Players, bool bRegister)
+{
+    if (this->GetNamedSession(SessionName) == nullptr)
+    {
+        return false;
+    }
+
+    bool bSucceeded =
+        this->Subsystem.BeginCall(bRegister ? TEXT("Session.RegisterPlayers") : TEXT("Session.UnregisterPlayers"));
+    this->Subsystem.Defer([this, SessionName, Players, bRegister, bSucceeded]() {
+        FNamedOnlineSession *Session = this->GetNamedSession(SessionName);
+        if (bSucceeded && Session != nullptr)
+        {
+            for (const auto &Player : Players)
+            {
+                int32 Index = Session->RegisteredPlayers.IndexOfByPredicate([&Player](const FUniqueNetIdRef &PlayerId) {
+                    return *PlayerId == *Player;
+                });
+                if (bRegister && Index == INDEX_NONE)
+                {
+                    Session->RegisteredPlayers.Add(Player);
+                }
+                else if (!bRegister && Index != INDEX_NONE)
+                {
+                    Session->RegisteredPlayers.RemoveAt(Index);
+                }
+            }
+        }
+
+        if (bRegister)
+        {
+            this->TriggerOnRegisterPlayersCompleteDelegates(SessionName, Players, bSucceeded && Session != nullptr);
+        }
+        else
+        {
+            this->TriggerOnUnregisterPlayersCompleteDelegates(SessionName, Players, bSucceeded && Session != nullptr);
+        }
+    });
+    return true;
+}
+
+bool FMockOnlineSession::RegisterPlayer(FName SessionName, const FUniqueNetId &PlayerId, bool bWasInvited)
+{
+    return this->UpdateRegisteredPlayers(SessionName, TArray<FUniqueNetIdRef>{PlayerId.AsShared()}, true);
+}
+
+bool FMockOnlineSession::RegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef> &Players, bool bWasInvited)
+{
+    return this->UpdateRegisteredPlayers(SessionName, Players, true);
+}
+
+bool FMockOnlineSession::UnregisterPlayer(FName SessionName, const FUniqueNetId &PlayerId)
+{
+    return this->UpdateRegisteredPlayers(SessionName, TArray<FUniqueNetIdRef>{PlayerId.AsShared()}, false);
+}
+
+bool FMockOnlineSession::UnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef> &Players)
+{
+    return this->UpdateRegisteredPlayers(SessionName, Players, false);
+}
+
+void FMockOnlineSession::RegisterLocalPlayer(
+    const FUniqueNetId &PlayerId,
+    FName SessionName,
+    const FOnRegisterLocalPlayerCompleteDelegate &Delegate)
+{
+    Delegate.ExecuteIfBound(PlayerId, EOnJoinSessionCompleteResult::Success);
+}
+
+void FMockOnlineSession::UnregisterLocalPlayer(
+    const FUniqueNetId &PlayerId,
+    FName SessionName,
+    const FOnUnregisterLocalPlayerCompleteDelegate &Delegate)
+{
+    Delegate.ExecuteIfBound(PlayerId, true);
+}
+
+void FMockOnlineSession::RemovePlayerFromSession(int32 LocalUserNum, FName SessionName, const FUniqueNetId &TargetPlayerId)
+{
+    if (FNamedOnlineSession *Session = this->GetNamedSession(SessionName))
+    {
+        Session->RegisteredPlayers.RemoveAll([&TargetPlayerId](const FUniqueNetIdRef &PlayerId) {
+            return *PlayerId == TargetPlayerId;
+        });
+    }
+}
+
+int32 FMockOnlineSession::GetNumSessions()
+{
+    return this->Sessions.Num();
+}
+
+void FMockOnlineSession::DumpSessionState()
+{
+}
+
+FNamedOnlineSession *FMockOnlineSession::AddNamedSession(FName SessionName, const FOnlineSessionSettings &SessionSettings)
+{
+    return &this->Sessions.Emplace_GetRef(SessionName, SessionSettings);
+}
+
+FNamedOnlineSession *FMockOnlineSession::AddNamedSession(FName SessionName, const FOnlineSession &Session)
+{
+    return &this->Sessions.Emplace_GetRef(SessionName, Session);
+}
+
+//
+// FMockOnlineFriends
+//
+
+TSharedPtr<FMockOnlineFriend> FMockOnlineFriends::FindFriend(const FUniqueNetId &FriendId) const
+{
+    for (const auto &Friend : this->Friends)
+    {
+        if (*Friend->UserId == FriendId)
+        {
+            return Friend;
+        }
+    }
+    return nullptr;
+}
+
+bool FMockOnlineFriends::ReadFriendsList(int32 LocalUserNum, const FString &ListName, const FOnReadFriendsListComplete &Delegate)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Friends.ReadFriendsList"));
+    this->Subsystem.Defer([LocalUserNum, ListName, Delegate, bSucceeded]() {
+        Delegate.ExecuteIfBound(LocalUserNum, bSucceeded, ListName, bSucceeded ? FString() : TEXT("ReadFriendsList failed."));
+    });
+    return true;
+}
+
+bool FMockOnlineFriends::DeleteFriendsList(
+    int32 LocalUserNum,
+    const FString &ListName,
+    const FOnDeleteFriendsListComplete &Delegate)
+{
+    return false;
+}
+
+bool FMockOnlineFriends::SendInvite(
+    int32 LocalUserNum,
+    const FUniqueNetId &FriendId,
+    const FString &ListName,
+    const FOnSendInviteComplete &Delegate)
+{
+    FUniqueNetIdRef TargetId = FriendId.AsShared();
+    bool bSucceeded = !this->FindFriend(FriendId).IsValid() && this->Subsystem.BeginCall(TEXT("Friends.SendInvite"));
+    this->Subsystem.Defer([this, LocalUserNum, TargetId, ListName, Delegate, bSucceeded]() {
+        if (bSucceeded)
+        {
+            auto Friend = MakeShared<FMockOnlineFriend>(TargetId);
+            Friend->DisplayName = TargetId->ToString();
+            Friend->InviteStatus = EInviteStatus::PendingOutbound;
+            this->Friends.Add(Friend);
+        }
+        Delegate.ExecuteIfBound(LocalUserNum, bSucceeded, *TargetId, ListName, bSucceeded ? FString() : TEXT("SendInvite failed."));
+    });
+    return true;
+}
+
+bool FMockOnlineFriends::AcceptInvite(
+    int32 LocalUserNum,
+    const FUniqueNetId &FriendId,
+    const FString &ListName,
+    const FOnAcceptInviteComplete &Delegate)
+{
+    FUniqueNetIdRef TargetId = FriendId.AsShared();
+    auto Friend = this->FindFriend(FriendId);
+    bool bSucceeded = Friend.IsValid() && Friend->InviteStatus == EInviteStatus::PendingInbound &&
+                      this->Subsystem.BeginCall(TEXT("Friends.AcceptInvite"));
+    this->Subsystem.Defer([LocalUserNum, TargetId, ListName, Delegate, Friend, bSucceeded]() {
+        if (bSucceeded)
+        {
+            Friend->InviteStatus = EInviteStatus::Accepted;
+        }
+        Delegate.ExecuteIfBound(LocalUserNum, bSucceeded, *TargetId, ListName, bSucceeded ? FString() : TEXT("AcceptInvite failed."));
+    });
+    return true;
+}
+
+bool FMockOnlineFriends::RejectInvite(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName)
+{
+    auto Friend = this->FindFriend(FriendId);
+    if (!Friend.IsValid() || Friend->InviteStatus != EInviteStatus::PendingInbound)
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef TargetId = FriendId.AsShared();
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Friends.RejectInvite"));
+    this->Subsystem.Defer([this, LocalUserNum, TargetId, ListName, Friend, bSucceeded]() {
+        if (bSucceeded)
+        {
+            this->Friends.Remove(Friend.ToSharedRef());
+        }
+        this->TriggerOnRejectInviteCompleteDelegates(
+            LocalUserNum,
+            bSucceeded,
+            *TargetId,
+            ListName,
+            bSucceeded ? FString() : TEXT("RejectInvite failed."));
+    });
+    return true;
+}
+
+void FMockOnlineFriends::SetFriendAlias(
+    int32 LocalUserNum,
+    const FUniqueNetId &FriendId,
+    const FString &ListName,
+    const FString &Alias,
+    const FOnSetFriendAliasComplete &Delegate)
+{
+    FUniqueNetIdRef TargetId = FriendId.AsShared();
+    auto Friend = this->FindFriend(FriendId);
+    bool bSucceeded = Friend.IsValid() && this->Subsystem.BeginCall(TEXT("Friends.SetFriendAlias"));
+    this->Subsystem.Defer([LocalUserNum, TargetId, ListName, Alias, Delegate, Friend, bSucceeded]() {
+        if (bSucceeded)
+        {
+            Friend->DisplayName = Alias;
+        }
+        Delegate.ExecuteIfBound(LocalUserNum, *TargetId, ListName, FOnlineError(bSucceeded));
+    });
+}
+
+void FMockOnlineFriends::DeleteFriendAlias(
+    int32 LocalUserNum,
+    const FUniqueNetId &FriendId,
+    const FString &ListName,
+    const FOnDeleteFriendAliasComplete &Delegate)
+{
+    FUniqueNetIdRef TargetId = FriendId.AsShared();
+    auto Friend = this->FindFriend(FriendId);
+    bool bSucceeded = Friend.IsValid() && this->Subsystem.BeginCall(TEXT("Friends.DeleteFriendAlias"));
+    this->Subsystem.Defer([LocalUserNum, TargetId, ListName, Delegate, Friend, bSucceeded]() {
+        if (bSucceeded)
+        {
+            Friend->DisplayName = TargetId->ToString();
+        }
+        Delegate.ExecuteIfBound(LocalUserNum, *TargetId, ListName, FOnlineError(bSucceeded));
+    });
+}
+
+bool FMockOnlineFriends::DeleteFriend(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName)
+{
+    auto Friend = this->FindFriend(FriendId);
+    if (!Friend.IsValid())
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef TargetId = FriendId.AsShared();
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Friends.DeleteFriend"));
+    this->Subsystem.Defer([this, LocalUserNum, TargetId, ListName, Friend, bSucceeded]() {
+        if (bSucceeded)
+        {
+            this->Friends.Remove(Friend.ToSharedRef());
+        }
+        this->TriggerOnDeleteFriendCompleteDelegates(
+            LocalUserNum,
+            bSucceeded,
+            *TargetId,
+            ListName,
+            bSucceeded ? FString() : TEXT("DeleteFriend failed."));
+    });
+    return true;
+}
+
+bool FMockOnlineFriends::GetFriendsList(int32 LocalUserNum, const FString &ListName, TArray<TSharedRef<FOnlineFriend>> &OutFriends)
+{
+    OutFriends.Reset(this->Friends.Num());
+    for (const auto &Friend : this->Friends)
+    {
+        OutFriends.Add(Friend);
+    }
+    return true;
+}
+
+TSharedPtr<FOnlineFriend> FMockOnlineFriends::GetFriend(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName)
+{
+    return this->FindFriend(FriendId);
+}
+
+bool FMockOnlineFriends::IsFriend(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName)
+{
+    auto Friend = this->FindFriend(FriendId);
+    return Friend.IsValid() && Friend->InviteStatus == EInviteStatus::Accepted;
+}
+
+bool FMockOnlineFriends::QueryRecentPlayers(const FUniqueNetId &UserId, const FString &Namespace)
+{
+    return false;
+}
+
+bool FMockOnlineFriends::GetRecentPlayers(
+    const FUniqueNetId &UserId,
+    const FString &Namespace,
+    TArray<TSharedRef<FOnlineRecentPlayer>> &OutRecentPlayers)
+{
+    OutRecentPlayers.Reset();
+    return false;
+}
+
+void FMockOnlineFriends::DumpRecentPlayers() const
+{
+}
+
+bool FMockOnlineFriends::BlockPlayer(int32 LocalUserNum, const FUniqueNetId &PlayerId)
+{
+    return false;
+}
+
+bool FMockOnlineFriends::UnblockPlayer(int32 LocalUserNum, const FUniqueNetId &PlayerId)
+{
+    return false;
+}
+
+bool FMockOnlineFriends::QueryBlockedPlayers(const FUniqueNetId &UserId)
+{
+    return false;
+}
+
+bool FMockOnlineFriends::GetBlockedPlayers(const FUniqueNetId &UserId, TArray<TSharedRef<FOnlineUser>> &OutBlockedUsers)
+{
+    OutBlockedUsers.Reset();
+    return false;
+}
+
+void FMockOnlineFriends::DumpBlockedPlayers() const
+{
+}
+
+//
+// FMockOnlinePartySystem
+//
+
+FMockOnlinePartySystem::FMockParty *FMockOnlinePartySystem::FindParty(const FOnlinePartyId &PartyId)
+{
+    return this->Parties.FindByPredicate([&PartyId](const FMockParty &Party) {
+        return Party.PartyId->ToString() == PartyId.ToString();
+    });
+}
+
+const FMockOnlinePartySystem::FMockParty *FMockOnlinePartySystem::FindParty(const FOnlinePartyId &PartyId) const
+{
+    return this->Parties.FindByPredicate([&PartyId](const FMockParty &Party) {
+        return Party.PartyId->ToString() == PartyId.ToString();
+    });
+}
+
+bool FMockOnlinePartySystem::RestoreParties(const FUniqueNetId &LocalUserId, const FOnRestorePartiesComplete &CompletionDelegate)
+{
+    return false;
+}
+
+bool FMockOnlinePartySystem::RestoreInvites(const FUniqueNetId &LocalUserId, const FOnRestoreInvitesComplete &CompletionDelegate)
+{
+    return false;
+}
+
+bool FMockOnlinePartySystem::CleanupParties(const FUniqueNetId &LocalUserId, const FOnCleanupPartiesComplete &CompletionDelegate)
+{
+    return false;
+}
+
+bool FMockOnlinePartySystem::CreateParty(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyTypeId PartyTypeId,
+    const FPartyConfiguration &PartyConfig,
+    const FOnCreatePartyComplete &Delegate)
+{
+    FUniqueNetIdRef LocalUser = LocalUserId.AsShared();
+    bool bAlreadyInParty = this->Parties.ContainsByPredicate([PartyTypeId](const FMockParty &Party) {
+        return Party.PartyTypeId == PartyTypeId;
+    });
+    bool bSucceeded = !bAlreadyInParty && this->Subsystem.BeginCall(TEXT("Party.CreateParty"));
+    this->Subsystem.Defer([this, LocalUser, PartyTypeId, Delegate, bAlreadyInParty, bSucceeded]() {
+        if (!bSucceeded)
+        {
+            Delegate.ExecuteIfBound(
+                *LocalUser,
+                TSharedPtr<const FOnlinePartyId>(),
+                bAlreadyInParty ? ECreatePartyCompletionResult::AlreadyInPartyOfSpecifiedType
+                                : ECreatePartyCompletionResult::UnknownInternalFailure);
+            return;
+        }
+
+        TSharedRef<const FMockPartyId> PartyId = MakeShared<FMockPartyId>(FString::Printf(TEXT("party-%d"), this->NextPartyId++));
+        FMockParty &Party = this->Parties.Add_GetRef(FMockParty{PartyId, PartyTypeId});
+        Party.Members.Add(LocalUser);
+        Delegate.ExecuteIfBound(*LocalUser, TSharedPtr<const FOnlinePartyId>(PartyId), ECreatePartyCompletionResult::Succeeded);
+    });
+    return true;
+}
+
+bool FMockOnlinePartySystem::UpdateParty(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FPartyConfiguration &PartyConfig,
+    bool bShouldRegenerateReservationKey,
+    const FOnUpdatePartyComplete &Delegate)
+{
+    return false;
+}
+
+bool FMockOnlinePartySystem::JoinParty(
+    const FUniqueNetId &LocalUserId,
+    const IOnlinePartyJoinInfo &OnlinePartyJoinInfo,
+    const FOnJoinPartyComplete &Delegate)
+{
+    // @note: Nobody else hosts parties in the mock, so there is never anything to join.
+    FUniqueNetIdRef LocalUser = LocalUserId.AsShared();
+    TSharedRef<const FOnlinePartyId> PartyId = OnlinePartyJoinInfo.GetPartyId();
+    this->Subsystem.BeginCall(TEXT("Party.JoinParty"));
+    this->Subsystem.Defer([LocalUser, PartyId, Delegate]() {
+        Delegate.ExecuteIfBound(*LocalUser, *PartyId, EJoinPartyCompletionResult::JoinInfoInvalid, 0);
+    });
+    return true;
+}
+
+void FMockOnlinePartySystem::RequestToJoinParty(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyTypeId PartyTypeId,
+    const FPartyInvitationRecipient &Recipient,
+    const FOnRequestToJoinPartyComplete &Delegate)
+{
+}
+
+void FMockOnlinePartySystem::ClearRequestToJoinParty(
+    const FUniqueNetId &LocalUserId,
+    const FUniqueNetId &Sender,
+    EPartyRequestToJoinRemovedReason Reason)
+{
+}
+
+void FMockOnlinePartySystem::QueryPartyJoinability(
+    const FUniqueNetId &LocalUserId,
+    const IOnlinePartyJoinInfo &OnlinePartyJoinInfo,
+    const FOnQueryPartyJoinabilityCompleteEx &Delegate)
+{
+}
+
+#if !REDPOINT_EXAMPLE_UE_5_5_OR_LATER
+bool FMockOnlinePartySystem::RejoinParty(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FOnlinePartyTypeId &PartyTypeId,
+    const TArray<FUniqueNetIdRef> &FormerMembers,
+    const FOnJoinPartyComplete &Delegate)
+{
+    return false;
+}
+#endif
+
+bool FMockOnlinePartySystem::LeaveParty(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FOnLeavePartyComplete &Delegate)
+{
+    return this->LeaveParty(LocalUserId, PartyId, true, Delegate);
+}
+
+bool FMockOnlinePartySystem::LeaveParty(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    bool bSynchronizeLeave,
+    const FOnLeavePartyComplete &Delegate)
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    if (Party == nullptr)
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef LocalUser = LocalUserId.AsShared();
+    TSharedRef<const FMockPartyId> LeftPartyId = Party->PartyId;
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Party.LeaveParty"));
+    this->Subsystem.Defer([this, LocalUser, LeftPartyId, Delegate, bSucceeded]() {
+        if (bSucceeded)
+        {
+            this->Parties.RemoveAll([&LeftPartyId](const FMockParty &Party) {
+                return Party.PartyId == LeftPartyId;
+            });
+        }
+        Delegate.ExecuteIfBound(
+            *LocalUser,
+            *LeftPartyId,
+            bSucceeded ? ELeavePartyCompletionResult::Succeeded : ELeavePartyCompletionResult::UnknownClientFailure);
+    });
+    return true;
+}
+
+bool FMockOnlinePartySystem::ApproveJoinRequest(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &RecipientId,
+    bool bIsApproved,
+    int32 DeniedResultCode)
+{
+    return false;
+}
+
+void FMockOnlinePartySystem::RespondToQueryJoinability(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &RecipientId,
+    bool bCanJoin,
+    int32 DeniedResultCode,
+    FOnlinePartyDataConstPtr PartyData)
+{
+}
+
+bool FMockOnlinePartySystem::SendInvitation(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FPartyInvitationRecipient &Recipient,
+    const FOnSendPartyInvitationComplete &Delegate)
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    if (Party == nullptr)
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef LocalUser = LocalUserId.AsShared();
+    FUniqueNetIdRef RecipientId = Recipient.Id;
+    TSharedRef<const FMockPartyId> InvitedPartyId = Party->PartyId;
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Party.SendInvitation"));
+    this->Subsystem.Defer([this, LocalUser, RecipientId, InvitedPartyId, Delegate, bSucceeded]() {
+        FMockParty *Party = this->FindParty(*InvitedPartyId);
+        if (bSucceeded && Party != nullptr)
+        {
+            Party->InvitedUsers.Add(RecipientId);
+        }
+        Delegate.ExecuteIfBound(
+            *LocalUser,
+            *InvitedPartyId,
+            *RecipientId,
+            bSucceeded && Party != nullptr ? ESendPartyInvitationCompletionResult::Succeeded
+                                           : ESendPartyInvitationCompletionResult::UnknownInternalFailure);
+    });
+    return true;
+}
+
+void FMockOnlinePartySystem::CancelInvitation(
+    const FUniqueNetId &LocalUserId,
+    const FUniqueNetId &TargetUserId,
+    const FOnlinePartyId &PartyId,
+    const FOnCancelPartyInvitationComplete &Delegate)
+{
+    if (FMockParty *Party = this->FindParty(PartyId))
+    {
+        Party->InvitedUsers.RemoveAll([&TargetUserId](const FUniqueNetIdRef &UserId) {
+            return *UserId == TargetUserId;
+        });
+    }
+}
+
+bool FMockOnlinePartySystem::RejectInvitation(const FUniqueNetId &LocalUserId, const FUniqueNetId &SenderId)
+{
+    return false;
+}
+
+void FMockOnlinePartySystem::ClearInvitations(
+    const FUniqueNetId &LocalUserId,
+    const FUniqueNetId &SenderId,
+    const FOnlinePartyId *PartyId)
+{
+}
+
+bool FMockOnlinePartySystem::KickMember(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &TargetMemberId,
+    const FOnKickPartyMemberComplete &Delegate)
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    if (Party == nullptr)
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef LocalUser = LocalUserId.AsShared();
+    FUniqueNetIdRef TargetId = TargetMemberId.AsShared();
+    TSharedRef<const FMockPartyId> KickPartyId = Party->PartyId;
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Party.KickMember"));
+    this->Subsystem.Defer([this, LocalUser, TargetId, KickPartyId, Delegate, bSucceeded]() {
+        EKickMemberCompletionResult Result = EKickMemberCompletionResult::UnknownInternalFailure;
+        FMockParty *Party = this->FindParty(*KickPartyId);
+        if (bSucceeded && Party != nullptr)
+        {
+            int32 Index = Party->Members.IndexOfByPredicate([&TargetId](const FUniqueNetIdRef &MemberId) {
+                return *MemberId == *TargetId;
+            });
+            if (Index == INDEX_NONE)
+            {
+                Result = EKickMemberCompletionResult::RemoteMemberNotMember;
+            }
+            else if (*Party->Members[0] != *LocalUser)
+            {
+                Result = EKickMemberCompletionResult::LocalMemberNotLeader;
+            }
+            else
+            {
+                Party->Members.RemoveAt(Index);
+                Result = EKickMemberCompletionResult::Succeeded;
+            }
+        }
+        Delegate.ExecuteIfBound(*LocalUser, *KickPartyId, *TargetId, Result);
+    });
+    return true;
+}
+
+bool FMockOnlinePartySystem::PromoteMember(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &TargetMemberId,
+    const FOnPromotePartyMemberComplete &Delegate)
+{
+    return false;
+}
+
+bool FMockOnlinePartySystem::UpdatePartyData(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FName &Namespace,
+    const FOnlinePartyData &PartyData)
+{
+    return this->FindParty(PartyId) != nullptr;
+}
+
+bool FMockOnlinePartySystem::UpdatePartyMemberData(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FName &Namespace,
+    const FOnlinePartyData &PartyMemberData)
+{
+    return this->FindParty(PartyId) != nullptr;
+}
+
+bool FMockOnlinePartySystem::IsMemberLeader(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &MemberId) const
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    return Party != nullptr && Party->Members.Num() > 0 && *Party->Members[0] == MemberId;
+}
+
+uint32 FMockOnlinePartySystem::GetPartyMemberCount(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId) const
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    return Party != nullptr ? Party->Members.Num() : 0;
+}
+
+FOnlinePartyConstPtr FMockOnlinePartySystem::GetParty(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId) const
+{
+    return nullptr;
+}
+
+FOnlinePartyConstPtr FMockOnlinePartySystem::GetParty(const FUniqueNetId &LocalUserId, const FOnlinePartyTypeId &PartyTypeId)
+    const
+{
+    return nullptr;
+}
+
+FOnlinePartyMemberConstPtr FMockOnlinePartySystem::GetPartyMember(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &MemberId) const
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    if (Party == nullptr)
+    {
+        return nullptr;
+    }
+    for (const auto &Member : Party->Members)
+    {
+        if (*Member == MemberId)
+        {
+            return MakeShared<FMockPartyMember>(Member);
+        }
+    }
+    return nullptr;
+}
+
+FOnlinePartyDataConstPtr FMockOnlinePartySystem::GetPartyData(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FName &Namespace) const
+{
+    return nullptr;
+}
+
+FOnlinePartyDataConstPtr FMockOnlinePartySystem::GetPartyMemberData(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    const FUniqueNetId &MemberId,
+    const FName &Namespace) const
+{
+    return nullptr;
+}
+
+IOnlinePartyJoinInfoConstPtr FMockOnlinePartySystem::GetAdvertisedParty(
+    const FUniqueNetId &LocalUserId,
+    const FUniqueNetId &UserId,
+    const FOnlinePartyTypeId PartyTypeId) const
+{
+    return nullptr;
+}
+
+bool FMockOnlinePartySystem::GetJoinedParties(
+    const FUniqueNetId &LocalUserId,
+    TArray<TSharedRef<const FOnlinePartyId>> &OutPartyIdArray) const
+{
+    OutPartyIdArray.Reset(this->Parties.Num());
+    for (const auto &Party : this->Parties)
+    {
+        OutPartyIdArray.Add(Party.PartyId);
+    }
+    return true;
+}
+
+bool FMockOnlinePartySystem::GetPartyMembers(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    TArray<FOnlinePartyMemberConstRef> &OutPartyMembersArray) const
+{
+    OutPartyMembersArray.Reset();
+    const FMockParty *Party = this->FindParty(PartyId);
+    if (Party == nullptr)
+    {
+        return false;
+    }
+    for (const auto &Member : Party->Members)
+    {
+        OutPartyMembersArray.Add(MakeShared<FMockPartyMember>(Member));
+    }
+    return true;
+}
+
+bool FMockOnlinePartySystem::GetPendingInvites(
+    const FUniqueNetId &LocalUserId,
+    TArray<IOnlinePartyJoinInfoConstRef> &OutPendingInvitesArray) const
+{
+    OutPendingInvitesArray.Reset();
+    return true;
+}
+
+bool FMockOnlinePartySystem::GetPendingJoinRequests(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    TArray<IOnlinePartyPendingJoinRequestInfoConstRef> &OutPendingJoinRequestArray) const
+{
+    OutPendingJoinRequestArray.Reset();
+    return true;
+}
+
+bool FMockOnlinePartySystem::GetPendingInvitedUsers(
+    const FUniqueNetId &LocalUserId,
+    const FOnlinePartyId &PartyId,
+    TArray<FUniqueNetIdRef> &OutPendingInvitedUserArray) const
+{
+    const FMockParty *Party = this->FindParty(PartyId);
+    if (Party == nullptr)
+    {
+        OutPendingInvitedUserArray.Reset();
+        return false;
+    }
+    OutPendingInvitedUserArray = Party->InvitedUsers;
+    return true;
+}
+
+bool FMockOnlinePartySystem::GetPendingRequestsToJoin(
+    const FUniqueNetId &LocalUserId,
+    TArray<IOnlinePartyRequestToJoinInfoConstRef> &OutRequestsToJoin) const
+{
+    OutRequestsToJoin.Reset();
+    return true;
+}
+
+FString FMockOnlinePartySystem::MakeJoinInfoJson(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId)
+{
+    return FString();
+}
+
+IOnlinePartyJoinInfoConstPtr FMockOnlinePartySystem::MakeJoinInfoFromJson(const FString &JoinInfoJson)
+{
+    return nullptr;
+}
+
+FString FMockOnlinePartySystem::MakeTokenFromJoinInfo(const IOnlinePartyJoinInfo &JoinInfo) const
+{
+    return FString();
+}
+
+IOnlinePartyJoinInfoConstPtr FMockOnlinePartySystem::MakeJoinInfoFromToken(const FString &Token) const
+{
+    return nullptr;
+}
+
+IOnlinePartyJoinInfoConstPtr FMockOnlinePartySystem::ConsumePendingCommandLineJoinInfo()
+{
+    return nullptr;
+}
+
+void FMockOnlinePartySystem::DumpPartyState()
+{
+}
+
+//
+// FMockOnlineLeaderboards
+//
+
+bool FMockOnlineLeaderboards::CompleteRead(
+    FName Api,
+    const FOnlineLeaderboardReadRef &ReadObject,
+    TFunction<void(FOnlineLeaderboardRead &)> Fill)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(Api);
+    ReadObject->ReadState = EOnlineAsyncTaskState::InProgress;
+    this->Subsystem.Defer([this, ReadObject, Fill = MoveTemp(Fill), bSucceeded]() {
+        ReadObject->Rows.Reset();
+        if (bSucceeded)
+        {
+            Fill(*ReadObject);
+        }
+        ReadObject->ReadState = bSucceeded ? EOnlineAsyncTaskState::Done : EOnlineAsyncTaskState::Failed;
+        this->TriggerOnLeaderboardReadCompleteDelegates(bSucceeded);
+    });
+    return true;
+}
+
+bool FMockOnlineLeaderboards::ReadLeaderboards(const TArray<FUniqueNetIdRef> &Players, FOnlineLeaderboardReadRef &ReadObject)
+{
+    return this->CompleteRead(TEXT("Leaderboards.ReadLeaderboards"), ReadObject, [this, Players](FOnlineLeaderboardRead &Read) {
+        const TArray<FOnlineStatsRow> *Rows = this->Leaderboards.Find(GetLeaderboardName(Read));
+        if (Rows == nullptr)
+        {
+            return;
+        }
+        for (const auto &Row : *Rows)
+        {
+            for (const auto &Player : Players)
+            {
+                if (*Row.PlayerId == *Player)
+                {
+                    Read.Rows.Add(Row);
+                    break;
+                }
+            }
+        }
+    });
+}
+
+bool FMockOnlineLeaderboards::ReadLeaderboardsForFriends(int32 LocalUserNum, FOnlineLeaderboardReadRef &ReadObject)
+{
+    return this->CompleteRead(TEXT("Leaderboards.ReadLeaderboardsForFriends"), ReadObject, [this](FOnlineLeaderboardRead &Read) {
+        // Every friend reports each requested column, with a score derived from their position in the list.
+        const auto &Friends = this->Subsystem.Friends->Friends;
+        for (int32 Index = 0; Index < Friends.Num(); Index++)
+        {
+            FOnlineStatsRow &Row = Read.Rows.Emplace_GetRef(Friends[Index]->DisplayName, Friends[Index]->UserId);
+            Row.Rank = Index + 1;
+            for (const auto &Column : Read.ColumnMetadata)
+            {
+                Row.Columns.Add(Column.ColumnName, MakeIntValue(Friends.Num() - Index));
+            }
+        }
+    });
+}
+
+bool FMockOnlineLeaderboards::ReadLeaderboardsAroundRank(int32 Rank, uint32 Range, FOnlineLeaderboardReadRef &ReadObject)
+{
+    return this->CompleteRead(TEXT("Leaderboards.ReadLeaderboardsAroundRank"), ReadObject, [this, Rank, Range](FOnlineLeaderboardRead &Read) {
+        // Ranks are contiguous from 1, so the rows from Rank - Range to Rank + Range are a slice of the board.
+        const TArray<FOnlineStatsRow> *Rows = this->Leaderboards.Find(GetLeaderboardName(Read));
+        if (Rows == nullptr)
+        {
+            return;
+        }
+        int64 FirstRank = FMath::Max<int64>(static_cast<int64>(Rank) - Range, 1);
+        int64 LastRank = FMath::Min<int64>(static_cast<int64>(Rank) + Range, Rows->Num());
+        for (int64 RowRank = FirstRank; RowRank <= LastRank; RowRank++)
+        {
+            Read.Rows.Add((*Rows)[RowRank - 1]);
+        }
+    });
+}
+
+bool FMockOnlineLeaderboards::ReadLeaderboardsAroundUser(FUniqueNetIdRef Player, uint32 Range, FOnlineLeaderboardReadRef &ReadObject)
+{
+    return this->CompleteRead(TEXT("Leaderboards.ReadLeaderboardsAroundUser"), ReadObject, [this, Player, Range](FOnlineLeaderboardRead &Read) {
+        const TArray<FOnlineStatsRow> *Rows = this->Leaderboards.Find(GetLeaderboardName(Read));
+        if (Rows == nullptr)
+        {
+            return;
+        }
+        int32 PlayerIndex = Rows->IndexOfByPredicate([&Player](const FOnlineStatsRow &Row) {
+            return *Row.PlayerId == *Player;
+        });
+        if (PlayerIndex == INDEX_NONE)
+        {
+            return;
+        }
+        int32 First = FMath::Max(PlayerIndex - static_cast<int32>(Range), 0);
+        int32 Last = FMath::Min(PlayerIndex + static_cast<int32>(Range), Rows->Num() - 1);
+        for (int32 Index = First; Index <= Last; Index++)
+        {
+            Read.Rows.Add((*Rows)[Index]);
+        }
+    });
+}
+
+void FMockOnlineLeaderboards::FreeStats(FOnlineLeaderboardRead &ReadObject)
+{
+    ReadObject.Rows.Empty();
+}
+
+bool FMockOnlineLeaderboards::WriteLeaderboards(
+    const FName &SessionName,
+    const FUniqueNetId &Player,
+    FOnlineLeaderboardWrite &WriteObject)
+{
+    return false;
+}
+
+bool FMockOnlineLeaderboards::FlushLeaderboards(const FName &SessionName)
+{
+    return false;
+}
+
+bool FMockOnlineLeaderboards::WriteOnlinePlayerRatings(
+    const FName &SessionName,
+    int32 LeaderboardId,
+    const TArray<FOnlinePlayerScore> &PlayerScores)
+{
+    return false;
+}
+
+//
+// FMockOnlineStats
+//
+
+void FMockOnlineStats::QueryStats(
+    const FUniqueNetIdRef LocalUserId,
+    const FUniqueNetIdRef StatsUser,
+    const FOnlineStatsQueryUserStatsComplete &Delegate)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Stats.QueryStats"));
+    this->Subsystem.Defer([this, StatsUser, Delegate, bSucceeded]() {
+        Delegate.ExecuteIfBound(FOnlineError(bSucceeded), bSucceeded ? this->GetStats(StatsUser) : nullptr);
+    });
+}
+
+void FMockOnlineStats::QueryStats(
+    const FUniqueNetIdRef LocalUserId,
+    const TArray<FUniqueNetIdRef> &StatUsers,
+    const TArray<FString> &StatNames,
+    const FOnlineStatsQueryUsersStatsComplete &Delegate)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Stats.QueryStats"));
+    this->Subsystem.Defer([this, StatUsers, StatNames, Delegate, bSucceeded]() {
+        TArray<TSharedRef<const FOnlineStatsUserStats>> UsersStats;
+        if (bSucceeded)
+        {
+            for (const auto &StatUser : StatUsers)
+            {
+                // Only the local user has stats; everyone else reports an empty set.
+                TMap<FString, FOnlineStatValue> UserStats;
+                if (*StatUser == *this->Subsystem.GetLocalUserId())
+                {
+                    for (const auto &StatName : StatNames)
+                    {
+                        if (const int32 *Value = this->Values.Find(StatName))
+                        {
+                            UserStats.Add(StatName, MakeIntValue(*Value));
+                        }
+                    }
+                }
+                UsersStats.Add(MakeShared<FOnlineStatsUserStats>(StatUser, UserStats));
+            }
+        }
+        Delegate.ExecuteIfBound(FOnlineError(bSucceeded), UsersStats);
+    });
+}
+
+TSharedPtr<const FOnlineStatsUserStats> FMockOnlineStats::GetStats(const FUniqueNetIdRef StatsUserId) const
+{
+    if (*StatsUserId != *this->Subsystem.GetLocalUserId())
+    {
+        return nullptr;
+    }
+    TMap<FString, FOnlineStatValue> UserStats;
+    for (const auto &KV : this->Values)
+    {
+        UserStats.Add(KV.Key, MakeIntValue(KV.Value));
+    }
+    return MakeShared<FOnlineStatsUserStats>(StatsUserId, UserStats);
+}
+
+void FMockOnlineStats::UpdateStats(
+    const FUniqueNetIdRef LocalUserId,
+    const TArray<FOnlineStatsUserUpdatedStats> &UpdatedUserStats,
+    const FOnlineStatsUpdateStatsComplete &Delegate)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("Stats.UpdateStats"));
+    this->Subsystem.Defer([this, UpdatedUserStats, Delegate, bSucceeded]() {
+        if (bSucceeded)
+        {
+            for (const auto &UserStats : UpdatedUserStats)
+            {
+                if (*UserStats.Account != *this->Subsystem.GetLocalUserId())
+                {
+                    continue;
+                }
+                for (const auto &KV : UserStats.Stats)
+                {
+                    int32 Update = 0;
+                    KV.Value.GetValue().GetValue(Update);
+                    int32 *Current = this->Values.Find(KV.Key);
+                    if (Current == nullptr)
+                    {
+                        this->Values.Add(KV.Key, Update);
+                        continue;
+                    }
+                    switch (KV.Value.GetModificationType())
+                    {
+                    case FOnlineStatUpdate::EOnlineStatModificationType::Sum:
+                        *Current += Update;
+                        break;
+                    case FOnlineStatUpdate::EOnlineStatModificationType::Largest:
+                        *Current = FMath::Max(*Current, Update);
+                        break;
+                    case FOnlineStatUpdate::EOnlineStatModificationType::Smallest:
+                        *Current = FMath::Min(*Current, Update);
+                        break;
+                    case FOnlineStatUpdate::EOnlineStatModificationType::Set:
+                    default:
+                        *Current = Update;
+                        break;
+                    }
+                }
+            }
+        }
+        Delegate.ExecuteIfBound(FOnlineError(bSucceeded));
+    });
+}
+
+#if !UE_BUILD_SHIPPING
+void FMockOnlineStats::ResetStats(const FUniqueNetIdRef StatsUserId)
+{
+    this->Values.Reset();
+}
+#endif
+
+//
+// FMockOnlineUserCloud
+//
+
+bool FMockOnlineUserCloud::GetFileContents(const FUniqueNetId &UserId, const FString &FileName, TArray<uint8> &FileContents)
+{
+    const TArray<uint8> *Contents = this->DownloadedFiles.Find(FileName);
+    if (Contents == nullptr)
+    {
+        return false;
+    }
+    FileContents = *Contents;
+    return true;
+}
+
+bool FMockOnlineUserCloud::ClearFiles(const FUniqueNetId &UserId)
+{
+    this->DownloadedFiles.Reset();
+    return true;
+}
+
+bool FMockOnlineUserCloud::ClearFile(const FUniqueNetId &UserId, const FString &FileName)
+{
+    this->DownloadedFiles.Remove(FileName);
+    return true;
+}
+
+void FMockOnlineUserCloud::EnumerateUserFiles(const FUniqueNetId &UserId)
+{
+    FUniqueNetIdRef User = UserId.AsShared();
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("UserCloud.EnumerateUserFiles"));
+    this->Subsystem.Defer([this, User, bSucceeded]() {
+        this->TriggerOnEnumerateUserFilesCompleteDelegates(bSucceeded, *User);
+    });
+}
+
+void FMockOnlineUserCloud::GetUserFileList(const FUniqueNetId &UserId, TArray<FCloudFileHeader> &UserFiles)
+{
+    ListFiles(this->Files, UserFiles);
+}
+
+bool FMockOnlineUserCloud::ReadUserFile(const FUniqueNetId &UserId, const FString &FileName)
+{
+    if (!this->Files.Contains(FileName))
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef User = UserId.AsShared();
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("UserCloud.ReadUserFile"));
+    this->Subsystem.Defer([this, User, FileName, bSucceeded]() {
+        const TArray<uint8> *Contents = this->Files.Find(FileName);
+        if (bSucceeded && Contents != nullptr)
+        {
+            this->DownloadedFiles.Add(FileName, *Contents);
+        }
+        this->TriggerOnReadUserFileCompleteDelegates(bSucceeded && Contents != nullptr, *User, FileName);
+    });
+    return true;
+}
+
+bool FMockOnlineUserCloud::WriteUserFile(
+    const FUniqueNetId &UserId,
+    const FString &FileName,
+    TArray<uint8> &FileContents,
+    bool bCompressBeforeUpload)
+{
+    FUniqueNetIdRef User = UserId.AsShared();
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("UserCloud.WriteUserFile"));
+    this->Subsystem.Defer([this, User, FileName, Contents = FileContents, bSucceeded]() {
+        if (bSucceeded)
+        {
+            this->Files.Add(FileName, Contents);
+        }
+        this->TriggerOnWriteUserFileCompleteDelegates(bSucceeded, *User, FileName);
+    });
+    return true;
+}
+
+void FMockOnlineUserCloud::CancelWriteUserFile(const FUniqueNetId &UserId, const FString &FileName)
+{
+}
+
+bool FMockOnlineUserCloud::DeleteUserFile(
+    const FUniqueNetId &UserId,
+    const FString &FileName,
+    bool bShouldCloudDelete,
+    bool bShouldLocallyDelete)
+{
+    if (!this->Files.Contains(FileName))
+    {
+        return false;
+    }
+
+    FUniqueNetIdRef User = UserId.AsShared();
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("UserCloud.DeleteUserFile"));
+    this->Subsystem.Defer([this, User, FileName, bShouldCloudDelete, bShouldLocallyDelete, bSucceeded]() {
+        if (bSucceeded && bShouldCloudDelete)
+        {
+            this->Files.Remove(FileName);
+        }
+        if (bSucceeded && bShouldLocallyDelete)
+        {
+            this->DownloadedFiles.Remove(FileName);
+        }
+        this->TriggerOnDeleteUserFileCompleteDelegates(bSucceeded, *User, FileName);
+    });
+    return true;
+}
+
+bool FMockOnlineUserCloud::RequestUsageInfo(const FUniqueNetId &UserId)
+{
+    return false;
+}
+
+void FMockOnlineUserCloud::DumpCloudState(const FUniqueNetId &UserId)
+{
+}
+
+void FMockOnlineUserCloud::DumpCloudFileState(const FUniqueNetId &UserId, const FString &FileName)
+{
+}
+
+//
+// FMockOnlineTitleFile
+//
+
+bool FMockOnlineTitleFile::GetFileContents(const FString &FileName, TArray<uint8> &FileContents)
+{
+    const TArray<uint8> *Contents = this->DownloadedFiles.Find(FileName);
+    if (Contents == nullptr)
+    {
+        return false;
+    }
+    FileContents = *Contents;
+    return true;
+}
+
+bool FMockOnlineTitleFile::ClearFiles()
+{
+    this->DownloadedFiles.Reset();
+    return true;
+}
+
+bool FMockOnlineTitleFile::ClearFile(const FString &FileName)
+{
+    this->DownloadedFiles.Remove(FileName);
+    return true;
+}
+
+void FMockOnlineTitleFile::DeleteCachedFiles(bool bSkipEnumerated)
+{
+    this->DownloadedFiles.Reset();
+}
+
+bool FMockOnlineTitleFile::EnumerateFiles(const FPagedQuery &Page)
+{
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("TitleFile.EnumerateFiles"));
+    this->Subsystem.Defer([this, bSucceeded]() {
+        this->TriggerOnEnumerateFilesCompleteDelegates(bSucceeded, bSucceeded ? FString() : TEXT("EnumerateFiles failed."));
+    });
+    return true;
+}
+
+void FMockOnlineTitleFile::GetFileList(TArray<FCloudFileHeader> &OutFiles)
+{
+    ListFiles(this->Files, OutFiles);
+}
+
+bool FMockOnlineTitleFile::ReadFile(const FString &FileName)
+{
+    if (!this->Files.Contains(FileName))
+    {
+        return false;
+    }
+
+    bool bSucceeded = this->Subsystem.BeginCall(TEXT("TitleFile.ReadFile"));
+    this->Subsystem.Defer([this, FileName, bSucceeded]() {
+        const TArray<uint8> *Contents = this->Files.Find(FileName);
+        if (bSucceeded && Contents != nullptr)
+        {
+            this->DownloadedFiles.Add(FileName, *Contents);
+        }
+        this->TriggerOnReadFileCompleteDelegates(bSucceeded && Contents != nullptr, FileName);
+    });
+    return true;
+}
+
+//
+// FMockOnlineSubsystem
+//
+
+FMockOnlineSubsystem::FMockOnlineSubsystem()
+    : FOnlineSubsystemImpl(TEXT("MOSMock"), TEXT("MOSMock"))
+    , FailureRandom(0)
+    , LocalUserId(MakeUserId(TEXT("local-user")))
+    , Identity(MakeShared<FMockOnlineIdentity, ESPMode::ThreadSafe>(*this))
+    , Session(MakeShared<FMockOnlineSession, ESPMode::ThreadSafe>(*this))
+    , Friends(MakeShared<FMockOnlineFriends, ESPMode::ThreadSafe>(*this))
+    , Parties(MakeShared<FMockOnlinePartySystem, ESPMode::ThreadSafe>(*this))
+    , Leaderboards(MakeShared<FMockOnlineLeaderboards, ESPMode::ThreadSafe>(*this))
+    , Stats(MakeShared<FMockOnlineStats, ESPMode::ThreadSafe>(*this))
+    , UserCloud(MakeShared<FMockOnlineUserCloud, ESPMode::ThreadSafe>(*this))
+    , TitleFile(MakeShared<FMockOnlineTitleFile, ESPMode::ThreadSafe>(*this))
+{
+}
+
+FMockOnlineSubsystem::~FMockOnlineSubsystem()
+{
+    if (this->PumpHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(this->PumpHandle);
+    }
+}
+
+FUniqueNetIdRef FMockOnlineSubsystem::MakeUserId(const FString &Id)
+{
+    return FUniqueNetIdString::Create(Id, TEXT("MOSMock"));
+}
+
+void FMockOnlineSubsystem::AddAdvertisedSessions(int32 Count)
+{
+    auto &Sessions = this->Session->AdvertisedSessions;
+    int32 First = Sessions.Num();
+    Sessions.Reserve(First + Count);
+    for (int32 Index = First; Index < First + Count; Index++)
+    {
+        FOnlineSessionSearchResult &Result = Sessions.AddDefaulted_GetRef();
+        Result.Session.OwningUserId = MakeUserId(FString::Printf(TEXT("host-%d"), Index));
+        Result.Session.OwningUserName = FString::Printf(TEXT("Host %d"), Index);
+        Result.Session.SessionInfo = MakeShared<FMockSessionInfo>(MakeUserId(FString::Printf(TEXT("session-%d"), Index)));
+        Result.Session.SessionSettings.NumPublicConnections = 4;
+        Result.Session.SessionSettings.bShouldAdvertise = true;
+        Result.Session.SessionSettings.Set(SEARCH_KEYWORDS, FString(TEXT("MOSSession")), EOnlineDataAdvertisementType::ViaOnlineService);
+
+        // @note: Every fifth session is full, so joins can be tested against both outcomes.
+        Result.Session.NumOpenPublicConnections = Index % 5 == 0 ? 0 : 3;
+        Result.PingInMs = 20 + (Index * 7919) % 200;
+    }
+}
+
+void FMockOnlineSubsystem::AddFriends(int32 Count)
+{
+    auto &FriendsList = this->Friends->Friends;
+    int32 First = FriendsList.Num();
+    FriendsList.Reserve(First + Count);
+    for (int32 Index = First; Index < First + Count; Index++)
+    {
+        auto Friend = MakeShared<FMockOnlineFriend>(MakeUserId(FString::Printf(TEXT("friend-%d"), Index)));
+        Friend->DisplayName = FString::Printf(TEXT("Friend %d"), Index);
+        Friend->Presence.bIsOnline = Index % 2 == 0;
+        Friend->Presence.Status.State = Friend->Presence.bIsOnline ? EOnlinePresenceState::Online : EOnlinePresenceState::Offline;
+        Friend->Presence.Status.StatusStr = Friend->Presence.bIsOnline ? TEXT("In the menus") : FString();
+        FriendsList.Add(Friend);
+    }
+}
+
+void FMockOnlineSubsystem::SetLeaderboard(const FString &LeaderboardName, int32 Count)
+{
+    TArray<FOnlineStatsRow> &Rows = this->Leaderboards->Leaderboards.FindOrAdd(LeaderboardName);
+    Rows.Reset(Count);
+    for (int32 Index = 0; Index < Count; Index++)
+    {
+        FOnlineStatsRow &Row =
+            Rows.Emplace_GetRef(FString::Printf(TEXT("Player %d"), Index), MakeUserId(FString::Printf(TEXT("player-%d"), Index)));
+        Row.Rank = Index + 1;
+        Row.Columns.Add(FStatPropertyArray::KeyType(TEXT("Score")), MakeIntValue(Count - Index));
+    }
+}
+
+bool FMockOnlineSubsystem::BeginCall(FName Api)
+{
+    this->CallCounts.FindOrAdd(Api)++;
+    return this->FailureRate <= 0.0f || this->FailureRandom.GetFraction() >= this->FailureRate;
+}
+
+void FMockOnlineSubsystem::Defer(TFunction<void()> Completion)
+{
+    this->PendingCompletions.Add(FPendingCompletion{FPlatformTime::Seconds() + this->LatencySeconds, MoveTemp(Completion)});
+}
+
+int32 FMockOnlineSubsystem::GetCallCount(FName Api) const
+{
+    const int32 *Count = this->CallCounts.Find(Api);
+    return Count != nullptr ? *Count : 0;
+}
+
+IOnlineSessionPtr FMockOnlineSubsystem::GetSessionInterface() const
+{
+    return this->Session;
+}
+
+IOnlineFriendsPtr FMockOnlineSubsystem::GetFriendsInterface() const
+{
+    return this->Friends;
+}
+
+IOnlinePartyPtr FMockOnlineSubsystem::GetPartyInterface() const
+{
+    return this->Parties;
+}
+
+IOnlineGroupsPtr FMockOnlineSubsystem::GetGroupsInterface() const
+{
+    return nullptr;
+}
+
+IOnlineSharedCloudPtr FMockOnlineSubsystem::GetSharedCloudInterface() const
+{
+    return nullptr;
+}
+
+IOnlineUserCloudPtr FMockOnlineSubsystem::GetUserCloudInterface() const
+{
+    return this->UserCloud;
+}
+
+IOnlineEntitlementsPtr FMockOnlineSubsystem::GetEntitlementsInterface() const
+{
+    return nullptr;
+}
+
+IOnlineLeaderboardsPtr FMockOnlineSubsystem::GetLeaderboardsInterface() const
+{
+    return this->Leaderboards;
+}
+
+IOnlineVoicePtr FMockOnlineSubsystem::GetVoiceInterface() const
+{
+    return nullptr;
+}
+
+IOnlineExternalUIPtr FMockOnlineSubsystem::GetExternalUIInterface() const
+{
+    return nullptr;
+}
+
+IOnlineTimePtr FMockOnlineSubsystem::GetTimeInterface() const
+{
+    return nullptr;
+}
+
+IOnlineIdentityPtr FMockOnlineSubsystem::GetIdentityInterface() const
+{
+    return this->Identity;
+}
+
+IOnlineTitleFilePtr FMockOnlineSubsystem::GetTitleFileInterface() const
+{
+    return this->TitleFile;
+}
+
+IOnlineStoreV2Ptr FMockOnlineSubsystem::GetStoreV2Interface() const
+{
+    return nullptr;
+}
+
+IOnlinePurchasePtr FMockOnlineSubsystem::GetPurchaseInterface() const
+{
+    return nullptr;
+}
+
+IOnlineEventsPtr FMockOnlineSubsystem::GetEventsInterface() const
+{
+    return nullptr;
+}
+
+IOnlineAchievementsPtr FMockOnlineSubsystem::GetAchievementsInterface() const
+{
+    return nullptr;
+}
+
+IOnlineSharingPtr FMockOnlineSubsystem::GetSharingInterface() const
+{
+    return nullptr;
+}
+
+IOnlineUserPtr FMockOnlineSubsystem::GetUserInterface() const
+{
+    return nullptr;
+}
+
+IOnlineMessagePtr FMockOnlineSubsystem::GetMessageInterface() const
+{
+    return nullptr;
+}
+
+IOnlinePresencePtr FMockOnlineSubsystem::GetPresenceInterface() const
+{
+    return nullptr;
+}
+
+IOnlineChatPtr FMockOnlineSubsystem::GetChatInterface() const
+{
+    return nullptr;
+}
+
+IOnlineStatsPtr FMockOnlineSubsystem::GetStatsInterface() const
+{
+    return this->Stats;
+}
+
+IOnlineTurnBasedPtr FMockOnlineSubsystem::GetTurnBasedInterface() const
+{
+    return nullptr;
+}
+
+IOnlineTournamentPtr FMockOnlineSubsystem::GetTournamentInterface() const
+{
+    return nullptr;
+}
+
+bool FMockOnlineSubsystem::Init()
+{
+    // Run the completions that are due every tick; those queued by a completion wait for the next tick, like a real
+    // backend's would.
+    this->PumpHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float) {
+        double Now = FPlatformTime::Seconds();
+        TArray<FPendingCompletion> Due;
+        TArray<FPendingCompletion> NotDue;
+        for (auto &Completion : this->PendingCompletions)
+        {
+            (Completion.DueTime <= Now ? Due : NotDue).Add(MoveTemp(Completion));
+        }
+        this->PendingCompletions = MoveTemp(NotDue);
+        for (const auto &Completion : Due)
+        {
+            Completion.Run();
+        }
+        return true;
+    }));
+    return true;
+}
+
+bool FMockOnlineSubsystem::Shutdown()
+{
+    if (this->PumpHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(this->PumpHandle);
+        this->PumpHandle.Reset();
+    }
+    this->PendingCompletions.Reset();
+    return FOnlineSubsystemImpl::Shutdown();
+}
+
+FString FMockOnlineSubsystem::GetAppId() const
+{
+    return TEXT("MOSMock");
+}
+
+FText FMockOnlineSubsystem::GetOnlineServiceName() const
+{
+    return FText::FromString(TEXT("MOS Mock"));
+}
+
+} // namespace OSS::OnlineAPI::Tests
+
+#endif
@@ -0,0 +1,766 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Containers/Ticker.h"
+#include "Interfaces/OnlineFriendsInterface.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Interfaces/OnlineLeaderboardInterface.h"
+#include "Interfaces/OnlinePartyInterface.h"
+#include "Interfaces/OnlineSessionInterface.h"
+#include "Interfaces/OnlineStatsInterface.h"
+#include "Interfaces/OnlineTitleFileInterface.h"
+#include "Interfaces/OnlineUserCloudInterface.h"
+#include "OnlineSessionSettings.h"
+#include "OnlineSubsystemImpl.h"
+
+namespace OSS::OnlineAPI::Tests
+{
+
+class FMockOnlineSubsystem;
+
+/** Session, party and user ids handed out by the mock backend. */
+class FMockSessionInfo : public FOnlineSessionInfo
+{
+private:
+    FUniqueNetIdRef SessionId;
+
+public:
+    explicit FMockSessionInfo(const FUniqueNetIdRef &InSessionId)
+        : SessionId(InSessionId)
+    {
+    }
+
+    virtual const uint8 *GetBytes() const override
+    {
+        return nullptr;
+    }
+    virtual int32 GetSize() const override
+    {
+        return 0;
+    }
+    virtual bool IsValid() const override
+    {
+        return true;
+    }
+    virtual const FUniqueNetId &GetSessionId() const override
+    {
+        return *this->SessionId;
+    }
+    virtual FString ToString() const override
+    {
+        return this->SessionId->ToString();
+    }
+    virtual FString ToDebugString() const override
+    {
+        return this->SessionId->ToString();
+    }
+};
+
+class FMockPartyId : public FOnlinePartyId
+{
+private:
+    FString Id;
+
+public:
+    explicit FMockPartyId(const FString &InId)
+        : Id(InId)
+    {
+    }
+
+    virtual const uint8 *GetBytes() const override
+    {
+        return reinterpret_cast<const uint8 *>(*this->Id);
+    }
+    virtual int32 GetSize() const override
+    {
+        return this->Id.Len() * sizeof(TCHAR);
+    }
+    virtual bool IsValid() const override
+    {
+        return !this->Id.IsEmpty();
+    }
+    virtual FString ToString() const override
+    {
+        return this->Id;
+    }
+    virtual FString ToDebugString() const override
+    {
+        return this->Id;
+    }
+};
+
+class FMockOnlineFriend : public FOnlineFriend
+{
+public:
+    FUniqueNetIdRef UserId;
+    FString DisplayName;
+    EInviteStatus::Type InviteStatus = EInviteStatus::Accepted;
+    FOnlineUserPresence Presence;
+
+    explicit FMockOnlineFriend(const FUniqueNetIdRef &InUserId)
+        : UserId(InUserId)
+    {
+    }
+
+    virtual FUniqueNetIdRef GetUserId() const override
+    {
+        return this->UserId;
+    }
+    virtual FString GetRealName() const override
+    {
+        return this->DisplayName;
+    }
+    virtual FString GetDisplayName(const FString &Platform = FString()) const override
+    {
+        return this->DisplayName;
+    }
+    virtual bool GetUserAttribute(const FString &AttrName, FString &OutAttrValue) const override
+    {
+        return false;
+    }
+    virtual EInviteStatus::Type GetInviteStatus() const override
+    {
+        return this->InviteStatus;
+    }
+    virtual const FOnlineUserPresence &GetPresence() const override
+    {
+        return this->Presence;
+    }
+};
+
+class FMockPartyMember : public FOnlinePartyMember
+{
+private:
+    FUniqueNetIdRef UserId;
+
+public:
+    explicit FMockPartyMember(const FUniqueNetIdRef &InUserId)
+        : UserId(InUserId)
+    {
+    }
+
+    virtual FUniqueNetIdRef GetUserId() const override
+    {
+        return this->UserId;
+    }
+    virtual FString GetRealName() const override
+    {
+        return this->UserId->ToString();
+    }
+    virtual FString GetDisplayName(const FString &Platform = FString()) const override
+    {
+        return this->UserId->ToString();
+    }
+    virtual bool GetUserAttribute(const FString &AttrName, FString &OutAttrValue) const override
+    {
+        return false;
+    }
+};
+
+/** Signs the local user in as soon as the mock is created; there's no credential check. */
+class FMockOnlineIdentity : public IOnlineIdentity
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+    bool bLoggedIn = true;
+
+public:
+    explicit FMockOnlineIdentity(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    virtual bool Login(int32 LocalUserNum, const FOnlineAccountCredentials &AccountCredentials) override;
+    virtual bool Logout(int32 LocalUserNum) override;
+    virtual bool AutoLogin(int32 LocalUserNum) override;
+    virtual TSharedPtr<FUserOnlineAccount> GetUserAccount(const FUniqueNetId &UserId) const override;
+    virtual TArray<TSharedPtr<FUserOnlineAccount>> GetAllUserAccounts() const override;
+    virtual FUniqueNetIdPtr GetUniquePlayerId(int32 LocalUserNum) const override;
+    virtual FUniqueNetIdPtr CreateUniquePlayerId(uint8 *Bytes, int32 Size) override;
+    virtual FUniqueNetIdPtr CreateUniquePlayerId(const FString &Str) override;
+    virtual ELoginStatus::Type GetLoginStatus(int32 LocalUserNum) const override;
+    virtual ELoginStatus::Type GetLoginStatus(const FUniqueNetId &UserId) const override;
+    virtual FString GetPlayerNickname(int32 LocalUserNum) const override;
+    virtual FString GetPlayerNickname(const FUniqueNetId &UserId) const override;
+    virtual FString GetAuthToken(int32 LocalUserNum) const override;
+    virtual void RevokeAuthToken(const FUniqueNetId &LocalUserId, const FOnRevokeAuthTokenCompleteDelegate &Delegate)
+        override;
+    virtual void GetUserPrivilege(
+        const FUniqueNetId &LocalUserId,
+        EUserPrivileges::Type Privilege,
+        const FOnGetUserPrivilegeCompleteDelegate &Delegate,
+        EShowPrivilegeResolveUI ShowResolveUI = EShowPrivilegeResolveUI::Default) override;
+    virtual FPlatformUserId GetPlatformUserIdFromUniqueNetId(const FUniqueNetId &UniqueNetId) const override;
+    virtual FString GetAuthType() const override;
+};
+
+/** Advertises a configurable number of sessions and tracks the named sessions created or joined locally. */
+class FMockOnlineSession : public IOnlineSession
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+    TArray<FNamedOnlineSession> Sessions;
+
+    bool UpdateRegisteredPlayers(FName SessionName, const TArray<FUniqueNetIdRef> &Players, bool bRegister);
+
+public:
+    explicit FMockOnlineSession(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    /** What FindSessions returns. */
+    TArray<FOnlineSessionSearchResult> AdvertisedSessions;
+
+    virtual FUniqueNetIdPtr CreateSessionIdFromString(const FString &SessionIdStr) override;
+    virtual FNamedOnlineSession *GetNamedSession(FName SessionName) override;
+    virtual void RemoveNamedSession(FName SessionName) override;
+    virtual bool HasPresenceSession() override;
+    virtual EOnlineSessionState::Type GetSessionState(FName SessionName) const override;
+    virtual bool CreateSession(int32 HostingPlayerNum, FName SessionName, const FOnlineSessionSettings &NewSessionSettings)
+        override;
+    virtual bool CreateSession(
+        const FUniqueNetId &HostingPlayerId,
+        FName SessionName,
+        const FOnlineSessionSettings &NewSessionSettings) override;
+    virtual bool StartSession(FName SessionName) override;
+    virtual bool UpdateSession(FName SessionName, FOnlineSessionSettings &UpdatedSessionSettings, bool bShouldRefreshOnlineData = true)
+        override;
+    virtual bool EndSession(FName SessionName) override;
+    virtual bool DestroySession(
+        FName SessionName,
+        const FOnDestroySessionCompleteDelegate &CompletionDelegate = FOnDestroySessionCompleteDelegate()) override;
+    virtual bool IsPlayerInSession(FName SessionName, const FUniqueNetId &UniqueId) override;
+    virtual bool StartMatchmaking(
+        const TArray<FUniqueNetIdRef> &LocalPlayers,
+        FName SessionName,
+        const FOnlineSessionSettings &NewSessionSettings,
+        TSharedRef<FOnlineSessionSearch> &SearchSettings) override;
+    virtual bool CancelMatchmaking(int32 SearchingPlayerNum, FName SessionName) override;
+    virtual bool CancelMatchmaking(const FUniqueNetId &SearchingPlayerId, FName SessionName) override;
+    virtual bool FindSessions(int32 SearchingPlayerNum, const TSharedRef<FOnlineSessionSearch> &SearchSettings) override;
+    virtual bool FindSessions(const FUniqueNetId &SearchingPlayerId, const TSharedRef<FOnlineSessionSearch> &SearchSettings)
+        override;
+    virtual bool FindSessionById(
+        const FUniqueNetId &SearchingUserId,
+        const FUniqueNetId &SessionId,
+        const FUniqueNetId &FriendId,
+        const FOnSingleSessionResultCompleteDelegate &CompletionDelegate) override;
+    virtual bool CancelFindSessions() override;
+    virtual bool PingSearchResults(const FOnlineSessionSearchResult &SearchResult) override;
+    virtual bool JoinSession(int32 LocalUserNum, FName SessionName, const FOnlineSessionSearchResult &DesiredSession)
+        override;
+    virtual bool JoinSession(const FUniqueNetId &LocalUserId, FName SessionName, const FOnlineSessionSearchResult &DesiredSession)
+        override;
+    virtual bool FindFriendSession(int32 LocalUserNum, const FUniqueNetId &Friend) override;
+    virtual bool FindFriendSession(const FUniqueNetId &LocalUserId, const FUniqueNetId &Friend) override;
+    virtual bool FindFriendSession(const FUniqueNetId &LocalUserId, const TArray<FUniqueNetIdRef> &FriendList) override;
+    virtual bool SendSessionInviteToFriend(int32 LocalUserNum, FName SessionName, const FUniqueNetId &Friend) override;
+    virtual bool SendSessionInviteToFriend(const FUniqueNetId &LocalUserId, FName SessionName, const FUniqueNetId &Friend)
+        override;
+    virtual bool SendSessionInviteToFriends(int32 LocalUserNum, FName SessionName, const TArray<FUniqueNetIdRef> &Friends)
+        override;
+    virtual bool SendSessionInviteToFriends(
+        const FUniqueNetId &LocalUserId,
+        FName SessionName,
+        const TArray<FUniqueNetIdRef> &Friends) override;
+    virtual bool GetResolvedConnectString(FName SessionName, FString &ConnectInfo, FName PortType = NAME_GamePort) override;
+    virtual bool GetResolvedConnectString(
+        const FOnlineSessionSearchResult &SearchResult,
+        FName PortType,
+        FString &ConnectInfo) override;
+    virtual FOnlineSessionSettings *GetSessionSettings(FName SessionName) override;
+    virtual bool RegisterPlayer(FName SessionName, const FUniqueNetId &PlayerId, bool bWasInvited) override;
+    virtual bool RegisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef> &Players, bool bWasInvited = false)
+        override;
+    virtual bool UnregisterPlayer(FName SessionName, const FUniqueNetId &PlayerId) override;
+    virtual bool UnregisterPlayers(FName SessionName, const TArray<FUniqueNetIdRef> &Players) override;
+    virtual void RegisterLocalPlayer(
+        const FUniqueNetId &PlayerId,
+        FName SessionName,
+        const FOnRegisterLocalPlayerCompleteDelegate &Delegate) override;
+    virtual void UnregisterLocalPlayer(
+        const FUniqueNetId &PlayerId,
+        FName SessionName,
+        const FOnUnregisterLocalPlayerCompleteDelegate &Delegate) override;
+    virtual void RemovePlayerFromSession(int32 LocalUserNum, FName SessionName, const FUniqueNetId &TargetPlayerId)
+        override;
+    virtual int32 GetNumSessions() override;
+    virtual void DumpSessionState() override;
+
+protected:
+    virtual FNamedOnlineSession *AddNamedSession(FName SessionName, const FOnlineSessionSettings &SessionSettings) override;
+    virtual FNamedOnlineSession *AddNamedSession(FName SessionName, const FOnlineSession &Session) override;
+};
+
+/** Holds one friends list for the local user. There is no blocked or recent players list. */
+class FMockOnlineFriends : public IOnlineFriends
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+
+public:
+    explicit FMockOnlineFriends(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    TArray<TSharedRef<FMockOnlineFriend>> Friends;
+
+    TSharedPtr<FMockOnlineFriend> FindFriend(const FUniqueNetId &FriendId) const;
+
+    virtual bool ReadFriendsList(
+        int32 LocalUserNum,
+        const FString &ListName,
+        const FOnReadFriendsListComplete &Delegate = FOnReadFriendsListComplete()) override;
+    virtual bool DeleteFriendsList(
+        int32 LocalUserNum,
+        const FString &ListName,
+        const FOnDeleteFriendsListComplete &Delegate = FOnDeleteFriendsListComplete()) override;
+    virtual bool SendInvite(
+        int32 LocalUserNum,
+        const FUniqueNetId &FriendId,
+        const FString &ListName,
+        const FOnSendInviteComplete &Delegate = FOnSendInviteComplete()) override;
+    virtual bool AcceptInvite(
+        int32 LocalUserNum,
+        const FUniqueNetId &FriendId,
+        const FString &ListName,
+        const FOnAcceptInviteComplete &Delegate = FOnAcceptInviteComplete()) override;
+    virtual bool RejectInvite(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName) override;
+    virtual void SetFriendAlias(
+        int32 LocalUserNum,
+        const FUniqueNetId &FriendId,
+        const FString &ListName,
+        const FString &Alias,
+        const FOnSetFriendAliasComplete &Delegate = FOnSetFriendAliasComplete()) override;
+    virtual void DeleteFriendAlias(
+        int32 LocalUserNum,
+        const FUniqueNetId &FriendId,
+        const FString &ListName,
+        const FOnDeleteFriendAliasComplete &Delegate = FOnDeleteFriendAliasComplete()) override;
+    virtual bool DeleteFriend(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName) override;
+    virtual bool GetFriendsList(int32 LocalUserNum, const FString &ListName, TArray<TSharedRef<FOnlineFriend>> &OutFriends)
+        override;
+    virtual TSharedPtr<FOnlineFriend> GetFriend(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName)
+        override;
+    virtual bool IsFriend(int32 LocalUserNum, const FUniqueNetId &FriendId, const FString &ListName) override;
+    virtual bool QueryRecentPlayers(const FUniqueNetId &UserId, const FString &Namespace) override;
+    virtual bool GetRecentPlayers(
+        const FUniqueNetId &UserId,
+        const FString &Namespace,
+        TArray<TSharedRef<FOnlineRecentPlayer>> &OutRecentPlayers) override;
+    virtual void DumpRecentPlayers() const override;
+    virtual bool BlockPlayer(int32 LocalUserNum, const FUniqueNetId &PlayerId) override;
+    virtual bool UnblockPlayer(int32 LocalUserNum, const FUniqueNetId &PlayerId) override;
+    virtual bool QueryBlockedPlayers(const FUniqueNetId &UserId) override;
+    virtual bool GetBlockedPlayers(const FUniqueNetId &UserId, TArray<TSharedRef<FOnlineUser>> &OutBlockedUsers) override;
+    virtual void DumpBlockedPlayers() const override;
+};
+
+/** Parties the local user creates and leads. Invitations are recorded but never delivered to anyone. */
+class FMockOnlinePartySystem : public IOnlinePartySystem
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+    int32 NextPartyId = 1;
+
+public:
+    struct FMockParty
+    {
+        TSharedRef<const FMockPartyId> PartyId;
+        FOnlinePartyTypeId PartyTypeId;
+        TArray<FUniqueNetIdRef> Members;
+        TArray<FUniqueNetIdRef> InvitedUsers;
+    };
+
+    explicit FMockOnlinePartySystem(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    TArray<FMockParty> Parties;
+
+    FMockParty *FindParty(const FOnlinePartyId &PartyId);
+    const FMockParty *FindParty(const FOnlinePartyId &PartyId) const;
+
+    virtual bool RestoreParties(const FUniqueNetId &LocalUserId, const FOnRestorePartiesComplete &CompletionDelegate)
+        override;
+    virtual bool RestoreInvites(const FUniqueNetId &LocalUserId, const FOnRestoreInvitesComplete &CompletionDelegate)
+        override;
+    virtual bool CleanupParties(const FUniqueNetId &LocalUserId, const FOnCleanupPartiesComplete &CompletionDelegate)
+        override;
+    virtual bool CreateParty(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyTypeId PartyTypeId,
+        const FPartyConfiguration &PartyConfig,
+        const FOnCreatePartyComplete &Delegate = FOnCreatePartyComplete()) override;
+    virtual bool UpdateParty(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FPartyConfiguration &PartyConfig,
+        bool bShouldRegenerateReservationKey = false,
+        const FOnUpdatePartyComplete &Delegate = FOnUpdatePartyComplete()) override;
+    virtual bool JoinParty(
+        const FUniqueNetId &LocalUserId,
+        const IOnlinePartyJoinInfo &OnlinePartyJoinInfo,
+        const FOnJoinPartyComplete &Delegate = FOnJoinPartyComplete()) override;
+    virtual void RequestToJoinParty(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyTypeId PartyTypeId,
+        const FPartyInvitationRecipient &Recipient,
+        const FOnRequestToJoinPartyComplete &Delegate = FOnRequestToJoinPartyComplete()) override;
+    virtual void ClearRequestToJoinParty(
+        const FUniqueNetId &LocalUserId,
+        const FUniqueNetId &Sender,
+        EPartyRequestToJoinRemovedReason Reason) override;
+    virtual void QueryPartyJoinability(
+        const FUniqueNetId &LocalUserId,
+        const IOnlinePartyJoinInfo &OnlinePartyJoinInfo,
+        const FOnQueryPartyJoinabilityCompleteEx &Delegate) override;
+#if !REDPOINT_EXAMPLE_UE_5_5_OR_LATER
+    virtual bool RejoinParty(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FOnlinePartyTypeId &PartyTypeId,
+        const TArray<FUniqueNetIdRef> &FormerMembers,
+        const FOnJoinPartyComplete &Delegate = FOnJoinPartyComplete()) override;
+#endif
+    virtual bool LeaveParty(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FOnLeavePartyComplete &Delegate = FOnLeavePartyComplete()) override;
+    virtual bool LeaveParty(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        bool bSynchronizeLeave,
+        const FOnLeavePartyComplete &Delegate = FOnLeavePartyComplete()) override;
+    virtual bool ApproveJoinRequest(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FUniqueNetId &RecipientId,
+        bool bIsApproved,
+        int32 DeniedResultCode = 0) override;
+    virtual void RespondToQueryJoinability(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FUniqueNetId &RecipientId,
+        bool bCanJoin,
+        int32 DeniedResultCode,
+        FOnlinePartyDataConstPtr PartyData) override;
+    virtual bool SendInvitation(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FPartyInvitationRecipient &Recipient,
+        const FOnSendPartyInvitationComplete &Delegate = FOnSendPartyInvitationComplete()) override;
+    virtual void CancelInvitation(
+        const FUniqueNetId &LocalUserId,
+        const FUniqueNetId &TargetUserId,
+        const FOnlinePartyId &PartyId,
+        const FOnCancelPartyInvitationComplete &Delegate = FOnCancelPartyInvitationComplete()) override;
+    virtual bool RejectInvitation(const FUniqueNetId &LocalUserId, const FUniqueNetId &SenderId) override;
+    virtual void ClearInvitations(
+        const FUniqueNetId &LocalUserId,
+        const FUniqueNetId &SenderId,
+        const FOnlinePartyId *PartyId = nullptr) override;
+    virtual bool KickMember(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FUniqueNetId &TargetMemberId,
+        const FOnKickPartyMemberComplete &Delegate = FOnKickPartyMemberComplete()) override;
+    virtual bool PromoteMember(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FUniqueNetId &TargetMemberId,
+        const FOnPromotePartyMemberComplete &Delegate = FOnPromotePartyMemberComplete()) override;
+    virtual bool UpdatePartyData(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FName &Namespace,
+        const FOnlinePartyData &PartyData) override;
+    virtual bool UpdatePartyMemberData(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FName &Namespace,
+        const FOnlinePartyData &PartyMemberData) override;
+    virtual bool IsMemberLeader(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId, const FUniqueNetId &MemberId)
+        const override;
+    virtual uint32 GetPartyMemberCount(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId) const override;
+    virtual FOnlinePartyConstPtr GetParty(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId) const override;
+    virtual FOnlinePartyConstPtr GetParty(const FUniqueNetId &LocalUserId, const FOnlinePartyTypeId &PartyTypeId) const
+        override;
+    virtual FOnlinePartyMemberConstPtr GetPartyMember(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FUniqueNetId &MemberId) const override;
+    virtual FOnlinePartyDataConstPtr GetPartyData(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FName &Namespace) const override;
+    virtual FOnlinePartyDataConstPtr GetPartyMemberData(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        const FUniqueNetId &MemberId,
+        const FName &Namespace) const override;
+    virtual IOnlinePartyJoinInfoConstPtr GetAdvertisedParty(
+        const FUniqueNetId &LocalUserId,
+        const FUniqueNetId &UserId,
+        const FOnlinePartyTypeId PartyTypeId) const override;
+    virtual bool GetJoinedParties(const FUniqueNetId &LocalUserId, TArray<TSharedRef<const FOnlinePartyId>> &OutPartyIdArray)
+        const override;
+    virtual bool GetPartyMembers(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        TArray<FOnlinePartyMemberConstRef> &OutPartyMembersArray) const override;
+    virtual bool GetPendingInvites(const FUniqueNetId &LocalUserId, TArray<IOnlinePartyJoinInfoConstRef> &OutPendingInvitesArray)
+        const override;
+    virtual bool GetPendingJoinRequests(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        TArray<IOnlinePartyPendingJoinRequestInfoConstRef> &OutPendingJoinRequestArray) const override;
+    virtual bool GetPendingInvitedUsers(
+        const FUniqueNetId &LocalUserId,
+        const FOnlinePartyId &PartyId,
+        TArray<FUniqueNetIdRef> &OutPendingInvitedUserArray) const override;
+    virtual bool GetPendingRequestsToJoin(
+        const FUniqueNetId &LocalUserId,
+        TArray<IOnlinePartyRequestToJoinInfoConstRef> &OutRequestsToJoin) const override;
+    virtual FString MakeJoinInfoJson(const FUniqueNetId &LocalUserId, const FOnlinePartyId &PartyId) override;
+    virtual IOnlinePartyJoinInfoConstPtr MakeJoinInfoFromJson(const FString &JoinInfoJson) override;
+    virtual FString MakeTokenFromJoinInfo(const IOnlinePartyJoinInfo &JoinInfo) const override;
+    virtual IOnlinePartyJoinInfoConstPtr MakeJoinInfoFromToken(const FString &Token) const override;
+    virtual IOnlinePartyJoinInfoConstPtr ConsumePendingCommandLineJoinInfo() override;
+    virtual void DumpPartyState() override;
+};
+
+/** Ranked leaderboards keyed by name, with ranks starting at 1 and the score in the "Score" column. */
+class FMockOnlineLeaderboards : public IOnlineLeaderboards
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+
+    bool CompleteRead(FName Api, const FOnlineLeaderboardReadRef &ReadObject, TFunction<void(FOnlineLeaderboardRead &)> Fill);
+
+public:
+    explicit FMockOnlineLeaderboards(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    /** Rows by leaderboard name, sorted by rank. */
+    TMap<FString, TArray<FOnlineStatsRow>> Leaderboards;
+
+    virtual bool ReadLeaderboards(const TArray<FUniqueNetIdRef> &Players, FOnlineLeaderboardReadRef &ReadObject) override;
+    virtual bool ReadLeaderboardsForFriends(int32 LocalUserNum, FOnlineLeaderboardReadRef &ReadObject) override;
+    virtual bool ReadLeaderboardsAroundRank(int32 Rank, uint32 Range, FOnlineLeaderboardReadRef &ReadObject) override;
+    virtual bool ReadLeaderboardsAroundUser(FUniqueNetIdRef Player, uint32 Range, FOnlineLeaderboardReadRef &ReadObject)
+        override;
+    virtual void FreeStats(FOnlineLeaderboardRead &ReadObject) override;
+    virtual bool WriteLeaderboards(const FName &SessionName, const FUniqueNetId &Player, FOnlineLeaderboardWrite &WriteObject)
+        override;
+    virtual bool FlushLeaderboards(const FName &SessionName) override;
+    virtual bool WriteOnlinePlayerRatings(
+        const FName &SessionName,
+        int32 LeaderboardId,
+        const TArray<FOnlinePlayerScore> &PlayerScores) override;
+};
+
+/** The local user's integer stats, applied the way the backend would for each modification type. */
+class FMockOnlineStats : public IOnlineStats
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+
+public:
+    explicit FMockOnlineStats(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    TMap<FString, int32> Values;
+
+    virtual void QueryStats(
+        const FUniqueNetIdRef LocalUserId,
+        const FUniqueNetIdRef StatsUser,
+        const FOnlineStatsQueryUserStatsComplete &Delegate) override;
+    virtual void QueryStats(
+        const FUniqueNetIdRef LocalUserId,
+        const TArray<FUniqueNetIdRef> &StatUsers,
+        const TArray<FString> &StatNames,
+        const FOnlineStatsQueryUsersStatsComplete &Delegate) override;
+    virtual TSharedPtr<const FOnlineStatsUserStats> GetStats(const FUniqueNetIdRef StatsUserId) const override;
+    virtual void UpdateStats(
+        const FUniqueNetIdRef LocalUserId,
+        const TArray<FOnlineStatsUserUpdatedStats> &UpdatedUserStats,
+        const FOnlineStatsUpdateStatsComplete &Delegate) override;
+#if !UE_BUILD_SHIPPING
+    virtual void ResetStats(const FUniqueNetIdRef StatsUserId) override;
+#endif
+};
+
+/** The local user's cloud files, plus the copies downloaded by ReadUserFile that GetFileContents returns. */
+class FMockOnlineUserCloud : public IOnlineUserCloud
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+    TMap<FString, TArray<uint8>> DownloadedFiles;
+
+public:
+    explicit FMockOnlineUserCloud(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    TMap<FString, TArray<uint8>> Files;
+
+    virtual bool GetFileContents(const FUniqueNetId &UserId, const FString &FileName, TArray<uint8> &FileContents) override;
+    virtual bool ClearFiles(const FUniqueNetId &UserId) override;
+    virtual bool ClearFile(const FUniqueNetId &UserId, const FString &FileName) override;
+    virtual void EnumerateUserFiles(const FUniqueNetId &UserId) override;
+    virtual void GetUserFileList(const FUniqueNetId &UserId, TArray<FCloudFileHeader> &UserFiles) override;
+    virtual bool ReadUserFile(const FUniqueNetId &UserId, const FString &FileName) override;
+    virtual bool WriteUserFile(
+        const FUniqueNetId &UserId,
+        const FString &FileName,
+        TArray<uint8> &FileContents,
+        bool bCompressBeforeUpload = false) override;
+    virtual void CancelWriteUserFile(const FUniqueNetId &UserId, const FString &FileName) override;
+    virtual bool DeleteUserFile(const FUniqueNetId &UserId, const FString &FileName, bool bShouldCloudDelete, bool bShouldLocallyDelete)
+        override;
+    virtual bool RequestUsageInfo(const FUniqueNetId &UserId) override;
+    virtual void DumpCloudState(const FUniqueNetId &UserId) override;
+    virtual void DumpCloudFileState(const FUniqueNetId &UserId, const FString &FileName) override;
+};
+
+/** Read-only title files, plus the copies downloaded by ReadFile that GetFileContents returns. */
+class FMockOnlineTitleFile : public IOnlineTitleFile
+{
+private:
+    FMockOnlineSubsystem &Subsystem;
+    TMap<FString, TArray<uint8>> DownloadedFiles;
+
+public:
+    explicit FMockOnlineTitleFile(FMockOnlineSubsystem &InSubsystem)
+        : Subsystem(InSubsystem)
+    {
+    }
+
+    TMap<FString, TArray<uint8>> Files;
+
+    virtual bool GetFileContents(const FString &FileName, TArray<uint8> &FileContents) override;
+    virtual bool ClearFiles() override;
+    virtual bool ClearFile(const FString &FileName) override;
+    virtual void DeleteCachedFiles(bool bSkipEnumerated) override;
+    virtual bool EnumerateFiles(const FPagedQuery &Page = FPagedQuery()) override;
+    virtual void GetFileList(TArray<FCloudFileHeader> &Files) override;
+    virtual bool ReadFile(const FString &FileName) override;
+};
+
+/**
+ * An in-memory online subsystem for the automation tests. It implements identity, sessions, friends, parties,
+ * leaderboards, stats, user cloud and title file; every other interface is unsupported.
+ *
+ * Backend calls never complete inline: each completion is queued and run by the core ticker once LatencySeconds have
+ * passed, so tests exercise the same asynchronous paths a real backend would. FailureRate makes that share of calls
+ * report a backend failure.
+ */
+class FMockOnlineSubsystem : public FOnlineSubsystemImpl
+{
+private:
+    struct FPendingCompletion
+    {
+        double DueTime;
+        TFunction<void()> Run;
+    };
+    TArray<FPendingCompletion> PendingCompletions;
+    TMap<FName, int32> CallCounts;
+    FTSTicker::FDelegateHandle PumpHandle;
+    FRandomStream FailureRandom;
+    FUniqueNetIdRef LocalUserId;
+
+public:
+    FMockOnlineSubsystem();
+    virtual ~FMockOnlineSubsystem() override;
+
+    /** How long each backend call takes to complete. */
+    float LatencySeconds = 0.0f;
+    /** The fraction of backend calls (0 to 1) that report failure. */
+    float FailureRate = 0.0f;
+
+    TSharedRef<FMockOnlineIdentity, ESPMode::ThreadSafe> Identity;
+    TSharedRef<FMockOnlineSession, ESPMode::ThreadSafe> Session;
+    TSharedRef<FMockOnlineFriends, ESPMode::ThreadSafe> Friends;
+    TSharedRef<FMockOnlinePartySystem, ESPMode::ThreadSafe> Parties;
+    TSharedRef<FMockOnlineLeaderboards, ESPMode::ThreadSafe> Leaderboards;
+    TSharedRef<FMockOnlineStats, ESPMode::ThreadSafe> Stats;
+    TSharedRef<FMockOnlineUserCloud, ESPMode::ThreadSafe> UserCloud;
+    TSharedRef<FMockOnlineTitleFile, ESPMode::ThreadSafe> TitleFile;
+
+    const FUniqueNetIdRef &GetLocalUserId() const
+    {
+        return this->LocalUserId;
+    }
+
+    /** Creates a user id in the mock's id space. */
+    static FUniqueNetIdRef MakeUserId(const FString &Id);
+
+    /** Advertises Count sessions, each with a distinct id, owner and ping. */
+    void AddAdvertisedSessions(int32 Count);
+    /** Adds Count accepted friends, half of them online. */
+    void AddFriends(int32 Count);
+    /** Fills a leaderboard with Count rows ranked from 1, scores descending. */
+    void SetLeaderboard(const FString &LeaderboardName, int32 Count);
+
+    /**
+     * Records a call under Api and rolls whether it fails. Returns false if the backend should report failure. The
+     * interfaces call this once per backend call they accept.
+     */
+    bool BeginCall(FName Api);
+    /** Runs Completion after LatencySeconds, from the core ticker. */
+    void Defer(TFunction<void()> Completion);
+    /** The number of backend calls made under Api since the mock was created. */
+    int32 GetCallCount(FName Api) const;
+    int32 GetPendingCompletionCount() const
+    {
+        return this->PendingCompletions.Num();
+    }
+
+    virtual IOnlineSessionPtr GetSessionInterface() const override;
+    virtual IOnlineFriendsPtr GetFriendsInterface() const override;
+    virtual IOnlinePartyPtr GetPartyInterface() const override;
+    virtual IOnlineGroupsPtr GetGroupsInterface() const override;
+    virtual IOnlineSharedCloudPtr GetSharedCloudInterface() const override;
+    virtual IOnlineUserCloudPtr GetUserCloudInterface() const override;
+    virtual IOnlineEntitlementsPtr GetEntitlementsInterface() const override;
+    virtual IOnlineLeaderboardsPtr GetLeaderboardsInterface() const override;
+    virtual IOnlineVoicePtr GetVoiceInterface() const override;
+    virtual IOnlineExternalUIPtr GetExternalUIInterface() const override;
+    virtual IOnlineTimePtr GetTimeInterface() const override;
+    virtual IOnlineIdentityPtr GetIdentityInterface() const override;
+    virtual IOnlineTitleFilePtr GetTitleFileInterface() const override;
+    virtual IOnlineStoreV2Ptr GetStoreV2Interface() const override;
+    virtual IOnlinePurchasePtr GetPurchaseInterface() const override;
+    virtual IOnlineEventsPtr GetEventsInterface() const override;
+    virtual IOnlineAchievementsPtr GetAchievementsInterface() const override;
+    virtual IOnlineSharingPtr GetSharingInterface() const override;
+    virtual IOnlineUserPtr GetUserInterface() const override;
+    virtual IOnlineMessagePtr GetMessageInterface() const override;
+    virtual IOnlinePresencePtr GetPresenceInterface() const override;
+    virtual IOnlineChatPtr GetChatInterface() const override;
+    virtual IOnlineStatsPtr GetStatsInterface() const override;
+    virtual IOnlineTurnBasedPtr GetTurnBasedInterface() const override;
+    virtual IOnlineTournamentPtr GetTournamentInterface() const override;
+    virtual bool Init() override;
+    virtual bool Shutdown() override;
+    virtual FString GetAppId() const override;
+    virtual FText GetOnlineServiceName() const override;
+};
+
+} // namespace OSS::OnlineAPI::Tests
+
+#endif
@@ -0,0 +1,1214 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/OnlineTitleFileInterface.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "MultiplayerOnlineSubsystem/Private/Tests/MOS_MockOnlineSubsystem.h"
+#include "MultiplayerOnlineSubsystem/Private/Tests/MOS_SessionListTestListener.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_AvatarCache.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_QueryLeaderboardPagesAsyncResult.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_SessionPing.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_SessionsFindSessionsAsyncResult.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_StatWriteBuffer.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_TitleFileCache.h"
+#include "MultiplayerOnlineSubsystem/Public/MOS_GameInstanceSubsystem.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace OSS::OnlineAPI::Tests
+{
+
+constexpr auto OnlineAPITestFlags =
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter;
+
+/**
+ * A standalone game instance whose MOS subsystem talks to an in-memory online subsystem. Completions are driven by the
+ * core ticker, which the tests tick by hand until the result they're waiting on arrives.
+ */
+class FOnlineAPITestFixture
+{
+public:
+    TStrongObjectPtr<UGameInstance> GameInstance;
+    UMOS_GameInstanceSubsystem *Subsystem = nullptr;
+    TSharedRef<FMockOnlineSubsystem, ESPMode::ThreadSafe> Mock;
+
+    FOnlineAPITestFixture()
+        : Mock(MakeShared<FMockOnlineSubsystem, ESPMode::ThreadSafe>())
+    {
+        this->GameInstance.Reset(NewObject<UGameInstance>(GEngine));
+        this->GameInstance->InitializeStandalone();
+        this->Subsystem = this->GameInstance->GetSubsystem<UMOS_GameInstanceSubsystem>();
+        this->Mock->Init();
+        this->Subsystem->SetOnlineSubsystemOverride(&this->Mock.Get());
+
+        // Every search should reach the backend, and nothing should try to open sockets.
+        this->Subsystem->SessionBrowserCacheTTLSeconds = 0.0f;
+        this->Subsystem->bProbeSessionPings = false;
+    }
+
+    ~FOnlineAPITestFixture()
+    {
+        this->Subsystem->SetOnlineSubsystemOverride(nullptr);
+        this->GameInstance->Shutdown();
+        this->Mock->Shutdown();
+    }
+
+    /** Ticks the core ticker until Done returns true. Returns false if that takes longer than TimeoutSeconds. */
+    bool TickUntil(TFunctionRef<bool()> Done, double TimeoutSeconds = 10.0) const
+    {
+        double Deadline = FPlatformTime::Seconds() + TimeoutSeconds;
+        while (!Done())
+        {
+            if (FPlatformTime::Seconds() > Deadline)
+            {
+                return false;
+            }
+            FTSTicker::GetCoreTicker().Tick(0.01f);
+        }
+        return true;
+    }
+
+    /** Runs Execute with a fresh result object and waits for its callback. Returns false if it never came. */
+    bool Await(TFunctionRef<void(UMOS_AsyncResult *)> Execute, bool &bOutSucceeded, FString &OutError) const
+    {
+        TStrongObjectPtr<UMOS_AsyncResult> Result(NewObject<UMOS_AsyncResult>());
+        bool bDone = false;
+        Result->NativeCallback.BindLambda([&](bool bWasSuccessful, FString ErrorMessage) {
+            bDone = true;
+            bOutSucceeded = bWasSuccessful;
+            OutError = ErrorMessage;
+        });
+        Execute(Result.Get());
+        return this->TickUntil([&bDone]() {
+            return bDone;
+        });
+    }
+
+    bool FindSessions(TArray<FMOSSessionsSearchResult> &OutResults, bool &bOutSucceeded) const
+    {
+        TStrongObjectPtr<UMOS_SessionsFindSessionsAsyncResult> Result(NewObject<UMOS_SessionsFindSessionsAsyncResult>());
+        bool bDone = false;
+        Result->NativeCallback.BindLambda(
+            [&](bool bWasSuccessful, const TArray<FMOSSessionsSearchResult> &Results, FString ErrorMessage) {
+                bDone = true;
+                bOutSucceeded = bWasSuccessful;
+                OutResults = Results;
+            });
+        this->Subsystem->ExecuteSessionsFindSessions(Result.Get());
+        return this->TickUntil([&bDone]() {
+            return bDone;
+        });
+    }
+};
+
+/** Sets the dispatcher's fault injection cvars for the lifetime of the scope, then clears them. */
+class FScopedInjectedFault
+{
+public:
+    FScopedInjectedFault(const TCHAR *Api, float FailureRate)
+    {
+        Set(TEXT("MOS.Fault.Api"), Api);
+        Set(TEXT("MOS.Fault.FailureRate"), *FString::SanitizeFloat(FailureRate));
+    }
+
+    ~FScopedInjectedFault()
+    {
+        Set(TEXT("MOS.Fault.Api"), TEXT(""));
+        Set(TEXT("MOS.Fault.FailureRate"), TEXT("0"));
+    }
+
+private:
+    static void Set(const TCHAR *Name, const TCHAR *Value)
+    {
+        if (IConsoleVariable *Variable = IConsoleManager::Get().FindConsoleVariable(Name))
+        {
+            Variable->Set(Value, ECVF_SetByCode);
+        }
+    }
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPISessionsFindSessionsAtScaleTest,
+    "MOS.OnlineAPI.Sessions.FindSessionsAtScale",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPISessionsFindSessionsAtScaleTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->AddAdvertisedSessions(10000);
+
+    TArray<FMOSSessionsSearchResult> Results;
+    bool bSucceeded = false;
+    double StartTime = FPlatformTime::Seconds();
+    if (!TestTrue(TEXT("The first search completes"), Fixture.FindSessions(Results, bSucceeded)))
+    {
+        return false;
+    }
+    double FirstSearchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestTrue(TEXT("The first search succeeds"), bSucceeded);
+    TestEqual(TEXT("Every advertised session is listed"), Results.Num(), 10000);
+    TestEqual(TEXT("The browser cache holds every session"), Fixture.Subsystem->CachedFindSessionResults.Num(), 10000);
+
+    // A second search over the same rows only diffs against the cache.
+    StartTime = FPlatformTime::Seconds();
+    TestTrue(TEXT("The second search completes"), Fixture.FindSessions(Results, bSucceeded));
+    double SecondSearchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestTrue(TEXT("The second search succeeds"), bSucceeded);
+    TestEqual(TEXT("The second search lists every session"), Results.Num(), 10000);
+    TestEqual(TEXT("Each search reached the backend"), Fixture.Mock->GetCallCount(TEXT("Session.FindSessions")), 2);
+
+    AddInfo(FString::Printf(
+        TEXT("FindSessions over 10000 sessions: %.2f ms first, %.2f ms against a warm cache."),
+        FirstSearchMs,
+        SecondSearchMs));
+
+    // A failed search reports failure instead of a stale list.
+    Fixture.Mock->FailureRate = 1.0f;
+    TestTrue(TEXT("The failing search completes"), Fixture.FindSessions(Results, bSucceeded));
+    TestFalse(TEXT("The failing search reports failure"), bSucceeded);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPISessionsBrowserRefreshTest,
+    "MOS.OnlineAPI.Sessions.BrowserRefresh",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPISessionsBrowserRefreshTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->AddAdvertisedSessions(10);
+
+    // Each search takes far longer than the refresh interval, so refreshes would pile up if they didn't wait.
+    Fixture.Mock->LatencySeconds = 0.5f;
+    Fixture.Subsystem->SessionBrowserRefreshIntervalSeconds = 0.05f;
+    Fixture.Subsystem->StartSessionBrowserRefresh();
+    double End = FPlatformTime::Seconds() + 0.4;
+    Fixture.TickUntil([End]() {
+        return FPlatformTime::Seconds() >= End;
+    });
+    TestEqual(
+        TEXT("Refreshes wait for the search in flight"),
+        Fixture.Mock->GetCallCount(TEXT("Session.FindSessions")),
+        1);
+
+    // Once the search lands, the next refresh starts another.
+    TestTrue(TEXT("The refresh searches again"), Fixture.TickUntil([&Fixture]() {
+        return Fixture.Mock->GetCallCount(TEXT("Session.FindSessions")) >= 2;
+    }));
+    TestEqual(TEXT("The browser list is filled in"), Fixture.Subsystem->CachedFindSessionResults.Num(), 10);
+
+    Fixture.Subsystem->StopSessionBrowserRefresh();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPISessionsProbePingsTest,
+    "MOS.OnlineAPI.Sessions.ProbePings",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPISessionsProbePingsTest::RunTest(const FString &Parameters)
+{
+    constexpr int32 SessionCount = 20;
+    constexpr int32 PingPort = 47787;
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->AddAdvertisedSessions(SessionCount);
+
+    // Every mock host resolves to the loopback address, so one responder answers for all of them.
+    FSessionPingResponder Responder;
+    if (!TestTrue(TEXT("The responder listens"), Responder.Start(PingPort)))
+    {
+        return false;
+    }
+    Fixture.Subsystem->bProbeSessionPings = true;
+    Fixture.Subsystem->SessionPingPort = PingPort;
+
+    // @note: The backend reports pings of 20ms and up, so lower pings were measured over the loopback.
+    TStrongObjectPtr<UMOS_SessionListTestListener> Listener(NewObject<UMOS_SessionListTestListener>());
+    Listener->MaxCountedPing = 20;
+    Fixture.Subsystem->UpdateFindSessionListDelegate.AddDynamic(Listener.Get(), &UMOS_SessionListTestListener::OnUpdate);
+    Fixture.Subsystem->UpdateSessionListCompleteDelegate.AddDynamic(
+        Listener.Get(),
+        &UMOS_SessionListTestListener::OnComplete);
+
+    TArray<FMOSSessionsSearchResult> Results;
+    bool bSucceeded = false;
+    TestTrue(TEXT("The search completes"), Fixture.FindSessions(Results, bSucceeded));
+    TestTrue(TEXT("The search succeeds"), bSucceeded);
+    int32 CompleteCountAfterSearch = Listener->CompleteCount;
+
+    TestTrue(TEXT("Every host answers"), Fixture.TickUntil([&Listener]() {
+        return Listener->UpdateCount >= SessionCount;
+    }));
+    TestEqual(TEXT("Each probed row is broadcast once"), Listener->UpdateCount, SessionCount);
+    TestTrue(TEXT("The list is re-broadcast after the pings"), Listener->CompleteCount > CompleteCountAfterSearch);
+
+    const auto &Rows = Fixture.Subsystem->CachedFindSessionResults;
+    TestEqual(TEXT("Every row is kept"), Rows.Num(), SessionCount);
+    for (int32 Index = 0; Index < Rows.Num(); Index++)
+    {
+        TestTrue(TEXT("Every row has its measured ping"), Rows[Index].PingInMs < 20);
+        if (Index > 0)
+        {
+            TestTrue(TEXT("The rows are sorted by ping"), Rows[Index - 1].PingInMs <= Rows[Index].PingInMs);
+        }
+    }
+
+    Fixture.Subsystem->UpdateFindSessionListDelegate.RemoveAll(Listener.Get());
+    Fixture.Subsystem->UpdateSessionListCompleteDelegate.RemoveAll(Listener.Get());
+    Responder.Stop();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPISessionsProbeAddressTest,
+    "MOS.OnlineAPI.Sessions.ProbeAddress",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPISessionsProbeAddressTest::RunTest(const FString &Parameters)
+{
+    FString ProbeAddress;
+    TestTrue(TEXT("An IPv4 host is probed"), FSessionPingProber::GetProbeAddress(TEXT("10.0.0.1:7777"), 47787, ProbeAddress));
+    TestEqual(TEXT("The ping port replaces the game port"), ProbeAddress, FString(TEXT("10.0.0.1:47787")));
+    TestTrue(TEXT("An IPv4 host without a port is probed"), FSessionPingProber::GetProbeAddress(TEXT("10.0.0.1"), 47787, ProbeAddress));
+    TestEqual(TEXT("The ping port is added"), ProbeAddress, FString(TEXT("10.0.0.1:47787")));
+    TestFalse(
+        TEXT("A P2P host is skipped"),
+        FSessionPingProber::GetProbeAddress(TEXT("EOS:0002aabbccddeeff00112233445566778:GameNetDriver:26"), 47787, ProbeAddress));
+    TestFalse(TEXT("An IPv6 host is skipped"), FSessionPingProber::GetProbeAddress(TEXT("[::1]:7777"), 47787, ProbeAddress));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPISessionsLifecycleTest,
+    "MOS.OnlineAPI.Sessions.Lifecycle",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPISessionsLifecycleTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    bool bSucceeded = false;
+    FString Error;
+
+    TestTrue(
+        TEXT("CreateSession completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsCreateSession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("CreateSession succeeds"), bSucceeded);
+    TestTrue(
+        TEXT("The session is pending"),
+        Fixture.Mock->Session->GetSessionState(NAME_GameSession) == EOnlineSessionState::Pending);
+
+    TestTrue(
+        TEXT("A second CreateSession completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsCreateSession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestFalse(TEXT("Creating the same session twice fails"), bSucceeded);
+
+    FUniqueNetIdRepl Player(FMockOnlineSubsystem::MakeUserId(TEXT("player-1")));
+    TestTrue(
+        TEXT("RegisterPlayer completes"),
+        Fixture.Await(
+            [&Fixture, &Player](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsRegisterPlayer(NAME_GameSession, Player, false, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("RegisterPlayer succeeds"), bSucceeded);
+    TestEqual(TEXT("The player is registered"), Fixture.Subsystem->GetSessionRegisteredPlayerIds(NAME_GameSession).Num(), 1);
+
+    TestTrue(
+        TEXT("StartSession completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsStartSession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("StartSession succeeds"), bSucceeded);
+
+    TestTrue(
+        TEXT("EndSession completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsEndSession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("EndSession succeeds"), bSucceeded);
+
+    TestTrue(
+        TEXT("DestroySession completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsDestroySession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("DestroySession succeeds"), bSucceeded);
+    TestEqual(TEXT("No sessions are left"), Fixture.Mock->Session->GetNumSessions(), 0);
+
+    // @note: A successful join travels to the host, which this standalone game instance can't do, so only the
+    // rejected join is driven here.
+    Fixture.Mock->AddAdvertisedSessions(5);
+    TArray<FMOSSessionsSearchResult> Results;
+    TestTrue(TEXT("FindSessions completes"), Fixture.FindSessions(Results, bSucceeded));
+    const FMOSSessionsSearchResult *FullSession = Results.FindByPredicate([](const FMOSSessionsSearchResult &Row) {
+        return Row.SessionSearchResult.Session.NumOpenPublicConnections == 0;
+    });
+    if (!TestNotNull(TEXT("One of the sessions is full"), FullSession))
+    {
+        return false;
+    }
+    FMOSSessionsSearchResult FullSessionCopy = *FullSession;
+    TestTrue(
+        TEXT("JoinSession completes"),
+        Fixture.Await(
+            [&Fixture, &FullSessionCopy](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsJoinSession(FullSessionCopy, NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestFalse(TEXT("Joining a full session fails"), bSucceeded);
+    TestEqual(TEXT("The join reports why"), Error, FString(TEXT("SessionIsFull")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPIFriendsQueryFriendsAtScaleTest,
+    "MOS.OnlineAPI.Friends.QueryFriendsAtScale",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPIFriendsQueryFriendsAtScaleTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->AddFriends(5000);
+
+    // The second query has to reach the backend to pick up the change.
+    Fixture.Subsystem->FriendsQueryFriendsMemoizeSeconds = 0.0f;
+    bool bSucceeded = false;
+    FString Error;
+
+    double StartTime = FPlatformTime::Seconds();
+    TestTrue(
+        TEXT("QueryFriends completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteFriendsQueryFriends(Result);
+            },
+            bSucceeded,
+            Error));
+    double QueryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestTrue(TEXT("QueryFriends succeeds"), bSucceeded);
+
+    StartTime = FPlatformTime::Seconds();
+    TArray<FUniqueNetIdRepl> Friends = Fixture.Subsystem->GetFriendsCurrentFriends();
+    double ListMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("Every friend is listed"), Friends.Num(), 5000);
+
+    // Changing one friend and reading again should only pick up that change.
+    Fixture.Mock->Friends->Friends.RemoveAt(0);
+    StartTime = FPlatformTime::Seconds();
+    TestTrue(
+        TEXT("The second QueryFriends completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteFriendsQueryFriends(Result);
+            },
+            bSucceeded,
+            Error));
+    double RequeryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    TestEqual(TEXT("The removed friend is gone"), Fixture.Subsystem->GetFriendsCurrentFriends().Num(), 4999);
+
+    AddInfo(FString::Printf(
+        TEXT("QueryFriends over 5000 friends: %.2f ms first, %.2f ms after one removal, %.2f ms to list."),
+        QueryMs,
+        RequeryMs,
+        ListMs));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSOnlineAPIPartiesTest, "MOS.OnlineAPI.Parties.Lifecycle", OnlineAPITestFlags)
+bool FMOSOnlineAPIPartiesTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    bool bSucceeded = false;
+    FString Error;
+
+    TestTrue(
+        TEXT("CreateParty completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecutePartiesCreateParty(Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("CreateParty succeeds"), bSucceeded);
+
+    TArray<FMOSInterfaceListEntry> Parties = Fixture.Subsystem->GetPartiesJoinedParties();
+    if (!TestEqual(TEXT("One party is joined"), Parties.Num(), 1))
+    {
+        return false;
+    }
+    FString PartyId = Parties[0].Id;
+
+    TestTrue(
+        TEXT("A second CreateParty completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecutePartiesCreateParty(Result);
+            },
+            bSucceeded,
+            Error));
+    TestFalse(TEXT("Creating a second primary party fails"), bSucceeded);
+
+    FUniqueNetIdRepl Friend(FMockOnlineSubsystem::MakeUserId(TEXT("friend-1")));
+    TestTrue(
+        TEXT("InviteFriend completes"),
+        Fixture.Await(
+            [&Fixture, &PartyId, &Friend](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecutePartiesInviteFriend(PartyId, Friend, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("InviteFriend succeeds"), bSucceeded);
+    TestEqual(TEXT("The invitation is recorded"), Fixture.Mock->Parties->Parties[0].InvitedUsers.Num(), 1);
+
+    // The mock never delivers invites, so put the friend in the party directly and kick them.
+    Fixture.Mock->Parties->Parties[0].Members.Add(Friend.GetUniqueNetId().ToSharedRef());
+    TestEqual(TEXT("The friend is a member"), Fixture.Subsystem->GetPartiesCurrentMembers(PartyId).Num(), 2);
+    TestTrue(
+        TEXT("KickMember completes"),
+        Fixture.Await(
+            [&Fixture, &PartyId, &Friend](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecutePartiesKickMember(PartyId, Friend, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("KickMember succeeds"), bSucceeded);
+    TestEqual(TEXT("Only the leader is left"), Fixture.Subsystem->GetPartiesCurrentMembers(PartyId).Num(), 1);
+
+    TestTrue(
+        TEXT("LeaveParty completes"),
+        Fixture.Await(
+            [&Fixture, &PartyId](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecutePartiesLeaveParty(PartyId, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("LeaveParty succeeds"), bSucceeded);
+    TestEqual(TEXT("No parties are joined"), Fixture.Subsystem->GetPartiesJoinedParties().Num(), 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPILeaderboardsQueryGlobalTest,
+    "MOS.OnlineAPI.Leaderboards.QueryGlobal",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPILeaderboardsQueryGlobalTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->SetLeaderboard(TEXT("TestScore"), 1000);
+
+    TStrongObjectPtr<UMOS_QueryLeaderboardsAsyncResult> Result(NewObject<UMOS_QueryLeaderboardsAsyncResult>());
+    bool bDone = false;
+    bool bSucceeded = false;
+    TArray<FMOSLeaderboardsLeaderboardEntry> Entries;
+    Result->NativeCallback.BindLambda(
+        [&](bool bWasSuccessful, const TArray<FMOSLeaderboardsLeaderboardEntry> &Results, FString ErrorMessage) {
+            bDone = true;
+            bSucceeded = bWasSuccessful;
+            Entries = Results;
+        });
+    Fixture.Subsystem->ExecuteLeaderboardsQueryGlobalLeaderboards(Result.Get());
+    TestTrue(TEXT("The query completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("The query succeeds"), bSucceeded);
+    if (TestTrue(TEXT("Rows are returned"), Entries.Num() > 0))
+    {
+        TestEqual(TEXT("The first row is the top rank"), Entries[0].Rank, 1);
+        TestEqual(TEXT("The top score is first"), Entries[0].CurrentValue, 1000.0);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPILeaderboardsQueryPagesTest,
+    "MOS.OnlineAPI.Leaderboards.QueryPages",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPILeaderboardsQueryPagesTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->SetLeaderboard(TEXT("TestScore"), 100);
+
+    // A window that starts and ends part way through a page.
+    const int32 FirstRank = 15;
+    const int32 RankCount = 30;
+    TStrongObjectPtr<UMOS_QueryLeaderboardPagesAsyncResult> Result(NewObject<UMOS_QueryLeaderboardPagesAsyncResult>());
+    bool bDone = false;
+    bool bSucceeded = false;
+    TMap<int32, FMOSLeaderboardsLeaderboardEntry> EntriesByRank;
+    int32 DuplicateCount = 0;
+    bool bPageFirstRanksMatch = true;
+    Result->NativePageCallback.BindLambda([&](int32 PageFirstRank, const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries) {
+        bPageFirstRanksMatch &= Entries.Num() > 0 && Entries[0].Rank == PageFirstRank;
+        for (const auto &Entry : Entries)
+        {
+            if (EntriesByRank.Contains(Entry.Rank))
+            {
+                DuplicateCount++;
+            }
+            EntriesByRank.Add(Entry.Rank, Entry);
+        }
+    });
+    Result->NativeCallback.BindLambda([&](bool bWasSuccessful, FString ErrorMessage) {
+        bDone = true;
+        bSucceeded = bWasSuccessful;
+    });
+    Fixture.Subsystem->ExecuteLeaderboardsQueryLeaderboardPages(TEXT("TestScore"), FirstRank, RankCount, 10, Result.Get());
+    TestTrue(TEXT("The query completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("The query succeeds"), bSucceeded);
+    TestTrue(TEXT("Each page reports the rank of its first entry"), bPageFirstRanksMatch);
+    TestEqual(TEXT("No rank is delivered twice"), DuplicateCount, 0);
+    TestEqual(TEXT("Exactly the ranks in the window are delivered"), EntriesByRank.Num(), RankCount);
+    for (int32 Rank = FirstRank; Rank < FirstRank + RankCount; Rank++)
+    {
+        const FMOSLeaderboardsLeaderboardEntry *Entry = EntriesByRank.Find(Rank);
+        if (!TestNotNull(FString::Printf(TEXT("Rank %d is delivered"), Rank), Entry))
+        {
+            continue;
+        }
+        TestEqual(FString::Printf(TEXT("Rank %d has its own score"), Rank), Entry->CurrentValue, 101.0 - Rank);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPILeaderboardsQueryPagesClampTest,
+    "MOS.OnlineAPI.Leaderboards.QueryPagesClamp",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPILeaderboardsQueryPagesClampTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Mock->SetLeaderboard(TEXT("TestScore"), 100);
+
+    auto Query = [&Fixture](int32 FirstRank, int32 RankCount, int32 &OutEntryCount) {
+        TStrongObjectPtr<UMOS_QueryLeaderboardPagesAsyncResult> Result(NewObject<UMOS_QueryLeaderboardPagesAsyncResult>());
+        bool bDone = false;
+        bool bSucceeded = false;
+        OutEntryCount = 0;
+        Result->NativePageCallback.BindLambda([&](int32 PageFirstRank, const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries) {
+            OutEntryCount += Entries.Num();
+        });
+        Result->NativeCallback.BindLambda([&](bool bWasSuccessful, FString ErrorMessage) {
+            bDone = true;
+            bSucceeded = bWasSuccessful;
+        });
+        Fixture.Subsystem->ExecuteLeaderboardsQueryLeaderboardPages(TEXT("TestScore"), FirstRank, RankCount, 10, Result.Get());
+        return Fixture.TickUntil([&bDone]() {
+            return bDone;
+        }) && bSucceeded;
+    };
+
+    // A huge window only reads the pages of the clamped window and its prefetched neighbour.
+    int32 EntryCount = 0;
+    TestTrue(TEXT("A huge window succeeds"), Query(1, MAX_int32, EntryCount));
+    TestEqual(TEXT("Every entry on the board is delivered"), EntryCount, 100);
+    TestEqual(
+        TEXT("Only the clamped window is read"),
+        Fixture.Mock->GetCallCount(TEXT("Leaderboards.ReadLeaderboardsAroundRank")),
+        OSS::OnlineAPI::LeaderboardMaxWindowRanks / 10 + Fixture.Subsystem->LeaderboardPrefetchPages);
+
+    // A window at the end of the rank range doesn't overflow.
+    TestTrue(TEXT("A window at the last rank succeeds"), Query(MAX_int32 - 5, MAX_int32, EntryCount));
+    TestEqual(TEXT("Nothing is ranked that low"), EntryCount, 0);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSOnlineAPIStatsTest, "MOS.OnlineAPI.Stats.IngestAndQuery", OnlineAPITestFlags)
+bool FMOSOnlineAPIStatsTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    bool bSucceeded = false;
+    FString Error;
+
+    TestTrue(
+        TEXT("IngestStat completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteStatsIngestStat(TEXT("TestScore"), 42.0, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("IngestStat succeeds"), bSucceeded);
+    TestEqual(TEXT("The backend holds the stat"), Fixture.Mock->Stats->Values.FindRef(TEXT("TestScore")), 42);
+
+    TStrongObjectPtr<UMOS_QueryStatsAsyncResult> Result(NewObject<UMOS_QueryStatsAsyncResult>());
+    bool bDone = false;
+    TArray<FMOSStatsStatState> Stats;
+    Result->NativeCallback.BindLambda([&](bool bWasSuccessful, const TArray<FMOSStatsStatState> &Results, FString ErrorMessage) {
+        bDone = true;
+        bSucceeded = bWasSuccessful;
+        Stats = Results;
+    });
+    Fixture.Subsystem->ExecuteStatsQueryStats(Result.Get());
+    TestTrue(TEXT("QueryStats completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("QueryStats succeeds"), bSucceeded);
+    const FMOSStatsStatState *Score = Stats.FindByPredicate([](const FMOSStatsStatState &Stat) {
+        return Stat.Name == TEXT("TestScore");
+    });
+    if (TestNotNull(TEXT("The stat is returned"), Score))
+    {
+        TestEqual(TEXT("The stat has the ingested value"), Score->CurrentValue, 42.0);
+    }
+
+    // Querying again reuses the memoized result, until a write makes it stale.
+    int32 QueryCount = Fixture.Mock->GetCallCount(TEXT("Stats.QueryStats"));
+    auto QueryAgain = [&]() {
+        bDone = false;
+        Fixture.Subsystem->ExecuteStatsQueryStats(Result.Get());
+        return Fixture.TickUntil([&bDone]() {
+            return bDone;
+        });
+    };
+    TestTrue(TEXT("A repeated QueryStats completes"), QueryAgain());
+    TestEqual(TEXT("A repeated QueryStats is memoized"), Fixture.Mock->GetCallCount(TEXT("Stats.QueryStats")), QueryCount);
+    TestTrue(
+        TEXT("A second IngestStat completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteStatsIngestStat(TEXT("TestScore"), 43.0, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("QueryStats after a write completes"), QueryAgain());
+    TestEqual(
+        TEXT("QueryStats after a write reaches the backend"),
+        Fixture.Mock->GetCallCount(TEXT("Stats.QueryStats")),
+        QueryCount + 1);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPIStatsFlushStatWritesTest,
+    "MOS.OnlineAPI.Stats.FlushStatWrites",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPIStatsFlushStatWritesTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+
+    // A stat can only be aggregated one way at a time.
+    Fixture.Subsystem->QueueStatsIngestStat(TEXT("Kills"), 5.0, EMOSStatAggregation::Sum);
+    Fixture.Subsystem->QueueStatsIngestStat(TEXT("Kills"), 100.0, EMOSStatAggregation::Max);
+    Fixture.Subsystem->QueueStatsIngestStat(TEXT("BestLap"), 80.0, EMOSStatAggregation::Max);
+    Fixture.Subsystem->FlushStatWrites();
+    TestTrue(TEXT("The flush completes"), Fixture.TickUntil([&Fixture]() {
+        return Fixture.Mock->GetPendingCompletionCount() == 0 && Fixture.Mock->GetCallCount(TEXT("Stats.UpdateStats")) == 1;
+    }));
+    TestEqual(TEXT("The sum is written once"), Fixture.Mock->Stats->Values.FindRef(TEXT("Kills")), 5);
+    TestEqual(TEXT("The other stat is written"), Fixture.Mock->Stats->Values.FindRef(TEXT("BestLap")), 80);
+
+    // The backend applies the next flush, but answers after the dispatcher has given up on it.
+    Fixture.Mock->LatencySeconds = 0.5f;
+    Fixture.Subsystem->OnlineCallTimeoutSeconds = 0.1f;
+    Fixture.Subsystem->QueueStatsIngestStat(TEXT("Kills"), 3.0, EMOSStatAggregation::Sum);
+    Fixture.Subsystem->QueueStatsIngestStat(TEXT("BestLap"), 90.0, EMOSStatAggregation::Max);
+    Fixture.Subsystem->FlushStatWrites();
+    TestTrue(TEXT("The late write lands"), Fixture.TickUntil([&Fixture]() {
+        return Fixture.Mock->GetPendingCompletionCount() == 0 && Fixture.Mock->GetCallCount(TEXT("Stats.UpdateStats")) == 2;
+    }));
+
+    // Retrying only resends the write that's safe to apply twice.
+    Fixture.Mock->LatencySeconds = 0.0f;
+    Fixture.Subsystem->OnlineCallTimeoutSeconds = 30.0f;
+    Fixture.Subsystem->FlushStatWrites();
+    TestTrue(TEXT("The retry completes"), Fixture.TickUntil([&Fixture]() {
+        return Fixture.Mock->GetPendingCompletionCount() == 0 && Fixture.Mock->GetCallCount(TEXT("Stats.UpdateStats")) == 3;
+    }));
+    TestEqual(TEXT("The sum is not counted twice"), Fixture.Mock->Stats->Values.FindRef(TEXT("Kills")), 8);
+    TestEqual(TEXT("The largest value is kept"), Fixture.Mock->Stats->Values.FindRef(TEXT("BestLap")), 90);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPIStatsWriteJournalTest,
+    "MOS.OnlineAPI.Stats.WriteJournal",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPIStatsWriteJournalTest::RunTest(const FString &Parameters)
+{
+    // Journals a flush that was cut short by the game exiting, and replays it the way the owner's next login does.
+    auto Replay = [this](bool bStatsSent, double ExpectedKills) {
+        FString OwnerId = TEXT("JournalTest-") + FGuid::NewGuid().ToString();
+        FStatWriteBatch Batch;
+        uint64 FlushId = 0;
+        {
+            FStatWriteBuffer Buffer;
+            Buffer.SetOwner(OwnerId);
+            Buffer.AddStat(TEXT("Kills"), 5.0, EMOSStatAggregation::Sum);
+            Buffer.AddStat(TEXT("BestLap"), 80.0, EMOSStatAggregation::Max);
+            Buffer.BeginFlush(Batch, FlushId);
+            Buffer.SaveJournal();
+            if (bStatsSent)
+            {
+                Buffer.MarkStatsSent(FlushId);
+                Buffer.SaveJournal();
+            }
+            Buffer.AddStat(TEXT("Kills"), 3.0, EMOSStatAggregation::Sum);
+            Buffer.SaveJournal();
+        }
+
+        FStatWriteBuffer Replayed;
+        Replayed.SetOwner(OwnerId);
+        TestTrue(TEXT("The journal is replayed"), Replayed.BeginFlush(Batch, FlushId));
+        TestEqual(TEXT("The summed stat is reconciled"), Batch.Stats.FindRef(TEXT("Kills")).Value, ExpectedKills);
+        TestEqual(TEXT("The idempotent stat is retried"), Batch.Stats.FindRef(TEXT("BestLap")).Value, 80.0);
+        Replayed.EndFlush(FlushId, EStatFlushResult::Succeeded, true);
+        Replayed.SaveJournal();
+    };
+
+    // A sum that was sent may already have been applied, so only the one queued since is replayed.
+    Replay(true, 3.0);
+    // A sum that was never sent definitely wasn't, so it's replayed along with the one queued since.
+    Replay(false, 8.0);
+
+    // A flush that began before the owner changed can't finish the new owner's flush.
+    FStatWriteBuffer Buffer;
+    FStatWriteBatch Batch;
+    uint64 StaleFlushId = 0;
+    uint64 FlushId = 0;
+    Buffer.SetOwner(TEXT("JournalTest-") + FGuid::NewGuid().ToString());
+    Buffer.AddStat(TEXT("Kills"), 1.0, EMOSStatAggregation::Sum);
+    Buffer.BeginFlush(Batch, StaleFlushId);
+    Buffer.Reset();
+    Buffer.SetOwner(TEXT("JournalTest-") + FGuid::NewGuid().ToString());
+    Buffer.AddStat(TEXT("Kills"), 2.0, EMOSStatAggregation::Sum);
+    TestTrue(TEXT("The new owner's flush begins"), Buffer.BeginFlush(Batch, FlushId));
+    TestFalse(TEXT("The stale flush is ignored"), Buffer.EndFlush(StaleFlushId, EStatFlushResult::Failed, false));
+    TestTrue(TEXT("The new owner's flush is still running"), Buffer.IsFlushing());
+    TestTrue(TEXT("The new owner's flush ends"), Buffer.EndFlush(FlushId, EStatFlushResult::Succeeded, true));
+    TestEqual(TEXT("Nothing is left to retry"), Buffer.GetPendingCount(), 0);
+    Buffer.SaveJournal();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSOnlineAPIUserCloudTest, "MOS.OnlineAPI.UserCloud.WriteAndRead", OnlineAPITestFlags)
+bool FMOSOnlineAPIUserCloudTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    bool bSucceeded = false;
+    FString Error;
+    FString FileName = FString::Printf(TEXT("MOSTest-%s.txt"), *FGuid::NewGuid().ToString());
+
+    TestTrue(
+        TEXT("WriteStringToFile completes"),
+        Fixture.Await(
+            [&Fixture, &FileName](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteUserCloudWriteStringToFile(FileName, TEXT("Hello, cloud."), Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("WriteStringToFile succeeds"), bSucceeded);
+    TestTrue(TEXT("The backend holds the file"), Fixture.Mock->UserCloud->Files.Contains(FileName));
+
+    // Until a file listing confirms the upload, writing the same content uploads it again.
+    auto WriteAgain = [&Fixture, &FileName, &bSucceeded, &Error]() {
+        return Fixture.Await(
+            [&Fixture, &FileName](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteUserCloudWriteStringToFile(FileName, TEXT("Hello, cloud."), Result);
+            },
+            bSucceeded,
+            Error);
+    };
+    TestTrue(TEXT("An unconfirmed rewrite completes"), WriteAgain());
+    TestTrue(TEXT("An unconfirmed rewrite succeeds"), bSucceeded);
+    TestEqual(
+        TEXT("An unconfirmed rewrite is uploaded"),
+        Fixture.Mock->GetCallCount(TEXT("UserCloud.WriteUserFile")),
+        2);
+
+    TStrongObjectPtr<UMOS_ReadFileStringAsyncResult> ReadResult(NewObject<UMOS_ReadFileStringAsyncResult>());
+    bool bDone = false;
+    FString Contents;
+    ReadResult->NativeCallback.BindLambda([&](bool bWasSuccessful, const FString &Result, FString ErrorMessage) {
+        bDone = true;
+        bSucceeded = bWasSuccessful;
+        Contents = Result;
+    });
+    Fixture.Subsystem->ExecuteUserCloudReadStringFromFile(FileName, ReadResult.Get());
+    TestTrue(TEXT("ReadStringFromFile completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("ReadStringFromFile succeeds"), bSucceeded);
+    TestEqual(TEXT("The contents round-trip"), Contents, FString(TEXT("Hello, cloud.")));
+
+    TStrongObjectPtr<UMOS_ListAsyncResult> ListResult(NewObject<UMOS_ListAsyncResult>());
+    bDone = false;
+    TArray<FMOSInterfaceListEntry> Files;
+    ListResult->NativeCallback.BindLambda(
+        [&](bool bWasSuccessful, const TArray<FMOSInterfaceListEntry> &Results, FString ErrorMessage) {
+            bDone = true;
+            bSucceeded = bWasSuccessful;
+            Files = Results;
+        });
+    Fixture.Subsystem->ExecuteUserCloudQueryFiles(ListResult.Get());
+    TestTrue(TEXT("QueryFiles completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("QueryFiles succeeds"), bSucceeded);
+    TestTrue(TEXT("The file is listed"), Files.ContainsByPredicate([&FileName](const FMOSInterfaceListEntry &Entry) {
+        return Entry.Id == FileName;
+    }));
+
+    // Once the listing has confirmed the remote hash, the same content isn't uploaded again.
+    TestTrue(TEXT("A confirmed rewrite completes"), WriteAgain());
+    TestTrue(TEXT("A confirmed rewrite succeeds"), bSucceeded);
+    TestEqual(
+        TEXT("A confirmed rewrite is skipped"),
+        Fixture.Mock->GetCallCount(TEXT("UserCloud.WriteUserFile")),
+        2);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPIUserCloudChunkCleanupTest,
+    "MOS.OnlineAPI.UserCloud.ChunkCleanup",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPIUserCloudChunkCleanupTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    Fixture.Subsystem->UserCloudChunkedSyncThresholdKB = 64;
+    bool bSucceeded = false;
+    FString Error;
+    FString FileName = FString::Printf(TEXT("MOSTest-%s.bin"), *FGuid::NewGuid().ToString());
+    FString LocalFilePath = FPaths::Combine(FPaths::AutomationTransientDir(), FileName);
+
+    auto SyncUp = [&](int32 Seed) {
+        FRandomStream Random(Seed);
+        TArray<uint8> Data;
+        Data.SetNumUninitialized(512 * 1024);
+        for (uint8 &Byte : Data)
+        {
+            Byte = static_cast<uint8>(Random.RandHelper(256));
+        }
+        FFileHelper::SaveArrayToFile(Data, *LocalFilePath);
+        bool bCompleted = Fixture.Await(
+            [&](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteUserCloudSyncFileUp(FileName, LocalFilePath, Result);
+            },
+            bSucceeded,
+            Error);
+
+        // Orphaned chunks are deleted after the sync has reported its result.
+        return bCompleted && Fixture.TickUntil([&Fixture]() {
+            return Fixture.Mock->GetPendingCompletionCount() == 0;
+        });
+    };
+    auto GetChunkFiles = [&Fixture]() {
+        TSet<FString> ChunkFiles;
+        for (const auto &KV : Fixture.Mock->UserCloud->Files)
+        {
+            if (KV.Key.StartsWith(TEXT("mos-chunk-")))
+            {
+                ChunkFiles.Add(KV.Key);
+            }
+        }
+        return ChunkFiles;
+    };
+
+    TestTrue(TEXT("The first sync completes"), SyncUp(1));
+    TestTrue(TEXT("The first sync succeeds"), bSucceeded);
+    TSet<FString> FirstChunks = GetChunkFiles();
+    TestTrue(TEXT("The file is uploaded in chunks"), FirstChunks.Num() > 1);
+
+    TestTrue(TEXT("The second sync completes"), SyncUp(2));
+    TestTrue(TEXT("The second sync succeeds"), bSucceeded);
+    TSet<FString> SecondChunks = GetChunkFiles();
+    TestTrue(TEXT("The new content is uploaded in chunks"), SecondChunks.Num() > 1);
+    TestTrue(TEXT("Chunks only the replaced index used are deleted"), FirstChunks.Intersect(SecondChunks).Num() == 0);
+    TestEqual(
+        TEXT("Every orphaned chunk is deleted"),
+        Fixture.Mock->GetCallCount(TEXT("UserCloud.DeleteUserFile")),
+        FirstChunks.Num());
+
+    IFileManager::Get().Delete(*LocalFilePath);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSOnlineAPITitleFileTest, "MOS.OnlineAPI.TitleFile.QueryAndRead", OnlineAPITestFlags)
+bool FMOSOnlineAPITitleFileTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    FTCHARToUTF8 Converted(TEXT("Message of the day"));
+    Fixture.Mock->TitleFile->Files.Add(
+        TEXT("Motd.txt"),
+        TArray<uint8>(reinterpret_cast<const uint8 *>(Converted.Get()), Converted.Length()));
+
+    TStrongObjectPtr<UMOS_ListAsyncResult> ListResult(NewObject<UMOS_ListAsyncResult>());
+    bool bDone = false;
+    bool bSucceeded = false;
+    TArray<FMOSInterfaceListEntry> Files;
+    ListResult->NativeCallback.BindLambda(
+        [&](bool bWasSuccessful, const TArray<FMOSInterfaceListEntry> &Results, FString ErrorMessage) {
+            bDone = true;
+            bSucceeded = bWasSuccessful;
+            Files = Results;
+        });
+    Fixture.Subsystem->ExecuteTitleFileQueryFiles(ListResult.Get());
+    TestTrue(TEXT("QueryFiles completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("QueryFiles succeeds"), bSucceeded);
+    TestEqual(TEXT("The title file is listed"), Files.Num(), 1);
+
+    TStrongObjectPtr<UMOS_ReadFileStringAsyncResult> ReadResult(NewObject<UMOS_ReadFileStringAsyncResult>());
+    bDone = false;
+    FString Contents;
+    ReadResult->NativeCallback.BindLambda([&](bool bWasSuccessful, const FString &Result, FString ErrorMessage) {
+        bDone = true;
+        bSucceeded = bWasSuccessful;
+        Contents = Result;
+    });
+    Fixture.Subsystem->ExecuteTitleFileReadStringFromFile(TEXT("Motd.txt"), ReadResult.Get());
+    TestTrue(TEXT("ReadStringFromFile completes"), Fixture.TickUntil([&bDone]() {
+        return bDone;
+    }));
+    TestTrue(TEXT("ReadStringFromFile succeeds"), bSucceeded);
+    TestEqual(TEXT("The contents are returned"), Contents, FString(TEXT("Message of the day")));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSOnlineAPITitleFileCacheTest, "MOS.OnlineAPI.TitleFile.Cache", OnlineAPITestFlags)
+bool FMOSOnlineAPITitleFileCacheTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    FString FileName = TEXT("CacheTest-") + FGuid::NewGuid().ToString();
+    FString CacheDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MOS"), TEXT("TitleFileCache"));
+    FString VersionWildcard = FPaths::Combine(CacheDirectory, FMD5::HashAnsiString(*FileName) + TEXT("-*"));
+    auto CountVersions = [&VersionWildcard]() {
+        TArray<FString> Versions;
+        IFileManager::Get().FindFiles(Versions, *VersionWildcard, true, false);
+        return Versions.Num();
+    };
+    auto ListVersion = [&FileName](FTitleFileCache &Cache, const TArray<uint8> &Contents, const TCHAR *HashType) {
+        TArray<FCloudFileHeader> Files;
+        FCloudFileHeader &Header = Files.Emplace_GetRef(FileName, FileName, Contents.Num());
+        FSHAHash Hash;
+        FSHA1::HashBuffer(Contents.GetData(), Contents.Num(), Hash.Hash);
+        Header.Hash = Hash.ToString();
+        Header.HashType = HashType;
+        Cache.SetListing(Files);
+    };
+
+    TArray<uint8> First = {1, 2, 3, 4};
+    TArray<uint8> Second = {5, 6, 7, 8, 9};
+    TArrayView<const uint8> View;
+    {
+        FTitleFileCache Cache;
+
+        // Storing a newer version while the first is still being written only keeps the newest one on disk.
+        ListVersion(Cache, First, TEXT("SHA1"));
+        Cache.Store(FileName, MakeShared<TArray<uint8>>(First));
+        ListVersion(Cache, Second, TEXT("SHA1"));
+        Cache.Store(FileName, MakeShared<TArray<uint8>>(Second));
+        TestTrue(TEXT("The newest version is cached"), Fixture.TickUntil([&]() {
+            return Cache.Find(FileName, View) && CountVersions() == 1;
+        }));
+        TestTrue(TEXT("The cached content is the newest version"), TArray<uint8>(View) == Second);
+
+        // Storing the current version again must not remove it.
+        Cache.Store(FileName, MakeShared<TArray<uint8>>(Second));
+        TestTrue(TEXT("The current version survives being stored again"), Fixture.TickUntil([&]() {
+            return Cache.Find(FileName, View) && CountVersions() == 1;
+        }));
+    }
+    {
+        // Content listed with a hash type we can't verify is never served from the cache.
+        FTitleFileCache Cache;
+        ListVersion(Cache, Second, TEXT("CRC32"));
+        Cache.Store(FileName, MakeShared<TArray<uint8>>(Second));
+        TestFalse(TEXT("A file with an unknown hash type is not served"), Cache.Find(FileName, View));
+    }
+
+    TArray<FString> Versions;
+    IFileManager::Get().FindFiles(Versions, *VersionWildcard, true, false);
+    for (const FString &Version : Versions)
+    {
+        IFileManager::Get().Delete(*FPaths::Combine(CacheDirectory, Version), false, false, true);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSOnlineAPIAvatarDiskCacheTest, "MOS.OnlineAPI.Avatar.DiskCache", OnlineAPITestFlags)
+bool FMOSOnlineAPIAvatarDiskCacheTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    FString CacheDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("MOS"), TEXT("AvatarCache"));
+    TArray<FUniqueNetIdRepl> UserIds;
+    TArray<FString> Paths;
+    for (int32 Index = 0; Index < 3; Index++)
+    {
+        UserIds.Add(FUniqueNetIdRepl(FMockOnlineSubsystem::MakeUserId(TEXT("AvatarTest-") + FGuid::NewGuid().ToString())));
+        Paths.Add(FPaths::Combine(CacheDirectory, FMD5::HashAnsiString(*UserIds.Last().ToString()) + TEXT(".bin")));
+    }
+    auto MakeAvatar = [](uint8 Shade) {
+        UTexture2D *Texture = UTexture2D::CreateTransient(8, 8, PF_B8G8R8A8);
+        auto &Mip = Texture->GetPlatformData()->Mips[0];
+        FMemory::Memset(Mip.BulkData.Lock(LOCK_READ_WRITE), Shade, 8 * 8 * 4);
+        Mip.BulkData.Unlock();
+        return TStrongObjectPtr<UTexture2D>(Texture);
+    };
+    auto CountFiles = [&Paths]() {
+        int32 Count = 0;
+        for (const FString &Path : Paths)
+        {
+            Count += IFileManager::Get().FileExists(*Path) ? 1 : 0;
+        }
+        return Count;
+    };
+
+    // @note: Room for two 8x8 avatars and their headers.
+    constexpr int64 DiskBudgetBytes = 2 * (8 * 8 * 4 + 24);
+    FAvatarCache Cache;
+    Cache.bPersistToDisk = true;
+    Cache.DiskBudgetBytes = DiskBudgetBytes;
+    auto First = MakeAvatar(1);
+    Cache.Add(UserIds[0], First.Get());
+    TestTrue(TEXT("The first avatar is written"), Fixture.TickUntil([&Paths]() {
+        return IFileManager::Get().FileExists(*Paths[0]);
+    }));
+
+    // Another cache, as in the next run, reads it back without blocking.
+    FAvatarCache NextRun;
+    NextRun.bPersistToDisk = true;
+    TestNull(TEXT("A memory miss doesn't touch the disk"), NextRun.Find(UserIds[0]));
+    bool bLoaded = false;
+    UTexture *Loaded = nullptr;
+    NextRun.LoadFromDisk(UserIds[0], [&bLoaded, &Loaded](UTexture *Texture) {
+        bLoaded = true;
+        Loaded = Texture;
+    });
+    TestTrue(TEXT("The load completes"), Fixture.TickUntil([&bLoaded]() {
+        return bLoaded;
+    }));
+    if (TestNotNull(TEXT("The avatar is read back"), Loaded))
+    {
+        TestTrue(TEXT("The avatar is kept in memory"), NextRun.Find(UserIds[0]) == Loaded);
+        TestTrue(TEXT("The disk read counts as a hit"), NextRun.GetHitCount() == 2);
+    }
+
+    // Writing past the budget deletes older avatar files, but never the one just written.
+    auto Second = MakeAvatar(2);
+    auto Third = MakeAvatar(3);
+    Cache.Add(UserIds[1], Second.Get());
+    Cache.Add(UserIds[2], Third.Get());
+    TestTrue(TEXT("The disk cache is kept within its budget"), Fixture.TickUntil([&]() {
+        return IFileManager::Get().FileExists(*Paths[2]) && CountFiles() <= 2;
+    }));
+
+    for (const FString &Path : Paths)
+    {
+        IFileManager::Get().Delete(*Path, false, false, true);
+    }
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FMOSOnlineAPIInjectedFaultsTest,
+    "MOS.OnlineAPI.Dispatcher.InjectedFaults",
+    OnlineAPITestFlags)
+bool FMOSOnlineAPIInjectedFaultsTest::RunTest(const FString &Parameters)
+{
+    FOnlineAPITestFixture Fixture;
+    bool bSucceeded = true;
+    FString Error;
+
+    // Each of these used to call the backend directly, so an injected fault never reached them.
+    {
+        FScopedInjectedFault Fault(TEXT("Sessions.CreateSession"), 1.0f);
+        TestTrue(
+            TEXT("CreateSession completes"),
+            Fixture.Await(
+                [&Fixture](UMOS_AsyncResult *Result) {
+                    Fixture.Subsystem->ExecuteSessionsCreateSession(NAME_GameSession, Result);
+                },
+                bSucceeded,
+                Error));
+        TestFalse(TEXT("CreateSession fails"), bSucceeded);
+        TestEqual(TEXT("CreateSession never reaches the backend"), Fixture.Mock->GetCallCount(TEXT("Session.CreateSession")), 0);
+    }
+    {
+        FScopedInjectedFault Fault(TEXT("Parties.CreateParty"), 1.0f);
+        TestTrue(
+            TEXT("CreateParty completes"),
+            Fixture.Await(
+                [&Fixture](UMOS_AsyncResult *Result) {
+                    Fixture.Subsystem->ExecutePartiesCreateParty(Result);
+                },
+                bSucceeded,
+                Error));
+        TestFalse(TEXT("CreateParty fails"), bSucceeded);
+        TestEqual(TEXT("CreateParty never reaches the backend"), Fixture.Mock->GetCallCount(TEXT("Party.CreateParty")), 0);
+    }
+    {
+        FScopedInjectedFault Fault(TEXT("Stats.IngestStat"), 1.0f);
+        TestTrue(
+            TEXT("IngestStat completes"),
+            Fixture.Await(
+                [&Fixture](UMOS_AsyncResult *Result) {
+                    Fixture.Subsystem->ExecuteStatsIngestStat(TEXT("TestScore"), 1.0, Result);
+                },
+                bSucceeded,
+                Error));
+        TestFalse(TEXT("IngestStat fails"), bSucceeded);
+        TestEqual(TEXT("IngestStat never reaches the backend"), Fixture.Mock->GetCallCount(TEXT("Stats.UpdateStats")), 0);
+    }
+
+    // Once the fault is cleared the same calls go through.
+    TestTrue(
+        TEXT("CreateSession completes without a fault"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsCreateSession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestTrue(TEXT("CreateSession succeeds without a fault"), bSucceeded);
+
+    // A slow backend runs into the dispatcher's timeout, and the late completion is dropped.
+    Fixture.Mock->LatencySeconds = 0.5f;
+    Fixture.Subsystem->OnlineCallTimeoutSeconds = 0.1f;
+    TestTrue(
+        TEXT("StartSession completes"),
+        Fixture.Await(
+            [&Fixture](UMOS_AsyncResult *Result) {
+                Fixture.Subsystem->ExecuteSessionsStartSession(NAME_GameSession, Result);
+            },
+            bSucceeded,
+            Error));
+    TestFalse(TEXT("A timed out StartSession fails"), bSucceeded);
+    TestTrue(TEXT("The late completion drains"), Fixture.TickUntil([&Fixture]() {
+        return Fixture.Mock->GetPendingCompletionCount() == 0;
+    }));
+    return true;
+}
+
+} // namespace OSS::OnlineAPI::Tests
+
+#endif
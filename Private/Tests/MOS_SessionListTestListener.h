@@ -0,0 +1,43 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_Types.h"
+#include "MOS_SessionListTestListener.generated.h"
+
+/**
+ * Counts the session browser broadcasts, so that tests can bind to the subsystem's dynamic delegates.
+ */
+UCLASS()
+class UMOS_SessionListTestListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Update broadcasts whose ping is below this are counted in UpdateCount. */
+	int32 MaxCountedPing = MAX_int32;
+	int32 UpdateCount = 0;
+	int32 CompleteCount = 0;
+
+	UFUNCTION()
+	void OnUpdate(
+		const FMOSSessionsSearchResult &SessionResult,
+		const FString &SessionIdOverride,
+		const FString &OwningUserName,
+		int32 Ping,
+		int32 OpenPublicConnections)
+	{
+		if (Ping < this->MaxCountedPing)
+		{
+			this->UpdateCount++;
+		}
+	}
+
+	UFUNCTION()
+	void OnComplete()
+	{
+		this->CompleteCount++;
+	}
+};
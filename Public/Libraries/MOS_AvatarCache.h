@@ -0,0 +1,102 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/List.h"
+#include "GameFramework/OnlineReplStructs.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UTexture;
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Keeps recently fetched avatar textures alive, evicting the least recently used ones once the resident texture
+ * memory exceeds the budget. Optionally persists decoded avatar pixels to disk so they survive restarts; files are read
+ * and written on worker threads, and the least recently used ones are deleted once the disk cache exceeds its budget.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FAvatarCache
+{
+private:
+    struct FEntry
+    {
+        TStrongObjectPtr<UTexture> Texture;
+        int64 SizeBytes = 0;
+        TDoubleLinkedList<FUniqueNetIdRepl>::TDoubleLinkedListNode *LruNode = nullptr;
+    };
+
+    TMap<FUniqueNetIdRepl, FEntry> Entries;
+    // @note: Most recently used at the head.
+    TDoubleLinkedList<FUniqueNetIdRepl> LruList;
+    int64 BytesResident = 0;
+    int64 HitCount = 0;
+    int64 MissCount = 0;
+
+    // @note: Only weakly held by disk tasks, so a task finishing after the cache is destroyed can tell.
+    TSharedRef<uint8, ESPMode::ThreadSafe> LifetimeToken = MakeShared<uint8, ESPMode::ThreadSafe>(0);
+
+    void Insert(const FUniqueNetIdRepl &UserId, UTexture *Texture);
+    void Evict(const FUniqueNetIdRepl &UserId);
+    void EnforceBudget();
+    FString GetDiskPath(const FUniqueNetIdRepl &UserId) const;
+    void SaveToDisk(const FUniqueNetIdRepl &UserId, UTexture *Texture) const;
+
+public:
+    FAvatarCache() = default;
+    UE_NONCOPYABLE(FAvatarCache);
+
+    /** Resident texture memory above which least recently used avatars are evicted. */
+    int64 BudgetBytes = 32 * 1024 * 1024;
+
+    /** When set, decoded avatars are written to Saved/MOS/AvatarCache and read back on a memory miss. */
+    bool bPersistToDisk = false;
+
+    /** Avatars on disk older than this are ignored and re-downloaded. */
+    double DiskMaxAgeSeconds = 24.0 * 60.0 * 60.0;
+
+    /** Size of the disk cache above which the least recently used avatar files are deleted. */
+    int64 DiskBudgetBytes = 128 * 1024 * 1024;
+
+    /**
+     * Returns the avatar for the user from memory, or nullptr if it isn't resident. When persisting to disk, a memory
+     * miss only counts as a miss once LoadFromDisk hasn't found the avatar either.
+     */
+    UTexture *Find(const FUniqueNetIdRepl &UserId);
+
+    /**
+     * Reads the user's avatar from disk on a worker thread. OnLoaded is called on the game thread with the avatar,
+     * which is also kept in memory, or with nullptr if there's no usable file. It isn't called if the cache is
+     * destroyed first.
+     */
+    void LoadFromDisk(const FUniqueNetIdRepl &UserId, TFunction<void(UTexture *)> OnLoaded);
+
+    /** Adds or replaces the avatar for the user. */
+    void Add(const FUniqueNetIdRepl &UserId, UTexture *Texture);
+
+    /** Drops every avatar held in memory; the disk cache is left alone. */
+    void Reset();
+
+    int64 GetBytesResident() const
+    {
+        return this->BytesResident;
+    }
+
+    int32 GetEntryCount() const
+    {
+        return this->Entries.Num();
+    }
+
+    int64 GetHitCount() const
+    {
+        return this->HitCount;
+    }
+
+    int64 GetMissCount() const
+    {
+        return this->MissCount;
+    }
+};
+
+} // namespace OSS::OnlineAPI
@@ -2,20 +2,160 @@
 
 #pragma once
 
-#include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_CallManagerBase.h"
-#include "UObject/StrongObjectPtr.h"
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
 
 namespace OSS::OnlineAPI
 {
 
-	class MULTIPLAYERONLINESUBSYSTEM_API FCallManagerBase
-	{
-	public:
-		FCallManagerBase() = default;
-		UE_NONCOPYABLE(FCallManagerBase);
-		virtual ~FCallManagerBase() = default;
+/**
+ * Identifies an object held by a call manager's registry. The generation changes whenever the slot is freed, so a
+ * handle to a released object never resolves to whatever reuses its slot. Handles are plain values and can be copied
+ * or relocated freely.
+ */
+struct FCallScopedObjectHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const
+    {
+        return this->Index != INDEX_NONE;
+    }
+};
+
+/**
+ * The base of objects whose lifetime bounds a call: every TCallScopedObjectPtr created against a call manager releases
+ * its object when the manager is destroyed, or when ReleaseCallScopedObjects is called.
+ *
+ * The manager owns its objects in a slot registry that it reports to the GC (it is an FGCObject, rather than each
+ * pointer holding its own TStrongObjectPtr), and pointers only hold a handle into it. Slots are reused through a free
+ * list, so once the registry has grown to the number of live pointers, creating, copying and destroying pointers never
+ * allocates.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FCallManagerBase : public FGCObject
+{
+private:
+    struct FCallScopedObjectSlot
+    {
+        TObjectPtr<UObject> Object = nullptr;
+        uint32 Generation = 0;
+        bool bInUse = false;
+
+        /** The next free slot while this one is free. */
+        int32 NextFree = INDEX_NONE;
+    };
+
+    TArray<FCallScopedObjectSlot> CallScopedObjectSlots;
+    int32 FirstFreeCallScopedObjectSlot = INDEX_NONE;
+    int32 CallScopedObjectCount = 0;
+
+public:
+    FCallManagerBase() = default;
+    UE_NONCOPYABLE(FCallManagerBase);
+    virtual ~FCallManagerBase() = default;
+
+    /** For derived managers to announce their own destruction; call-scoped pointers don't need it. */
+    FSimpleMulticastDelegate OnDestruction;
+
+    /** Holds Object until the returned handle is removed or the manager releases its objects. */
+    FCallScopedObjectHandle AddCallScopedObject(UObject *Object)
+    {
+        int32 Index = this->FirstFreeCallScopedObjectSlot;
+        if (Index != INDEX_NONE)
+        {
+            this->FirstFreeCallScopedObjectSlot = this->CallScopedObjectSlots[Index].NextFree;
+        }
+        else
+        {
+            Index = this->CallScopedObjectSlots.AddDefaulted();
+        }
+
+        FCallScopedObjectSlot &Slot = this->CallScopedObjectSlots[Index];
+        Slot.Object = Object;
+        Slot.bInUse = true;
+        Slot.NextFree = INDEX_NONE;
+        this->CallScopedObjectCount++;
+        return FCallScopedObjectHandle{Index, Slot.Generation};
+    }
+
+    /** Releases the object of Handle. Does nothing if it has already been released. */
+    void RemoveCallScopedObject(const FCallScopedObjectHandle &Handle)
+    {
+        if (this->IsCurrent(Handle))
+        {
+            this->FreeSlot(Handle.Index);
+        }
+    }
+
+    /** The object held for Handle, or nullptr if it has been released. */
+    UObject *GetCallScopedObject(const FCallScopedObjectHandle &Handle) const
+    {
+        return this->IsCurrent(Handle) ? this->CallScopedObjectSlots[Handle.Index].Object.Get() : nullptr;
+    }
+
+    /** Releases every object held by a TCallScopedObjectPtr against this manager. */
+    void ReleaseCallScopedObjects()
+    {
+        for (int32 Index = 0; Index < this->CallScopedObjectSlots.Num(); Index++)
+        {
+            if (this->CallScopedObjectSlots[Index].bInUse)
+            {
+                this->FreeSlot(Index);
+            }
+        }
+    }
+
+    /** The number of objects currently held by TCallScopedObjectPtrs against this manager. */
+    int32 GetCallScopedObjectCount() const
+    {
+        int32 FreeCount = 0;
+        for (int32 Index = this->FirstFreeCallScopedObjectSlot; Index != INDEX_NONE;
+             Index = this->CallScopedObjectSlots[Index].NextFree)
+        {
+            checkf(!this->CallScopedObjectSlots[Index].bInUse, TEXT("Expected free call-scoped object slots to be unused."));
+            FreeCount++;
+        }
+        checkf(
+            this->CallScopedObjectCount + FreeCount == this->CallScopedObjectSlots.Num(),
+            TEXT("Expected every call-scoped object slot to be either in use or free."));
+        return this->CallScopedObjectCount;
+    }
+
+    virtual void AddReferencedObjects(FReferenceCollector &Collector) override
+    {
+        for (FCallScopedObjectSlot &Slot : this->CallScopedObjectSlots)
+        {
+            if (Slot.bInUse)
+            {
+                Collector.AddReferencedObject(Slot.Object);
+            }
+        }
+    }
+
+    virtual FString GetReferencerName() const override
+    {
+        return TEXT("OSS::OnlineAPI::FCallManagerBase");
+    }
+
+private:
+    void FreeSlot(int32 Index)
+    {
+        FCallScopedObjectSlot &Slot = this->CallScopedObjectSlots[Index];
+        Slot.Object = nullptr;
+        Slot.Generation++;
+        Slot.bInUse = false;
+        Slot.NextFree = this->FirstFreeCallScopedObjectSlot;
+        this->FirstFreeCallScopedObjectSlot = Index;
+        this->CallScopedObjectCount--;
+    }
 
-		FSimpleMulticastDelegate OnDestruction;
-	};
+    bool IsCurrent(const FCallScopedObjectHandle &Handle) const
+    {
+        return this->CallScopedObjectSlots.IsValidIndex(Handle.Index) &&
+               this->CallScopedObjectSlots[Handle.Index].bInUse &&
+               this->CallScopedObjectSlots[Handle.Index].Generation == Handle.Generation;
+    }
+};
 
 } // namespace OSS::OnlineAPI
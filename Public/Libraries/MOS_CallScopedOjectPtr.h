@@ -3,103 +3,98 @@
 #pragma once
 
 #include "MultiplayerOnlineSubsystem/Public/Libraries/MOS_CallManagerBase.h"
-#include "UObject/StrongObjectPtr.h"
 
 namespace OSS::OnlineAPI
 {
 
+/**
+ * A strong reference to a UObject that is dropped when its call manager is destroyed. The manager holds the object in
+ * its registry and this only keeps a weak reference to the manager and a handle into the registry, so the pointer has
+ * no address-dependent state and can be relocated freely by containers. Copying takes a registry slot of its own,
+ * moving hands the source's handle over, and neither allocates once the registry has grown to the live pointer count.
+ */
 template <typename T> class TCallScopedObjectPtr
 {
     template <typename OtherObjectType> friend class TCallScopedObjectPtr;
 
+    static_assert(std::is_base_of_v<UObject, T>, "TCallScopedObjectPtr can only point to UObjects.");
+
 private:
     TWeakPtr<FCallManagerBase> Owner;
-    TStrongObjectPtr<T> Ptr;
-    FDelegateHandle Handle;
+    FCallScopedObjectHandle Handle;
+
+    void Link(const TWeakPtr<FCallManagerBase> &InOwner, UObject *InObject)
+    {
+        TSharedPtr<FCallManagerBase> OwnerPinned = InOwner.Pin();
+        if (OwnerPinned.IsValid() && InObject != nullptr)
+        {
+            this->Owner = InOwner;
+            this->Handle = OwnerPinned->AddCallScopedObject(InObject);
+        }
+    }
+
+    template <typename OtherObjectType> void LinkCopyOf(const TCallScopedObjectPtr<OtherObjectType> &InOther)
+    {
+        this->Link(InOther.Owner, InOther.Get());
+    }
 
-    void Cleanup()
+    template <typename OtherObjectType> void TakeFrom(TCallScopedObjectPtr<OtherObjectType> &InOther)
     {
-        this->Ptr.Reset();
-        if (this->Handle.IsValid())
+        this->Owner = MoveTemp(InOther.Owner);
+        this->Handle = InOther.Handle;
+        InOther.Owner.Reset();
+        InOther.Handle = FCallScopedObjectHandle();
+    }
+
+    void Release()
+    {
+        if (this->Handle.IsSet())
         {
-            auto OwnerPinned = this->Owner.Pin();
+            TSharedPtr<FCallManagerBase> OwnerPinned = this->Owner.Pin();
             if (OwnerPinned.IsValid())
             {
-                OwnerPinned->OnDestruction.Remove(this->Handle);
-                this->Handle.Reset();
+                OwnerPinned->RemoveCallScopedObject(this->Handle);
             }
         }
+        this->Owner.Reset();
+        this->Handle = FCallScopedObjectHandle();
     }
 
 public:
-    TCallScopedObjectPtr()
-        : Owner()
-        , Ptr()
-        , Handle()
-    {
-    }
+    TCallScopedObjectPtr() = default;
     TCallScopedObjectPtr(const TSharedRef<FCallManagerBase> &InOwner, T *InPtr)
-        : Owner(InOwner)
-        , Ptr(InPtr)
     {
-        this->Handle = InOwner->OnDestruction.AddLambda([this]() {
-            this->Cleanup();
-        });
+        this->Link(InOwner, InPtr);
     }
     TCallScopedObjectPtr(const TCallScopedObjectPtr &InOther)
-        : Owner(InOther.Owner)
-        , Ptr(InOther.Ptr)
     {
-        auto OwnerPinned = this->Owner.Pin();
-        if (OwnerPinned.IsValid())
-        {
-            this->Handle = OwnerPinned->OnDestruction.AddLambda([this]() {
-                this->Cleanup();
-            });
-        }
+        this->LinkCopyOf(InOther);
     }
     TCallScopedObjectPtr(TCallScopedObjectPtr &&InOther)
-        : Owner(InOther.Owner)
-        , Ptr(InOther.Ptr)
     {
-        auto OwnerPinned = this->Owner.Pin();
-        if (OwnerPinned.IsValid())
-        {
-            this->Handle = OwnerPinned->OnDestruction.AddLambda([this]() {
-                this->Cleanup();
-            });
-        }
-        InOther.Cleanup();
+        this->TakeFrom(InOther);
     }
     template <typename OtherObjectType UE_REQUIRES(std::is_convertible_v<OtherObjectType *, T *>)>
     TCallScopedObjectPtr(const TCallScopedObjectPtr<OtherObjectType> &InOther)
-        : Owner(InOther.Owner)
-        , Ptr(InOther.Ptr)
     {
-        auto OwnerPinned = this->Owner.Pin();
-        if (OwnerPinned.IsValid())
-        {
-            this->Handle = OwnerPinned->OnDestruction.AddLambda([this]() {
-                this->Cleanup();
-            });
-        }
+        this->LinkCopyOf(InOther);
+    }
+    template <typename OtherObjectType UE_REQUIRES(std::is_convertible_v<OtherObjectType *, T *>)>
+    TCallScopedObjectPtr(TCallScopedObjectPtr<OtherObjectType> &&InOther)
+    {
+        this->TakeFrom(InOther);
     }
     ~TCallScopedObjectPtr()
     {
-        this->Cleanup();
+        this->Release();
     }
 
     TCallScopedObjectPtr &operator=(const TCallScopedObjectPtr &InOther)
     {
-        this->Cleanup();
-        this->Ptr = InOther.Ptr;
-        this->Owner = InOther.Owner;
-        auto OwnerPinned = this->Owner.Pin();
-        if (OwnerPinned.IsValid())
+        if (&InOther != this)
         {
-            this->Handle = OwnerPinned->OnDestruction.AddLambda([this]() {
-                this->Cleanup();
-            });
+            this->Release();
+            this->LinkCopyOf(InOther);
         }
         return *this;
     }
@@ -107,72 +102,71 @@ public:
     template <typename OtherObjectType UE_REQUIRES(std::is_convertible_v<OtherObjectType *, T *>)>
     TCallScopedObjectPtr &operator=(const TCallScopedObjectPtr<OtherObjectType> &InOther)
     {
-        this->Cleanup();
-        this->Ptr = InOther.Ptr;
-        this->Owner = InOther.Owner;
-        auto OwnerPinned = this->Owner.Pin();
-        if (OwnerPinned.IsValid())
-        {
-            this->Handle = OwnerPinned->OnDestruction.AddLambda([this]() {
-                this->Cleanup();
-            });
-        }
+        this->Release();
+        this->LinkCopyOf(InOther);
         return *this;
     }
 
     TCallScopedObjectPtr &operator=(TCallScopedObjectPtr &&InOther)
     {
-        this->Cleanup();
-        this->Ptr = InOther.Ptr;
-        this->Owner = InOther.Owner;
-        auto OwnerPinned = this->Owner.Pin();
-        if (OwnerPinned.IsValid())
+        if (&InOther != this)
         {
-            this->Handle = OwnerPinned->OnDestruction.AddLambda([this]() {
-                this->Cleanup();
-            });
+            this->Release();
+            this->TakeFrom(InOther);
         }
-        InOther.Cleanup();
+        return *this;
+    }
+
+    template <typename OtherObjectType UE_REQUIRES(std::is_convertible_v<OtherObjectType *, T *>)>
+    TCallScopedObjectPtr &operator=(TCallScopedObjectPtr<OtherObjectType> &&InOther)
+    {
+        this->Release();
+        this->TakeFrom(InOther);
         return *this;
     }
 
     T *operator->() const
     {
-        return this->Ptr.Get();
+        return this->Get();
     }
 
     T &operator*() const
     {
         checkf(this->IsValid(), TEXT("Expected pointer to be valid before using * operator!"));
-        return *this->Ptr;
+        return *this->Get();
     }
 
     T *Get() const
     {
-        return this->Ptr.Get();
+        TSharedPtr<FCallManagerBase> OwnerPinned = this->Owner.Pin();
+        if (!OwnerPinned.IsValid())
+        {
+            return nullptr;
+        }
+
+        // @note: Only ever assigned from a T*, so the cast is safe.
+        return static_cast<T *>(OwnerPinned->GetCallScopedObject(this->Handle));
     }
 
     bool IsValid() const
     {
-        return this->Owner.IsValid() && this->Ptr.IsValid();
+        return this->Get() != nullptr;
     }
 
     void Reset()
     {
-        this->Cleanup();
+        this->Release();
     }
 
     friend uint32 GetTypeHash(const TCallScopedObjectPtr &Value)
     {
-        return GetTypeHashHelper(Value.Ptr);
+        return GetTypeHash(Value.Get());
     }
 
     bool operator==(const TCallScopedObjectPtr &InOther) const
     {
-        return this->Ptr == InOther.Ptr;
+        return this->Get() == InOther.Get();
     }
 };
 
 } // namespace OSS::OnlineAPI
-
-
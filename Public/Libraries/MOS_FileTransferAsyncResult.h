@@ -0,0 +1,30 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MOS_FileTransferAsyncResult.generated.h"
+
+/**
+ * Receives progress updates for a streamed file transfer, then a single completion.
+ */
+UCLASS()
+class MULTIPLAYERONLINESUBSYSTEM_API UMOS_FileTransferAsyncResult : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	typedef TDelegate<void(float)> FNativeProgressCallback;
+	typedef TDelegate<void(bool, FString)> FNativeCallback;
+	bool bDidCallback;
+	FNativeProgressCallback NativeProgressCallback;
+	FNativeCallback NativeCallback;
+
+	/** Called on the game thread as the transfer advances; Progress runs from 0 to 1. */
+	UFUNCTION(BlueprintCallable, Category = "Callbacks")
+	void OnProgress(float Progress);
+
+	UFUNCTION(BlueprintCallable, Category = "Callbacks")
+	void OnResult(bool bWasSuccessful, const FString &ErrorMessage);
+};
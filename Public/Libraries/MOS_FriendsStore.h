@@ -0,0 +1,199 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/OnlineReplStructs.h"
+#include "MOS_Types.h"
+#include "OnlineSubsystemTypes.h"
+
+class FOnlineUserPresence;
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Stores each distinct string once and hands out stable indices for it, so that friends sharing a status string (or
+ * re-reporting an unchanged display name) don't each hold their own copy. Strings are reference counted, and once the
+ * last reference is released the string is freed and its index reused.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FStringInterner
+{
+private:
+    TArray<FString> Strings;
+    TArray<int32> RefCounts;
+    TArray<int32> FreeIndices;
+    TMap<FString, int32> Indices;
+
+public:
+    /**
+     * Returns the index of Value and adds a reference to it, adding the string if it isn't held yet. Index 0 is always
+     * the empty string, which isn't counted.
+     */
+    int32 Intern(const FString &Value);
+
+    /** Drops a reference taken by Intern, freeing the string when it was the last one. */
+    void Release(int32 Index);
+
+    /** The number of distinct strings currently held, including the empty string. */
+    int32 NumLive() const
+    {
+        return this->Strings.Num() - this->FreeIndices.Num();
+    }
+
+    const FString &Get(int32 Index) const
+    {
+        return this->Strings.IsValidIndex(Index) ? this->Strings[Index] : this->Strings[0];
+    }
+
+    int32 Num() const
+    {
+        return this->Strings.Num();
+    }
+
+    void Reset();
+
+    FStringInterner()
+    {
+        this->Reset();
+    }
+};
+
+/** The presence bits kept for every friend. */
+enum class EFriendPresenceFlags : uint8
+{
+    None = 0,
+    Online = 1 << 0,
+    Playing = 1 << 1,
+    PlayingThisGame = 1 << 2,
+    Joinable = 1 << 3,
+    HasVoiceSupport = 1 << 4,
+};
+ENUM_CLASS_FLAGS(EFriendPresenceFlags);
+
+/**
+ * Holds the signed in user's friends list as parallel arrays of the fields the UI reads every frame (presence bits,
+ * status, interned names), indexed by a dense friend index. Syncing against the online subsystem's list and applying
+ * presence updates only touch the friends whose state actually changed, and the ids of those friends are collected
+ * for the next change feed.
+ *
+ * Rarely read data (attributes, presence properties, party) isn't kept here; GetFriendsFriendState still reads it from
+ * the online subsystem on demand.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FFriendsStore
+{
+private:
+    TArray<FUniqueNetIdRepl> Ids;
+    TArray<EFriendPresenceFlags> PresenceFlags;
+    TArray<EMOSFriendsFriendPresenceStatus> PresenceStates;
+    TArray<EMOSFriendsFriendInvitationStatus> InvitationStates;
+    TArray<int32> DisplayNames;
+    TArray<int32> RealNames;
+    TArray<int32> StatusStrings;
+    TArray<FDateTime> LastOnline;
+
+    TMap<FUniqueNetIdRepl, int32> IndexById;
+    FStringInterner Names;
+    bool bPopulated = false;
+
+    TArray<FUniqueNetIdRepl> ChangedIds;
+    TSet<FUniqueNetIdRepl> ChangedIdSet;
+
+    int32 AddFriend(const FUniqueNetIdRepl &Id);
+    void RemoveFriendAt(int32 Index);
+    bool ApplyPresenceAt(int32 Index, const FOnlineUserPresence &Presence);
+    void MarkChanged(const FUniqueNetIdRepl &Id);
+    bool AssignString(int32 &Slot, const FString &Value);
+
+public:
+    FFriendsStore() = default;
+    UE_NONCOPYABLE(FFriendsStore);
+
+    static EMOSFriendsFriendInvitationStatus ConvertInvitationStatus(EInviteStatus::Type Status);
+    static EMOSFriendsFriendPresenceStatus ConvertPresenceStatus(const FOnlineUserPresence &Presence);
+
+    /**
+     * Brings the store in line with the friends list the online subsystem currently holds: new friends are added,
+     * missing friends removed and the rest updated in place.
+     */
+    void Sync(const TArray<TSharedRef<FOnlineFriend>> &Friends);
+
+    /** Applies a presence update for one user. Returns false if the user isn't a friend or nothing changed. */
+    bool ApplyPresence(const FUniqueNetIdRepl &Id, const FOnlineUserPresence &Presence);
+
+    /** Returns the ids of the friends that were added, removed or changed since the last call. */
+    TArray<FUniqueNetIdRepl> TakeChangedIds();
+
+    bool HasChanges() const
+    {
+        return this->ChangedIds.Num() > 0;
+    }
+
+    /** Whether Sync has been called since the last Reset. */
+    bool IsPopulated() const
+    {
+        return this->bPopulated;
+    }
+
+    void Reset();
+
+    int32 Num() const
+    {
+        return this->Ids.Num();
+    }
+
+    /** Returns the dense index of the friend, or INDEX_NONE. Indices change when friends are removed. */
+    int32 IndexOf(const FUniqueNetIdRepl &Id) const
+    {
+        const int32 *Index = this->IndexById.Find(Id);
+        return Index != nullptr ? *Index : INDEX_NONE;
+    }
+
+    const TArray<FUniqueNetIdRepl> &GetIds() const
+    {
+        return this->Ids;
+    }
+
+    EFriendPresenceFlags GetPresenceFlags(int32 Index) const
+    {
+        return this->PresenceFlags[Index];
+    }
+
+    EMOSFriendsFriendPresenceStatus GetPresenceStatus(int32 Index) const
+    {
+        return this->PresenceStates[Index];
+    }
+
+    EMOSFriendsFriendInvitationStatus GetInvitationStatus(int32 Index) const
+    {
+        return this->InvitationStates[Index];
+    }
+
+    const FString &GetDisplayName(int32 Index) const
+    {
+        return this->Names.Get(this->DisplayNames[Index]);
+    }
+
+    const FString &GetRealName(int32 Index) const
+    {
+        return this->Names.Get(this->RealNames[Index]);
+    }
+
+    const FString &GetStatusString(int32 Index) const
+    {
+        return this->Names.Get(this->StatusStrings[Index]);
+    }
+
+    FDateTime GetLastOnline(int32 Index) const
+    {
+        return this->LastOnline[Index];
+    }
+
+    /** The number of distinct name and status strings currently held. */
+    int32 GetStringCount() const
+    {
+        return this->Names.NumLive();
+    }
+};
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,113 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MOS_Types.h"
+
+namespace OSS::OnlineAPI
+{
+
+/** The rank the backend reports for the top entry of a leaderboard; the ranks used by page reads are in this base. */
+constexpr int32 LeaderboardFirstRank = 1;
+
+/**
+ * The most ranks a single ExecuteLeaderboardsQueryLeaderboardPages window (and a single page) covers; larger windows
+ * and pages are clamped to it. EOS only ranks the top 1000 entries of a leaderboard, so nothing is lost there.
+ */
+constexpr int32 LeaderboardMaxWindowRanks = 1000;
+
+/**
+ * Identifies one fixed-size page of a leaderboard: ranks [GetFirstRank(), GetEndRank()), so page 0 starts at
+ * LeaderboardFirstRank.
+ */
+struct FLeaderboardPageKey
+{
+    FName LeaderboardName;
+    int32 PageSize = 0;
+    int32 PageIndex = 0;
+
+    // @note: 64-bit, so the pages at the end of the rank range don't overflow.
+    int64 GetFirstRank() const
+    {
+        return LeaderboardFirstRank + static_cast<int64>(this->PageIndex) * this->PageSize;
+    }
+
+    int64 GetEndRank() const
+    {
+        return this->GetFirstRank() + this->PageSize;
+    }
+
+    bool operator==(const FLeaderboardPageKey &Other) const
+    {
+        return this->LeaderboardName == Other.LeaderboardName && this->PageSize == Other.PageSize &&
+               this->PageIndex == Other.PageIndex;
+    }
+
+    friend uint32 GetTypeHash(const FLeaderboardPageKey &Key)
+    {
+        return HashCombine(GetTypeHash(Key.LeaderboardName), HashCombine(Key.PageSize, Key.PageIndex));
+    }
+};
+
+/**
+ * Holds recently read leaderboard pages and the page reads currently in flight, so that overlapping windows and
+ * prefetched neighbours are only read from the backend once.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FLeaderboardPageCache
+{
+public:
+    typedef TSharedRef<const TArray<FMOSLeaderboardsLeaderboardEntry>> FPageRef;
+    typedef TFunction<void(bool, const TArray<FMOSLeaderboardsLeaderboardEntry> &, const FString &)> FOnPage;
+
+private:
+    struct FPage
+    {
+        FPageRef Entries;
+        double FetchedAt;
+    };
+
+    TMap<FLeaderboardPageKey, FPage> Pages;
+    TMap<FLeaderboardPageKey, TArray<FOnPage>> Fetches;
+
+    void EnforceLimit();
+
+public:
+    FLeaderboardPageCache() = default;
+    UE_NONCOPYABLE(FLeaderboardPageCache);
+
+    /** Pages older than this are read from the backend again. */
+    float MaxAgeSeconds = 30.0f;
+
+    /** The maximum number of pages kept; the oldest pages are dropped first. */
+    int32 MaxPages = 64;
+
+    /** Returns the cached page if it is younger than MaxAgeSeconds. */
+    TSharedPtr<const TArray<FMOSLeaderboardsLeaderboardEntry>> Find(const FLeaderboardPageKey &Key) const;
+
+    bool IsFetching(const FLeaderboardPageKey &Key) const
+    {
+        return this->Fetches.Contains(Key);
+    }
+
+    /**
+     * Waits for the page to be read; OnPage may be unset for prefetches. Returns true if the caller must start the
+     * read and later pass its outcome to CompleteFetch.
+     */
+    bool JoinFetch(const FLeaderboardPageKey &Key, FOnPage OnPage);
+
+    /** Stores a successful read and passes the outcome to everyone waiting on the page. */
+    void CompleteFetch(
+        const FLeaderboardPageKey &Key,
+        bool bWasSuccessful,
+        const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries,
+        const FString &ErrorMessage);
+
+    /** Drops every cached page; reads in flight still complete. */
+    void Reset()
+    {
+        this->Pages.Empty();
+    }
+};
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,174 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "MOS_OnlineCallMetrics.h"
+#include "Online/CoreOnline.h"
+
+class IOnlineSubsystem;
+class IOnlineIdentity;
+
+/**
+ * The online subsystem, identity interface and signed in user, resolved once and reused by every Execute* call until
+ * the user logs in or out, or the subsystem's world changes.
+ */
+struct MULTIPLAYERONLINESUBSYSTEM_API FMOSOnlineContext
+{
+    TWeakObjectPtr<UWorld> World;
+    IOnlineSubsystem *OSS = nullptr;
+    TSharedPtr<IOnlineIdentity, ESPMode::ThreadSafe> Identity;
+    FUniqueNetIdPtr UserId;
+    int32 LocalUserNum = INDEX_NONE;
+
+    void Reset()
+    {
+        *this = FMOSOnlineContext();
+    }
+};
+
+namespace OSS::OnlineAPI
+{
+
+template <typename... TPayload> struct TOnlineCall
+{
+    /** Reports the outcome of a call: success flag, payload, error message. */
+    typedef TFunction<void(bool, const TPayload &..., const FString &)> FComplete;
+
+    /** Starts the backend call; it must invoke the passed FComplete exactly once when the call finishes. */
+    typedef TFunction<void(const FComplete &)> FStart;
+};
+
+// @note: Reports the size of a call's result for FOnlineCallMetrics; payloads that aren't byte buffers or arrays
+// count as zero.
+template <typename T> int64 GetOnlineCallPayloadBytes(const T &)
+{
+    return 0;
+}
+
+template <typename T, typename TAllocator> int64 GetOnlineCallPayloadBytes(const TArray<T, TAllocator> &Payload)
+{
+    return static_cast<int64>(Payload.Num()) * sizeof(T);
+}
+
+template <typename T, ESPMode Mode> int64 GetOnlineCallPayloadBytes(const TSharedPtr<T, Mode> &Payload)
+{
+    return Payload.IsValid() ? GetOnlineCallPayloadBytes(*Payload) : 0;
+}
+
+/**
+ * Runs online calls through one completion path, with a bounded number of calls in flight, a per-call timeout and
+ * cancellation. Calls over the concurrency limit are queued and started in order as earlier calls finish.
+ *
+ * The MOS.Fault.* console variables inject latency and failures into dispatched calls, which together with the
+ * in-memory online subsystem in Private/Tests lets the Execute* paths be exercised without a live backend.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FOnlineCallDispatcher
+{
+private:
+    struct FPendingCall
+    {
+        int32 CallId;
+        FName Api;
+        float TimeoutSeconds;
+        double QueuedAt;
+        double StartedAt;
+        TFunction<void(int32)> Start;
+        TFunction<void(const FString &)> Abort;
+        FTSTicker::FDelegateHandle TimeoutHandle;
+        FTSTicker::FDelegateHandle DelayHandle;
+    };
+
+    int32 NextCallId = 1;
+    TArray<FPendingCall> QueuedCalls;
+    TMap<int32, FPendingCall> InFlightCalls;
+    FRandomStream FaultRandom;
+    int32 FaultSeed = 0;
+
+    void StartQueuedCalls();
+    void AbortCall(int32 CallId, const FString &Reason);
+    void RecordCall(const FPendingCall &Call, bool bWasSuccessful, int64 PayloadBytes);
+    void RemoveTickers(FPendingCall &Call);
+
+    // @note: Applies the MOS.Fault.* console variables. Returns true if the call should fail instead of starting;
+    // otherwise OutDelaySeconds is how long to hold the call before starting it.
+    bool RollFault(FName Api, float &OutDelaySeconds);
+
+public:
+    FOnlineCallDispatcher() = default;
+    UE_NONCOPYABLE(FOnlineCallDispatcher);
+    ~FOnlineCallDispatcher();
+
+    /**
+     * Returns the maximum number of calls that may be in flight at once; 0 or less means unbounded. Read whenever a
+     * queued call could start, so the owner can change the limit at any time.
+     */
+    TFunction<int32()> GetMaxConcurrentCalls = []() {
+        return 16;
+    };
+
+    /** Latency, outcome and payload size of every call, per API name. */
+    FOnlineCallMetrics Metrics;
+
+    /**
+     * Queues an untyped call. Start receives the call ID and must eventually pass it to Complete. Abort is invoked
+     * instead if the call times out or is cancelled first. Returns the call ID.
+     */
+    int32 Enqueue(
+        FName Api,
+        float TimeoutSeconds,
+        TFunction<void(int32)> Start,
+        TFunction<void(const FString &)> Abort);
+
+    /**
+     * Marks a call as finished and frees its slot. Returns false if the call already timed out or was cancelled, in
+     * which case the caller must drop its result.
+     */
+    bool Complete(int32 CallId, bool bWasSuccessful = true, int64 PayloadBytes = 0);
+
+    /** Cancels a queued or in-flight call, reporting failure to its caller. */
+    void Cancel(int32 CallId);
+
+    /** Cancels every queued and in-flight call, e.g. when the signed in user changes. */
+    void CancelAll(const FString &Reason);
+
+    int32 GetInFlightCount() const
+    {
+        return this->InFlightCalls.Num();
+    }
+
+    int32 GetQueuedCount() const
+    {
+        return this->QueuedCalls.Num();
+    }
+
+    /**
+     * Queues a typed call. OnComplete receives the outcome exactly once: either from Start, or a failure with a
+     * default payload if the call times out or is cancelled.
+     */
+    template <typename... TPayload>
+    int32 Run(
+        FName Api,
+        float TimeoutSeconds,
+        typename TOnlineCall<TPayload...>::FStart Start,
+        typename TOnlineCall<TPayload...>::FComplete OnComplete)
+    {
+        return this->Enqueue(
+            Api,
+            TimeoutSeconds,
+            [this, Start = MoveTemp(Start), OnComplete](int32 CallId) {
+                Start([this, CallId, OnComplete](bool bWasSuccessful, const TPayload &...Payload, const FString &Error) {
+                    if (this->Complete(CallId, bWasSuccessful, (GetOnlineCallPayloadBytes(Payload) + ... + 0)))
+                    {
+                        OnComplete(bWasSuccessful, Payload..., Error);
+                    }
+                });
+            },
+            [OnComplete](const FString &Reason) {
+                OnComplete(false, TPayload()..., Reason);
+            });
+    }
+};
+
+} // namespace OSS::OnlineAPI
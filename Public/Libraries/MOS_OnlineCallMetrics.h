@@ -0,0 +1,100 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "MOS_Types.h"
+
+namespace OSS::OnlineAPI
+{
+
+/** One finished online call or span, as kept for trace export. Times are FPlatformTime::Seconds(). */
+struct FOnlineCallRecord
+{
+    int32 Id = 0;
+    FName Api;
+    double QueuedAt = 0.0;
+    double StartedAt = 0.0;
+    double FinishedAt = 0.0;
+    bool bWasSuccessful = false;
+    int64 PayloadBytes = 0;
+};
+
+/**
+ * Records how long each online call and span took, per API name. Latencies go into log-spaced histograms covering two
+ * rolling windows, from which approximate p50/p95/p99 values are read; the most recent records are also kept so they
+ * can be exported as a Chrome trace (which Unreal Insights and chrome://tracing / Perfetto can open).
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FOnlineCallMetrics
+{
+private:
+    // @note: Bucket i holds latencies up to MinBucketMs * BucketRatio^i, so each bucket is 15% wider than the last and
+    // 96 buckets cover 0.5ms to a few minutes.
+    static constexpr int32 NumBuckets = 96;
+    static constexpr double MinBucketMs = 0.5;
+    static constexpr double BucketRatio = 1.15;
+
+    typedef TStaticArray<uint32, NumBuckets> FBuckets;
+
+    struct FApiMetrics
+    {
+        FBuckets CurrentWindow;
+        FBuckets PreviousWindow;
+        double WindowStartedAt = 0.0;
+        int64 CallCount = 0;
+        int64 FailureCount = 0;
+        int64 PayloadBytes = 0;
+        double MaxMs = 0.0;
+
+        FApiMetrics();
+    };
+
+    struct FOpenSpan
+    {
+        FName Name;
+        double StartedAt;
+    };
+
+    TMap<FName, FApiMetrics> Apis;
+    TArray<FOnlineCallRecord> Records;
+    int32 NextRecord = 0;
+    TMap<int32, FOpenSpan> OpenSpans;
+    int32 NextSpanId = 1;
+
+    void RotateWindow(FApiMetrics &Metrics, double Now) const;
+    static int32 GetBucket(double LatencyMs);
+    static double GetBucketUpperBoundMs(int32 Bucket);
+
+public:
+    FOnlineCallMetrics() = default;
+    UE_NONCOPYABLE(FOnlineCallMetrics);
+
+    /** How long each histogram window lasts; percentiles cover the current and previous window. */
+    double WindowSeconds = 60.0;
+
+    /** How many recent records are kept for trace export. */
+    int32 MaxRecords = 4096;
+
+    /** Records a finished call; its latency is measured from StartedAt, so time spent queued isn't counted. */
+    void Record(const FOnlineCallRecord &Record);
+
+    /**
+     * Starts a span for a step that doesn't go through the call dispatcher (e.g. session travel). Spans are also
+     * emitted as Unreal Insights regions where the engine supports them. Returns the span ID to pass to EndSpan.
+     */
+    int32 BeginSpan(FName Name);
+
+    /** Ends a span started by BeginSpan and records it like a call. Does nothing for an unknown or zero ID. */
+    void EndSpan(int32 SpanId, bool bWasSuccessful);
+
+    /** Returns the current statistics for every API that has been recorded, sorted by name. */
+    TArray<FMOSOnlineCallStats> GetStats() const;
+
+    /** Writes the recent records to FilePath as Chrome trace event JSON. */
+    bool ExportChromeTrace(const FString &FilePath) const;
+
+    void Reset();
+};
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,32 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MOS_Types.h"
+#include "MOS_QueryLeaderboardPagesAsyncResult.generated.h"
+
+/**
+ * Receives a leaderboard rank window one page at a time as each page is read, then a single completion.
+ */
+UCLASS()
+class MULTIPLAYERONLINESUBSYSTEM_API UMOS_QueryLeaderboardPagesAsyncResult : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	typedef TDelegate<void(int32, const TArray<FMOSLeaderboardsLeaderboardEntry> &)> FNativePageCallback;
+	typedef TDelegate<void(bool, FString)> FNativeCallback;
+	bool bDidCallback;
+	FNativePageCallback NativePageCallback;
+	FNativeCallback NativeCallback;
+
+	/** Called for each page that lands; FirstRank is the rank of the first entry. Pages may arrive out of order. */
+	UFUNCTION(BlueprintCallable, Category = "Callbacks")
+	void OnPage(int32 FirstRank, const TArray<FMOSLeaderboardsLeaderboardEntry> &Entries);
+
+	/** Called once every page in the window has landed or failed. */
+	UFUNCTION(BlueprintCallable, Category = "Callbacks")
+	void OnResult(bool bWasSuccessful, const FString &ErrorMessage);
+};
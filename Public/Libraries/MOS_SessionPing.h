@@ -0,0 +1,121 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FInternetAddr;
+class FSocket;
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Measures the round-trip time to session hosts by sending each one a small UDP probe and timing the echo. Hosts are
+ * probed in parallel, with at most MaxInFlight probes outstanding; a probe that isn't answered is resent until its
+ * attempts run out, after which the host is reported as unreachable (MAX_QUERY_PING). Replies are received and
+ * timestamped on a worker thread as they arrive, so the frame rate doesn't inflate the measured ping, then reported on
+ * the game thread in batches once per tick, so the caller can re-sort once per batch rather than per host.
+ *
+ * Anything that echoes the packet back unchanged can answer, e.g. FSessionPingResponder on the host or a local UDP
+ * echo server standing in for hosts while testing (see MOS.SessionPing.Target).
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FSessionPingProber
+{
+public:
+    /** Host keys paired with their measured ping in milliseconds. */
+    typedef TArray<TPair<FString, int32>> FPingBatch;
+    typedef TFunction<void(const FPingBatch &)> FOnPings;
+    typedef TFunction<void()> FOnComplete;
+
+private:
+    struct FProbe
+    {
+        FString Key;
+        TSharedPtr<FInternetAddr> Address;
+        uint32 Sequence = 0;
+        int32 AttemptsLeft = 0;
+        double SentAt = 0.0;
+    };
+
+    class FReceiver;
+
+    FSocket *Socket = nullptr;
+    TUniquePtr<FReceiver> Receiver;
+    FTSTicker::FDelegateHandle TickHandle;
+    TArray<FProbe> Queued;
+    TMap<uint32, FProbe> InFlight;
+    uint32 NextSequence = 1;
+    FOnPings OnPings;
+    FOnComplete OnComplete;
+
+    bool OpenSocket();
+    void CloseSocket();
+    bool Send(FProbe &Probe);
+    bool Tick(float DeltaTime);
+
+public:
+    FSessionPingProber() = default;
+    UE_NONCOPYABLE(FSessionPingProber);
+    ~FSessionPingProber();
+
+    /** The maximum number of probes awaiting a reply at once. */
+    int32 MaxInFlight = 16;
+
+    /** How long to wait for each reply before resending or giving up. */
+    float AttemptTimeoutSeconds = 0.5f;
+
+    /** How many probes are sent to a host before it is reported as unreachable. */
+    int32 MaxAttempts = 2;
+
+    /**
+     * Cancels any running probes and starts probing Hosts, a list of keys paired with "address:port" strings. Hosts
+     * whose address isn't an IPv4 address (e.g. P2P hosts) are skipped and never reported. OnPings is called with each
+     * batch of results, and OnComplete once every probed host has been reported.
+     */
+    void Start(const TArray<TPair<FString, FString>> &Hosts, FOnPings InOnPings, FOnComplete InOnComplete);
+
+    bool IsRunning() const
+    {
+        return this->TickHandle.IsValid();
+    }
+
+    /**
+     * Builds the "address:port" to probe a host at from its game connect string, keeping its address but using
+     * PingPort. Returns false for hosts without an IPv4 address, which can't be probed: EOS P2P sessions, whose connect
+     * string names the host's product user and socket ("EOS:<ProductUserId>:<SocketName>:<Channel>") rather than an IP
+     * address and which are only reachable through the EOS P2P socket, and IPv6 hosts.
+     */
+    static bool GetProbeAddress(const FString &ConnectString, int32 PingPort, FString &OutHostAndPort);
+
+    /** Stops probing without reporting the hosts still outstanding. */
+    void Cancel();
+};
+
+/** Echoes session ping probes back to their sender while this client is hosting. */
+class MULTIPLAYERONLINESUBSYSTEM_API FSessionPingResponder
+{
+private:
+    FSocket *Socket = nullptr;
+    FTSTicker::FDelegateHandle TickHandle;
+
+    bool Tick(float DeltaTime);
+
+public:
+    FSessionPingResponder() = default;
+    UE_NONCOPYABLE(FSessionPingResponder);
+    ~FSessionPingResponder();
+
+    /** Starts answering probes on Port, replacing any previous listener. */
+    bool Start(int32 Port);
+
+    bool IsRunning() const
+    {
+        return this->Socket != nullptr;
+    }
+
+    void Stop();
+};
+
+} // namespace OSS::OnlineAPI
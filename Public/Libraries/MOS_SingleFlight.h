@@ -0,0 +1,89 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Coalesces identical online queries so that only one backend call is in flight at a time. Every result object that
+ * joins while the call is running is fanned the same outcome when it completes. Successful outcomes can optionally be
+ * memoized for a short time, so that callers arriving just after a completion don't hit the backend again.
+ *
+ * TResultObject is one of the UMOS_*AsyncResult types; TPayload are the values passed to its OnResult between the
+ * success flag and the error message.
+ */
+template <typename TResultObject, typename... TPayload> class TSingleFlight
+{
+private:
+    TArray<TWeakObjectPtr<TResultObject>> Waiters;
+    bool bInFlight = false;
+    double MemoizedAt = 0.0;
+    TOptional<TTuple<TPayload...>> Memoized;
+
+public:
+    /**
+     * Adds Result as a waiter. Returns true if the caller must start the backend call, or false if the call is
+     * already in flight or a memoized result younger than MemoizeSeconds was returned immediately.
+     */
+    bool Join(TResultObject *Result, float MemoizeSeconds)
+    {
+        if (Memoized.IsSet() && MemoizeSeconds > 0.0f && FPlatformTime::Seconds() - MemoizedAt < MemoizeSeconds)
+        {
+            Memoized->ApplyAfter([Result](const TPayload &...Payload) {
+                Result->OnResult(true, Payload..., TEXT(""));
+            });
+            return false;
+        }
+
+        this->Waiters.Add(Result);
+        if (this->bInFlight)
+        {
+            return false;
+        }
+        this->bInFlight = true;
+        return true;
+    }
+
+    /**
+     * Completes the in-flight call, passing the outcome to every waiter that is still alive.
+     */
+    void Complete(bool bWasSuccessful, const TPayload &...Payload, const FString &ErrorMessage)
+    {
+        if (bWasSuccessful)
+        {
+            this->Memoized.Emplace(Payload...);
+            this->MemoizedAt = FPlatformTime::Seconds();
+        }
+
+        // @note: Take the waiter list first, since a waiter's callback may immediately start a new call.
+        TArray<TWeakObjectPtr<TResultObject>> CurrentWaiters = MoveTemp(this->Waiters);
+        this->Waiters.Reset();
+        this->bInFlight = false;
+        for (const auto &Waiter : CurrentWaiters)
+        {
+            if (Waiter.IsValid())
+            {
+                Waiter->OnResult(bWasSuccessful, Payload..., ErrorMessage);
+            }
+        }
+    }
+
+    bool IsInFlight() const
+    {
+        return this->bInFlight;
+    }
+
+    /**
+     * Drops any memoized result, e.g. when the signed in user changes.
+     */
+    void Invalidate()
+    {
+        this->Memoized.Reset();
+    }
+};
+
+} // namespace OSS::OnlineAPI
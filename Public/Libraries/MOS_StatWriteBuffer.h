@@ -0,0 +1,125 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MOS_Types.h"
+
+namespace OSS::OnlineAPI
+{
+
+struct FPendingStatWrite
+{
+    double Value = 0.0;
+    EMOSStatAggregation Aggregation = EMOSStatAggregation::Latest;
+};
+
+/** A set of stat updates and achievement unlocks written to the backend together. */
+struct FStatWriteBatch
+{
+    TMap<FString, FPendingStatWrite> Stats;
+    TSet<FString> Achievements;
+
+    bool IsEmpty() const
+    {
+        return this->Stats.Num() == 0 && this->Achievements.Num() == 0;
+    }
+};
+
+/** How the stats write of a flush ended. */
+enum class EStatFlushResult : uint8
+{
+    /** The backend applied the writes. */
+    Succeeded,
+    /** The writes definitely weren't applied: the backend rejected them, or they were never sent. */
+    Failed,
+    /** The writes were sent but no answer came back (a timeout or a cancellation), so they may have been applied. */
+    Unknown,
+};
+
+/**
+ * Buffers stat updates and achievement unlocks so they can be written in batches. Repeated updates to a stat are
+ * folded together according to its aggregation, and everything not yet confirmed by the backend is journaled to disk
+ * so that it is written on the owner's next login if the game exits first.
+ *
+ * The journal keeps the pending writes apart from the in-flight ones, and records whether the in-flight stats were sent.
+ * On replay, a flush that was never sent is retried in full. A flush that was sent has an unknown outcome, so its
+ * writes are reconciled the way EndFlush treats an unknown result: idempotent writes are retried and summed stats are
+ * dropped. Pending sums are always replayed in full.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FStatWriteBuffer
+{
+private:
+    FString OwnerId;
+    FStatWriteBatch Pending;
+    FStatWriteBatch InFlight;
+    bool bFlushing = false;
+    bool bInFlightStatsSent = false;
+    bool bJournalDirty = false;
+
+    /** Identifies the running flush; never reused, even across owners, so a stale EndFlush can't finish a newer one. */
+    uint64 FlushId = 0;
+    uint64 NextFlushId = 1;
+
+    static bool Merge(FStatWriteBatch &Into, const FString &StatName, const FPendingStatWrite &Write, bool bIsOlder);
+    void MergeUnconfirmed(const FStatWriteBatch &Unconfirmed, EStatFlushResult StatsResult, bool bAchievementsSucceeded);
+    FString GetJournalPath() const;
+
+public:
+    FStatWriteBuffer() = default;
+    UE_NONCOPYABLE(FStatWriteBuffer);
+
+    /** Sets the user whose writes are buffered, merging in anything journaled for them by a previous run. */
+    void SetOwner(const FString &InOwnerId);
+
+    /**
+     * Queues a stat update. Returns false, and queues nothing, if the stat is already queued or in flight with a
+     * different aggregation, since the two can't be folded into one write.
+     */
+    bool AddStat(const FString &StatName, double Value, EMOSStatAggregation Aggregation);
+    void AddAchievement(const FString &AchievementId);
+
+    /** The number of distinct stats and achievements waiting to be flushed. */
+    int32 GetPendingCount() const
+    {
+        return this->Pending.Stats.Num() + this->Pending.Achievements.Num();
+    }
+
+    bool IsFlushing() const
+    {
+        return this->bFlushing;
+    }
+
+    /**
+     * Moves the pending writes into OutBatch, and sets OutFlushId to the id EndFlush must be called with. Returns false
+     * if a flush is already running or nothing is pending.
+     */
+    bool BeginFlush(FStatWriteBatch &OutBatch, uint64 &OutFlushId);
+
+    /**
+     * Records that the stats of the flush InFlushId are about to be sent to the backend. Call SaveJournal right after,
+     * before sending them, so a replay never sends summed stats the backend may already have applied.
+     */
+    void MarkStatsSent(uint64 InFlushId);
+
+    /**
+     * Finishes the flush InFlushId; the parts that failed are merged back into the pending writes to be retried. When
+     * the stats outcome is unknown only the idempotent writes are retried, and summed stats are dropped rather than
+     * risk counting them twice. Returns false, and does nothing, if InFlushId isn't the running flush, such as a flush
+     * started before the owner changed.
+     */
+    bool EndFlush(uint64 InFlushId, EStatFlushResult StatsResult, bool bAchievementsSucceeded);
+
+    /** Writes the pending and in-flight writes to the owner's journal, or deletes the journal if there are none. */
+    void SaveJournal();
+
+    bool IsJournalDirty() const
+    {
+        return this->bJournalDirty;
+    }
+
+    /** Forgets the owner and every buffered write; call SaveJournal first to keep them. */
+    void Reset();
+};
+
+} // namespace OSS::OnlineAPI
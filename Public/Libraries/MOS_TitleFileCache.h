@@ -0,0 +1,97 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/CriticalSection.h"
+
+struct FCloudFileHeader;
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Keeps downloaded title files on disk, keyed by file name and the hash reported by the last enumeration, and serves
+ * them from memory-mapped files. A cached file is only used while the enumeration still lists the same hash, and its
+ * content is checked against that hash the first time it is mapped.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FTitleFileCache
+{
+private:
+    struct FListedFile
+    {
+        FString Hash;
+        FName HashType;
+        int64 Size = 0;
+    };
+
+    struct FMappedFile
+    {
+        FString Hash;
+        TUniquePtr<IMappedFileHandle> Handle;
+        // @note: Declared after Handle so that it is unmapped before the handle is closed.
+        TUniquePtr<IMappedFileRegion> Region;
+    };
+
+    struct FPendingWrite
+    {
+        FString Path;
+        TSharedPtr<TArray<uint8>> Contents;
+    };
+
+    /**
+     * Shared with the worker tasks, which may outlive the cache. Writes are single-flighted per file name: while one
+     * is running, later stores only replace the queued write, and the running task writes the newest one next.
+     */
+    struct FPendingWrites
+    {
+        FCriticalSection Lock;
+        TMap<FString, FPendingWrite> Queued;
+        TSet<FString> Writing;
+    };
+
+    TArray<FString> ListedFileNames;
+    TMap<FString, FListedFile> ListedFiles;
+    TMap<FString, FMappedFile> MappedFiles;
+    TSharedRef<FPendingWrites, ESPMode::ThreadSafe> PendingWrites = MakeShared<FPendingWrites, ESPMode::ThreadSafe>();
+
+    FString GetCachePath(const FString &FileName, const FString &Hash) const;
+    static void WritePending(const TSharedRef<FPendingWrites, ESPMode::ThreadSafe> &PendingWrites, const FString &FileName);
+    static bool CanVerifyHash(const FName &HashType);
+    static bool VerifyHash(const FListedFile &Listed, const uint8 *Data, int64 Size);
+
+public:
+    FTitleFileCache() = default;
+    UE_NONCOPYABLE(FTitleFileCache);
+
+    /** Replaces the listing with the result of a title file enumeration. */
+    void SetListing(const TArray<FCloudFileHeader> &Files);
+
+    bool HasListing() const
+    {
+        return this->ListedFiles.Num() > 0;
+    }
+
+    const TArray<FString> &GetListedFileNames() const
+    {
+        return this->ListedFileNames;
+    }
+
+    /**
+     * Returns the cached content of FileName in OutView if the cache holds the version currently listed. The view
+     * points straight into the mapped file and stays valid until the file is stored again or the cache is reset.
+     */
+    bool Find(const FString &FileName, TArrayView<const uint8> &OutView);
+
+    /**
+     * Writes downloaded content to the cache on a worker thread, if FileName is listed with a hash type we can verify.
+     * Other cached versions of FileName are removed once the new one is in place.
+     */
+    void Store(const FString &FileName, const TSharedRef<TArray<uint8>> &Contents);
+
+    /** Unmaps every file and forgets the listing; the files stay on disk for the next run. */
+    void Reset();
+};
+
+} // namespace OSS::OnlineAPI
@@ -24,6 +24,19 @@ enum class EMOSInterfaceVoiceChatConnectionStatus : uint8
 	Connected,
 };
 
+UENUM(BlueprintType)
+enum class EMOSStatAggregation : uint8
+{
+	/** Queued values are added together. */
+	Sum,
+
+	/** The largest queued value is kept. */
+	Max,
+
+	/** The most recently queued value is kept. */
+	Latest,
+};
+
 UENUM(BlueprintType)
 enum class EMOSFriendsFriendInvitationStatus : uint8
 {
@@ -151,6 +164,104 @@ struct MULTIPLAYERONLINESUBSYSTEM_API FMOSEcommerceReceipt
 	FText Title;
 };
 
+USTRUCT(BlueprintType)
+struct MULTIPLAYERONLINESUBSYSTEM_API FMOSAvatarCacheStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int64 HitCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int64 MissCount = 0;
+
+	/** Fraction of avatar requests served from memory or disk, between 0 and 1. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float HitRate = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int64 BytesResident = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int32 EntryCount = 0;
+};
+
+/** Latency statistics for one online API, as recorded by the call dispatcher. */
+USTRUCT(BlueprintType)
+struct MULTIPLAYERONLINESUBSYSTEM_API FMOSOnlineCallStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	FName Api;
+
+	/** Calls recorded since the statistics were last reset. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int64 CallCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int64 FailureCount = 0;
+
+	/** Total size of the results returned, for calls whose results are arrays or byte buffers. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int64 PayloadBytes = 0;
+
+	/** Calls in the rolling window the percentiles below are taken from. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	int32 WindowCallCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float P50Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float P95Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float P99Ms = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float MaxMs = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct MULTIPLAYERONLINESUBSYSTEM_API FMOSWarmupStepReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	FName Name;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	bool bWasSuccessful = false;
+
+	/** When the step started, in seconds after the warm-up started. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float StartSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float DurationSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	FString ErrorMessage;
+};
+
+USTRUCT(BlueprintType)
+struct MULTIPLAYERONLINESUBSYSTEM_API FMOSWarmupReport
+{
+	GENERATED_BODY()
+
+	/** Whether every warm-up step succeeded. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	bool bWasSuccessful = false;
+
+	/** Seconds from login completing until the last warm-up query finished. */
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	float TimeToInteractiveSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Data")
+	TArray<FMOSWarmupStepReport> Steps;
+};
+
 struct MULTIPLAYERONLINESUBSYSTEM_API FUIListEntry
 {
 	FString Id;
@@ -235,6 +346,40 @@ struct MULTIPLAYERONLINESUBSYSTEM_API FMOSFriendsFriendState
     TMap<FString, FString> Attributes;
 };
 
+/** The frequently read part of a friend's state, served from the friends store without asking the online subsystem. */
+USTRUCT(BlueprintType)
+struct MULTIPLAYERONLINESUBSYSTEM_API FMOSFriendsFriendSummary
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    FUniqueNetIdRepl Id;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    FString DisplayName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    EMOSFriendsFriendInvitationStatus InvitationStatus = EMOSFriendsFriendInvitationStatus::Unknown;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    bool bPresenceIsOnline = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    bool bPresenceIsPlaying = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    bool bPresenceIsPlayingThisGame = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    bool bPresenceIsJoinable = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    FString PresenceStatusString;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Friend")
+    EMOSFriendsFriendPresenceStatus PresenceStatusState = EMOSFriendsFriendPresenceStatus::Offline;
+};
+
 USTRUCT(BlueprintType)
 struct MULTIPLAYERONLINESUBSYSTEM_API FMOSFriendsRecentPlayerState
 {
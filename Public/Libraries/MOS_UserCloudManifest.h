@@ -0,0 +1,156 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/SecureHash.h"
+
+struct FCloudFileHeader;
+
+namespace OSS::OnlineAPI
+{
+
+/** A content-defined chunk of a file: its position, length and content hash. */
+struct FUserCloudChunk
+{
+    int64 Offset = 0;
+    int32 Size = 0;
+    FSHAHash Hash;
+};
+
+/**
+ * Remembers the content hash of every user cloud file this client last uploaded or downloaded, alongside the hash the
+ * backend reported for it, so that unchanged files can be skipped in either direction. Large files are uploaded as
+ * content-defined chunks stored in their own cloud files plus a small index, so that an edit only uploads the chunks
+ * it touched; the manifest also tracks which chunks are known to exist remotely.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FUserCloudManifest
+{
+public:
+    struct FEntry
+    {
+        FSHAHash ContentHash;
+        int64 Size = 0;
+        // @note: Empty until a file listing reports the backend's hash for what we last transferred.
+        FString RemoteHash;
+        // @note: Orders transfers against file listings; not saved, since a new run starts without a listing.
+        uint64 TransferSerial = 0;
+        // The chunks the file's index referenced when we last transferred it; empty if it was transferred whole.
+        TArray<FSHAHash> Chunks;
+    };
+
+private:
+    struct FRemoteFile
+    {
+        FString Hash;
+        int64 Size = 0;
+    };
+
+    FString OwnerId;
+    TMap<FString, FEntry> Entries;
+    TSet<FSHAHash> RemoteChunks;
+    TMap<FString, FRemoteFile> RemoteFiles;
+    bool bHasRemoteListing = false;
+    uint64 LastTransferSerial = 0;
+
+    FString GetManifestPath() const;
+
+public:
+    FUserCloudManifest() = default;
+    UE_NONCOPYABLE(FUserCloudManifest);
+
+    /** Sets the user whose files are tracked, loading their manifest from a previous run. */
+    void SetOwner(const FString &InOwnerId);
+
+    /** Writes the manifest to disk. */
+    void Save() const;
+
+    /** Forgets the owner and everything tracked for them. */
+    void Reset();
+
+    const FEntry *Find(const FString &FileName) const
+    {
+        return this->Entries.Find(FileName);
+    }
+
+    /**
+     * Records that FileName now has the given content on both sides. After a download the file listing describes what
+     * we just read, so its hash is adopted straight away; after an upload it is adopted from the next listing that
+     * was started after the upload finished.
+     */
+    void Record(const FString &FileName, const FSHAHash &ContentHash, int64 Size, bool bWasDownload);
+
+    /**
+     * Call when a user cloud enumeration is started, and pass the result to UpdateRemoteListing once it completes, so
+     * that a listing that raced an upload isn't taken as describing it.
+     */
+    uint64 BeginRemoteListing() const
+    {
+        return this->LastTransferSerial;
+    }
+
+    /** Replaces the known remote file list with the result of a user cloud enumeration. */
+    void UpdateRemoteListing(const TArray<FCloudFileHeader> &Files, uint64 ListingSerial);
+
+    /**
+     * Returns true if a file listing has confirmed that the remote file is the one we last transferred. This is never
+     * assumed: until a listing started after the last upload reports the file's hash, the remote copy is unknown.
+     */
+    bool IsRemoteCurrent(const FString &FileName) const;
+
+    /** The size the last file listing reported for FileName, or INDEX_NONE if it wasn't listed. */
+    int64 GetRemoteSize(const FString &FileName) const
+    {
+        const FRemoteFile *Remote = this->RemoteFiles.Find(FileName);
+        return Remote != nullptr ? Remote->Size : INDEX_NONE;
+    }
+
+    /**
+     * Records the chunks FileName's index references after a transfer (none if it was transferred whole), and returns
+     * the chunks of its previous index that no tracked file references anymore.
+     *
+     * @note: Only files this client has transferred are tracked, so a chunk that a file written by another client
+     * shares with one of ours is considered orphaned once ours stops using it. Other clients find out about deleted
+     * chunks from their next file listing.
+     */
+    TArray<FSHAHash> SetFileChunks(const FString &FileName, const TArray<FUserCloudChunk> &Chunks);
+
+    /** Returns true if the last transferred index of any tracked file references the chunk. */
+    bool IsChunkReferenced(const FSHAHash &Hash) const;
+
+    bool HasRemoteChunk(const FSHAHash &Hash) const
+    {
+        return this->RemoteChunks.Contains(Hash);
+    }
+
+    void AddRemoteChunk(const FSHAHash &Hash)
+    {
+        this->RemoteChunks.Add(Hash);
+    }
+
+    void RemoveRemoteChunk(const FSHAHash &Hash)
+    {
+        this->RemoteChunks.Remove(Hash);
+    }
+
+    static FSHAHash HashBytes(const uint8 *Data, int64 Size);
+
+    /**
+     * Splits Data into content-defined chunks using a gear rolling hash, so that inserting or removing bytes only
+     * changes the chunks around the edit.
+     */
+    static void SplitIntoChunks(const uint8 *Data, int64 Size, TArray<FUserCloudChunk> &OutChunks);
+
+    /** The cloud file name a chunk is stored under. */
+    static FString GetChunkFileName(const FSHAHash &Hash);
+
+    static bool IsChunkFileName(const FString &FileName);
+
+    /** Serializes the index that lists a chunked file's chunks in order. */
+    static void WriteChunkIndex(int64 TotalSize, const TArray<FUserCloudChunk> &Chunks, TArray<uint8> &OutIndex);
+
+    /** Parses a chunk index; returns false if Data isn't one, i.e. the file was uploaded whole. */
+    static bool ReadChunkIndex(const TArray<uint8> &Data, int64 &OutTotalSize, TArray<FUserCloudChunk> &OutChunks);
+};
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,41 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Encodes local data into the chunked user cloud file format and back, one chunk at a time, so that neither side ever
+ * holds a whole uncompressed copy of the file. Encoded files start with a small header followed by independently
+ * compressed chunks; data without the header is treated as a plain file written by the non-streaming API.
+ *
+ * These functions block and are meant to be run on a worker thread.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FUserCloudStream
+{
+public:
+    typedef TFunctionRef<void(int64 BytesDone, int64 BytesTotal)> FOnProgress;
+
+    /** The compression format used by default: Oodle where available, otherwise zlib. */
+    static FName GetDefaultCompressionFormat();
+
+    /**
+     * Reads Source to the end in chunks of ChunkSize bytes, compressing each with Format (NAME_None stores them as is),
+     * and appends the encoded file to OutPayload.
+     */
+    static bool Encode(
+        FArchive &Source,
+        FName Format,
+        int32 ChunkSize,
+        TArray<uint8> &OutPayload,
+        FOnProgress OnProgress,
+        FString &OutError);
+
+    /** Decodes Payload chunk by chunk into Destination. */
+    static bool Decode(const TArray<uint8> &Payload, FArchive &Destination, FOnProgress OnProgress, FString &OutError);
+};
+
+} // namespace OSS::OnlineAPI
@@ -0,0 +1,74 @@
+// Copyright Grumpy Giraffe Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MOS_Types.h"
+
+namespace OSS::OnlineAPI
+{
+
+/**
+ * Runs a set of named steps as a dependency graph: every step whose dependencies have succeeded is started at once,
+ * and steps are started as soon as the last of their dependencies finishes. A step whose dependency failed is not run
+ * and is reported as failed. The pipeline reports how long it took from Start until the last step finished.
+ */
+class MULTIPLAYERONLINESUBSYSTEM_API FWarmupPipeline
+{
+public:
+    /** Reports the outcome of a step: success flag, error message. Must be called exactly once. */
+    typedef TFunction<void(bool, const FString &)> FStepComplete;
+    typedef TFunction<void(const FStepComplete &)> FStepStart;
+    typedef TFunction<void(const FMOSWarmupReport &)> FOnComplete;
+
+private:
+    enum class EStepState : uint8
+    {
+        Pending,
+        Running,
+        Succeeded,
+        Failed,
+    };
+
+    struct FStep
+    {
+        FName Name;
+        TArray<FName> DependsOn;
+        FStepStart Start;
+        EStepState State = EStepState::Pending;
+        double StartedAt = 0.0;
+        double FinishedAt = 0.0;
+        FString ErrorMessage;
+    };
+
+    TArray<FStep> Steps;
+    FOnComplete OnComplete;
+    double StartedAt = 0.0;
+    int32 Generation = 0;
+    bool bRunning = false;
+
+    int32 FindStep(FName Name) const;
+    void StartReadySteps();
+    void FinishStep(int32 Generation, int32 StepIndex, bool bWasSuccessful, const FString &ErrorMessage);
+    void Finish();
+
+public:
+    FWarmupPipeline() = default;
+    UE_NONCOPYABLE(FWarmupPipeline);
+
+    /** Adds a step. Steps can only be added while the pipeline isn't running. */
+    void AddStep(FName Name, TArray<FName> DependsOn, FStepStart Start);
+
+    /** Starts every step, calling OnComplete once the last one has finished or been skipped. */
+    void Start(FOnComplete InOnComplete);
+
+    /** Drops every step; completions from steps that are still in flight are ignored. */
+    void Reset();
+
+    bool IsRunning() const
+    {
+        return this->bRunning;
+    }
+};
+
+} // namespace OSS::OnlineAPI
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Engine/GameInstance.h"
 #include "OnlineSessionSettings.h"
 #include "VoiceChat.h"
@@ -10,14 +11,26 @@
 #include "Interfaces/OnlineSessionInterface.h"
 
 #include "Libraries/MOS_AsyncResult.h"
+#include "Libraries/MOS_AvatarCache.h"
+#include "Libraries/MOS_FileTransferAsyncResult.h"
+#include "Libraries/MOS_FriendsStore.h"
 #include "Libraries/MOS_GetAvatarAsyncResult.h"
+#include "Libraries/MOS_LeaderboardPageCache.h"
 #include "Libraries/MOS_ListAsyncResult.h"
+#include "Libraries/MOS_OnlineCallDispatcher.h"
 #include "Libraries/MOS_QueryAchievementsAsyncResult.h"
+#include "Libraries/MOS_QueryLeaderboardPagesAsyncResult.h"
 #include "Libraries/MOS_QueryLeaderboardsAsyncResult.h"
 #include "Libraries/MOS_QueryStatsAsyncResult.h"
 #include "Libraries/MOS_ReadFileSaveGameAsyncResult.h"
 #include "Libraries/MOS_ReadFileStringAsyncResult.h"
+#include "Libraries/MOS_SingleFlight.h"
+#include "Libraries/MOS_StatWriteBuffer.h"
 #include "Libraries/MOS_TextAsyncResult.h"
+#include "Libraries/MOS_SessionPing.h"
+#include "Libraries/MOS_TitleFileCache.h"
+#include "Libraries/MOS_UserCloudManifest.h"
+#include "Libraries/MOS_WarmupPipeline.h"
 #include "Libraries/MOS_Types.h"
 
 #include "MOS_GameInstanceSubsystem.generated.h"
@@ -29,7 +42,9 @@ class IOnlineSubsystem;
 DECLARE_LOG_CATEGORY_EXTERN(MOSGameInstanceSubsystem, Log, All);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FUpdateFindSessionListDelegate, const FMOSSessionsSearchResult&, SessionResult, const FString&, SessionIdOverride, const FString&, OwningUserName, int32, Ping, int32, OpenPublicConnections);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRemoveFindSessionListDelegate, const FString&, SessionId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FUpdateSessionListCompleteDelegate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWarmupCompleteDelegate, const FMOSWarmupReport&, Report);
 
 UCLASS(Blueprintable)
 class MULTIPLAYERONLINESUBSYSTEM_API UMOS_GameInstanceSubsystem : public UGameInstanceSubsystem
@@ -43,16 +58,131 @@ class MULTIPLAYERONLINESUBSYSTEM_API UMOS_GameInstanceSubsystem : public UGameIn
     // @note: This is the voice chat user that has currently been created for interacting with voice chat.
     IVoiceChatUser *CachedVoiceChatUser;
 	
+	// @note: Resolved lazily by GetOnlineContext and reset on login, logout and world change.
+	mutable FMOSOnlineContext OnlineContext;
+	IOnlineSubsystem *OnlineSubsystemOverride = nullptr;
+
+	// @note: Every dispatched online call goes through here so it can be throttled, timed out and cancelled.
+	OSS::OnlineAPI::FOnlineCallDispatcher CallDispatcher;
+
 	bool bDoesAutoLogin = true;
 	bool bIsAttemptingLogin = false;
-	TArray<FOnlineSessionSearchResult> SessionResults;
+
+	// @note: Index of CachedFindSessionResults keyed by session ID, so joins don't have to scan the browser list.
+	TMap<FString, int32> CachedFindSessionIndexById;
+	// @note: Rows added or changed, and session IDs removed, by the last FindSessions; broadcast by OnFindSessionsComplete.
+	TArray<int32> PendingFindSessionChangedRows;
+	TArray<FString> PendingFindSessionRemovedIds;
+	double LastFindSessionsTime = 0.0;
+	FTSTicker::FDelegateHandle SessionBrowserRefreshHandle;
+	int32 FindSessionsInFlight = 0;
+
+	// @note: Concurrent calls to these queries share one backend call; see TSingleFlight.
+	OSS::OnlineAPI::TSingleFlight<UMOS_AsyncResult> FriendsQueryFriendsFlight;
+	OSS::OnlineAPI::TSingleFlight<UMOS_QueryLeaderboardsAsyncResult, TArray<FMOSLeaderboardsLeaderboardEntry>> LeaderboardsQueryGlobalFlight;
+	OSS::OnlineAPI::TSingleFlight<UMOS_QueryStatsAsyncResult, TArray<FMOSStatsStatState>> StatsQueryStatsFlight;
+	OSS::OnlineAPI::TSingleFlight<UMOS_ListAsyncResult, TArray<FMOSInterfaceListEntry>> TitleFileQueryFilesFlight;
+
+	// @note: The friends list as of the last sync, kept up to date by presence updates; see FFriendsStore.
+	OSS::OnlineAPI::FFriendsStore FriendsStore;
+	FDelegateHandle FriendsStoreFriendsChangeHandle;
+	FDelegateHandle FriendsStorePresenceHandle;
+	FTSTicker::FDelegateHandle FriendsChangeFeedHandle;
+	void BindFriendsStoreEvents();
+	void UnbindFriendsStoreEvents();
+	void SyncFriendsStore();
+	void ScheduleFriendsChangeFeed();
+
+	// @note: Downloaded avatars, and the avatar downloads currently in flight keyed by the user they're for.
+	OSS::OnlineAPI::FAvatarCache AvatarCache;
+	TMap<FUniqueNetIdRepl, OSS::OnlineAPI::TSingleFlight<UMOS_GetAvatarAsyncResult, TSoftObjectPtr<UTexture>>> AvatarRequestFlights;
+	void DownloadAvatar(const FUniqueNetIdRepl &TargetUserId);
+	void CompleteAvatarRequests(const FUniqueNetIdRepl &TargetUserId, bool bWasSuccessful, const TSoftObjectPtr<UTexture> &Texture, const FString &ErrorMessage);
+
+	// @note: Leaderboard pages read by ExecuteLeaderboardsQueryLeaderboardPages, including prefetched neighbours.
+	OSS::OnlineAPI::FLeaderboardPageCache LeaderboardPageCache;
+	void RequestLeaderboardPage(const OSS::OnlineAPI::FLeaderboardPageKey &Key, OSS::OnlineAPI::FLeaderboardPageCache::FOnPage OnPage);
+
+	// @note: Stat updates and achievement unlocks queued by QueueStats*/QueueAchievements*, written in batches.
+	OSS::OnlineAPI::FStatWriteBuffer StatWriteBuffer;
+	FTSTicker::FDelegateHandle StatWriteTickHandle;
+	double NextStatWriteFlushTime = 0.0;
+	int32 StatWriteFailureCount = 0;
+	bool TickStatWrites(float DeltaTime);
+
+	void UploadUserCloudPayload(const FString &FileName, const TSharedRef<TArray<uint8>> &Payload, UMOS_FileTransferAsyncResult *Result);
+
+	// @note: Content hashes of the user cloud files this client last uploaded or downloaded; see FUserCloudManifest.
+	OSS::OnlineAPI::FUserCloudManifest UserCloudManifest;
+	bool IsUserCloudFileUnchanged(const FString &FileName, const FSHAHash &ContentHash) const;
+	float GetUserCloudTransferTimeout(int64 Bytes) const;
+	void ReadUserCloudFile(const FString &FileName, TFunction<void(bool, const TSharedPtr<TArray<uint8>> &, const FString &)> OnDone);
+	void WriteUserCloudFile(const FString &FileName, const TSharedRef<TArray<uint8>> &Contents, TFunction<void(bool, const FString &)> OnDone);
+	void UploadUserCloudSync(const FString &FileName, const TSharedRef<TArray<uint8>> &Data, const TSharedRef<TArray<OSS::OnlineAPI::FUserCloudChunk>> &Chunks, const FSHAHash &ContentHash, UMOS_AsyncResult *Result);
+	// @note: Chunk files being deleted because no index references them anymore, each with the chunk uploads waiting for
+	// its delete to finish, so that a delete can't land after an upload of the same chunk.
+	TMap<FSHAHash, TArray<TFunction<void()>>> DeletingUserCloudChunks;
+	// @note: Chunks referenced by sync uploads that haven't finished yet, with how many uploads reference each; these are
+	// never deleted, even if no recorded index references them.
+	TMap<FSHAHash, int32> UploadingUserCloudChunks;
+	void DeleteUserCloudChunks(const TArray<FSHAHash> &Hashes);
+	void DownloadUserCloudSync(const FString &FileName, const FString &LocalFilePath, UMOS_AsyncResult *Result);
+	void DownloadUserCloudChunks(const FString &FileName, const FString &LocalFilePath, const TSharedRef<TArray<OSS::OnlineAPI::FUserCloudChunk>> &Chunks, const TSharedRef<TArray<uint8>> &LocalData, const TSharedRef<TArray<FSHAHash>> &MissingHashes, UMOS_AsyncResult *Result);
+	void AssembleUserCloudSync(const FString &FileName, const FString &LocalFilePath, const TSharedPtr<TArray<uint8>> &Source, const TSharedPtr<TArray<OSS::OnlineAPI::FUserCloudChunk>> &Chunks, const TSharedPtr<TMap<FSHAHash, TSharedPtr<TArray<uint8>>>> &Downloaded, UMOS_AsyncResult *Result);
+
+	// @note: Title files downloaded by this or a previous run; see FTitleFileCache.
+	OSS::OnlineAPI::FTitleFileCache TitleFileCache;
+	void EnumerateTitleFiles(TFunction<void(bool, const FString &)> OnDone);
+	void ReadTitleFile(const FString &FileName, TFunction<void(bool, const TSharedPtr<TArray<uint8>> &, const FString &)> OnDone);
+
+	// @note: The queries run right after login so that menus are populated on first paint; see StartLoginWarmup.
+	OSS::OnlineAPI::FWarmupPipeline WarmupPipeline;
+	UPROPERTY(Transient)
+	TArray<UObject *> WarmupResults;
+	FMOSWarmupReport LastWarmupReport;
+	bool bIsWarmupComplete = false;
+	void StartLoginWarmup();
+	void CancelLoginWarmup();
+
+	// @note: Spans for the host and join flows, recorded alongside the dispatched calls; 0 when not running.
+	int32 HostFlowSpan = 0;
+	int32 JoinFlowSpan = 0;
+	int32 ListenSpan = 0;
+	int32 TravelSpan = 0;
+	FDelegateHandle PostLoadMapHandle;
+	int32 BeginOnlineSpan(FName Name);
+	void EndOnlineSpan(int32 &SpanId, bool bWasSuccessful);
+	void OnPostLoadMap(UWorld *LoadedWorld);
+
+	// @note: Pings measured by probing each browser row's host, keyed by session ID; see FSessionPingProber.
+	OSS::OnlineAPI::FSessionPingProber SessionPingProber;
+	OSS::OnlineAPI::FSessionPingResponder SessionPingResponder;
+	TMap<FString, int32> MeasuredSessionPings;
+	int32 SessionPingSpan = 0;
+	void StartSessionPings();
+	void ApplySessionPings(const OSS::OnlineAPI::FSessionPingProber::FPingBatch &Pings);
+	void SortCachedFindSessionResults();
+
+	void FindSessionsInternal(UMOS_SessionsFindSessionsAsyncResult *Result);
+	void ApplyFindSessionsResults(const TArray<FOnlineSessionSearchResult> &SearchResults);
+	const FMOSSessionsSearchResult *FindCachedSessionResult(const FString &SessionId) const;
 	
 public:
 	
 	UPROPERTY(BlueprintAssignable)
 	FUpdateFindSessionListDelegate UpdateFindSessionListDelegate;
 	UPROPERTY(BlueprintAssignable)
+	FRemoveFindSessionListDelegate RemoveFindSessionListDelegate;
+	UPROPERTY(BlueprintAssignable)
 	FUpdateSessionListCompleteDelegate UpdateSessionListCompleteDelegate;
+	UPROPERTY(BlueprintAssignable)
+	FWarmupCompleteDelegate OnWarmupComplete;
+	/* Lets the game add its own steps to the post-login warm-up before it starts. */
+	TMulticastDelegate<void(OSS::OnlineAPI::FWarmupPipeline &)> OnConfigureWarmup;
+	UFUNCTION(BlueprintPure, Category = "MOS")
+	bool IsWarmupComplete() const { return bIsWarmupComplete; }
+	UFUNCTION(BlueprintPure, Category = "MOS")
+	FMOSWarmupReport GetWarmupReport() const { return LastWarmupReport; }
 
 	UPROPERTY(BlueprintReadOnly, Category = "MOS")
 	TArray<FMOSSessionsSearchResult> CachedFindSessionResults;
@@ -74,10 +204,85 @@ public:
 	int32 LocalUserNum = 0;
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
 	int32 SessionAvailableSlots = 2;
+	/*FindSessions returns the cached browser list instead of querying the backend if it is younger than this*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
+	float SessionBrowserCacheTTLSeconds = 5.0f;
+	/*How often the session browser refreshes itself in the background once StartSessionBrowserRefresh is called*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
+	float SessionBrowserRefreshIntervalSeconds = 15.0f;
+	/*Measure the ping to each found session's host with a UDP probe, and answer probes while hosting*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
+	bool bProbeSessionPings = true;
+	/*The UDP port hosts answer ping probes on; hosts and clients must use the same port*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
+	int32 SessionPingPort = 7787;
+	/*The maximum number of hosts probed at once*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
+	int32 MaxConcurrentSessionPings = 16;
+	/*How long to wait for a probe reply before trying again, then reporting the host as unreachable*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
+	float SessionPingTimeoutSeconds = 0.5f;
 	/*This must match the session name in the game mode*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Sessions")
 	FName MOSSessionName = "MyLocalSessionName";
 	
+	/*Online calls that haven't completed after this many seconds report failure (0 disables)*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS")
+	float OnlineCallTimeoutSeconds = 30.0f;
+	/*The maximum number of dispatched online calls in flight at once; further calls are queued*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS")
+	int32 MaxConcurrentOnlineCalls = 16;
+	/*Query friends, entitlements, offers, stats, achievements and user cloud files in parallel as soon as login completes*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS")
+	bool bWarmupOnLogin = true;
+	/*Successful query results are reused for this many seconds instead of querying the backend again (0 disables); this is what lets screens opened after the login warm-up use its results*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Friends")
+	float FriendsQueryFriendsMemoizeSeconds = 30.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Leaderboards")
+	float LeaderboardsQueryGlobalMemoizeSeconds = 30.0f;
+	/*Leaderboard pages are read from the backend again once they are older than this*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Leaderboards")
+	float LeaderboardPageCacheSeconds = 30.0f;
+	/*The maximum number of leaderboard pages kept in memory*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Leaderboards")
+	int32 LeaderboardPageCacheMaxPages = 64;
+	/*How many pages either side of a requested window are read ahead of time*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Leaderboards")
+	int32 LeaderboardPrefetchPages = 1;
+	/*Stat writes drop the memoized query result, so it's never older than the last write*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Stats")
+	float StatsQueryStatsMemoizeSeconds = 30.0f;
+	/*Queued stat and achievement writes are flushed at least this often*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Stats")
+	float StatWriteFlushIntervalSeconds = 10.0f;
+	/*Queued writes are flushed early once this many distinct stats and achievements are pending*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Stats")
+	int32 StatWriteFlushThreshold = 32;
+	/*Failed flushes are retried with exponential backoff up to this delay*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Stats")
+	float StatWriteMaxRetryDelaySeconds = 120.0f;
+	/*Streamed user cloud files are read, compressed and decompressed in chunks of this size*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|UserCloud")
+	int32 UserCloudStreamChunkSizeKB = 1024;
+	/*Synced files at least this large are uploaded as content-defined chunks, so edits only upload what changed (0 disables)*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|UserCloud")
+	int32 UserCloudChunkedSyncThresholdKB = 1024;
+	/*User cloud reads and writes time out after OnlineCallTimeoutSeconds plus the time to move the file at this rate; reads of files not in the last listing, and all transfers when this is 0, never time out*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|UserCloud")
+	float UserCloudTransferMinKBPerSecond = 32.0f;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|TitleFile")
+	float TitleFileQueryFilesMemoizeSeconds = 60.0f;
+	
+	/*Avatar textures are evicted least-recently-used first once they use more than this much memory*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Avatar")
+	int32 AvatarCacheBudgetMegabytes = 32;
+	/*Persist decoded avatars under Saved/MOS/AvatarCache so they survive restarts*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Avatar")
+	bool bPersistAvatarsToDisk = false;
+	/*Avatar files on disk are deleted least-recently-used first once they use more than this much space*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS|Avatar")
+	int32 AvatarDiskCacheBudgetMegabytes = 128;
+	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS")
 	TSubclassOf<AGameModeBase> TravelGameMode = TSubclassOf<AGameModeBase>(AGameModeBase::StaticClass());
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MOS")
@@ -92,9 +297,25 @@ public:
     ~UMOS_GameInstanceSubsystem();
 
     virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
 
 	void RegisterEvents();
 
+	const FMOSOnlineContext &GetOnlineContext() const;
+	void InvalidateOnlineContext();
+	/** Resolves online calls against the given subsystem instead of the world's, e.g. an in-memory one in tests. */
+	void SetOnlineSubsystemOverride(IOnlineSubsystem *InOnlineSubsystem);
+	UFUNCTION(BlueprintCallable)
+	void CancelAllOnlineCalls();
+	/** Returns latency percentiles, failure counts and payload sizes for every online API called so far. */
+	UFUNCTION(BlueprintCallable, Category = "MOS|Metrics")
+	TArray<FMOSOnlineCallStats> GetOnlineCallStats() const;
+	UFUNCTION(BlueprintCallable, Category = "MOS|Metrics")
+	void ResetOnlineCallStats();
+	/** Writes recent online calls and session flow spans as a Chrome trace; an empty path writes under Saved/Profiling/MOS. */
+	UFUNCTION(BlueprintCallable, Category = "MOS|Metrics")
+	bool ExportOnlineCallTrace(const FString &FilePath);
+
 	UFUNCTION(BlueprintCallable)
 	bool GetIsAttemptingLogin() {return bIsAttemptingLogin;}
 	UFUNCTION(BlueprintCallable)
@@ -131,6 +352,12 @@ public:
     UFUNCTION(BlueprintCallable)
     void ExecuteSessionsFindSessions(UMOS_SessionsFindSessionsAsyncResult *Result);
 	void OnFindSessionsComplete(bool bWasSuccessful);
+	UFUNCTION(BlueprintCallable)
+	void InvalidateSessionBrowserCache();
+	UFUNCTION(BlueprintCallable)
+	void StartSessionBrowserRefresh();
+	UFUNCTION(BlueprintCallable)
+	void StopSessionBrowserRefresh();
 	
     UFUNCTION(BlueprintCallable)
     void ExecuteSessionsStartListenServer(int32 AvailableSlots);
@@ -176,9 +403,13 @@ public:
 	TMulticastDelegate<void()> FriendsOnFriendsChange;
 	UFUNCTION(BlueprintCallable, meta = (DisplayName = "RaiseFriendsOnFriendsChange", Category = "Friends"))
 	void RaiseFriendsOnFriendsChange();
+	/** Fired once per frame at most, with the ids of the friends that were added, removed or changed since the last call. */
+	TMulticastDelegate<void(const TArray<FUniqueNetIdRepl> &)> FriendsOnFriendsStateChanged;
     UFUNCTION(BlueprintCallable)
     TArray<FUniqueNetIdRepl> GetFriendsCurrentFriends() const;
     FMOSFriendsFriendState GetFriendsFriendState(const FUniqueNetIdRepl &UserId) const;
+    UFUNCTION(BlueprintCallable, Category = "MOS|Friends")
+    FMOSFriendsFriendSummary GetFriendsFriendSummary(const FUniqueNetIdRepl &UserId) const;
     void ExecuteFriendsSetFriendAlias(const FUniqueNetIdRepl &UserId, const FString &Alias, UMOS_AsyncResult *Result);
     void ExecuteFriendsDeleteFriendAlias(const FUniqueNetIdRepl &UserId, UMOS_AsyncResult *Result);
     void ExecuteFriendsSendInvite(const FUniqueNetIdRepl &UserId, UMOS_AsyncResult *Result);
@@ -197,6 +428,8 @@ public:
 	/* AVATAR */
 	
     void ExecuteAvatarGetAvatar(const FUniqueNetIdRepl &UserId, UMOS_GetAvatarAsyncResult *Result);
+	UFUNCTION(BlueprintCallable)
+	FMOSAvatarCacheStats GetAvatarCacheStats() const;
 	
     /* VOICE CHAT */
 	
@@ -254,16 +487,23 @@ public:
 
 	void ExecuteStatsQueryStats(UMOS_QueryStatsAsyncResult *Result);
 	void ExecuteStatsIngestStat(const FString &StatName, double StatValue, UMOS_AsyncResult *Result);
+	UFUNCTION(BlueprintCallable, Category = "MOS|Stats")
+	void QueueStatsIngestStat(const FString &StatName, double StatValue, EMOSStatAggregation Aggregation);
+	UFUNCTION(BlueprintCallable, Category = "MOS|Stats")
+	void FlushStatWrites();
 
 	/* ACHIEVEMENTS */
 
 	void ExecuteAchievementsQueryAchievements(UMOS_QueryAchievementsAsyncResult *Result);
 	void ExecuteAchievementsUnlockAchievement(const FString &Id, UMOS_AsyncResult *Result);
+	UFUNCTION(BlueprintCallable, Category = "MOS|Achievements")
+	void QueueAchievementsUnlockAchievement(const FString &Id);
 
 	/* LEADERBOARDS */
 
     void ExecuteLeaderboardsQueryGlobalLeaderboards(UMOS_QueryLeaderboardsAsyncResult *Result);
 	void ExecuteLeaderboardsQueryFriendsLeaderboards(UMOS_QueryLeaderboardsAsyncResult *Result);
+	void ExecuteLeaderboardsQueryLeaderboardPages(const FString &LeaderboardName, int32 FirstRank, int32 RankCount, int32 PageSize, UMOS_QueryLeaderboardPagesAsyncResult *Result);
 
 	/* USER CLOUD */
 
@@ -272,10 +512,18 @@ public:
 	void ExecuteUserCloudWriteSaveGameToFile(const FString &FileName, double SaveGameNumber, UMOS_AsyncResult *Result);
 	void ExecuteUserCloudReadStringFromFile(const FString &FileName, UMOS_ReadFileStringAsyncResult *Result);
 	void ExecuteUserCloudReadSaveGameFromFile(const FString &FileName, UMOS_ReadFileSaveGameAsyncResult *Result);
+	void ExecuteUserCloudWriteFileStreamed(const FString &FileName, const FString &LocalFilePath, bool bCompress, UMOS_FileTransferAsyncResult *Result);
+	void ExecuteUserCloudReadFileStreamed(const FString &FileName, const FString &LocalFilePath, UMOS_FileTransferAsyncResult *Result);
+	void ExecuteUserCloudSyncFileUp(const FString &FileName, const FString &LocalFilePath, UMOS_AsyncResult *Result);
+	void ExecuteUserCloudSyncFileDown(const FString &FileName, const FString &LocalFilePath, UMOS_AsyncResult *Result);
+
 	/* TITLE FILE */
 
 	void ExecuteTitleFileQueryFiles(UMOS_ListAsyncResult *Result);
 	void ExecuteTitleFileReadStringFromFile(const FString &FileName, UMOS_ReadFileStringAsyncResult *Result);
+	void ExecuteTitleFilePrefetchAll(UMOS_FileTransferAsyncResult *Result);
+	/** Returns a view straight into the cached copy of a title file, valid until the file is next refreshed. */
+	bool GetTitleFileCachedContents(const FString &FileName, TArrayView<const uint8> &OutContents);
 
 	FDelegateHandle WorldInitHandle;
 };
\ No newline at end of file
@@ -2,88 +2,188 @@
 
 #include "pch.h"
 #include "AntiCheatNetworkTransport.h"
+#include "DebugLog.h"
+
+constexpr size_t FAntiCheatNetworkTransport::HeaderSize;
+constexpr uint32_t FAntiCheatNetworkTransport::MaxMessageLength;
 
 FAntiCheatNetworkTransport::FAntiCheatNetworkTransport()
-	: TCPClient(10, 64 * 1024)
+	: TCPClient(MaxClients, ReceiveBufferSize)
 {
 	TCPClient.SetOnBufferReceivedCallback([this](void* From, char* Buffer, size_t Length) { Receive(From, Buffer, Length); });
-	TCPClient.SetOnClientDisconnectedCallback([this](void* Which) { OnClientDisconnectedCallback(Which); });
+	TCPClient.SetOnClientDisconnectedCallback([this](void* Which) { PendingReceives.erase(Which); OnClientDisconnectedCallback(Which); });
 	TCPClient.Open(1234);
 }
 
 void FAntiCheatNetworkTransport::Send(const EOS_AntiCheatCommon_OnClientActionRequiredCallbackInfo* Message)
 {
-	char Buffer[4096] = {};
-	size_t BufferPos = {};
+	const char* ActionReasonDetails = Message->ActionReasonDetailsString != nullptr ? Message->ActionReasonDetailsString : "";
+	const size_t ActionReasonDetailsSize = strlen(ActionReasonDetails) + 1;
 
 	constexpr FMessageType MessageType = FMessageType::ClientActionRequired;
-	const uint32_t MessageLength = 
-		sizeof(Message->ActionReasonCode) +
+	const uint32_t MessageLength = static_cast<uint32_t>(
 		sizeof(Message->ClientAction) +
-		static_cast<uint32_t>(strlen(Message->ActionReasonDetailsString)) + 1;
+		sizeof(Message->ActionReasonCode) +
+		ActionReasonDetailsSize);
 
-	Write(MessageType, Buffer, BufferPos);
-	Write(MessageLength, Buffer, BufferPos);
-	Write(Message->ClientAction, Buffer, BufferPos);
-	Write(Message->ActionReasonCode, Buffer, BufferPos);
-	Write(Message->ActionReasonDetailsString, strlen(Message->ActionReasonDetailsString) + 1, Buffer, BufferPos);
+	std::vector<char> Buffer(HeaderSize + MessageLength);
+	size_t BufferPos = {};
 
-	TCPClient.Send(Message->ClientHandle, &Buffer, BufferPos);
+	Write(MessageType, Buffer.data(), BufferPos);
+	Write(MessageLength, Buffer.data(), BufferPos);
+	Write(Message->ClientAction, Buffer.data(), BufferPos);
+	Write(Message->ActionReasonCode, Buffer.data(), BufferPos);
+	Write(ActionReasonDetails, ActionReasonDetailsSize, Buffer.data(), BufferPos);
+
+	TCPClient.Send(Message->ClientHandle, std::move(Buffer));
 }
 
 void FAntiCheatNetworkTransport::Send(const EOS_AntiCheatCommon_OnMessageToClientCallbackInfo* Message)
 {
-	char Buffer[4096] = {};
-	size_t BufferPos = {};
-
 	constexpr FMessageType MessageType = FMessageType::Opaque;
 	const uint32_t MessageLength = Message->MessageDataSizeBytes;
 
-	Write(MessageType, Buffer, BufferPos);
-	Write(MessageLength, Buffer, BufferPos);
-	Write(Message->MessageData, Message->MessageDataSizeBytes, Buffer, BufferPos);
+	std::vector<char> Buffer(HeaderSize + MessageLength);
+	size_t BufferPos = {};
 
-	TCPClient.Send(Message->ClientHandle, Buffer, BufferPos);
+	Write(MessageType, Buffer.data(), BufferPos);
+	Write(MessageLength, Buffer.data(), BufferPos);
+	Write(Message->MessageData, Message->MessageDataSizeBytes, Buffer.data(), BufferPos);
+
+	TCPClient.Send(Message->ClientHandle, std::move(Buffer));
 }
 
 void FAntiCheatNetworkTransport::CloseClientConnection(void* ClientHandle)
 {
-	TCPClient.CloseClientConnection(reinterpret_cast<TCPsocket>(ClientHandle));
+	TCPClient.CloseClientConnection(ClientHandle);
 }
 
-size_t FAntiCheatNetworkTransport::ProcessMessage(void* From, char* Buffer, size_t StartPosition)
+bool FAntiCheatNetworkTransport::ReadHeader(void* From, const char* Header, FMessageType& OutMessageType, uint32_t& OutMessageLength)
 {
-	size_t Position = StartPosition;
+	size_t Position = 0;
+	OutMessageType = Read<FMessageType>(Header, Position);
+	OutMessageLength = Read<uint32_t>(Header, Position);
+
+	if (OutMessageType != FMessageType::Opaque && OutMessageType != FMessageType::RegistrationInfo)
+	{
+		FDebugLog::LogWarning(L"AntiCheat: Unexpected message type %d, disconnecting client", static_cast<int>(OutMessageType));
+		CloseClientConnection(From);
+		return false;
+	}
+
+	if (OutMessageLength > MaxMessageLength)
+	{
+		FDebugLog::LogWarning(L"AntiCheat: Message of %u bytes is too long, disconnecting client", OutMessageLength);
+		CloseClientConnection(From);
+		return false;
+	}
 
-	const FMessageType MessageType = Read<FMessageType>(Buffer, Position);
-	const uint32_t MessageLength = Read<uint32_t>(Buffer, Position);
+	return true;
+}
 
+bool FAntiCheatNetworkTransport::DispatchMessage(void* From, FMessageType MessageType, const char* Message, uint32_t MessageLength)
+{
 	if (MessageType == FMessageType::Opaque)
 	{
-		const char* Message = Read<char*>(Buffer, MessageLength, Position);
 		OnNewMessageCallback(From, Message, MessageLength);
 	}
 	else if (MessageType == FMessageType::RegistrationInfo)
 	{
-		FRegistrationInfoMessage Message = {};
-		Message.ProductUserId = Read<char*>(Buffer, strlen(Buffer + Position) + 1, Position);
-		Message.EOSConnectIdTokenJWT = Read<char*>(Buffer, strlen(Buffer + Position) + 1, Position);
-		Message.ClientPlatform = Read<EOS_EAntiCheatCommonClientPlatform>(Buffer, Position);
-		OnNewClientCallback(From, Message);
+		// two null terminated strings followed by the platform, all within the message
+		const char* MessageEnd = Message + MessageLength;
+		const char* ProductUserIdEnd = static_cast<const char*>(memchr(Message, '\0', MessageLength));
+		const char* TokenEnd = ProductUserIdEnd != nullptr ?
+			static_cast<const char*>(memchr(ProductUserIdEnd + 1, '\0', MessageEnd - (ProductUserIdEnd + 1))) :
+			nullptr;
+
+		FRegistrationInfoMessage Registration = {};
+		if (TokenEnd == nullptr || static_cast<size_t>(MessageEnd - (TokenEnd + 1)) != sizeof(Registration.ClientPlatform))
+		{
+			FDebugLog::LogWarning(L"AntiCheat: Malformed registration message, disconnecting client");
+			CloseClientConnection(From);
+			return false;
+		}
+
+		Registration.ProductUserId = Message;
+		Registration.EOSConnectIdTokenJWT = ProductUserIdEnd + 1;
+		memcpy(&Registration.ClientPlatform, TokenEnd + 1, sizeof(Registration.ClientPlatform));
+		OnNewClientCallback(From, Registration);
 	}
 
-	return Position - StartPosition;
+	// the callbacks may disconnect the client
+	return TCPClient.IsClientConnected(From);
 }
 
-void FAntiCheatNetworkTransport::Receive(void* From, char* Buffer, size_t Length)
+bool FAntiCheatNetworkTransport::ProcessMessages(void* From, const char* Buffer, size_t Length, size_t& OutConsumed)
 {
 	size_t Position = 0;
-	size_t BytesRemaining = Length;
-	while (BytesRemaining > 0)
+	while (Length - Position >= HeaderSize)
 	{
-		const size_t BytesRead = ProcessMessage(From, Buffer, Position);
-		Position += BytesRead;
-		BytesRemaining -= BytesRead;
+		FMessageType MessageType;
+		uint32_t MessageLength;
+		if (!ReadHeader(From, Buffer + Position, MessageType, MessageLength))
+		{
+			return false;
+		}
+
+		if (Length - Position - HeaderSize < MessageLength)
+		{
+			break;
+		}
+
+		if (!DispatchMessage(From, MessageType, Buffer + Position + HeaderSize, MessageLength))
+		{
+			return false;
+		}
+		Position += HeaderSize + MessageLength;
+	}
+
+	OutConsumed = Position;
+	return true;
+}
+
+void FAntiCheatNetworkTransport::Receive(void* From, char* Buffer, size_t Length)
+{
+	auto Itr = PendingReceives.find(From);
+	if (Itr == PendingReceives.end() || Itr->second.IsEmpty())
+	{
+		// nothing held back from earlier reads, so messages are handled straight from the receive buffer and only a trailing partial one is kept
+		size_t Consumed = 0;
+		if (ProcessMessages(From, Buffer, Length, Consumed) && Consumed < Length)
+		{
+			PendingReceives[From].Write(Buffer + Consumed, Length - Consumed);
+		}
+		return;
+	}
+
+	FRingBuffer& Pending = Itr->second;
+	Pending.Write(Buffer, Length);
+
+	while (Pending.GetSize() >= HeaderSize)
+	{
+		char Header[HeaderSize];
+		Pending.Peek(0, Header, HeaderSize);
+
+		FMessageType MessageType;
+		uint32_t MessageLength;
+		if (!ReadHeader(From, Header, MessageType, MessageLength))
+		{
+			return;
+		}
+
+		const size_t FrameLength = HeaderSize + MessageLength;
+		if (Pending.GetSize() < FrameLength)
+		{
+			break;
+		}
+
+		// a disconnected client's pending data is gone, so it's not touched after that
+		const char* Frame = Pending.PeekContiguous(FrameLength, MessageScratch);
+		if (!DispatchMessage(From, MessageType, Frame + HeaderSize, MessageLength))
+		{
+			return;
+		}
+		Pending.Consume(FrameLength);
 	}
 }
 
@@ -98,6 +198,11 @@ void FAntiCheatNetworkTransport::Update()
 	TCPClient.Update();
 }
 
+const FTCPClient::FSendStats& FAntiCheatNetworkTransport::GetSendStats() const
+{
+	return TCPClient.GetSendStats();
+}
+
 void FAntiCheatNetworkTransport::SetOnNewMessageCallback(FOnNewMessageCallback Callback)
 {
 	OnNewMessageCallback = std::move(Callback);
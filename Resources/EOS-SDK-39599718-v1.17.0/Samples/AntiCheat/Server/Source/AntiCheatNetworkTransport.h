@@ -3,6 +3,7 @@
 #pragma once
 
 #include "eos_anticheatserver_types.h"
+#include "RingBuffer.h"
 #include "TCPClient.h"
 
 #include <cstring>
@@ -11,6 +12,7 @@
 class FAntiCheatNetworkTransport
 {
 public:
+	/** The strings point into the received message and are only valid during the OnNewClient callback */
 	struct FRegistrationInfoMessage
 	{
 		const char* ProductUserId = nullptr;
@@ -31,6 +33,10 @@ public:
 
 	void Update();
 
+	/** Bytes, messages and send calls of the last Update, which sends everything queued since the previous one */
+	const FTCPClient::FSendStats& GetSendStats() const;
+
+	/** Messages are queued and sent by the next Update */
 	void Send(const EOS_AntiCheatCommon_OnClientActionRequiredCallbackInfo* Message);
 	void Send(const EOS_AntiCheatCommon_OnMessageToClientCallbackInfo* Message);
 
@@ -39,8 +45,24 @@ public:
 private:
 	FAntiCheatNetworkTransport();
 
+	/** Reassembles the messages of a client from the data of its reads, which may hold any number of messages and partial ones */
 	void Receive(void* From, char* Buffer, size_t Length);
-	size_t ProcessMessage(void* From, char* Buffer, size_t StartPosition);
+
+	enum class FMessageType : char
+	{
+		Opaque = 1,
+		RegistrationInfo = 2,
+		ClientActionRequired = 3
+	};
+
+	/** Handles the complete messages at the start of Buffer, returns false if the client was disconnected. OutConsumed is set to the bytes they took. */
+	bool ProcessMessages(void* From, const char* Buffer, size_t Length, size_t& OutConsumed);
+
+	/** Reads and validates a message header, disconnecting the client if it's invalid */
+	bool ReadHeader(void* From, const char* Header, FMessageType& OutMessageType, uint32_t& OutMessageLength);
+
+	/** Passes a message on to the callbacks, returns false if the client was disconnected */
+	bool DispatchMessage(void* From, FMessageType MessageType, const char* Message, uint32_t MessageLength);
 
 	template<typename T, typename = std::enable_if_t<!std::is_pointer<T>::value>>
 	void Write(T ObjectToWrite, char* Buffer, size_t& Position)
@@ -57,7 +79,7 @@ private:
 	}
 
 	template<typename T, typename = std::enable_if_t<!std::is_pointer<T>::value>>
-	T Read(char* Buffer, size_t& StartingPosition)
+	T Read(const char* Buffer, size_t& StartingPosition)
 	{
 		T ObjectToRead;
 		memcpy(&ObjectToRead, &Buffer[StartingPosition], sizeof(ObjectToRead));
@@ -65,24 +87,27 @@ private:
 		return ObjectToRead;
 	}
 
-	template<typename T, typename = std::enable_if_t<std::is_pointer<T>::value>>
-	T Read(char* Buffer, size_t BytesToRead, size_t& StartingPosition)
-	{
-		T Result = &Buffer[StartingPosition];
-		StartingPosition += BytesToRead;
-		return Result;
-	}
-
 private:
-	enum class FMessageType : char
-	{
-		Opaque = 1,
-		RegistrationInfo = 2,
-		ClientActionRequired = 3
-	};
+	/** Most game clients connected at once */
+	static constexpr int MaxClients = 4096;
+
+	/** Size of each client connection's receive buffer */
+	static constexpr size_t ReceiveBufferSize = 16 * 1024;
+
+	/** Every message starts with its FMessageType and the uint32_t length of what follows */
+	static constexpr size_t HeaderSize = sizeof(char) + sizeof(uint32_t);
+
+	/** Clients sending longer messages are disconnected */
+	static constexpr uint32_t MaxMessageLength = 64 * 1024;
 
 	FTCPClient TCPClient;
 
+	/** Partial messages of each client, kept until the rest of them has been received */
+	std::unordered_map<void*, FRingBuffer> PendingReceives;
+
+	/** Holds messages that wrap around the end of a client's ring buffer while they're handled */
+	std::vector<char> MessageScratch;
+
 	FOnNewMessageCallback OnNewMessageCallback;
 	FOnNewClientCallback OnNewClientCallback;
 	FOnClientDisconnectedCallback OnClientDisconnectedCallback;
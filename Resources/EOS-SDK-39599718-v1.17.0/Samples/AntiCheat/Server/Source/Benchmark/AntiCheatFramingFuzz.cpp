@@ -0,0 +1,304 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "AntiCheatNetworkTransport.h"
+#include "TransportTestClient.h"
+
+#include "CommandLine.h"
+#include "StringUtils.h"
+
+#include <cstdio>
+
+/** Fuzz harness for the framing of FAntiCheatNetworkTransport::Receive. Each iteration connects a client over loopback and sends
+  * a random mix of opaque and registration messages in randomly sized pieces, with an Update between pieces, so frames and headers
+  * are split across reads at every possible point and partial frames pile up in the client's ring buffer.
+  * Some iterations end the stream with a malformed frame (unknown type, oversized length, broken registration or random bytes),
+  * which must disconnect the client after everything before it was delivered.
+  * Every message must come out of the callbacks exactly as it was sent, in order.
+  *
+  * Usage: AntiCheatFramingFuzz -iterations 2000 -seed 1
+  */
+namespace
+{
+	/** What the callbacks saw, or are expected to see, one entry per message: the type byte followed by the message */
+	using FMessageLog = std::vector<std::string>;
+
+	/** Mirrors FAntiCheatNetworkTransport::MaxMessageLength */
+	constexpr uint32_t MaxMessageLength = 64 * 1024;
+
+	enum class EMalformedFrame : int
+	{
+		UnknownType,
+		OversizedLength,
+		BrokenRegistration,
+		RandomBytes,
+		Count
+	};
+
+	struct FFuzzStream
+	{
+		std::string Data;
+		FMessageLog Expected;
+		bool bExpectDisconnect = false;
+	};
+
+	size_t GetSizeParam(const wchar_t* Name, size_t Default)
+	{
+		if (FCommandLine::Get().HasParam(Name))
+		{
+			try
+			{
+				return static_cast<size_t>(std::stoul(FCommandLine::Get().GetParamValue(Name)));
+			}
+			catch (const std::exception&)
+			{
+				fprintf(stderr, "Can't parse %ls, using %d\n", Name, static_cast<int>(Default));
+			}
+		}
+		return Default;
+	}
+
+	std::string MakeRandomBytes(std::mt19937& Random, size_t Length)
+	{
+		std::uniform_int_distribution<int> Byte(0, 255);
+		std::string Bytes(Length, '\0');
+		for (char& Value : Bytes)
+		{
+			Value = static_cast<char>(Byte(Random));
+		}
+		return Bytes;
+	}
+
+	std::string MakeRandomText(std::mt19937& Random, size_t Length)
+	{
+		std::uniform_int_distribution<int> Character('!', '~');
+		std::string Text(Length, '\0');
+		for (char& Value : Text)
+		{
+			Value = static_cast<char>(Character(Random));
+		}
+		return Text;
+	}
+
+	/** Mostly small messages, some that span several reads, and the odd one at the length limit */
+	size_t PickMessageLength(std::mt19937& Random)
+	{
+		const int Kind = std::uniform_int_distribution<int>(0, 99)(Random);
+		if (Kind < 50)
+		{
+			return std::uniform_int_distribution<size_t>(0, 64)(Random);
+		}
+		if (Kind < 95)
+		{
+			return std::uniform_int_distribution<size_t>(65, 20 * 1024)(Random);
+		}
+		return std::uniform_int_distribution<size_t>(MaxMessageLength - 16, MaxMessageLength)(Random);
+	}
+
+	void AppendMalformedFrame(std::mt19937& Random, std::string& Out)
+	{
+		switch (static_cast<EMalformedFrame>(std::uniform_int_distribution<int>(0, static_cast<int>(EMalformedFrame::Count) - 1)(Random)))
+		{
+			case EMalformedFrame::UnknownType:
+			{
+				// anything but an opaque or registration message, including the server-to-client action type
+				int Type = std::uniform_int_distribution<int>(0, 253)(Random);
+				Type = Type >= FTransportTestClient::OpaqueType ? Type + 2 : Type;
+				FTransportTestClient::AppendHeader(Out, static_cast<char>(Type), std::uniform_int_distribution<uint32_t>(0, 64)(Random));
+				break;
+			}
+			case EMalformedFrame::OversizedLength:
+				FTransportTestClient::AppendHeader(Out, FTransportTestClient::OpaqueType, std::uniform_int_distribution<uint32_t>(MaxMessageLength + 1, UINT32_MAX)(Random));
+				break;
+			case EMalformedFrame::BrokenRegistration:
+			{
+				// a valid registration body with its terminators or platform cut short or padded
+				std::string Body = FTransportTestClient::MakeRegistrationBody(MakeRandomText(Random, 32), MakeRandomText(Random, 64), EOS_EAntiCheatCommonClientPlatform::EOS_ACCCP_Windows);
+				switch (std::uniform_int_distribution<int>(0, 2)(Random))
+				{
+					case 0: Body.resize(32); break;
+					case 1: Body.pop_back(); break;
+					default: Body.push_back('\0'); break;
+				}
+				FTransportTestClient::AppendRegistrationFrame(Out, Body);
+				break;
+			}
+			default:
+			{
+				// random bytes, whose first byte is never a valid type
+				std::string Bytes = MakeRandomBytes(Random, std::uniform_int_distribution<size_t>(FTransportTestClient::OpaqueType, 256)(Random));
+				if (Bytes[0] == FTransportTestClient::OpaqueType || Bytes[0] == FTransportTestClient::RegistrationInfoType)
+				{
+					Bytes[0] = 0;
+				}
+				Out += Bytes;
+				break;
+			}
+		}
+	}
+
+	FFuzzStream MakeStream(std::mt19937& Random)
+	{
+		FFuzzStream Stream;
+		const size_t NumMessages = std::uniform_int_distribution<size_t>(1, 32)(Random);
+		for (size_t Index = 0; Index < NumMessages; ++Index)
+		{
+			if (std::uniform_int_distribution<int>(0, 4)(Random) == 0)
+			{
+				const EOS_EAntiCheatCommonClientPlatform Platform = static_cast<EOS_EAntiCheatCommonClientPlatform>(std::uniform_int_distribution<int>(0, 8)(Random));
+				const std::string Body = FTransportTestClient::MakeRegistrationBody(
+					MakeRandomText(Random, std::uniform_int_distribution<size_t>(0, 64)(Random)),
+					MakeRandomText(Random, std::uniform_int_distribution<size_t>(0, 2048)(Random)),
+					Platform);
+				FTransportTestClient::AppendRegistrationFrame(Stream.Data, Body);
+				Stream.Expected.push_back(FTransportTestClient::RegistrationInfoType + Body);
+			}
+			else
+			{
+				const std::string Payload = MakeRandomBytes(Random, PickMessageLength(Random));
+				FTransportTestClient::AppendOpaqueFrame(Stream.Data, Payload);
+				Stream.Expected.push_back(FTransportTestClient::OpaqueType + Payload);
+			}
+		}
+
+		if (std::uniform_int_distribution<int>(0, 9)(Random) < 3)
+		{
+			AppendMalformedFrame(Random, Stream.Data);
+			Stream.bExpectDisconnect = true;
+
+			// whatever follows the malformed frame must never be looked at
+			Stream.Data += MakeRandomBytes(Random, std::uniform_int_distribution<size_t>(0, 512)(Random));
+		}
+		return Stream;
+	}
+
+	/** Mostly pieces that split headers, and some that hold several frames at once */
+	size_t PickPieceLength(std::mt19937& Random)
+	{
+		return std::uniform_int_distribution<int>(0, 1)(Random) == 0 ?
+			std::uniform_int_distribution<size_t>(1, 12)(Random) :
+			std::uniform_int_distribution<size_t>(13, 48 * 1024)(Random);
+	}
+
+	bool UpdateUntil(FAntiCheatNetworkTransport& Transport, const std::function<bool()>& Done)
+	{
+		const ServerTimePoint Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (!Done())
+		{
+			if (std::chrono::steady_clock::now() > Deadline)
+			{
+				return false;
+			}
+			Transport.Update();
+		}
+		return true;
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	std::vector<std::wstring> CommandLineParams;
+	for (int i = 1; i < argc; ++i)
+	{
+		CommandLineParams.push_back(FStringUtils::Widen(argv[i]));
+	}
+	FCommandLine::Get().Init(CommandLineParams);
+
+	const size_t NumIterations = GetSizeParam(L"iterations", 2000);
+	const size_t Seed = GetSizeParam(L"seed", 1);
+
+	// the state the callbacks fill in for the client of the current iteration
+	void* CurrentClient = nullptr;
+	FMessageLog Received;
+	bool bDisconnected = false;
+
+	FAntiCheatNetworkTransport& Transport = FAntiCheatNetworkTransport::GetInstance();
+	Transport.SetOnNewMessageCallback([&](void* ClientHandle, const void* Data, uint32_t Length) {
+		CurrentClient = ClientHandle;
+		Received.push_back(FTransportTestClient::OpaqueType + std::string(static_cast<const char*>(Data), Length));
+	});
+	Transport.SetOnNewClientCallback([&](void* ClientHandle, FAntiCheatNetworkTransport::FRegistrationInfoMessage Message) {
+		CurrentClient = ClientHandle;
+		const std::string Body = FTransportTestClient::MakeRegistrationBody(Message.ProductUserId, Message.EOSConnectIdTokenJWT, Message.ClientPlatform);
+		Received.push_back(FTransportTestClient::RegistrationInfoType + Body);
+	});
+	Transport.SetOnClientDisconnectedCallback([&](void* ClientHandle) {
+		bDisconnected = CurrentClient == nullptr || ClientHandle == CurrentClient;
+	});
+
+	std::mt19937 Random(static_cast<std::mt19937::result_type>(Seed));
+	size_t NumMessages = 0;
+	size_t NumPieces = 0;
+	size_t NumDisconnects = 0;
+	uint64_t NumBytes = 0;
+	for (size_t Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		FFuzzStream Stream = MakeStream(Random);
+		CurrentClient = nullptr;
+		Received.clear();
+		bDisconnected = false;
+
+		FTransportTestClient Client;
+		if (!Client.Connect())
+		{
+			fprintf(stderr, "Can't connect to the transport on port %d\n", FTransportTestClient::ServerPort);
+			return 1;
+		}
+		Transport.Update();
+
+		// once the server has closed the connection, the rest of the stream can't be sent anymore, which is expected
+		for (size_t Offset = 0; Offset < Stream.Data.size() && !bDisconnected; )
+		{
+			const size_t PieceLength = std::min(PickPieceLength(Random), Stream.Data.size() - Offset);
+			if (!Client.SendAll(Stream.Data.data() + Offset, PieceLength))
+			{
+				break;
+			}
+			Offset += PieceLength;
+			++NumPieces;
+			Transport.Update();
+		}
+
+		const bool bSettled = UpdateUntil(Transport, [&]() {
+			return Stream.bExpectDisconnect ? bDisconnected : Received.size() >= Stream.Expected.size() || bDisconnected;
+		});
+
+		bool bPassed = bSettled && Received == Stream.Expected && bDisconnected == Stream.bExpectDisconnect;
+		if (!Stream.bExpectDisconnect)
+		{
+			Client.Close();
+			bPassed = UpdateUntil(Transport, [&]() { return bDisconnected; }) && bPassed;
+		}
+
+		if (!bPassed)
+		{
+			size_t NumMatching = 0;
+			while (NumMatching < Received.size() && NumMatching < Stream.Expected.size() && Received[NumMatching] == Stream.Expected[NumMatching])
+			{
+				++NumMatching;
+			}
+			fprintf(stderr, "Iteration %d (seed %d) failed: %d of %d messages received, %d matching, %s, expected %s\n",
+				static_cast<int>(Iteration),
+				static_cast<int>(Seed),
+				static_cast<int>(Received.size()),
+				static_cast<int>(Stream.Expected.size()),
+				static_cast<int>(NumMatching),
+				bDisconnected ? "disconnected" : "still connected",
+				Stream.bExpectDisconnect ? "a disconnect" : "no disconnect");
+			return 1;
+		}
+
+		NumMessages += Received.size();
+		NumDisconnects += Stream.bExpectDisconnect ? 1 : 0;
+		NumBytes += Stream.Data.size();
+	}
+
+	printf("%d iterations passed: %d messages reassembled from %d pieces (%.1f MB), %d malformed streams disconnected\n",
+		static_cast<int>(NumIterations),
+		static_cast<int>(NumMessages),
+		static_cast<int>(NumPieces),
+		NumBytes / (1024.0 * 1024.0),
+		static_cast<int>(NumDisconnects));
+	return 0;
+}
@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "AntiCheatNetworkTransport.h"
+#include "TransportTestClient.h"
+
+#include "CommandLine.h"
+#include "StringUtils.h"
+
+#include <cstdio>
+
+/** Receive throughput of FAntiCheatNetworkTransport. Client threads connect over loopback, register and stream opaque messages
+  * in fixed size writes that don't line up with the frames, so most reads end in a partial message that has to be reassembled.
+  * The main thread runs Update until every message has come out of the new message callback.
+  *
+  * Usage: AntiCheatTransportBenchmark -clients 64 -messages 20000 -size 256
+  */
+namespace
+{
+	/** Bytes per send, which splits frames the way a busy game client's writes do */
+	constexpr size_t WriteSize = 4096;
+
+	size_t GetSizeParam(const wchar_t* Name, size_t Default)
+	{
+		if (FCommandLine::Get().HasParam(Name))
+		{
+			try
+			{
+				return static_cast<size_t>(std::stoul(FCommandLine::Get().GetParamValue(Name)));
+			}
+			catch (const std::exception&)
+			{
+				fprintf(stderr, "Can't parse %ls, using %d\n", Name, static_cast<int>(Default));
+			}
+		}
+		return Default;
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	std::vector<std::wstring> CommandLineParams;
+	for (int i = 1; i < argc; ++i)
+	{
+		CommandLineParams.push_back(FStringUtils::Widen(argv[i]));
+	}
+	FCommandLine::Get().Init(CommandLineParams);
+
+	const size_t NumClients = std::max<size_t>(GetSizeParam(L"clients", 64), 1);
+	const size_t NumMessagesPerClient = GetSizeParam(L"messages", 20000);
+	const size_t MessageSize = std::min<size_t>(GetSizeParam(L"size", 256), 64 * 1024);
+
+	size_t NumRegistered = 0;
+	size_t NumReceived = 0;
+	uint64_t NumBytesReceived = 0;
+	size_t NumDisconnected = 0;
+
+	FAntiCheatNetworkTransport& Transport = FAntiCheatNetworkTransport::GetInstance();
+	Transport.SetOnNewMessageCallback([&](void*, const void*, uint32_t Length) {
+		++NumReceived;
+		NumBytesReceived += Length;
+	});
+	Transport.SetOnNewClientCallback([&](void*, FAntiCheatNetworkTransport::FRegistrationInfoMessage) {
+		++NumRegistered;
+	});
+	Transport.SetOnClientDisconnectedCallback([&](void*) {
+		++NumDisconnected;
+	});
+
+	// every client sends the same stream: its registration followed by all of its messages
+	std::string Stream;
+	FTransportTestClient::AppendRegistrationFrame(Stream, FTransportTestClient::MakeRegistrationBody(
+		"0002aabbccddeeff00112233445566778", "BenchmarkToken", EOS_EAntiCheatCommonClientPlatform::EOS_ACCCP_Linux));
+	const std::string Payload(MessageSize, 'x');
+	for (size_t Index = 0; Index < NumMessagesPerClient; ++Index)
+	{
+		FTransportTestClient::AppendOpaqueFrame(Stream, Payload);
+	}
+
+	std::vector<std::unique_ptr<FTransportTestClient>> Clients;
+	for (size_t Index = 0; Index < NumClients; ++Index)
+	{
+		Clients.push_back(std::make_unique<FTransportTestClient>());
+		if (!Clients.back()->Connect())
+		{
+			fprintf(stderr, "Can't connect to the transport on port %d\n", FTransportTestClient::ServerPort);
+			return 1;
+		}
+	}
+
+	std::atomic<size_t> NumSendFailures(0);
+	const ServerTimePoint StartTime = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> Senders;
+	for (size_t Index = 0; Index < NumClients; ++Index)
+	{
+		FTransportTestClient* Client = Clients[Index].get();
+		Senders.emplace_back([Client, &Stream, &NumSendFailures]() {
+			for (size_t Offset = 0; Offset < Stream.size(); Offset += WriteSize)
+			{
+				if (!Client->SendAll(Stream.data() + Offset, std::min(WriteSize, Stream.size() - Offset)))
+				{
+					++NumSendFailures;
+					return;
+				}
+			}
+		});
+	}
+
+	const size_t NumExpected = NumClients * NumMessagesPerClient;
+	const ServerTimePoint Deadline = StartTime + std::chrono::minutes(5);
+	while ((NumReceived < NumExpected || NumRegistered < NumClients) && NumDisconnected == 0 && std::chrono::steady_clock::now() < Deadline)
+	{
+		Transport.Update();
+	}
+	const double Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count();
+
+	for (std::thread& Sender : Senders)
+	{
+		Sender.join();
+	}
+
+	printf("Clients: %d, messages per client: %d, message size: %d bytes, write size: %d bytes\n",
+		static_cast<int>(NumClients),
+		static_cast<int>(NumMessagesPerClient),
+		static_cast<int>(MessageSize),
+		static_cast<int>(WriteSize));
+	printf("Received %d of %d messages from %d registered clients in %.3f s\n",
+		static_cast<int>(NumReceived),
+		static_cast<int>(NumExpected),
+		static_cast<int>(NumRegistered),
+		Seconds);
+	printf("Throughput: %.0f messages/s, %.1f MB/s\n",
+		NumReceived / Seconds,
+		NumBytesReceived / (1024.0 * 1024.0) / Seconds);
+
+	const bool bPassed = NumReceived == NumExpected && NumRegistered == NumClients && NumDisconnected == 0 && NumSendFailures == 0;
+	if (!bPassed)
+	{
+		fprintf(stderr, "%d clients were disconnected and %d failed to send\n", static_cast<int>(NumDisconnected), static_cast<int>(NumSendFailures.load()));
+	}
+	return bPassed ? 0 : 1;
+}
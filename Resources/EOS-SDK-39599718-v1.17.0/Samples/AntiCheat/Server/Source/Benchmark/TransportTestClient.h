@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "eos_anticheatserver_types.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+/** A game client's end of the anti-cheat transport, for the offline fuzz and benchmark targets.
+  * Frames are built the way the game client writes them: an FMessageType byte, the uint32_t length of what follows, then the message.
+  */
+class FTransportTestClient
+{
+public:
+	/** The transport listens here, see FAntiCheatNetworkTransport's constructor */
+	static constexpr uint16_t ServerPort = 1234;
+
+	static constexpr char OpaqueType = 1;
+	static constexpr char RegistrationInfoType = 2;
+
+	static void AppendHeader(std::string& Out, char MessageType, uint32_t MessageLength)
+	{
+		Out.push_back(MessageType);
+		Out.append(reinterpret_cast<const char*>(&MessageLength), sizeof(MessageLength));
+	}
+
+	static void AppendOpaqueFrame(std::string& Out, const std::string& Payload)
+	{
+		AppendHeader(Out, OpaqueType, static_cast<uint32_t>(Payload.size()));
+		Out += Payload;
+	}
+
+	/** The body of a registration message: the product user id and token, each null terminated, then the platform */
+	static std::string MakeRegistrationBody(const std::string& ProductUserId, const std::string& Token, EOS_EAntiCheatCommonClientPlatform Platform)
+	{
+		std::string Body;
+		Body += ProductUserId;
+		Body.push_back('\0');
+		Body += Token;
+		Body.push_back('\0');
+		Body.append(reinterpret_cast<const char*>(&Platform), sizeof(Platform));
+		return Body;
+	}
+
+	static void AppendRegistrationFrame(std::string& Out, const std::string& Body)
+	{
+		AppendHeader(Out, RegistrationInfoType, static_cast<uint32_t>(Body.size()));
+		Out += Body;
+	}
+
+	FTransportTestClient() = default;
+	FTransportTestClient(const FTransportTestClient&) = delete;
+	FTransportTestClient& operator=(const FTransportTestClient&) = delete;
+	~FTransportTestClient() { Close(); }
+
+	bool Connect()
+	{
+		Socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (Socket == InvalidSocket)
+		{
+			return false;
+		}
+
+		int NoDelay = 1;
+		setsockopt(Socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&NoDelay), sizeof(NoDelay));
+
+		sockaddr_in Address = {};
+		Address.sin_family = AF_INET;
+		Address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		Address.sin_port = htons(ServerPort);
+		if (connect(Socket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0)
+		{
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	/** Blocks until all of Data is sent, returns false if the server closed the connection first */
+	bool SendAll(const char* Data, size_t Length)
+	{
+		while (Length > 0)
+		{
+			const int BytesSent = static_cast<int>(send(Socket, Data, static_cast<int>(Length), SendFlags));
+			if (BytesSent <= 0)
+			{
+				return false;
+			}
+			Data += BytesSent;
+			Length -= BytesSent;
+		}
+		return true;
+	}
+
+	void Close()
+	{
+		if (Socket != InvalidSocket)
+		{
+#ifdef _WIN32
+			closesocket(Socket);
+#else
+			close(Socket);
+#endif
+			Socket = InvalidSocket;
+		}
+	}
+
+private:
+#ifdef _WIN32
+	using FSocketHandle = SOCKET;
+	static constexpr FSocketHandle InvalidSocket = INVALID_SOCKET;
+	static constexpr int SendFlags = 0;
+#else
+	using FSocketHandle = int;
+	static constexpr FSocketHandle InvalidSocket = -1;
+#ifdef MSG_NOSIGNAL
+	static constexpr int SendFlags = MSG_NOSIGNAL;
+#else
+	static constexpr int SendFlags = 0;
+#endif
+#endif
+
+	FSocketHandle Socket = InvalidSocket;
+};
@@ -125,6 +125,7 @@ int MasterMain(int Argc, const char* Args[])
 			FAntiCheatServer* Server = nullptr;
 			void* ClientHandle = nullptr;
 			FAntiCheatNetworkTransport::FRegistrationInfoMessage Message;
+			std::string ProductUserId;
 		};
 		auto VerifyCallback = [](const EOS_Connect_VerifyIdTokenCallbackInfo* Data)
 		{
@@ -209,7 +210,12 @@ int MasterMain(int Argc, const char* Args[])
 		};
 
 		// We must verify the the player's identity using the provided Connect ID Token before we allow them to continue connecting.
-		Server.VerifyIdToken(EOS_ProductUserId_FromString(Message.ProductUserId), Message.EOSConnectIdTokenJWT, new VerifyCallbackHelper{&Server, ClientHandle, Message}, VerifyCallback);
+		// The message strings are only valid during this callback, the helper keeps its own copy of the ProductUserId for RegisterClient.
+		VerifyCallbackHelper* Helper = new VerifyCallbackHelper{&Server, ClientHandle, Message, Message.ProductUserId};
+		Helper->Message.ProductUserId = Helper->ProductUserId.c_str();
+		Helper->Message.EOSConnectIdTokenJWT = nullptr;
+
+		Server.VerifyIdToken(EOS_ProductUserId_FromString(Message.ProductUserId), Message.EOSConnectIdTokenJWT, Helper, VerifyCallback);
 	});
 	FAntiCheatNetworkTransport::GetInstance().SetOnClientDisconnectedCallback([&Server](void* ClientHandle) 
 	{
@@ -221,11 +227,36 @@ int MasterMain(int Argc, const char* Args[])
 		Server.OnMessageFromClientReceived(ClientHandle, Data, Length);
 	});
 
+	// send stats are reported over a window of updates
+	constexpr std::chrono::seconds SendStatsInterval(10);
+	std::chrono::steady_clock::time_point SendStatsStartTime = std::chrono::steady_clock::now();
+	FTCPClient::FSendStats SendStats;
+	uint32_t SendStatsUpdates = 0;
+
 	// main loop
 	while (bIsRunning)
 	{
 		FAntiCheatNetworkTransport::GetInstance().Update();
 
+		const FTCPClient::FSendStats& UpdateSendStats = FAntiCheatNetworkTransport::GetInstance().GetSendStats();
+		SendStats.BytesSent += UpdateSendStats.BytesSent;
+		SendStats.MessagesSent += UpdateSendStats.MessagesSent;
+		SendStats.SendCalls += UpdateSendStats.SendCalls;
+		++SendStatsUpdates;
+
+		if (std::chrono::steady_clock::now() - SendStatsStartTime >= SendStatsInterval)
+		{
+			if (SendStats.SendCalls > 0)
+			{
+				FDebugLog::Log(L"Sent %llu bytes in %u messages with %u send calls over %u updates (%.1f bytes, %.2f calls per update)",
+					static_cast<unsigned long long>(SendStats.BytesSent), SendStats.MessagesSent, SendStats.SendCalls, SendStatsUpdates,
+					static_cast<double>(SendStats.BytesSent) / SendStatsUpdates, static_cast<double>(SendStats.SendCalls) / SendStatsUpdates);
+			}
+			SendStats = FTCPClient::FSendStats();
+			SendStatsUpdates = 0;
+			SendStatsStartTime = std::chrono::steady_clock::now();
+		}
+
 		// update the sdk on the mainthread
 		EosSdk->Tick();
 		
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+#include "RingBuffer.h"
+
+#include <cstring>
+
+namespace
+{
+	constexpr size_t MinRingCapacity = 1024;
+}
+
+void FRingBuffer::Write(const char* Data, size_t Length)
+{
+	if (Length == 0)
+	{
+		return;
+	}
+
+	if (Size + Length > Ring.size())
+	{
+		Grow(Size + Length);
+	}
+
+	const size_t Mask = Ring.size() - 1;
+	const size_t Tail = (Head + Size) & Mask;
+	const size_t FirstPart = std::min(Length, Ring.size() - Tail);
+	memcpy(&Ring[Tail], Data, FirstPart);
+	memcpy(&Ring[0], Data + FirstPart, Length - FirstPart);
+	Size += Length;
+}
+
+void FRingBuffer::Peek(size_t Offset, void* Out, size_t Length) const
+{
+	assert(Offset + Length <= Size);
+	if (Length == 0)
+	{
+		return;
+	}
+
+	const size_t Mask = Ring.size() - 1;
+	const size_t Start = (Head + Offset) & Mask;
+	const size_t FirstPart = std::min(Length, Ring.size() - Start);
+	memcpy(Out, &Ring[Start], FirstPart);
+	memcpy(static_cast<char*>(Out) + FirstPart, &Ring[0], Length - FirstPart);
+}
+
+const char* FRingBuffer::PeekContiguous(size_t Length, std::vector<char>& Scratch) const
+{
+	assert(Length <= Size);
+
+	// an empty ring may not have been allocated yet, so there's nothing to point into
+	if (Length == 0)
+	{
+		return Ring.data();
+	}
+
+	if (Head + Length <= Ring.size())
+	{
+		return &Ring[Head];
+	}
+
+	Scratch.resize(Length);
+	Peek(0, Scratch.data(), Length);
+	return Scratch.data();
+}
+
+void FRingBuffer::Consume(size_t Length)
+{
+	assert(Length <= Size);
+
+	Size -= Length;
+	Head = Size == 0 ? 0 : (Head + Length) & (Ring.size() - 1);
+}
+
+void FRingBuffer::Grow(size_t MinCapacity)
+{
+	size_t NewCapacity = std::max(Ring.size(), MinRingCapacity);
+	while (NewCapacity < MinCapacity)
+	{
+		NewCapacity *= 2;
+	}
+
+	// unwrap the content to the start of the new ring
+	std::vector<char> NewRing(NewCapacity);
+	if (Size > 0)
+	{
+		Peek(0, NewRing.data(), Size);
+	}
+	Ring.swap(NewRing);
+	Head = 0;
+}
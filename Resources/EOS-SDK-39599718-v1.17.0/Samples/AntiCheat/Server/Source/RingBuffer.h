@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <vector>
+
+/** Byte FIFO over a power-of-two sized ring, which grows when a write doesn't fit. Holds the partial messages of a connection between reads. */
+class FRingBuffer
+{
+public:
+	size_t GetSize() const { return Size; }
+	bool IsEmpty() const { return Size == 0; }
+
+	/** Appends Length bytes, growing the ring if needed */
+	void Write(const char* Data, size_t Length);
+
+	/** Copies Length bytes starting Offset bytes from the front into Out, without consuming them */
+	void Peek(size_t Offset, void* Out, size_t Length) const;
+
+	/** Returns the Length bytes at the front as one contiguous block. Points into the ring unless they wrap around its end,
+	  * in which case they're copied into Scratch. Valid until the ring is written to or Scratch changes, and not to be read for a Length of 0. */
+	const char* PeekContiguous(size_t Length, std::vector<char>& Scratch) const;
+
+	/** Drops Length bytes from the front */
+	void Consume(size_t Length);
+
+private:
+	void Grow(size_t MinCapacity);
+
+	std::vector<char> Ring;
+	size_t Head = 0;
+	size_t Size = 0;
+};
@@ -4,40 +4,207 @@
 #include "TCPClient.h"
 #include "DebugLog.h"
 
-FTCPClient::FTCPClient(int MaxSockets, size_t MaxBufferSizeBytes)
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32.lib")
+#endif
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+
+namespace
 {
-	SDLNet_Init();
+#ifdef _WIN32
+	using FPollFd = WSAPOLLFD;
+	using FSendBuffer = WSABUF;
+	const FSocketHandle InvalidSocket = INVALID_SOCKET;
+
+	int PollSockets(FPollFd* PollFds, size_t NumPollFds, int TimeoutMs) { return WSAPoll(PollFds, static_cast<ULONG>(NumPollFds), TimeoutMs); }
+	void CloseSocket(FSocketHandle Socket) { closesocket(Socket); }
+	bool IsWouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+	bool IsInterrupted() { return WSAGetLastError() == WSAEINTR; }
+
+	bool SetNonBlocking(FSocketHandle Socket)
+	{
+		u_long NonBlocking = 1;
+		return ioctlsocket(Socket, FIONBIO, &NonBlocking) == 0;
+	}
+
+	void SetSendBuffer(FSendBuffer& Buffer, const char* Data, size_t Length)
+	{
+		Buffer.buf = const_cast<char*>(Data);
+		Buffer.len = static_cast<ULONG>(Length);
+	}
+
+	int64_t SendBuffers(FSocketHandle Socket, FSendBuffer* Buffers, size_t NumBuffers)
+	{
+		DWORD BytesSent = 0;
+		return WSASend(Socket, Buffers, static_cast<DWORD>(NumBuffers), &BytesSent, 0, nullptr, nullptr) == 0 ? BytesSent : -1;
+	}
+#else
+	using FPollFd = pollfd;
+	using FSendBuffer = iovec;
+	const FSocketHandle InvalidSocket = -1;
+#ifdef MSG_NOSIGNAL
+	const int SendFlags = MSG_NOSIGNAL;
+#else
+	const int SendFlags = 0;
+#endif
+
+#ifndef __linux__
+	// Linux watches the sockets with epoll instead
+	int PollSockets(FPollFd* PollFds, size_t NumPollFds, int TimeoutMs) { return poll(PollFds, static_cast<nfds_t>(NumPollFds), TimeoutMs); }
+#endif
+	void CloseSocket(FSocketHandle Socket) { close(Socket); }
+	bool IsWouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+	bool IsInterrupted() { return errno == EINTR; }
+
+	bool SetNonBlocking(FSocketHandle Socket)
+	{
+#ifdef SO_NOSIGPIPE
+		// no MSG_NOSIGNAL on mac, writing to a closed connection must not raise SIGPIPE either
+		int NoSigPipe = 1;
+		setsockopt(Socket, SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+		const int Flags = fcntl(Socket, F_GETFL, 0);
+		return Flags != -1 && fcntl(Socket, F_SETFL, Flags | O_NONBLOCK) == 0;
+	}
+
+	void SetSendBuffer(FSendBuffer& Buffer, const char* Data, size_t Length)
+	{
+		Buffer.iov_base = const_cast<char*>(Data);
+		Buffer.iov_len = Length;
+	}
+
+	int64_t SendBuffers(FSocketHandle Socket, FSendBuffer* Buffers, size_t NumBuffers)
+	{
+		// sendmsg rather than writev, which has no flags to keep a closed connection from raising SIGPIPE
+		msghdr Message = {};
+		Message.msg_iov = Buffers;
+		Message.msg_iovlen = NumBuffers;
+		return sendmsg(Socket, &Message, SendFlags);
+	}
+#endif
 
-	ClientsSockets.reserve(MaxSockets);
-	SocketSet = SDLNet_AllocSocketSet(MaxSockets + 1); // +1 for the Server socket
+	/** Most queued messages written by one send call */
+	constexpr size_t MaxBuffersPerSend = 64;
 
-	Buffer.resize(MaxBufferSizeBytes);
+	/** A client that doesn't read is disconnected once this much data is queued for it */
+	constexpr size_t MaxQueuedBytes = 1024 * 1024;
+
+	/** Closed connections get this long to send their queued data before the socket is closed regardless */
+	constexpr std::chrono::seconds CloseTimeout(5);
+
+#ifdef __linux__
+	/** Most events handled per Update, ready connections that don't fit are reported by the next one */
+	constexpr int MaxEventsPerUpdate = 256;
+#endif
+}
+
+FTCPClient::FTCPClient(int MaxSockets, size_t MaxBufferSizeBytes)
+	: ServerSocket(InvalidSocket)
+	, MaxConnections(static_cast<size_t>(MaxSockets))
+	, ReceiveBufferSize(MaxBufferSizeBytes)
+{
+#ifdef _WIN32
+	WSADATA WsaData;
+	WSAStartup(MAKEWORD(2, 2), &WsaData);
+#endif
+
+#ifdef __linux__
+	EpollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (EpollFd == -1)
+	{
+		FDebugLog::LogError(L"TCPClient: Unable to create epoll instance (%d)", errno);
+	}
+#endif
 }
 
 FTCPClient::~FTCPClient()
 {
+	// the owner is going away, so connections are closed without calling back
+	for (const auto& Connection : Connections)
+	{
+		CloseSocket(Connection.second->Socket);
+	}
+	Connections.clear();
+	ClosingConnections.clear();
+	PendingFlushConnections.clear();
+
 	CloseServerConnection();
-	for (TCPsocket ClientSocket : ClientsSockets)
+
+#ifdef __linux__
+	if (EpollFd != -1)
 	{
-		CloseClientConnection(ClientSocket);
+		close(EpollFd);
 	}
+#endif
 
-	SDLNet_FreeSocketSet(SocketSet);
-	SDLNet_Quit();
+#ifdef _WIN32
+	WSACleanup();
+#endif
 }
 
 void FTCPClient::Open(uint16_t Port)
 {
-	IPaddress IP;
-	SDLNet_ResolveHost(&IP, nullptr, Port);
-	
-	ServerSocket = SDLNet_TCP_Open(&IP);
-	SDLNet_TCP_AddSocket(SocketSet, ServerSocket);
+	ServerSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (ServerSocket == InvalidSocket)
+	{
+		FDebugLog::LogError(L"TCPClient: Unable to create server socket");
+		return;
+	}
+
+	int ReuseAddress = 1;
+	setsockopt(ServerSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&ReuseAddress), sizeof(ReuseAddress));
+
+	sockaddr_in Address = {};
+	Address.sin_family = AF_INET;
+	Address.sin_addr.s_addr = htonl(INADDR_ANY);
+	Address.sin_port = htons(Port);
+
+	if (bind(ServerSocket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0 ||
+		listen(ServerSocket, SOMAXCONN) != 0 ||
+		!SetNonBlocking(ServerSocket))
+	{
+		FDebugLog::LogError(L"TCPClient: Unable to listen on port %d", Port);
+		CloseServerConnection();
+		return;
+	}
+
+	AddToPoller(ServerSocket, nullptr);
 }
 
-void FTCPClient::Send(void* To, const void* Data, size_t Length)
+void FTCPClient::Send(void* To, std::vector<char> Message)
 {
-	SDLNet_TCP_Send(reinterpret_cast<TCPsocket>(To), Data, static_cast<int>(Length));
+	auto Itr = Connections.find(To);
+	if (Itr == Connections.end() || Itr->second->bIsClosing || Message.empty())
+	{
+		return;
+	}
+
+	FConnection& Connection = *Itr->second;
+	if (Connection.QueuedBytes + Message.size() > MaxQueuedBytes)
+	{
+		FDebugLog::LogWarning(L"TCPClient: Client is not reading, disconnecting it");
+		CloseClientConnection(To);
+		return;
+	}
+
+	Connection.QueuedBytes += Message.size();
+	Connection.SendQueue.push_back(std::move(Message));
+	QueueFlush(Connection);
 }
 
 void FTCPClient::SetOnClientDisconnectedCallback(FOnClientDisconnectedCallback Callback)
@@ -52,53 +219,336 @@ void FTCPClient::SetOnBufferReceivedCallback(FOnBufferReceivedCallback Callback)
 
 void FTCPClient::OpenNewClientConnection()
 {
-	TCPsocket NewlyConnectedClientSocket = SDLNet_TCP_Accept(ServerSocket);
+	// accept every pending connection, the listen socket won't be reported again until a new one arrives
+	for (;;)
+	{
+		const FSocketHandle Socket = accept(ServerSocket, nullptr, nullptr);
+		if (Socket == InvalidSocket)
+		{
+			if (IsInterrupted())
+			{
+				continue;
+			}
+			return;
+		}
 
-	SDLNet_TCP_AddSocket(SocketSet, NewlyConnectedClientSocket);
-	ClientsSockets.push_back(NewlyConnectedClientSocket);
+		if (Connections.size() >= MaxConnections)
+		{
+			FDebugLog::LogWarning(L"TCPClient: Refusing client, %d clients connected", static_cast<int>(Connections.size()));
+			CloseSocket(Socket);
+			continue;
+		}
+
+		if (!SetNonBlocking(Socket))
+		{
+			CloseSocket(Socket);
+			continue;
+		}
+
+		int NoDelay = 1;
+		setsockopt(Socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&NoDelay), sizeof(NoDelay));
+
+		std::unique_ptr<FConnection> Connection(new FConnection());
+		Connection->Socket = Socket;
+		Connection->ReceiveBuffer.resize(ReceiveBufferSize);
+
+		void* Client = Connection.get();
+		Connections.emplace(Client, std::move(Connection));
+		AddToPoller(Socket, Client);
+	}
 }
 
-void FTCPClient::CloseClientConnection(TCPsocket Socket)
+void FTCPClient::CloseClientConnection(void* Client)
 {
-	OnClientDisconnectedCallback(Socket);
+	auto Itr = Connections.find(Client);
+	if (Itr == Connections.end() || Itr->second->bIsClosing)
+	{
+		return;
+	}
 
-	ClientsSockets.erase(std::find(ClientsSockets.begin(), ClientsSockets.end(), Socket));
-	SDLNet_TCP_DelSocket(SocketSet, Socket);
+	// the connection is released after the Update, as it may still be in use further up the stack
+	FConnection& Connection = *Itr->second;
+	Connection.bIsClosing = true;
+	Connection.CloseTime = std::chrono::steady_clock::now();
+	ClosingConnections.push_back(&Connection);
 
-	SDLNet_TCP_Close(Socket);
+	if (OnClientDisconnectedCallback)
+	{
+		OnClientDisconnectedCallback(Client);
+	}
 }
 
-void FTCPClient::CloseServerConnection() const
+bool FTCPClient::IsClientConnected(void* Client) const
 {
-	if (ServerSocket)
+	auto Itr = Connections.find(Client);
+	return Itr != Connections.end() && !Itr->second->bIsClosing;
+}
+
+void FTCPClient::CloseServerConnection()
+{
+	if (ServerSocket != InvalidSocket)
 	{
-		SDLNet_TCP_DelSocket(SocketSet, ServerSocket);
-		SDLNet_TCP_Close(ServerSocket);
+		RemoveFromPoller(ServerSocket);
+		CloseSocket(ServerSocket);
+		ServerSocket = InvalidSocket;
 	}
 }
 
-void FTCPClient::Update()
+void FTCPClient::ReceiveFromConnection(FConnection& Connection)
+{
+	while (!Connection.bIsClosing)
+	{
+		const int BytesReceived = recv(Connection.Socket, Connection.ReceiveBuffer.data(), static_cast<int>(Connection.ReceiveBuffer.size()), 0);
+		if (BytesReceived > 0)
+		{
+			OnBufferReceivedCallback(&Connection, Connection.ReceiveBuffer.data(), BytesReceived);
+		}
+		else if (BytesReceived < 0 && IsInterrupted())
+		{
+			continue;
+		}
+		else if (BytesReceived < 0 && IsWouldBlock())
+		{
+			return;
+		}
+		else
+		{
+			// closed by the client, or failed
+			CloseClientConnection(&Connection);
+		}
+	}
+}
+
+bool FTCPClient::FlushConnection(FConnection& Connection)
+{
+	while (!Connection.SendQueue.empty())
+	{
+		// gather as many queued messages as one call takes, the first one may have been partly sent already
+		FSendBuffer Buffers[MaxBuffersPerSend];
+		size_t NumBuffers = 0;
+		for (auto Itr = Connection.SendQueue.begin(); Itr != Connection.SendQueue.end() && NumBuffers < MaxBuffersPerSend; ++Itr)
+		{
+			const size_t Offset = NumBuffers == 0 ? Connection.SendOffset : 0;
+			SetSendBuffer(Buffers[NumBuffers++], Itr->data() + Offset, Itr->size() - Offset);
+		}
+
+		const int64_t BytesSent = SendBuffers(Connection.Socket, Buffers, NumBuffers);
+		++SendStats.SendCalls;
+		if (BytesSent > 0)
+		{
+			SendStats.BytesSent += static_cast<uint64_t>(BytesSent);
+			Connection.QueuedBytes -= static_cast<size_t>(BytesSent);
+
+			size_t Remaining = static_cast<size_t>(BytesSent);
+			while (Remaining > 0)
+			{
+				const size_t FrontRemaining = Connection.SendQueue.front().size() - Connection.SendOffset;
+				if (Remaining < FrontRemaining)
+				{
+					Connection.SendOffset += Remaining;
+					break;
+				}
+
+				Remaining -= FrontRemaining;
+				Connection.SendQueue.pop_front();
+				Connection.SendOffset = 0;
+				++SendStats.MessagesSent;
+			}
+		}
+		else if (BytesSent < 0 && IsInterrupted())
+		{
+			continue;
+		}
+		else if (BytesSent < 0 && IsWouldBlock())
+		{
+			Connection.bIsWritable = false;
+			return true;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FTCPClient::QueueFlush(FConnection& Connection)
 {
-	SDLNet_CheckSockets(SocketSet, 0);
+	if (!Connection.bIsFlushPending && Connection.bIsWritable && !Connection.SendQueue.empty())
+	{
+		Connection.bIsFlushPending = true;
+		PendingFlushConnections.push_back(&Connection);
+	}
+}
 
-	for (TCPsocket ClientSocket : ClientsSockets)
+void FTCPClient::FlushPendingConnections()
+{
+	// closing connections may be flushed too, they're only released after this
+	for (size_t Index = 0; Index < PendingFlushConnections.size(); ++Index)
 	{
-		if (SDLNet_SocketReady(ClientSocket))
+		FConnection& Connection = *PendingFlushConnections[Index];
+		Connection.bIsFlushPending = false;
+		if (!Connection.bIsClosing && !FlushConnection(Connection))
 		{
-			const int ReceivedBufferLength = SDLNet_TCP_Recv(ClientSocket, &Buffer[0], static_cast<int>(Buffer.size()));
-			if (ReceivedBufferLength > 0)
+			CloseClientConnection(&Connection);
+		}
+	}
+	PendingFlushConnections.clear();
+}
+
+void FTCPClient::ReleaseClosedConnections()
+{
+	const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+	erase_if(ClosingConnections, [this, Now](FConnection* Connection)
+	{
+		// keep closed connections around while they're still sending, e.g. a kick message followed by the close
+		if (!Connection->SendQueue.empty() && Now - Connection->CloseTime < CloseTimeout)
+		{
+			if (FlushConnection(*Connection) && !Connection->SendQueue.empty())
 			{
-				OnBufferReceivedCallback(ClientSocket, &Buffer[0], static_cast<size_t>(ReceivedBufferLength));
+				return false;
 			}
-			else
+		}
+
+		DestroyConnection(Connection);
+		return true;
+	});
+}
+
+void FTCPClient::DestroyConnection(FConnection* Connection)
+{
+	RemoveFromPoller(Connection->Socket);
+	CloseSocket(Connection->Socket);
+	Connections.erase(Connection);
+}
+
+#ifdef __linux__
+
+void FTCPClient::AddToPoller(FSocketHandle Socket, void* Key)
+{
+	epoll_event Event = {};
+	Event.events = Key != nullptr ? (EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET) : (EPOLLIN | EPOLLET);
+	Event.data.ptr = Key;
+	if (epoll_ctl(EpollFd, EPOLL_CTL_ADD, Socket, &Event) != 0)
+	{
+		FDebugLog::LogError(L"TCPClient: Unable to watch socket (%d)", errno);
+	}
+}
+
+void FTCPClient::RemoveFromPoller(FSocketHandle Socket)
+{
+	epoll_ctl(EpollFd, EPOLL_CTL_DEL, Socket, nullptr);
+}
+
+void FTCPClient::Update()
+{
+	if (ServerSocket == InvalidSocket)
+	{
+		return;
+	}
+
+	SendStats = FSendStats();
+
+	epoll_event Events[MaxEventsPerUpdate];
+	const int NumEvents = epoll_wait(EpollFd, Events, MaxEventsPerUpdate, 0);
+	for (int EventIndex = 0; EventIndex < NumEvents; ++EventIndex)
+	{
+		const epoll_event& Event = Events[EventIndex];
+		if (Event.data.ptr == nullptr)
+		{
+			OpenNewClientConnection();
+			continue;
+		}
+
+		// connections closed earlier in this Update are still alive, but are done receiving
+		FConnection& Connection = *static_cast<FConnection*>(Event.data.ptr);
+		if (Event.events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+		{
+			ReceiveFromConnection(Connection);
+		}
+		if (Event.events & EPOLLOUT)
+		{
+			Connection.bIsWritable = true;
+			QueueFlush(Connection);
+		}
+	}
+
+	FlushPendingConnections();
+	ReleaseClosedConnections();
+}
+
+#else
+
+void FTCPClient::AddToPoller(FSocketHandle Socket, void* Key)
+{
+	// poll takes the whole socket list every Update
+}
+
+void FTCPClient::RemoveFromPoller(FSocketHandle Socket)
+{
+}
+
+void FTCPClient::Update()
+{
+	if (ServerSocket == InvalidSocket)
+	{
+		return;
+	}
+
+	SendStats = FSendStats();
+
+	std::vector<FPollFd> PollFds;
+	std::vector<FConnection*> PolledConnections;
+	PollFds.reserve(Connections.size() + 1);
+	PolledConnections.reserve(Connections.size());
+
+	FPollFd ServerPollFd = {};
+	ServerPollFd.fd = ServerSocket;
+	ServerPollFd.events = POLLIN;
+	PollFds.push_back(ServerPollFd);
+
+	for (const auto& Connection : Connections)
+	{
+		if (!Connection.second->bIsClosing)
+		{
+			FPollFd PollFd = {};
+			PollFd.fd = Connection.second->Socket;
+			PollFd.events = POLLIN;
+			if (!Connection.second->bIsWritable)
 			{
-				CloseClientConnection(ClientSocket);
+				PollFd.events |= POLLOUT;
 			}
+			PollFds.push_back(PollFd);
+			PolledConnections.push_back(Connection.second.get());
 		}
 	}
-	if (SDLNet_SocketReady(ServerSocket))
+
+	if (PollSockets(PollFds.data(), PollFds.size(), 0) > 0)
 	{
-		OpenNewClientConnection();
+		for (size_t Index = 0; Index < PolledConnections.size(); ++Index)
+		{
+			const short Events = PollFds[Index + 1].revents;
+			FConnection& Connection = *PolledConnections[Index];
+			if (Events & (POLLIN | POLLHUP | POLLERR))
+			{
+				ReceiveFromConnection(Connection);
+			}
+			if (Events & POLLOUT)
+			{
+				Connection.bIsWritable = true;
+				QueueFlush(Connection);
+			}
+		}
+
+		if (PollFds[0].revents & POLLIN)
+		{
+			OpenNewClientConnection();
+		}
 	}
-	
+
+	FlushPendingConnections();
+	ReleaseClosedConnections();
 }
+
+#endif // __linux__
@@ -2,12 +2,27 @@
 
 #pragma once
 
-#define WITHOUT_SDL
-#include "SDL_net.h"
-
-#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
+#ifdef _WIN32
+#include <winsock2.h>
+using FSocketHandle = SOCKET;
+#else
+using FSocketHandle = int;
+#endif
+
+/** Non-blocking TCP server socket and its client connections.
+  * Sockets are watched with edge-triggered epoll on Linux, and with poll (WSAPoll on Windows) elsewhere, so an Update only
+  * touches the connections that have something to do. Each connection reads into its own receive buffer and queues the messages
+  * sent to it, which are written with one vectored send per connection at the end of each Update.
+  * Clients are identified by an opaque handle that stays valid until they're disconnected.
+  */
 class FTCPClient final
 {
 public:
@@ -18,6 +33,8 @@ public:
 
 	/**
 	 * Constructor
+	 * @param MaxSockets Most clients connected at once, further connections are refused
+	 * @param MaxBufferSizeBytes Size of each connection's receive buffer
 	 */
 	FTCPClient(int MaxSockets, size_t MaxBufferSizeBytes);
 
@@ -33,7 +50,9 @@ public:
 	virtual ~FTCPClient();
 
 	void Open(uint16_t Port);
-	void Send(void* To, const void* Data, size_t Length);
+
+	/** Queues a message for the client, it's sent with the rest of the client's messages by the next Update */
+	void Send(void* To, std::vector<char> Message);
 
 	using FOnBufferReceivedCallback = std::function<void(void*, char*, int)>;
 	void SetOnBufferReceivedCallback(FOnBufferReceivedCallback Callback);
@@ -43,22 +62,88 @@ public:
 
 	void Update();
 
+	/** What the sends of an Update took */
+	struct FSendStats
+	{
+		uint64_t BytesSent = 0;
+		uint32_t MessagesSent = 0;
+		uint32_t SendCalls = 0;
+	};
+
+	/** Send stats of the last Update */
+	const FSendStats& GetSendStats() const { return SendStats; }
+
+	/** Whether the client is connected and hasn't been closed */
+	bool IsClientConnected(void* Client) const;
+
 private:
+	struct FConnection
+	{
+		FSocketHandle Socket;
+
+		/** Data read from the socket is received here before it's passed on */
+		std::vector<char> ReceiveBuffer;
+
+		/** Messages that weren't sent yet, the first one from SendQueue.front()[SendOffset] on */
+		std::deque<std::vector<char>> SendQueue;
+		size_t SendOffset = 0;
+		size_t QueuedBytes = 0;
+
+		/** Cleared when the socket would block, and set again once it reports it's writable */
+		bool bIsWritable = true;
+
+		/** Whether the connection is in the list of connections to flush */
+		bool bIsFlushPending = false;
+
+		/** Closed connections don't receive anymore, their socket is closed once the queued data is sent */
+		bool bIsClosing = false;
+		std::chrono::steady_clock::time_point CloseTime;
+	};
+
 	friend class FAntiCheatNetworkTransport;
 	void OpenNewClientConnection();
-	void CloseClientConnection(TCPsocket ClientSocket);
+	void CloseClientConnection(void* Client);
+
+	void CloseServerConnection();
+
+	/** Reads until the socket would block, as edge-triggered notifications only arrive for new data */
+	void ReceiveFromConnection(FConnection& Connection);
+
+	/** Writes queued messages until the socket would block, returns false if the connection failed */
+	bool FlushConnection(FConnection& Connection);
+
+	/** Adds a writable connection with queued messages to the list flushed by FlushPendingConnections */
+	void QueueFlush(FConnection& Connection);
+
+	/** Flushes the connections that were sent messages or became writable since the last Update */
+	void FlushPendingConnections();
 
-	void CloseServerConnection() const;
+	/** Closes the sockets of closed connections once they're done sending, after the Update has stopped using them */
+	void ReleaseClosedConnections();
+
+	void DestroyConnection(FConnection* Connection);
+
+	/** Watches a socket for readability (and writability, in the poll fallback while data is queued) */
+	void AddToPoller(FSocketHandle Socket, void* Key);
+	void RemoveFromPoller(FSocketHandle Socket);
 
 private:
-	TCPsocket ServerSocket = nullptr;
-	std::vector<TCPsocket> ClientsSockets;
+	FSocketHandle ServerSocket;
+
+	/** Client handles are the addresses of their connection */
+	std::unordered_map<void*, std::unique_ptr<FConnection>> Connections;
+	std::vector<FConnection*> ClosingConnections;
+	std::vector<FConnection*> PendingFlushConnections;
 
-	SDLNet_SocketSet SocketSet;
+	FSendStats SendStats;
 
-	std::vector<char> Buffer;
+	size_t MaxConnections;
+	size_t ReceiveBufferSize;
+
+#ifdef __linux__
+	int EpollFd = -1;
+#endif
 
 	FOnBufferReceivedCallback OnBufferReceivedCallback;
 	FOnClientDisconnectedCallback OnClientDisconnectedCallback;
 };
-
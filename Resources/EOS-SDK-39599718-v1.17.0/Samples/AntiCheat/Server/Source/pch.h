@@ -11,6 +11,7 @@
 #include <fstream>
 #include <cassert>
 #include <future>
+#include <thread>
 #include <iterator>
 #include <queue>
 #include <unordered_set>
@@ -0,0 +1,203 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "LoopbackP2PInterface.h"
+#include "P2PMessenger.h"
+#include "P2PPacketDispatcher.h"
+
+#include <cstdio>
+#include <string>
+
+/** Offline benchmark of the P2P messaging layer. Two users exchange messages through FLoopbackP2PInterface, once for each
+  * channel setup, and the throughput, packets per message and latency from SendMessage to the receiving callback are reported.
+  *
+  * Usage: P2PNATLoopbackBenchmark -messages 64 -size 32 -ticks 2000 -latencyus 0 -loss 0
+  */
+namespace
+{
+	struct FBenchmarkOptions
+	{
+		/** Messages sent every tick */
+		size_t MessagesPerTick = 64;
+
+		/** Size of each message, at least the timestamp and sequence number it carries */
+		size_t MessageSize = 32;
+
+		size_t NumTicks = 2000;
+		std::chrono::microseconds Latency{ 0 };
+		float UnreliableLossRate = 0.f;
+	};
+
+	struct FScenario
+	{
+		const char* Name;
+		FP2PMessenger::FChannelSettings Settings;
+	};
+
+	/** What a message starts with, the rest is filler */
+	struct FMessageHeader
+	{
+		int64_t SendTimeUs;
+		uint32_t Sequence;
+	};
+
+	/** Socket name, dispatcher and messenger of one user, wired up the way FP2PNAT does it */
+	struct FEndpoint
+	{
+		FEndpoint(IP2PInterface& P2P, FProductUserId InUserId)
+			: UserId(InUserId)
+			, Messenger(P2P, "BENCH")
+		{
+		}
+
+		void ConfigureChannel(uint8_t Channel, const FP2PMessenger::FChannelSettings& Settings, FP2PMessenger::FOnMessageReceived OnMessageReceived)
+		{
+			Messenger.ConfigureChannel(Channel, Settings, std::move(OnMessageReceived));
+			Dispatcher.RegisterPacketHandler(Messenger.GetSocketName(), Channel, [this](FProductUserId PeerId, uint8_t PacketChannel, const char* Data, uint32_t DataLengthBytes)
+			{
+				Messenger.ReceivePacket(PeerId, PacketChannel, Data, DataLengthBytes);
+			});
+		}
+
+		FProductUserId UserId;
+		FP2PPacketDispatcher Dispatcher;
+		FP2PMessenger Messenger;
+	};
+
+	int64_t NowUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	int64_t Percentile(std::vector<int64_t>& Values, double Fraction)
+	{
+		if (Values.empty())
+		{
+			return 0;
+		}
+		const size_t Index = std::min(Values.size() - 1, static_cast<size_t>(Fraction * Values.size()));
+		std::nth_element(Values.begin(), Values.begin() + Index, Values.end());
+		return Values[Index];
+	}
+
+	const char* GetParam(int argc, const char* argv[], const char* Name)
+	{
+		for (int i = 1; i + 1 < argc; ++i)
+		{
+			if (argv[i][0] == '-' && strcmp(argv[i] + 1, Name) == 0)
+			{
+				return argv[i + 1];
+			}
+		}
+		return nullptr;
+	}
+
+	size_t GetSizeParam(int argc, const char* argv[], const char* Name, size_t Default)
+	{
+		const char* Value = GetParam(argc, argv, Name);
+		return Value != nullptr ? static_cast<size_t>(strtoull(Value, nullptr, 10)) : Default;
+	}
+
+	void RunScenario(const FBenchmarkOptions& Options, const FScenario& Scenario)
+	{
+		constexpr uint8_t Channel = 1;
+
+		FLoopbackP2PInterface P2P(Options.Latency, Options.UnreliableLossRate);
+		FEndpoint Sender(P2P, FProductUserId(reinterpret_cast<EOS_ProductUserId>(static_cast<uintptr_t>(1))));
+		FEndpoint Receiver(P2P, FProductUserId(reinterpret_cast<EOS_ProductUserId>(static_cast<uintptr_t>(2))));
+
+		std::vector<int64_t> Latencies;
+		Latencies.reserve(Options.MessagesPerTick * Options.NumTicks);
+		uint32_t NextExpectedSequence = 0;
+		uint64_t OutOfOrder = 0;
+
+		Sender.ConfigureChannel(Channel, Scenario.Settings, nullptr);
+		Receiver.ConfigureChannel(Channel, Scenario.Settings, [&](FProductUserId, uint8_t, const char* Data, uint16_t)
+		{
+			FMessageHeader Header;
+			memcpy(&Header, Data, sizeof(Header));
+			Latencies.push_back(NowUs() - Header.SendTimeUs);
+			if (Header.Sequence < NextExpectedSequence)
+			{
+				++OutOfOrder;
+			}
+			NextExpectedSequence = std::max(NextExpectedSequence, Header.Sequence + 1);
+		});
+
+		std::vector<char> Message(std::max(Options.MessageSize, sizeof(FMessageHeader)));
+		const uint64_t MessagesToSend = static_cast<uint64_t>(Options.MessagesPerTick) * Options.NumTicks;
+		uint32_t Sequence = 0;
+
+		const int64_t StartUs = NowUs();
+		for (size_t Tick = 0; Tick < Options.NumTicks; ++Tick)
+		{
+			for (size_t Index = 0; Index < Options.MessagesPerTick; ++Index)
+			{
+				FMessageHeader Header = { NowUs(), Sequence++ };
+				memcpy(Message.data(), &Header, sizeof(Header));
+				Sender.Messenger.SendMessage(Receiver.UserId, Channel, Message.data(), static_cast<uint16_t>(Message.size()));
+			}
+			Sender.Messenger.Flush(Sender.UserId);
+			Receiver.Dispatcher.ReceivePackets(P2P, Receiver.UserId);
+		}
+
+		// wait out the simulated latency for the packets still in flight
+		while (P2P.GetNumPacketsInFlight() > 0)
+		{
+			Receiver.Dispatcher.ReceivePackets(P2P, Receiver.UserId);
+		}
+		const double ElapsedSeconds = (NowUs() - StartUs) / 1000000.0;
+
+		const FP2PMessenger::FStats& SenderStats = Sender.Messenger.GetStats();
+		const uint64_t MessagesReceived = Latencies.size();
+		printf("%-28s %10.0f msg/s %8.2f MB/s %7.2f msg/packet %6.2f%% lost %8llu out of order   latency us p50 %6lld p99 %6lld max %6lld\n",
+			Scenario.Name,
+			MessagesReceived / ElapsedSeconds,
+			SenderStats.BytesSent / ElapsedSeconds / (1024.0 * 1024.0),
+			SenderStats.PacketsSent > 0 ? static_cast<double>(SenderStats.MessagesSent) / SenderStats.PacketsSent : 0.0,
+			MessagesToSend > 0 ? 100.0 * (MessagesToSend - MessagesReceived) / MessagesToSend : 0.0,
+			static_cast<unsigned long long>(OutOfOrder),
+			static_cast<long long>(Percentile(Latencies, 0.5)),
+			static_cast<long long>(Percentile(Latencies, 0.99)),
+			static_cast<long long>(Percentile(Latencies, 1.0)));
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	FBenchmarkOptions Options;
+	Options.MessagesPerTick = std::max<size_t>(1, GetSizeParam(argc, argv, "messages", Options.MessagesPerTick));
+	Options.MessageSize = std::min<size_t>(FP2PMessenger::MaxMessageSize, GetSizeParam(argc, argv, "size", Options.MessageSize));
+	Options.NumTicks = GetSizeParam(argc, argv, "ticks", Options.NumTicks);
+	Options.Latency = std::chrono::microseconds(GetSizeParam(argc, argv, "latencyus", Options.Latency.count()));
+	if (const char* Loss = GetParam(argc, argv, "loss"))
+	{
+		Options.UnreliableLossRate = static_cast<float>(atof(Loss));
+	}
+
+	printf("%d messages of %d bytes per tick for %d ticks, latency %dus, unreliable loss %.1f%%\n\n",
+		static_cast<int>(Options.MessagesPerTick),
+		static_cast<int>(std::max(Options.MessageSize, sizeof(FMessageHeader))),
+		static_cast<int>(Options.NumTicks),
+		static_cast<int>(Options.Latency.count()),
+		Options.UnreliableLossRate * 100.f);
+
+	FScenario Scenarios[3];
+	Scenarios[0].Name = "reliable, one per packet";
+	Scenarios[0].Settings.Reliability = EOS_EPacketReliability::EOS_PR_ReliableOrdered;
+	Scenarios[0].Settings.bCoalesce = false;
+	Scenarios[1].Name = "reliable, coalesced";
+	Scenarios[1].Settings.Reliability = EOS_EPacketReliability::EOS_PR_ReliableOrdered;
+	Scenarios[1].Settings.bCoalesce = true;
+	Scenarios[2].Name = "unreliable, coalesced";
+	Scenarios[2].Settings.Reliability = EOS_EPacketReliability::EOS_PR_UnreliableUnordered;
+	Scenarios[2].Settings.bCoalesce = true;
+
+	for (const FScenario& Scenario : Scenarios)
+	{
+		RunScenario(Options, Scenario);
+	}
+
+	return 0;
+}
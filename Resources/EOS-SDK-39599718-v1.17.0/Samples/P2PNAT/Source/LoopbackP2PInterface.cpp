@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+#include "LoopbackP2PInterface.h"
+
+FLoopbackP2PInterface::FLoopbackP2PInterface(std::chrono::microseconds InLatency, float InUnreliableLossRate)
+	: Latency(InLatency)
+	, UnreliableLossRate(InUnreliableLossRate)
+{
+
+}
+
+EOS_EResult FLoopbackP2PInterface::SendPacket(const EOS_P2P_SendPacketOptions& Options)
+{
+	if (Options.LocalUserId == nullptr || Options.RemoteUserId == nullptr || Options.SocketId == nullptr ||
+		Options.Data == nullptr || Options.DataLengthBytes == 0 || Options.DataLengthBytes > EOS_P2P_MAX_PACKET_SIZE)
+	{
+		return EOS_EResult::EOS_InvalidParameters;
+	}
+
+	++Stats.PacketsSent;
+	Stats.BytesSent += Options.DataLengthBytes;
+
+	if (Options.Reliability == EOS_EPacketReliability::EOS_PR_UnreliableUnordered && UnreliableLossRate > 0.f &&
+		std::uniform_real_distribution<float>(0.f, 1.f)(Random) < UnreliableLossRate)
+	{
+		++Stats.PacketsDropped;
+		return EOS_EResult::EOS_Success;
+	}
+
+	FPacket Packet;
+	Packet.PeerId = Options.LocalUserId;
+	Packet.SocketId = *Options.SocketId;
+	Packet.Channel = Options.Channel;
+	if (!FreeBuffers.empty())
+	{
+		Packet.Data = std::move(FreeBuffers.back());
+		FreeBuffers.pop_back();
+	}
+	const char* Data = static_cast<const char*>(Options.Data);
+	Packet.Data.assign(Data, Data + Options.DataLengthBytes);
+	Packet.DeliveryTime = std::chrono::steady_clock::now() + Latency;
+
+	PacketQueues[Options.RemoteUserId].push_back(std::move(Packet));
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_EResult FLoopbackP2PInterface::ReceivePacket(const EOS_P2P_ReceivePacketOptions& Options, EOS_ProductUserId* OutPeerId, EOS_P2P_SocketId* OutSocketId, uint8_t* OutChannel, void* OutData, uint32_t* OutBytesWritten)
+{
+	if (Options.LocalUserId == nullptr || OutPeerId == nullptr || OutSocketId == nullptr || OutChannel == nullptr || OutData == nullptr || OutBytesWritten == nullptr)
+	{
+		return EOS_EResult::EOS_InvalidParameters;
+	}
+
+	auto QueueItr = PacketQueues.find(Options.LocalUserId);
+	if (QueueItr == PacketQueues.end())
+	{
+		return EOS_EResult::EOS_NotFound;
+	}
+
+	// the first packet that has arrived, on the requested channel if there is one
+	std::deque<FPacket>& Queue = QueueItr->second;
+	const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+	auto PacketItr = Queue.begin();
+	for (; PacketItr != Queue.end() && PacketItr->DeliveryTime <= Now; ++PacketItr)
+	{
+		if (Options.RequestedChannel == nullptr || *Options.RequestedChannel == PacketItr->Channel)
+		{
+			break;
+		}
+	}
+	if (PacketItr == Queue.end() || PacketItr->DeliveryTime > Now)
+	{
+		return EOS_EResult::EOS_NotFound;
+	}
+
+	// like EOS, data that doesn't fit is truncated
+	const uint32_t BytesWritten = std::min(static_cast<uint32_t>(PacketItr->Data.size()), Options.MaxDataSizeBytes);
+	memcpy(OutData, PacketItr->Data.data(), BytesWritten);
+	*OutBytesWritten = BytesWritten;
+	*OutPeerId = PacketItr->PeerId;
+	*OutSocketId = PacketItr->SocketId;
+	*OutChannel = PacketItr->Channel;
+
+	FreeBuffers.push_back(std::move(PacketItr->Data));
+	Queue.erase(PacketItr);
+	return EOS_EResult::EOS_Success;
+}
+
+size_t FLoopbackP2PInterface::GetNumPacketsInFlight() const
+{
+	size_t NumPackets = 0;
+	for (const auto& Queue : PacketQueues)
+	{
+		NumPackets += Queue.second.size();
+	}
+	return NumPackets;
+}
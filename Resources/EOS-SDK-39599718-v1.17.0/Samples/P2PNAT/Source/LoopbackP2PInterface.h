@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "P2PInterface.h"
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <random>
+#include <vector>
+
+/**
+* In-memory stand-in for EOS P2P, which delivers the packets sent to a user to the ReceivePacket calls made for that user.
+* Lets the messaging layer be run and benchmarked offline, with a simulated latency and loss of unreliable packets.
+*/
+class FLoopbackP2PInterface : public IP2PInterface
+{
+public:
+	/**
+	* Constructor
+	* @param Latency - how long a sent packet takes until it can be received
+	* @param UnreliableLossRate - share of the unreliable packets that are dropped, from 0 to 1
+	*/
+	FLoopbackP2PInterface(std::chrono::microseconds Latency = std::chrono::microseconds(0), float UnreliableLossRate = 0.f);
+
+	EOS_EResult SendPacket(const EOS_P2P_SendPacketOptions& Options) override;
+	EOS_EResult ReceivePacket(const EOS_P2P_ReceivePacketOptions& Options, EOS_ProductUserId* OutPeerId, EOS_P2P_SocketId* OutSocketId, uint8_t* OutChannel, void* OutData, uint32_t* OutBytesWritten) override;
+
+	struct FStats
+	{
+		uint64_t PacketsSent = 0;
+		uint64_t PacketsDropped = 0;
+		uint64_t BytesSent = 0;
+	};
+
+	const FStats& GetStats() const { return Stats; }
+
+	/** Packets sent that haven't been received yet */
+	size_t GetNumPacketsInFlight() const;
+
+private:
+	struct FPacket
+	{
+		EOS_ProductUserId PeerId;
+		EOS_P2P_SocketId SocketId;
+		uint8_t Channel;
+		std::vector<char> Data;
+		std::chrono::steady_clock::time_point DeliveryTime;
+	};
+
+	std::chrono::microseconds Latency;
+	float UnreliableLossRate;
+	std::mt19937 Random;
+
+	/** Packets in flight, by receiving user. All have the same latency, so they become receivable in order. */
+	std::map<EOS_ProductUserId, std::deque<FPacket>> PacketQueues;
+
+	/** Data buffers of received packets, reused by the packets sent after them */
+	std::vector<std::vector<char>> FreeBuffers;
+
+	FStats Stats;
+};
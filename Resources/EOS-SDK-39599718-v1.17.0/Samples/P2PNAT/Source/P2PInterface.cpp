@@ -0,0 +1,17 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+#include "Platform.h"
+#include "P2PInterface.h"
+
+EOS_EResult FEOSP2PInterface::SendPacket(const EOS_P2P_SendPacketOptions& Options)
+{
+	EOS_HP2P P2PHandle = EOS_Platform_GetP2PInterface(FPlatform::GetPlatformHandle());
+	return EOS_P2P_SendPacket(P2PHandle, &Options);
+}
+
+EOS_EResult FEOSP2PInterface::ReceivePacket(const EOS_P2P_ReceivePacketOptions& Options, EOS_ProductUserId* OutPeerId, EOS_P2P_SocketId* OutSocketId, uint8_t* OutChannel, void* OutData, uint32_t* OutBytesWritten)
+{
+	EOS_HP2P P2PHandle = EOS_Platform_GetP2PInterface(FPlatform::GetPlatformHandle());
+	return EOS_P2P_ReceivePacket(P2PHandle, &Options, OutPeerId, OutSocketId, OutChannel, OutData, OutBytesWritten);
+}
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <eos_sdk.h>
+#include <eos_p2p.h>
+
+/**
+* The EOS P2P calls made by the P2P messaging layer, so it can run over EOS P2P or over FLoopbackP2PInterface.
+*/
+class IP2PInterface
+{
+public:
+	virtual ~IP2PInterface() {}
+
+	/** Same as EOS_P2P_SendPacket */
+	virtual EOS_EResult SendPacket(const EOS_P2P_SendPacketOptions& Options) = 0;
+
+	/** Same as EOS_P2P_ReceivePacket */
+	virtual EOS_EResult ReceivePacket(const EOS_P2P_ReceivePacketOptions& Options, EOS_ProductUserId* OutPeerId, EOS_P2P_SocketId* OutSocketId, uint8_t* OutChannel, void* OutData, uint32_t* OutBytesWritten) = 0;
+};
+
+/**
+* Passes the calls on to the P2P interface of the EOS platform.
+*/
+class FEOSP2PInterface : public IP2PInterface
+{
+public:
+	EOS_EResult SendPacket(const EOS_P2P_SendPacketOptions& Options) override;
+	EOS_EResult ReceivePacket(const EOS_P2P_ReceivePacketOptions& Options, EOS_ProductUserId* OutPeerId, EOS_P2P_SocketId* OutSocketId, uint8_t* OutChannel, void* OutData, uint32_t* OutBytesWritten) override;
+};
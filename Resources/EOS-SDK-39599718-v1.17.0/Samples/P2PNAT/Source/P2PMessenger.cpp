@@ -0,0 +1,177 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+#include "P2PMessenger.h"
+
+#if !defined(_WIN32)
+#define strncpy_s strncpy
+#endif
+
+constexpr uint32_t FP2PMessenger::MessageHeaderSize;
+constexpr uint32_t FP2PMessenger::MaxMessageSize;
+
+FP2PMessenger::FP2PMessenger(IP2PInterface& InP2P, const char* SocketName)
+	: P2P(InP2P)
+	, SocketId()
+{
+	SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
+	strncpy_s(SocketId.SocketName, SocketName, EOS_P2P_SOCKETID_SOCKETNAME_SIZE - 1);
+}
+
+void FP2PMessenger::ConfigureChannel(uint8_t Channel, const FChannelSettings& Settings, FOnMessageReceived OnMessageReceived)
+{
+	Channels[Channel].Settings = Settings;
+	Channels[Channel].OnMessageReceived = std::move(OnMessageReceived);
+	Channels[Channel].bIsConfigured = true;
+}
+
+bool FP2PMessenger::IsChannelConfigured(uint8_t Channel) const
+{
+	return Channels[Channel].bIsConfigured;
+}
+
+EOS_EResult FP2PMessenger::SendMessage(FProductUserId PeerId, uint8_t Channel, const void* Data, uint16_t DataLengthBytes)
+{
+	if (!Channels[Channel].bIsConfigured || Data == nullptr || DataLengthBytes == 0 || DataLengthBytes > MaxMessageSize)
+	{
+		return EOS_EResult::EOS_InvalidParameters;
+	}
+
+	FPendingPacket* Packet = nullptr;
+	if (Channels[Channel].Settings.bCoalesce)
+	{
+		// add to the peer's open packet on the channel, or start a new one once it's full
+		const std::pair<EOS_ProductUserId, uint8_t> Key(PeerId.AccountId, Channel);
+		auto Itr = OpenPackets.find(Key);
+		if (Itr != OpenPackets.end() && PendingPackets[Itr->second].Data.size() + MessageHeaderSize + DataLengthBytes <= EOS_P2P_MAX_PACKET_SIZE)
+		{
+			Packet = &PendingPackets[Itr->second];
+		}
+		else
+		{
+			Packet = &AddPendingPacket(PeerId, Channel);
+			OpenPackets[Key] = PendingPackets.size() - 1;
+		}
+	}
+	else
+	{
+		Packet = &AddPendingPacket(PeerId, Channel);
+	}
+
+	const size_t Position = Packet->Data.size();
+	Packet->Data.resize(Position + MessageHeaderSize + DataLengthBytes);
+	memcpy(&Packet->Data[Position], &DataLengthBytes, MessageHeaderSize);
+	memcpy(&Packet->Data[Position + MessageHeaderSize], Data, DataLengthBytes);
+
+	++Stats.MessagesSent;
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_EResult FP2PMessenger::Flush(FProductUserId LocalUserId)
+{
+	EOS_EResult FirstError = EOS_EResult::EOS_Success;
+
+	EOS_P2P_SendPacketOptions Options = {};
+	Options.ApiVersion = EOS_P2P_SENDPACKET_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.SocketId = &SocketId;
+	Options.bAllowDelayedDelivery = EOS_TRUE;
+	Options.bDisableAutoAcceptConnection = EOS_FALSE;
+
+	for (FPendingPacket& Packet : PendingPackets)
+	{
+		Options.RemoteUserId = Packet.PeerId;
+		Options.Channel = Packet.Channel;
+		Options.Reliability = Channels[Packet.Channel].Settings.Reliability;
+		Options.DataLengthBytes = static_cast<uint32_t>(Packet.Data.size());
+		Options.Data = Packet.Data.data();
+
+		EOS_EResult Result = P2P.SendPacket(Options);
+		if (Result == EOS_EResult::EOS_Success)
+		{
+			++Stats.PacketsSent;
+			Stats.BytesSent += Packet.Data.size();
+		}
+		else
+		{
+			++Stats.PacketsDropped;
+			if (FirstError == EOS_EResult::EOS_Success)
+			{
+				FirstError = Result;
+			}
+		}
+	}
+
+	ClearQueuedMessages();
+	return FirstError;
+}
+
+void FP2PMessenger::ClearQueuedMessages()
+{
+	for (FPendingPacket& Packet : PendingPackets)
+	{
+		Packet.Data.clear();
+		FreeBuffers.push_back(std::move(Packet.Data));
+	}
+	PendingPackets.clear();
+	OpenPackets.clear();
+}
+
+bool FP2PMessenger::ReceivePacket(FProductUserId PeerId, uint8_t Channel, const char* Data, uint32_t DataLengthBytes)
+{
+	const FChannel& ChannelInfo = Channels[Channel];
+	if (!ChannelInfo.bIsConfigured)
+	{
+		++Stats.MalformedPackets;
+		return false;
+	}
+
+	++Stats.PacketsReceived;
+
+	uint32_t Position = 0;
+	while (Position < DataLengthBytes)
+	{
+		uint16_t MessageLength = 0;
+		if (DataLengthBytes - Position < MessageHeaderSize)
+		{
+			++Stats.MalformedPackets;
+			return false;
+		}
+		memcpy(&MessageLength, Data + Position, MessageHeaderSize);
+		Position += MessageHeaderSize;
+
+		if (MessageLength == 0 || MessageLength > DataLengthBytes - Position)
+		{
+			++Stats.MalformedPackets;
+			return false;
+		}
+
+		++Stats.MessagesReceived;
+		if (ChannelInfo.OnMessageReceived)
+		{
+			ChannelInfo.OnMessageReceived(PeerId, Channel, Data + Position, MessageLength);
+		}
+		Position += MessageLength;
+	}
+
+	return true;
+}
+
+FP2PMessenger::FPendingPacket& FP2PMessenger::AddPendingPacket(FProductUserId PeerId, uint8_t Channel)
+{
+	FPendingPacket Packet;
+	Packet.PeerId = PeerId;
+	Packet.Channel = Channel;
+	if (!FreeBuffers.empty())
+	{
+		Packet.Data = std::move(FreeBuffers.back());
+		FreeBuffers.pop_back();
+	}
+	else
+	{
+		Packet.Data.reserve(EOS_P2P_MAX_PACKET_SIZE);
+	}
+
+	PendingPackets.push_back(std::move(Packet));
+	return PendingPackets.back();
+}
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "AccountHelpers.h"
+#include "P2PInterface.h"
+
+#include <array>
+#include <functional>
+#include <map>
+#include <vector>
+
+/**
+* Channelized messaging over one P2P socket. Each channel has its own reliability, and the messages sent on a coalescing
+* channel to the same peer are packed together into packets of up to EOS_P2P_MAX_PACKET_SIZE bytes, which are sent by Flush.
+* In a packet every message is prefixed with its uint16_t length.
+*/
+class FP2PMessenger
+{
+public:
+	/**
+	* Constructor
+	* @param P2P - interface the packets are sent through
+	* @param SocketName - name of the socket the packets are sent on
+	*/
+	FP2PMessenger(IP2PInterface& P2P, const char* SocketName);
+
+	/**
+	* No copying or copy assignment allowed for this class.
+	*/
+	FP2PMessenger(FP2PMessenger const&) = delete;
+	FP2PMessenger& operator=(FP2PMessenger const&) = delete;
+
+	/**
+	 * Called for each message received on a channel.
+	 * @param PeerId - account Id of the sender
+	 * @param Channel - channel the message was sent on
+	 * @param Data - message data, only valid during the call
+	 * @param DataLengthBytes - size of the message data
+	 */
+	using FOnMessageReceived = std::function<void(FProductUserId PeerId, uint8_t Channel, const char* Data, uint16_t DataLengthBytes)>;
+
+	struct FChannelSettings
+	{
+		EOS_EPacketReliability Reliability = EOS_EPacketReliability::EOS_PR_ReliableOrdered;
+
+		/** Whether messages are packed with the others sent to the same peer before the next Flush, or sent in a packet of their own */
+		bool bCoalesce = true;
+	};
+
+	/** Sets how a channel's messages are sent, and who gets the ones received on it */
+	void ConfigureChannel(uint8_t Channel, const FChannelSettings& Settings, FOnMessageReceived OnMessageReceived);
+	bool IsChannelConfigured(uint8_t Channel) const;
+
+	/**
+	 * Queues a message for a peer, it's sent by the next Flush.
+	 *
+	 * @return EOS_Success, or EOS_InvalidParameters if the channel isn't configured or the message is empty or longer than MaxMessageSize
+	 */
+	EOS_EResult SendMessage(FProductUserId PeerId, uint8_t Channel, const void* Data, uint16_t DataLengthBytes);
+
+	/**
+	 * Sends the queued messages of the local user. Packets that can't be sent are dropped.
+	 *
+	 * @return EOS_Success, or the error the first failed send returned
+	 */
+	EOS_EResult Flush(FProductUserId LocalUserId);
+
+	/** Drops the queued messages, e.g. once the local user has logged out */
+	void ClearQueuedMessages();
+
+	/**
+	 * Passes the messages of a packet received on a configured channel on to the channel's callback.
+	 *
+	 * @return false if the packet is malformed, in which case the messages after the malformed one are dropped
+	 */
+	bool ReceivePacket(FProductUserId PeerId, uint8_t Channel, const char* Data, uint32_t DataLengthBytes);
+
+	const char* GetSocketName() const { return SocketId.SocketName; }
+
+	struct FStats
+	{
+		uint64_t MessagesSent = 0;
+		uint64_t PacketsSent = 0;
+		uint64_t BytesSent = 0;
+		uint64_t PacketsDropped = 0;
+		uint64_t MessagesReceived = 0;
+		uint64_t PacketsReceived = 0;
+		uint64_t MalformedPackets = 0;
+	};
+
+	const FStats& GetStats() const { return Stats; }
+
+	/** Every message in a packet starts with its length */
+	static constexpr uint32_t MessageHeaderSize = sizeof(uint16_t);
+
+	/** Longest message that fits in a packet */
+	static constexpr uint32_t MaxMessageSize = EOS_P2P_MAX_PACKET_SIZE - MessageHeaderSize;
+
+private:
+	struct FChannel
+	{
+		FChannelSettings Settings;
+		FOnMessageReceived OnMessageReceived;
+		bool bIsConfigured = false;
+	};
+
+	struct FPendingPacket
+	{
+		FProductUserId PeerId;
+		uint8_t Channel;
+		std::vector<char> Data;
+	};
+
+	/** Queues a new packet, its data buffer is reused from an earlier packet if there is one */
+	FPendingPacket& AddPendingPacket(FProductUserId PeerId, uint8_t Channel);
+
+	IP2PInterface& P2P;
+	EOS_P2P_SocketId SocketId;
+
+	std::array<FChannel, 256> Channels;
+
+	/** Packets to send, in the order their first message was queued */
+	std::vector<FPendingPacket> PendingPackets;
+
+	/** The pending packet of each peer and coalescing channel that still takes messages, by index in PendingPackets */
+	std::map<std::pair<EOS_ProductUserId, uint8_t>, size_t> OpenPackets;
+
+	/** Data buffers of sent packets, reused by later ones */
+	std::vector<std::vector<char>> FreeBuffers;
+
+	FStats Stats;
+};
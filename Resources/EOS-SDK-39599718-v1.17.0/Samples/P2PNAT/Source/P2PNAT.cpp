@@ -19,9 +19,20 @@
 #endif
 
 
+constexpr char FP2PNAT::P2PSocketName[];
+constexpr uint8_t FP2PNAT::ChatChannel;
+
 FP2PNAT::FP2PNAT()
+	: Messenger(P2PInterface, P2PSocketName)
 {
-	
+	FP2PMessenger::FChannelSettings ChatSettings;
+	ChatSettings.Reliability = EOS_EPacketReliability::EOS_PR_ReliableOrdered;
+	ChatSettings.bCoalesce = true;
+
+	ConfigureChannel(ChatChannel, ChatSettings, [this](FProductUserId FriendId, uint8_t Channel, const char* Data, uint16_t DataLengthBytes)
+	{
+		OnChatMessageReceived(FriendId, Channel, Data, DataLengthBytes);
+	});
 }
 
 FP2PNAT::~FP2PNAT()
@@ -32,6 +43,7 @@ FP2PNAT::~FP2PNAT()
 void FP2PNAT::Update()
 {
 	HandleReceivedMessages();
+	FlushMessages();
 }
 
 void FP2PNAT::RefreshNATType()
@@ -82,6 +94,7 @@ void FP2PNAT::OnUserConnectLoggedIn(FProductUserId UserId)
 
 void FP2PNAT::OnLoggedOut(FEpicAccountId UserId)
 {
+	Messenger.ClearQueuedMessages();
 	UnsubscribeFromConnectionRequests();
 	UnsubscribeToConnectionEstablished();
 }
@@ -129,6 +142,18 @@ void FP2PNAT::SendMessage(FProductUserId FriendId, const std::wstring& Message)
 		return;
 	}
 
+	std::string MessageNarrow = FStringUtils::Narrow(Message);
+	if (MessageNarrow.size() > FP2PMessenger::MaxMessageSize)
+	{
+		FDebugLog::LogError(L"EOS P2PNAT SendMessage: message is too long.");
+		return;
+	}
+
+	SendMessage(FriendId, ChatChannel, MessageNarrow.data(), static_cast<uint16_t>(MessageNarrow.size()));
+}
+
+void FP2PNAT::SendMessage(FProductUserId PeerId, uint8_t Channel, const void* Data, uint16_t DataLengthBytes)
+{
 	PlayerPtr Player = FPlayerManager::Get().GetPlayer(FPlayerManager::Get().GetCurrentUser());
 	if (Player == nullptr)
 	{
@@ -136,34 +161,25 @@ void FP2PNAT::SendMessage(FProductUserId FriendId, const std::wstring& Message)
 		return;
 	}
 
-	EOS_HP2P P2PHandle = EOS_Platform_GetP2PInterface(FPlatform::GetPlatformHandle());
-
-	EOS_P2P_SocketId SocketId = {};
-	SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
-	strncpy_s(SocketId.SocketName, "CHAT", 5);
-
-	EOS_P2P_SendPacketOptions Options = {};
-	Options.ApiVersion = EOS_P2P_SENDPACKET_API_LATEST;
-	Options.LocalUserId = Player->GetProductUserID();
-	Options.RemoteUserId = FriendId;
-	Options.SocketId = &SocketId;
-	Options.bAllowDelayedDelivery = EOS_TRUE;
-	Options.Channel = 0;
-	Options.Reliability = EOS_EPacketReliability::EOS_PR_ReliableOrdered;
-	Options.bDisableAutoAcceptConnection = EOS_FALSE;
-
-	std::string MessageNarrow = FStringUtils::Narrow(Message);
-
-	Options.DataLengthBytes = static_cast<uint32_t>(MessageNarrow.size());
-	Options.Data = MessageNarrow.data();
-
-	EOS_EResult Result = EOS_P2P_SendPacket(P2PHandle, &Options);
+	EOS_EResult Result = Messenger.SendMessage(PeerId, Channel, Data, DataLengthBytes);
 	if (Result != EOS_EResult::EOS_Success)
 	{
-		FDebugLog::LogError(L"EOS P2PNAT SendMessage: error while sending data, code: %ls.", FStringUtils::Widen(EOS_EResult_ToString(Result)).c_str());
+		FDebugLog::LogError(L"EOS P2PNAT SendMessage: could not queue message on channel %d, code: %ls.", static_cast<int>(Channel), FStringUtils::Widen(EOS_EResult_ToString(Result)).c_str());
 	}
 }
 
+void FP2PNAT::ConfigureChannel(uint8_t Channel, const FP2PMessenger::FChannelSettings& Settings, FP2PMessenger::FOnMessageReceived OnMessageReceived)
+{
+	Messenger.ConfigureChannel(Channel, Settings, std::move(OnMessageReceived));
+	RegisterPacketHandler(P2PSocketName, Channel, [this](FProductUserId PeerId, uint8_t PacketChannel, const char* Data, uint32_t DataLengthBytes)
+	{
+		if (!Messenger.ReceivePacket(PeerId, PacketChannel, Data, DataLengthBytes))
+		{
+			FDebugLog::LogWarning(L"EOS P2PNAT: malformed packet received on channel %d.", static_cast<int>(PacketChannel));
+		}
+	});
+}
+
 void FP2PNAT::HandleReceivedMessages()
 {
 	PlayerPtr Player = FPlayerManager::Get().GetPlayer(FPlayerManager::Get().GetCurrentUser());
@@ -172,45 +188,50 @@ void FP2PNAT::HandleReceivedMessages()
 		return;
 	}
 
-	EOS_HP2P P2PHandle = EOS_Platform_GetP2PInterface(FPlatform::GetPlatformHandle());
-
-	EOS_P2P_ReceivePacketOptions Options = {};
-	Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
-	Options.LocalUserId = Player->GetProductUserID();
-	Options.MaxDataSizeBytes = 4096;
-	Options.RequestedChannel = nullptr;
-
-	//Packet params
-	FProductUserId FriendId;
-
-	EOS_P2P_SocketId SocketId = {};
-	SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
-	uint8_t Channel = 0;
+	EOS_EResult Result = PacketDispatcher.ReceivePackets(P2PInterface, Player->GetProductUserID());
+	if (Result != EOS_EResult::EOS_Success)
+	{
+		FDebugLog::LogError(L"EOS P2PNAT HandleReceivedMessages: error while reading data, code: %ls.", FStringUtils::Widen(EOS_EResult_ToString(Result)).c_str());
+	}
 
-	std::vector<char> MessageData;
-	MessageData.resize(Options.MaxDataSizeBytes);
-	uint32_t BytesWritten = 0;
+	if (PacketDispatcher.GetReceiveStats().UnhandledPackets > 0)
+	{
+		FDebugLog::LogWarning(L"EOS P2PNAT HandleReceivedMessages: %u packets without a handler dropped.", PacketDispatcher.GetReceiveStats().UnhandledPackets);
+	}
+}
 
-	EOS_EResult Result = EOS_P2P_ReceivePacket(P2PHandle, &Options, &FriendId.AccountId, &SocketId, &Channel, MessageData.data(), &BytesWritten);
-	if (Result == EOS_EResult::EOS_NotFound)
+void FP2PNAT::FlushMessages()
+{
+	PlayerPtr Player = FPlayerManager::Get().GetPlayer(FPlayerManager::Get().GetCurrentUser());
+	if (Player == nullptr || !Player->GetProductUserID().IsValid())
 	{
-		//no more packets, just end
 		return;
 	}
-	else if (Result == EOS_EResult::EOS_Success)
+
+	EOS_EResult Result = Messenger.Flush(Player->GetProductUserID());
+	if (Result != EOS_EResult::EOS_Success)
 	{
-		std::shared_ptr<FP2PNATDialog> P2PDialog = static_cast<FMenu&>(*FGame::Get().GetMenu()).GetP2PNATDialog();
-		if (P2PDialog)
-		{
-			std::wstring MessageWide;
-			std::string MessageNarrow(MessageData.data(), BytesWritten);
-			MessageWide = FStringUtils::Widen(MessageNarrow);
-			P2PDialog->OnMessageReceived(MessageWide, FriendId);
-		}
+		FDebugLog::LogError(L"EOS P2PNAT FlushMessages: error while sending data, code: %ls.", FStringUtils::Widen(EOS_EResult_ToString(Result)).c_str());
 	}
-	else
+}
+
+void FP2PNAT::RegisterPacketHandler(const char* SocketName, uint8_t Channel, FP2PPacketDispatcher::FPacketHandler Handler)
+{
+	PacketDispatcher.RegisterPacketHandler(SocketName, Channel, std::move(Handler));
+}
+
+void FP2PNAT::UnregisterPacketHandler(const char* SocketName, uint8_t Channel)
+{
+	PacketDispatcher.UnregisterPacketHandler(SocketName, Channel);
+}
+
+void FP2PNAT::OnChatMessageReceived(FProductUserId FriendId, uint8_t Channel, const char* Data, uint16_t DataLengthBytes)
+{
+	std::shared_ptr<FP2PNATDialog> P2PDialog = static_cast<FMenu&>(*FGame::Get().GetMenu()).GetP2PNATDialog();
+	if (P2PDialog)
 	{
-		FDebugLog::LogError(L"EOS P2PNAT HandleReceivedMessages: error while reading data, code: %ls.", FStringUtils::Widen(EOS_EResult_ToString(Result)).c_str());
+		std::string MessageNarrow(Data, DataLengthBytes);
+		P2PDialog->OnMessageReceived(FStringUtils::Widen(MessageNarrow), FriendId);
 	}
 }
 
@@ -229,7 +250,7 @@ void FP2PNAT::SubscribeToConnectionRequests()
 
 		EOS_P2P_SocketId SocketId = {};
 		SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
-		strncpy_s(SocketId.SocketName, "CHAT", 5);
+		strncpy_s(SocketId.SocketName, P2PSocketName, sizeof(P2PSocketName));
 
 		EOS_P2P_AddNotifyPeerConnectionRequestOptions Options = {};
 		Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONREQUEST_API_LATEST;
@@ -266,7 +287,7 @@ void FP2PNAT::SubscribeToConnectionEstablished()
 
 		EOS_P2P_SocketId SocketId = {};
 		SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
-		strncpy_s(SocketId.SocketName, "CHAT", 5);
+		strncpy_s(SocketId.SocketName, P2PSocketName, sizeof(P2PSocketName));
 
 		EOS_P2P_AddNotifyPeerConnectionEstablishedOptions Options = {};
 		Options.ApiVersion = EOS_P2P_ADDNOTIFYPEERCONNECTIONESTABLISHED_API_LATEST;
@@ -293,7 +314,7 @@ void EOS_CALL FP2PNAT::OnIncomingConnectionRequest(const EOS_P2P_OnIncomingConne
 	if (Data)
 	{
 		std::string SocketName = Data->SocketId->SocketName;
-		if (SocketName != "CHAT")
+		if (SocketName != P2PSocketName)
 		{
 			FDebugLog::LogError(L"EOS P2PNAT OnIncomingConnectionRequest: bad socket id.");
 			return;
@@ -314,7 +335,7 @@ void EOS_CALL FP2PNAT::OnIncomingConnectionRequest(const EOS_P2P_OnIncomingConne
 
 		EOS_P2P_SocketId SocketId = {};
 		SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
-		strncpy_s(SocketId.SocketName, "CHAT", 5);
+		strncpy_s(SocketId.SocketName, P2PSocketName, sizeof(P2PSocketName));
 		Options.SocketId = &SocketId;
 
 		EOS_EResult Result = EOS_P2P_AcceptConnection(P2PHandle, &Options);
@@ -334,7 +355,7 @@ void EOS_CALL FP2PNAT::OnIncomingConnectionEstablished(const EOS_P2P_OnPeerConne
 	if (Data)
 	{
 		std::string SocketName = Data->SocketId->SocketName;
-		if (SocketName != "CHAT")
+		if (SocketName != P2PSocketName)
 		{
 			FDebugLog::LogError(L"EOS P2PNAT OnIncomingConnectionEstablished: bad socket id.");
 			return;
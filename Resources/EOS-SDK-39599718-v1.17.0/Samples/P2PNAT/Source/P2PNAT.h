@@ -5,6 +5,10 @@
 #include <eos_sdk.h>
 #include <eos_p2p.h>
 
+#include "P2PInterface.h"
+#include "P2PMessenger.h"
+#include "P2PPacketDispatcher.h"
+
 /**
 * Manages Peer 2 Peer connections with capabilities of NAT traversal.
 */
@@ -45,8 +49,46 @@ public:
 	 * @param Message - chat text message to send
 	 */
 	void SendMessage(FProductUserId FriendId, const std::wstring& Message);
+
+	/**
+	 * Queues a binary message for a peer on a configured channel, it's sent with the other messages queued this frame.
+	 * @param PeerId - account Id of the receiver
+	 * @param Channel - channel to send the message on
+	 * @param Data - message data
+	 * @param DataLengthBytes - size of the message data, at most FP2PMessenger::MaxMessageSize
+	 */
+	void SendMessage(FProductUserId PeerId, uint8_t Channel, const void* Data, uint16_t DataLengthBytes);
+
+	/**
+	 * Sets the reliability of a channel on the sample's socket, and who gets the messages received on it.
+	 * Channel ChatChannel carries the chat, the other channels are free for gameplay traffic.
+	 */
+	void ConfigureChannel(uint8_t Channel, const FP2PMessenger::FChannelSettings& Settings, FP2PMessenger::FOnMessageReceived OnMessageReceived);
+
+	/**
+	 * Receives the pending packets, up to FP2PPacketDispatcher::MaxPacketsPerUpdate and MaxBytesPerUpdate, and passes each of
+	 * them on to the handler registered for its socket and channel.
+	 */
 	void HandleReceivedMessages();
 
+	/**
+	 * Sends the messages queued since the last update.
+	 */
+	void FlushMessages();
+
+	/**
+	 * Registers the handler of the raw packets received on a socket and channel, replacing the one registered before.
+	 * The channels of the sample's socket are handled by the messenger, see ConfigureChannel.
+	 */
+	void RegisterPacketHandler(const char* SocketName, uint8_t Channel, FP2PPacketDispatcher::FPacketHandler Handler);
+	void UnregisterPacketHandler(const char* SocketName, uint8_t Channel);
+
+	/** Socket the sample's messages are sent on */
+	static constexpr char P2PSocketName[] = "CHAT";
+
+	/** Channel of the chat messages */
+	static constexpr uint8_t ChatChannel = 0;
+
 	void SubscribeToConnectionRequests();
 	void UnsubscribeFromConnectionRequests();
 
@@ -70,6 +112,19 @@ private:
 
 	static void EOS_CALL OnRefreshNATTypeFinished(const EOS_P2P_OnQueryNATTypeCompleteInfo* Data);
 
+	/**
+	* Shows a chat message received from a friend
+	*/
+	void OnChatMessageReceived(FProductUserId FriendId, uint8_t Channel, const char* Data, uint16_t DataLengthBytes);
+
+	/** Packets are sent and received through EOS P2P */
+	FEOSP2PInterface P2PInterface;
+
+	FP2PPacketDispatcher PacketDispatcher;
+
+	/** Channelized messages on the sample's socket */
+	FP2PMessenger Messenger;
+
 	EOS_NotificationId ConnectionNotificationId = EOS_INVALID_NOTIFICATIONID;
 	EOS_NotificationId ConnectionEstablishedNotificationId = EOS_INVALID_NOTIFICATIONID;
 };
@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+#include "P2PPacketDispatcher.h"
+
+#if !defined(_WIN32)
+#define strncpy_s strncpy
+#endif
+
+constexpr uint32_t FP2PPacketDispatcher::MaxPacketsPerUpdate;
+constexpr uint32_t FP2PPacketDispatcher::MaxBytesPerUpdate;
+
+FP2PPacketDispatcher::FP2PPacketDispatcher()
+	: ReceiveBuffer(EOS_P2P_MAX_PACKET_SIZE)
+{
+
+}
+
+void FP2PPacketDispatcher::RegisterPacketHandler(const char* SocketName, uint8_t Channel, FPacketHandler Handler)
+{
+	UnregisterPacketHandler(SocketName, Channel);
+
+	FPacketHandlerEntry Entry = {};
+	strncpy_s(Entry.SocketName, SocketName, EOS_P2P_SOCKETID_SOCKETNAME_SIZE - 1);
+	Entry.Channel = Channel;
+	Entry.Handler = std::move(Handler);
+	PacketHandlers.push_back(std::move(Entry));
+}
+
+void FP2PPacketDispatcher::UnregisterPacketHandler(const char* SocketName, uint8_t Channel)
+{
+	PacketHandlers.erase(std::remove_if(PacketHandlers.begin(), PacketHandlers.end(), [SocketName, Channel](const FPacketHandlerEntry& Entry)
+	{
+		return Entry.Channel == Channel && strncmp(Entry.SocketName, SocketName, EOS_P2P_SOCKETID_SOCKETNAME_SIZE) == 0;
+	}), PacketHandlers.end());
+}
+
+bool FP2PPacketDispatcher::HasPacketHandler(const char* SocketName) const
+{
+	return std::any_of(PacketHandlers.begin(), PacketHandlers.end(), [SocketName](const FPacketHandlerEntry& Entry)
+	{
+		return strncmp(Entry.SocketName, SocketName, EOS_P2P_SOCKETID_SOCKETNAME_SIZE) == 0;
+	});
+}
+
+EOS_EResult FP2PPacketDispatcher::ReceivePackets(IP2PInterface& P2P, FProductUserId LocalUserId)
+{
+	ReceiveStats = FReceiveStats();
+
+	EOS_P2P_ReceivePacketOptions Options = {};
+	Options.ApiVersion = EOS_P2P_RECEIVEPACKET_API_LATEST;
+	Options.LocalUserId = LocalUserId;
+	Options.MaxDataSizeBytes = static_cast<uint32_t>(ReceiveBuffer.size());
+	Options.RequestedChannel = nullptr;
+
+	// drain the queue rather than taking one packet per frame, which lets it back up by a frame for every packet queued
+	while (ReceiveStats.PacketsReceived < MaxPacketsPerUpdate && ReceiveStats.BytesReceived < MaxBytesPerUpdate)
+	{
+		//Packet params
+		FProductUserId PeerId;
+
+		EOS_P2P_SocketId SocketId = {};
+		SocketId.ApiVersion = EOS_P2P_SOCKETID_API_LATEST;
+		uint8_t Channel = 0;
+		uint32_t BytesWritten = 0;
+
+		EOS_EResult Result = P2P.ReceivePacket(Options, &PeerId.AccountId, &SocketId, &Channel, ReceiveBuffer.data(), &BytesWritten);
+		if (Result == EOS_EResult::EOS_NotFound)
+		{
+			//no more packets, just end
+			break;
+		}
+		else if (Result != EOS_EResult::EOS_Success)
+		{
+			return Result;
+		}
+
+		++ReceiveStats.PacketsReceived;
+		ReceiveStats.BytesReceived += BytesWritten;
+
+		if (!DispatchPacket(PeerId, SocketId, Channel, ReceiveBuffer.data(), BytesWritten))
+		{
+			++ReceiveStats.UnhandledPackets;
+		}
+	}
+
+	return EOS_EResult::EOS_Success;
+}
+
+bool FP2PPacketDispatcher::DispatchPacket(FProductUserId PeerId, const EOS_P2P_SocketId& SocketId, uint8_t Channel, const char* Data, uint32_t DataLengthBytes)
+{
+	for (const FPacketHandlerEntry& Entry : PacketHandlers)
+	{
+		if (Entry.Channel == Channel && strncmp(Entry.SocketName, SocketId.SocketName, EOS_P2P_SOCKETID_SOCKETNAME_SIZE) == 0)
+		{
+			Entry.Handler(PeerId, Channel, Data, DataLengthBytes);
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "AccountHelpers.h"
+#include "P2PInterface.h"
+
+#include <functional>
+#include <vector>
+
+/**
+* Receives the packets of a local user and passes each of them on to the handler registered for its socket and channel.
+*/
+class FP2PPacketDispatcher
+{
+public:
+	/**
+	* Constructor
+	*/
+	FP2PPacketDispatcher();
+
+	/**
+	 * Called for each packet received on a socket and channel.
+	 * @param PeerId - account Id of the sender
+	 * @param Channel - channel the packet was sent on
+	 * @param Data - packet data, only valid during the call
+	 * @param DataLengthBytes - size of the packet data
+	 */
+	using FPacketHandler = std::function<void(FProductUserId PeerId, uint8_t Channel, const char* Data, uint32_t DataLengthBytes)>;
+
+	/**
+	 * Registers the handler of the packets received on a socket and channel, replacing the one registered before.
+	 * Handlers must not be registered or unregistered from within a handler.
+	 */
+	void RegisterPacketHandler(const char* SocketName, uint8_t Channel, FPacketHandler Handler);
+	void UnregisterPacketHandler(const char* SocketName, uint8_t Channel);
+
+	/** Whether any handler is registered for the socket */
+	bool HasPacketHandler(const char* SocketName) const;
+
+	struct FReceiveStats
+	{
+		uint32_t PacketsReceived = 0;
+		uint32_t BytesReceived = 0;
+
+		/** Packets dropped as no handler was registered for them */
+		uint32_t UnhandledPackets = 0;
+	};
+
+	/**
+	 * Receives the pending packets of the local user until there are none left, or MaxPacketsPerUpdate or MaxBytesPerUpdate
+	 * have been received, and passes them on to their handlers.
+	 *
+	 * @return EOS_Success, or the error a receive failed with
+	 */
+	EOS_EResult ReceivePackets(IP2PInterface& P2P, FProductUserId LocalUserId);
+
+	/** Stats of the last ReceivePackets */
+	const FReceiveStats& GetReceiveStats() const { return ReceiveStats; }
+
+	/** Most packets received in one update, the rest wait for the next one so a flood of packets can't stall the frame */
+	static constexpr uint32_t MaxPacketsPerUpdate = 256;
+
+	/** Most bytes received in one update */
+	static constexpr uint32_t MaxBytesPerUpdate = 128 * 1024;
+
+private:
+	/** Passes a packet on to the handler of its socket and channel, returns false if there's none */
+	bool DispatchPacket(FProductUserId PeerId, const EOS_P2P_SocketId& SocketId, uint8_t Channel, const char* Data, uint32_t DataLengthBytes);
+
+	struct FPacketHandlerEntry
+	{
+		char SocketName[EOS_P2P_SOCKETID_SOCKETNAME_SIZE];
+		uint8_t Channel;
+		FPacketHandler Handler;
+	};
+
+	std::vector<FPacketHandlerEntry> PacketHandlers;
+
+	/** Every packet is received into this, it fits the largest packet EOS P2P sends */
+	std::vector<char> ReceiveBuffer;
+
+	FReceiveStats ReceiveStats;
+};
@@ -31,6 +31,7 @@ constexpr wchar_t CommandLineConstants::AssetDir[];
 constexpr wchar_t CommandLineConstants::Server[];
 constexpr wchar_t CommandLineConstants::ServerURL[];
 constexpr wchar_t CommandLineConstants::ServerPort[];
+constexpr wchar_t CommandLineConstants::VoiceRequestsPerTick[];
 constexpr wchar_t CommandLineConstants::Locale[];
 
 #ifdef DEV_BUILD
@@ -85,6 +85,9 @@ struct CommandLineConstants
 	/** Port to be used for server */
 	static constexpr wchar_t ServerPort[] = L"voiceserverport";
 
+	/** Voice requests made per server tick (Format: Number - e.g. "-voicerequestspertick 32") */
+	static constexpr wchar_t VoiceRequestsPerTick[] = L"voicerequestspertick";
+
 	/** Override locale to be used for EOS_Platform_Create */
 	static constexpr wchar_t Locale[] = L"locale";
 
@@ -3,104 +3,133 @@
 #include "pch.h"
 
 #include "ApiParams.h"
+#include "PooledJson.h"
 
-#include "rapidjson/document.h"
-#include "rapidjson/stringbuffer.h"
-#include "rapidjson/writer.h"
 #include "rapidjson/error/en.h"
 
+namespace
+{
+	/** Parses a request body in situ, on the calling thread's pooled json buffers */
+	FParseResult ParseRequestBody(const std::string& Body, FPooledJsonDocument& ReqDoc)
+	{
+		ReqDoc.ParseInsitu(Body);
+		if (ReqDoc.GetDocument().HasParseError())
+		{
+			const rapidjson::ParseErrorCode ParseErr = ReqDoc.GetDocument().GetParseError();
+			return RESULT_FAILED(rapidjson::GetParseError_En(ParseErr));
+		}
+
+		if (!ReqDoc.GetDocument().IsObject())
+		{
+			return RESULT_FAILED("Expected a json object");
+		}
+
+		return RESULT_OK();
+	}
+
+	/** Returns the string member Name, or nullptr if it's missing or not a string */
+	const FJsonValue* FindString(const FJsonDocument& Doc, const char* Name)
+	{
+		FJsonValue::ConstMemberIterator Itr = Doc.FindMember(Name);
+		return Itr != Doc.MemberEnd() && Itr->value.IsString() ? &Itr->value : nullptr;
+	}
+}
+
 FParseResult FCreateSessionParams::FromRequestBody(const std::string& Body, FCreateSessionParams& Out)
 {	
-	rapidjson::Document ReqDoc;	
-	ReqDoc.Parse(Body.c_str());
-	if (ReqDoc.HasParseError())
+	FPooledJsonDocument ReqDoc;
+	FParseResult Result = ParseRequestBody(Body, ReqDoc);
+	if (!Result.IsOk())
 	{
-		const rapidjson::ParseErrorCode ParseErr = ReqDoc.GetParseError();
-		return RESULT_FAILED(rapidjson::GetParseError_En(ParseErr));
+		return Result;
 	}
+	const FJsonDocument& Doc = ReqDoc.GetDocument();
 
-	if (!ReqDoc.HasMember("puid") || !ReqDoc["puid"].IsString())
+	const FJsonValue* Puid = FindString(Doc, "puid");
+	if (Puid == nullptr)
 	{
 		return RESULT_FAILED("Missing string parameter: puid");
 	}
 
 	// optional password
-	if (ReqDoc.HasMember("password"))
+	FJsonValue::ConstMemberIterator Password = Doc.FindMember("password");
+	if (Password != Doc.MemberEnd())
 	{
-		if (!ReqDoc["password"].IsString())
+		if (!Password->value.IsString())
 		{
 			return RESULT_FAILED("Invalid password, expected string");
 		}
-		Out.Password = ReqDoc["password"].GetString();
+		Out.Password.assign(Password->value.GetString(), Password->value.GetStringLength());
 	}
 	
-	Out.Puid = ReqDoc["puid"].GetString();
+	Out.Puid.assign(Puid->GetString(), Puid->GetStringLength());
 	return RESULT_OK();
 }
 
 FParseResult FKickUserParams::FromRequestBody(const std::string& Body, FKickUserParams& Out)
 {
-	rapidjson::Document ReqDoc;
-	ReqDoc.Parse(Body.c_str());
-	if (ReqDoc.HasParseError())
+	FPooledJsonDocument ReqDoc;
+	FParseResult Result = ParseRequestBody(Body, ReqDoc);
+	if (!Result.IsOk())
 	{
-		const rapidjson::ParseErrorCode ParseErr = ReqDoc.GetParseError();
-		return RESULT_FAILED(rapidjson::GetParseError_En(ParseErr));
+		return Result;
 	}
 
-	if (!ReqDoc.HasMember("lock") || !ReqDoc["lock"].IsString())
+	const FJsonValue* Lock = FindString(ReqDoc.GetDocument(), "lock");
+	if (Lock == nullptr)
 	{
 		return RESULT_FAILED("Missing string parameter: lock");
 	}
 	
-	Out.Lock= ReqDoc["lock"].GetString();
+	Out.Lock.assign(Lock->GetString(), Lock->GetStringLength());
 	return RESULT_OK();
 }
 
 
 FParseResult FMuteUserParams::FromRequestBody(const std::string& Body, FMuteUserParams& Out)
 {
-	rapidjson::Document ReqDoc;
-	ReqDoc.Parse(Body.c_str());
-	if (ReqDoc.HasParseError())
+	FPooledJsonDocument ReqDoc;
+	FParseResult Result = ParseRequestBody(Body, ReqDoc);
+	if (!Result.IsOk())
 	{
-		const rapidjson::ParseErrorCode ParseErr = ReqDoc.GetParseError();
-		return RESULT_FAILED(rapidjson::GetParseError_En(ParseErr));
+		return Result;
 	}
+	const FJsonDocument& Doc = ReqDoc.GetDocument();
 
-	if (!ReqDoc.HasMember("lock") || !ReqDoc["lock"].IsString())
+	const FJsonValue* Lock = FindString(Doc, "lock");
+	if (Lock == nullptr)
 	{
 		return RESULT_FAILED("Missing string parameter: lock");
 	}
 
-	if (!ReqDoc.HasMember("mute") || !ReqDoc["mute"].IsBool())
+	FJsonValue::ConstMemberIterator Mute = Doc.FindMember("mute");
+	if (Mute == Doc.MemberEnd() || !Mute->value.IsBool())
 	{
 		return RESULT_FAILED("Missing bool parameter: mute");
 	}
 	
-	Out.Lock = ReqDoc["lock"].GetString();
-	Out.bMute = ReqDoc["mute"].GetBool();
+	Out.Lock.assign(Lock->GetString(), Lock->GetStringLength());
+	Out.bMute = Mute->value.GetBool();
 
 	return RESULT_OK();
 }
 
 FParseResult FHeartbeatParams::FromRequestBody(const std::string& Body, FHeartbeatParams& Out)
 {
-	rapidjson::Document ReqDoc;
-	ReqDoc.Parse(Body.c_str());
-
-	if (ReqDoc.HasParseError())
+	FPooledJsonDocument ReqDoc;
+	FParseResult Result = ParseRequestBody(Body, ReqDoc);
+	if (!Result.IsOk())
 	{
-		const rapidjson::ParseErrorCode ParseErr = ReqDoc.GetParseError();
-		return RESULT_FAILED(rapidjson::GetParseError_En(ParseErr));
+		return Result;
 	}
 
-	if (!ReqDoc.HasMember("lock") || !ReqDoc["lock"].IsString())
+	const FJsonValue* Lock = FindString(ReqDoc.GetDocument(), "lock");
+	if (Lock == nullptr)
 	{
 		return RESULT_FAILED("Missing string parameter: lock");
 	}
 
-	Out.Lock = ReqDoc["lock"].GetString();
+	Out.Lock.assign(Lock->GetString(), Lock->GetStringLength());
 
 	return RESULT_OK();
-}
\ No newline at end of file
+}
@@ -0,0 +1,761 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "AsyncHttpServer.h"
+
+#include "DebugLog.h"
+#include "StringUtils.h"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32.lib")
+#endif
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+constexpr size_t FAsyncHttpServer::MaxRequestSize;
+constexpr std::chrono::seconds FAsyncHttpServer::KeepAliveTimeout;
+
+namespace
+{
+#ifdef _WIN32
+	using FPollFd = WSAPOLLFD;
+	const FSocketHandle InvalidSocket = INVALID_SOCKET;
+	const int SendFlags = 0;
+
+	int PollSockets(FPollFd* PollFds, size_t NumPollFds, int TimeoutMs) { return WSAPoll(PollFds, static_cast<ULONG>(NumPollFds), TimeoutMs); }
+	void CloseSocket(FSocketHandle Socket) { closesocket(Socket); }
+	bool IsWouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+	bool IsInterrupted() { return WSAGetLastError() == WSAEINTR; }
+
+	bool SetNonBlocking(FSocketHandle Socket)
+	{
+		u_long NonBlocking = 1;
+		return ioctlsocket(Socket, FIONBIO, &NonBlocking) == 0;
+	}
+#else
+	using FPollFd = pollfd;
+	const FSocketHandle InvalidSocket = -1;
+#ifdef MSG_NOSIGNAL
+	const int SendFlags = MSG_NOSIGNAL;
+#else
+	const int SendFlags = 0;
+#endif
+
+	int PollSockets(FPollFd* PollFds, size_t NumPollFds, int TimeoutMs) { return poll(PollFds, static_cast<nfds_t>(NumPollFds), TimeoutMs); }
+	void CloseSocket(FSocketHandle Socket) { close(Socket); }
+	bool IsWouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
+	bool IsInterrupted() { return errno == EINTR; }
+
+	bool SetNonBlocking(FSocketHandle Socket)
+	{
+#ifdef SO_NOSIGPIPE
+		// no MSG_NOSIGNAL on mac, writing to a closed connection must not raise SIGPIPE either
+		int NoSigPipe = 1;
+		setsockopt(Socket, SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+		const int Flags = fcntl(Socket, F_GETFL, 0);
+		return Flags != -1 && fcntl(Socket, F_SETFL, Flags | O_NONBLOCK) == 0;
+	}
+#endif
+
+	const char* GetStatusText(int Status)
+	{
+		switch (Status)
+		{
+			case 200: return "OK";
+			case 204: return "No Content";
+			case 400: return "Bad Request";
+			case 403: return "Forbidden";
+			case 404: return "Not Found";
+			case 408: return "Request Timeout";
+			case 413: return "Payload Too Large";
+			case 500: return "Internal Server Error";
+			case 503: return "Service Unavailable";
+			default: return "Unknown";
+		}
+	}
+
+	bool EqualsIgnoreCase(const std::string& Lhs, const char* Rhs)
+	{
+		const size_t RhsLength = strlen(Rhs);
+		if (Lhs.size() != RhsLength)
+		{
+			return false;
+		}
+		for (size_t Index = 0; Index < RhsLength; ++Index)
+		{
+			if (tolower(static_cast<unsigned char>(Lhs[Index])) != tolower(static_cast<unsigned char>(Rhs[Index])))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::string Trim(const std::string& Value)
+	{
+		const size_t Begin = Value.find_first_not_of(" \t");
+		if (Begin == std::string::npos)
+		{
+			return std::string();
+		}
+		return Value.substr(Begin, Value.find_last_not_of(" \t") - Begin + 1);
+	}
+
+	std::string DecodeUrl(const std::string& Value)
+	{
+		std::string Decoded;
+		Decoded.reserve(Value.size());
+		for (size_t Index = 0; Index < Value.size(); ++Index)
+		{
+			if (Value[Index] == '%' && Index + 2 < Value.size() && isxdigit(static_cast<unsigned char>(Value[Index + 1])) && isxdigit(static_cast<unsigned char>(Value[Index + 2])))
+			{
+				Decoded += static_cast<char>(std::stoi(Value.substr(Index + 1, 2), nullptr, 16));
+				Index += 2;
+			}
+			else
+			{
+				Decoded += Value[Index] == '+' ? ' ' : Value[Index];
+			}
+		}
+		return Decoded;
+	}
+
+	void ParseQuery(const std::string& Query, std::multimap<std::string, std::string>& OutParams)
+	{
+		size_t Begin = 0;
+		while (Begin < Query.size())
+		{
+			size_t End = Query.find('&', Begin);
+			if (End == std::string::npos)
+			{
+				End = Query.size();
+			}
+
+			const std::string Pair = Query.substr(Begin, End - Begin);
+			const size_t Separator = Pair.find('=');
+			if (!Pair.empty())
+			{
+				OutParams.emplace(DecodeUrl(Pair.substr(0, Separator)), Separator == std::string::npos ? std::string() : DecodeUrl(Pair.substr(Separator + 1)));
+			}
+
+			Begin = End + 1;
+		}
+	}
+}
+
+/** Responses handed over from any thread, picked up by the event loop after it's woken through a loopback datagram */
+class FHttpResponseQueue
+{
+public:
+	struct FResponse
+	{
+		uint64_t ConnectionId;
+		int Status;
+		std::string Body;
+		std::string ContentType;
+	};
+
+	std::mutex Mutex;
+	std::vector<FResponse> Responses;
+
+	/** Udp socket connected to itself, readable whenever the loop has been woken */
+	FSocketHandle WakeSocket = InvalidSocket;
+
+	bool Open()
+	{
+		WakeSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		if (WakeSocket == InvalidSocket)
+		{
+			return false;
+		}
+
+		sockaddr_in Address = {};
+		Address.sin_family = AF_INET;
+		Address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		Address.sin_port = 0;
+
+		socklen_t AddressLength = sizeof(Address);
+		return bind(WakeSocket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) == 0 &&
+			getsockname(WakeSocket, reinterpret_cast<sockaddr*>(&Address), &AddressLength) == 0 &&
+			connect(WakeSocket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) == 0 &&
+			SetNonBlocking(WakeSocket);
+	}
+
+	void Close()
+	{
+		FScopedLock Lock(Mutex);
+		if (WakeSocket != InvalidSocket)
+		{
+			CloseSocket(WakeSocket);
+			WakeSocket = InvalidSocket;
+		}
+		Responses.clear();
+	}
+
+	void Push(FResponse&& Response)
+	{
+		FScopedLock Lock(Mutex);
+		if (WakeSocket != InvalidSocket)
+		{
+			const bool bWasEmpty = Responses.empty();
+			Responses.push_back(std::move(Response));
+			if (bWasEmpty)
+			{
+				WakeLocked();
+			}
+		}
+	}
+
+	void Wake()
+	{
+		FScopedLock Lock(Mutex);
+		WakeLocked();
+	}
+
+	/** Reads all pending wake datagrams */
+	void Drain()
+	{
+		char Buffer[16];
+		while (recv(WakeSocket, Buffer, sizeof(Buffer), 0) > 0)
+		{
+		}
+	}
+
+private:
+	void WakeLocked()
+	{
+		if (WakeSocket != InvalidSocket)
+		{
+			const char Byte = 0;
+			send(WakeSocket, &Byte, 1, SendFlags);
+		}
+	}
+};
+
+std::string FHttpRequest::GetParamValue(const std::string& Key) const
+{
+	auto Itr = Params.find(Key);
+	return Itr != Params.end() ? Itr->second : std::string();
+}
+
+FHttpResponder::~FHttpResponder()
+{
+	if (!bResponded)
+	{
+		Respond(500);
+	}
+}
+
+void FHttpResponder::Respond(int Status, std::string Body, const char* ContentType)
+{
+	if (!bResponded.exchange(true))
+	{
+		Queue->Push(FHttpResponseQueue::FResponse{ ConnectionId, Status, std::move(Body), ContentType ? ContentType : "" });
+	}
+}
+
+FAsyncHttpServer::FAsyncHttpServer() :
+	ListenSocket(InvalidSocket),
+	ResponseQueue(std::make_shared<FHttpResponseQueue>())
+{
+#ifdef _WIN32
+	WSADATA WsaData;
+	WSAStartup(MAKEWORD(2, 2), &WsaData);
+#endif
+}
+
+FAsyncHttpServer::~FAsyncHttpServer()
+{
+	for (auto& Itr : Connections)
+	{
+		CloseConnection(*Itr.second);
+	}
+	Connections.clear();
+
+	if (ListenSocket != InvalidSocket)
+	{
+		CloseSocket(ListenSocket);
+	}
+
+	// responders that are still pending from here on are dropped
+	ResponseQueue->Close();
+
+#ifdef _WIN32
+	WSACleanup();
+#endif
+}
+
+void FAsyncHttpServer::Post(const std::string& Pattern, FHandler Handler)
+{
+	Routes.push_back(FRoute{ "POST", std::regex(Pattern), std::move(Handler) });
+}
+
+bool FAsyncHttpServer::Bind(const char* Host, unsigned short Port)
+{
+	if (!ResponseQueue->Open())
+	{
+		return false;
+	}
+
+	ListenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (ListenSocket == InvalidSocket)
+	{
+		return false;
+	}
+
+	int ReuseAddress = 1;
+	setsockopt(ListenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&ReuseAddress), sizeof(ReuseAddress));
+
+	sockaddr_in Address = {};
+	Address.sin_family = AF_INET;
+	Address.sin_port = htons(Port);
+	if (inet_pton(AF_INET, Host, &Address.sin_addr) != 1 ||
+		bind(ListenSocket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0 ||
+		listen(ListenSocket, SOMAXCONN) != 0 ||
+		!SetNonBlocking(ListenSocket))
+	{
+		CloseSocket(ListenSocket);
+		ListenSocket = InvalidSocket;
+		return false;
+	}
+
+	bIsRunning = true;
+	return true;
+}
+
+void FAsyncHttpServer::Stop()
+{
+	bIsRunning = false;
+	ResponseQueue->Wake();
+}
+
+void FAsyncHttpServer::Run()
+{
+	std::vector<FPollFd> PollFds;
+	std::vector<uint64_t> PollConnectionIds;
+
+	while (bIsRunning)
+	{
+		PollFds.clear();
+		PollConnectionIds.clear();
+
+		FPollFd WakeFd = {};
+		WakeFd.fd = ResponseQueue->WakeSocket;
+		WakeFd.events = POLLIN;
+		PollFds.push_back(WakeFd);
+
+		FPollFd ListenFd = {};
+		ListenFd.fd = ListenSocket;
+		ListenFd.events = POLLIN;
+		PollFds.push_back(ListenFd);
+
+		for (const auto& Itr : Connections)
+		{
+			const FConnection& Connection = *Itr.second;
+
+			// stop reading while a request is in flight, so that a client can't queue up unbounded work
+			FPollFd ConnectionFd = {};
+			ConnectionFd.fd = Connection.Socket;
+			ConnectionFd.events = (Connection.PendingRequest == nullptr && !Connection.bClosing && !Connection.bReadClosed ? POLLIN : 0) |
+				(Connection.OutOffset < Connection.OutBuffer.size() ? POLLOUT : 0);
+			PollFds.push_back(ConnectionFd);
+			PollConnectionIds.push_back(Connection.Id);
+		}
+
+		// wake up every so often to close idle connections
+		const int NumReady = PollSockets(PollFds.data(), PollFds.size(), 1000);
+		if (NumReady < 0)
+		{
+			if (IsInterrupted())
+			{
+				continue;
+			}
+			FDebugLog::LogError(L"Http server poll failed, stopping.");
+			break;
+		}
+
+		if (PollFds[0].revents & POLLIN)
+		{
+			ResponseQueue->Drain();
+		}
+		DeliverResponses();
+
+		if (PollFds[1].revents & POLLIN)
+		{
+			AcceptConnections();
+		}
+
+		for (size_t Index = 0; Index < PollConnectionIds.size(); ++Index)
+		{
+			const short Events = PollFds[Index + 2].revents;
+			auto Itr = Connections.find(PollConnectionIds[Index]);
+			if (Events == 0 || Itr == Connections.end() || Itr->second->Socket == InvalidSocket)
+			{
+				continue;
+			}
+
+			FConnection& Connection = *Itr->second;
+			if (Events & POLLOUT)
+			{
+				WriteToConnection(Connection);
+			}
+			if (Events & POLLIN)
+			{
+				ReadFromConnection(Connection);
+			}
+			else if (Events & (POLLERR | POLLHUP | POLLNVAL))
+			{
+				CloseConnection(Connection);
+			}
+		}
+
+		// pipelined requests are picked up here rather than from QueueResponse, so answering one never recurses into the next
+		for (auto& Itr : Connections)
+		{
+			ProcessBufferedRequests(*Itr.second);
+		}
+
+		// drop closed connections, idle ones that have outstayed the keep alive, and half closed ones that have nothing left to send
+		const ServerTimePoint Now = std::chrono::steady_clock::now();
+		for (auto Itr = Connections.begin(); Itr != Connections.end(); )
+		{
+			FConnection& Connection = *Itr->second;
+			if (Connection.Socket != InvalidSocket && Connection.PendingRequest == nullptr && Connection.OutBuffer.empty() &&
+				(Connection.bReadClosed || Now - Connection.LastActivity > KeepAliveTimeout))
+			{
+				CloseConnection(Connection);
+			}
+
+			if (Connection.Socket == InvalidSocket)
+			{
+				Itr = Connections.erase(Itr);
+			}
+			else
+			{
+				++Itr;
+			}
+		}
+	}
+
+	for (auto& Itr : Connections)
+	{
+		CloseConnection(*Itr.second);
+	}
+	Connections.clear();
+}
+
+void FAsyncHttpServer::AcceptConnections()
+{
+	for (;;)
+	{
+		sockaddr_in Address = {};
+		socklen_t AddressLength = sizeof(Address);
+		FSocketHandle Socket = accept(ListenSocket, reinterpret_cast<sockaddr*>(&Address), &AddressLength);
+		if (Socket == InvalidSocket)
+		{
+			return;
+		}
+
+		if (!SetNonBlocking(Socket))
+		{
+			CloseSocket(Socket);
+			continue;
+		}
+
+		int NoDelay = 1;
+		setsockopt(Socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&NoDelay), sizeof(NoDelay));
+
+		char AddressBuffer[INET_ADDRSTRLEN] = {};
+		inet_ntop(AF_INET, &Address.sin_addr, AddressBuffer, sizeof(AddressBuffer));
+
+		FConnectionPtr Connection(new FConnection());
+		Connection->Id = NextConnectionId++;
+		Connection->Socket = Socket;
+		Connection->RemoteAddr = AddressBuffer;
+		Connection->LastActivity = std::chrono::steady_clock::now();
+		Connections.emplace(Connection->Id, std::move(Connection));
+	}
+}
+
+void FAsyncHttpServer::ReadFromConnection(FConnection& Connection)
+{
+	char Buffer[16 * 1024];
+	for (;;)
+	{
+		const int BytesRead = static_cast<int>(recv(Connection.Socket, Buffer, sizeof(Buffer), 0));
+		if (BytesRead > 0)
+		{
+			Connection.InBuffer.append(Buffer, BytesRead);
+			Connection.LastActivity = std::chrono::steady_clock::now();
+			if (Connection.InBuffer.size() > MaxRequestSize)
+			{
+				break;
+			}
+		}
+		else if (BytesRead < 0 && IsWouldBlock())
+		{
+			break;
+		}
+		else if (BytesRead == 0)
+		{
+			// the client won't send anything more, but may still be waiting for the responses to what it sent
+			Connection.bReadClosed = true;
+			break;
+		}
+		else
+		{
+			CloseConnection(Connection);
+			return;
+		}
+	}
+}
+
+void FAsyncHttpServer::WriteToConnection(FConnection& Connection)
+{
+	while (Connection.OutOffset < Connection.OutBuffer.size())
+	{
+		const int BytesSent = static_cast<int>(send(Connection.Socket, Connection.OutBuffer.data() + Connection.OutOffset, static_cast<int>(Connection.OutBuffer.size() - Connection.OutOffset), SendFlags));
+		if (BytesSent > 0)
+		{
+			Connection.OutOffset += BytesSent;
+		}
+		else if (BytesSent < 0 && IsWouldBlock())
+		{
+			return;
+		}
+		else
+		{
+			CloseConnection(Connection);
+			return;
+		}
+	}
+
+	Connection.OutBuffer.clear();
+	Connection.OutOffset = 0;
+	Connection.LastActivity = std::chrono::steady_clock::now();
+
+	if (Connection.bClosing)
+	{
+		CloseConnection(Connection);
+	}
+}
+
+void FAsyncHttpServer::ProcessRequest(FConnection& Connection)
+{
+	if (Connection.Socket == InvalidSocket || Connection.PendingRequest != nullptr || Connection.bClosing)
+	{
+		return;
+	}
+
+	const size_t HeaderEnd = Connection.InBuffer.find("\r\n\r\n");
+	if (HeaderEnd == std::string::npos)
+	{
+		if (Connection.InBuffer.size() > MaxRequestSize)
+		{
+			Connection.bKeepAlive = false;
+			QueueResponse(Connection, 413, std::string(), nullptr);
+		}
+		return;
+	}
+
+	std::unique_ptr<FHttpRequest> Request(new FHttpRequest());
+	Request->RemoteAddr = Connection.RemoteAddr;
+
+	// request line
+	size_t LineEnd = Connection.InBuffer.find("\r\n");
+	std::string Target;
+	std::string Version;
+	{
+		const std::string RequestLine = Connection.InBuffer.substr(0, LineEnd);
+		const size_t MethodEnd = RequestLine.find(' ');
+		const size_t TargetEnd = MethodEnd == std::string::npos ? std::string::npos : RequestLine.find(' ', MethodEnd + 1);
+		if (TargetEnd == std::string::npos)
+		{
+			Connection.bKeepAlive = false;
+			QueueResponse(Connection, 400, std::string(), nullptr);
+			return;
+		}
+		Request->Method = RequestLine.substr(0, MethodEnd);
+		Target = RequestLine.substr(MethodEnd + 1, TargetEnd - MethodEnd - 1);
+		Version = RequestLine.substr(TargetEnd + 1);
+	}
+
+	// headers, only the ones needed to frame the request
+	size_t ContentLength = 0;
+	std::string ConnectionHeader;
+	while (LineEnd < HeaderEnd)
+	{
+		const size_t LineBegin = LineEnd + 2;
+		LineEnd = Connection.InBuffer.find("\r\n", LineBegin);
+
+		const std::string Line = Connection.InBuffer.substr(LineBegin, LineEnd - LineBegin);
+		const size_t Separator = Line.find(':');
+		if (Separator == std::string::npos)
+		{
+			continue;
+		}
+
+		const std::string Name = Line.substr(0, Separator);
+		if (EqualsIgnoreCase(Name, "Content-Length"))
+		{
+			ContentLength = static_cast<size_t>(strtoull(Trim(Line.substr(Separator + 1)).c_str(), nullptr, 10));
+		}
+		else if (EqualsIgnoreCase(Name, "Connection"))
+		{
+			ConnectionHeader = Trim(Line.substr(Separator + 1));
+		}
+	}
+
+	Connection.bKeepAlive = Version == "HTTP/1.1" ? !EqualsIgnoreCase(ConnectionHeader, "close") : EqualsIgnoreCase(ConnectionHeader, "keep-alive");
+
+	if (ContentLength > MaxRequestSize)
+	{
+		Connection.bKeepAlive = false;
+		QueueResponse(Connection, 413, std::string(), nullptr);
+		return;
+	}
+
+	const size_t BodyBegin = HeaderEnd + 4;
+	if (Connection.InBuffer.size() < BodyBegin + ContentLength)
+	{
+		// wait for the rest of the body
+		return;
+	}
+
+	Request->Body = Connection.InBuffer.substr(BodyBegin, ContentLength);
+	Connection.InBuffer.erase(0, BodyBegin + ContentLength);
+
+	const size_t QueryBegin = Target.find('?');
+	Request->Path = Target.substr(0, QueryBegin);
+	if (QueryBegin != std::string::npos)
+	{
+		ParseQuery(Target.substr(QueryBegin + 1), Request->Params);
+	}
+
+	const FRoute* MatchedRoute = nullptr;
+	std::smatch Matches;
+	for (const FRoute& Route : Routes)
+	{
+		if (Route.Method == Request->Method && std::regex_match(Request->Path, Matches, Route.Pattern))
+		{
+			MatchedRoute = &Route;
+			for (const auto& Match : Matches)
+			{
+				Request->Matches.push_back(Match.str());
+			}
+			break;
+		}
+	}
+
+	Connection.PendingRequest = std::move(Request);
+
+	if (MatchedRoute == nullptr)
+	{
+		QueueResponse(Connection, 404, std::string(), nullptr);
+		return;
+	}
+
+	// the handler may respond right away or hold on to the responder, either way the response is delivered by the loop
+	FHttpResponderPtr Responder = std::make_shared<FHttpResponder>(ResponseQueue, Connection.Id);
+	try
+	{
+		MatchedRoute->Handler(*Connection.PendingRequest, Responder);
+	}
+	catch (const std::exception& Exception)
+	{
+		FDebugLog::LogError(L"Http handler failed: %ls", FStringUtils::Widen(Exception.what()).c_str());
+		Responder->Respond(500);
+	}
+}
+
+void FAsyncHttpServer::ProcessBufferedRequests(FConnection& Connection)
+{
+	while (Connection.Socket != InvalidSocket && Connection.PendingRequest == nullptr && !Connection.bClosing && !Connection.InBuffer.empty())
+	{
+		const size_t BufferedSize = Connection.InBuffer.size();
+		ProcessRequest(Connection);
+		if (Connection.InBuffer.size() == BufferedSize)
+		{
+			// the next request isn't complete yet
+			break;
+		}
+	}
+}
+
+void FAsyncHttpServer::QueueResponse(FConnection& Connection, int Status, const std::string& Body, const char* ContentType)
+{
+	if (Logger && Connection.PendingRequest != nullptr)
+	{
+		Logger(*Connection.PendingRequest, Status);
+	}
+	Connection.PendingRequest.reset();
+
+	std::string& Out = Connection.OutBuffer;
+	Out += "HTTP/1.1 ";
+	Out += std::to_string(Status);
+	Out += ' ';
+	Out += GetStatusText(Status);
+	Out += "\r\n";
+	if (Status != 204)
+	{
+		if (ContentType != nullptr && ContentType[0] != '\0')
+		{
+			Out += "Content-Type: ";
+			Out += ContentType;
+			Out += "\r\n";
+		}
+		Out += "Content-Length: ";
+		Out += std::to_string(Body.size());
+		Out += "\r\n";
+	}
+	Out += Connection.bKeepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+	if (Status != 204)
+	{
+		Out += Body;
+	}
+
+	Connection.bClosing = !Connection.bKeepAlive;
+	WriteToConnection(Connection);
+}
+
+void FAsyncHttpServer::DeliverResponses()
+{
+	std::vector<FHttpResponseQueue::FResponse> Responses;
+	{
+		FScopedLock Lock(ResponseQueue->Mutex);
+		std::swap(Responses, ResponseQueue->Responses);
+	}
+
+	for (const FHttpResponseQueue::FResponse& Response : Responses)
+	{
+		// the connection may have been closed while the response was pending
+		auto Itr = Connections.find(Response.ConnectionId);
+		if (Itr != Connections.end() && Itr->second->Socket != InvalidSocket && Itr->second->PendingRequest != nullptr)
+		{
+			QueueResponse(*Itr->second, Response.Status, Response.Body, Response.ContentType.c_str());
+		}
+	}
+}
+
+void FAsyncHttpServer::CloseConnection(FConnection& Connection)
+{
+	if (Connection.Socket != InvalidSocket)
+	{
+		CloseSocket(Connection.Socket);
+		Connection.Socket = InvalidSocket;
+	}
+	Connection.PendingRequest.reset();
+}
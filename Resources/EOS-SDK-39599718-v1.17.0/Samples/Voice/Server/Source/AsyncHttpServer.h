@@ -0,0 +1,142 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "NonCopyable.h"
+
+#include <functional>
+#include <regex>
+
+#ifdef _WIN32
+#include <winsock2.h>
+using FSocketHandle = SOCKET;
+#else
+using FSocketHandle = int;
+#endif
+
+/** An http request as seen by FAsyncHttpServer handlers */
+class FHttpRequest
+{
+public:
+	std::string Method;
+	std::string Path;
+	std::string Body;
+	std::string RemoteAddr;
+
+	/** Sub-matches of the route pattern, Matches[0] is the whole path */
+	std::vector<std::string> Matches;
+
+	/** Decoded query parameters */
+	std::multimap<std::string, std::string> Params;
+
+	bool HasParam(const std::string& Key) const { return Params.find(Key) != Params.end(); }
+	std::string GetParamValue(const std::string& Key) const;
+};
+
+class FHttpResponseQueue;
+
+/** Completes a single http request. May be used from any thread, and is kept alive for as long as the response is pending.
+  * Responding more than once has no effect, and a responder that is destroyed without responding answers with 500.
+  */
+class FHttpResponder : public FNonCopyable
+{
+public:
+	FHttpResponder(const std::shared_ptr<FHttpResponseQueue>& InQueue, uint64_t InConnectionId) : Queue(InQueue), ConnectionId(InConnectionId) {}
+	~FHttpResponder();
+
+	/** Takes the body by value, so a body built for the response is moved all the way into the connection */
+	void Respond(int Status, std::string Body = std::string(), const char* ContentType = nullptr);
+
+private:
+	std::shared_ptr<FHttpResponseQueue> Queue;
+	uint64_t ConnectionId = 0;
+	std::atomic<bool> bResponded{ false };
+};
+using FHttpResponderPtr = std::shared_ptr<FHttpResponder>;
+
+/** Minimal HTTP/1.1 server running every connection on a single event loop thread.
+  * Handlers are called on the loop thread and must not block. They pass their response to the FHttpResponder once it's ready,
+  * which may be much later and from another thread, e.g. when an EOS SDK request completes on the main thread.
+  * Each connection has at most one request in flight, pipelined requests are read once the previous one has been answered.
+  */
+class FAsyncHttpServer : public FNonCopyable
+{
+public:
+	using FHandler = std::function<void(const FHttpRequest&, const FHttpResponderPtr&)>;
+	using FLogger = std::function<void(const FHttpRequest&, int Status)>;
+
+	FAsyncHttpServer();
+	~FAsyncHttpServer();
+
+	void Post(const std::string& Pattern, FHandler Handler);
+	void SetLogger(FLogger InLogger) { Logger = std::move(InLogger); }
+
+	/** Binds the listen socket, returns false if the port can't be used */
+	bool Bind(const char* Host, unsigned short Port);
+
+	/** Runs the event loop on the calling thread until Stop is called */
+	void Run();
+
+	/** Stops the event loop, may be called from any thread */
+	void Stop();
+
+	/** Requests larger than this are refused */
+	static constexpr size_t MaxRequestSize = 64 * 1024;
+
+	/** Connections without a request in flight are closed after this long */
+	static constexpr std::chrono::seconds KeepAliveTimeout{ 5 };
+
+private:
+	struct FRoute
+	{
+		std::string Method;
+		std::regex Pattern;
+		FHandler Handler;
+	};
+
+	struct FConnection
+	{
+		uint64_t Id = 0;
+		FSocketHandle Socket;
+		std::string RemoteAddr;
+
+		std::string InBuffer;
+		std::string OutBuffer;
+		size_t OutOffset = 0;
+
+		/** The request that is waiting for its responder, kept for the logger */
+		std::unique_ptr<FHttpRequest> PendingRequest;
+
+		bool bKeepAlive = true;
+		bool bClosing = false;
+
+		/** The client has shut down its side. Buffered requests are still answered, then the connection is closed */
+		bool bReadClosed = false;
+		ServerTimePoint LastActivity;
+	};
+	using FConnectionPtr = std::unique_ptr<FConnection>;
+
+	void AcceptConnections();
+	void ReadFromConnection(FConnection& Connection);
+	void WriteToConnection(FConnection& Connection);
+
+	/** Parses and dispatches the next buffered request, if complete and nothing else is in flight */
+	void ProcessRequest(FConnection& Connection);
+
+	/** Processes buffered requests one after another until one is left waiting for its responder or no complete request is left */
+	void ProcessBufferedRequests(FConnection& Connection);
+
+	void QueueResponse(FConnection& Connection, int Status, const std::string& Body, const char* ContentType);
+	void DeliverResponses();
+	void CloseConnection(FConnection& Connection);
+
+	std::vector<FRoute> Routes;
+	FLogger Logger;
+
+	FSocketHandle ListenSocket;
+	std::shared_ptr<FHttpResponseQueue> ResponseQueue;
+	std::atomic<bool> bIsRunning{ false };
+
+	uint64_t NextConnectionId = 1;
+	std::unordered_map<uint64_t, FConnectionPtr> Connections;
+};
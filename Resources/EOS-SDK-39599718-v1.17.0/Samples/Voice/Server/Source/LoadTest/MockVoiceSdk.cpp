@@ -0,0 +1,246 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "MockVoiceSdk.h"
+
+#include <eos_logging.h>
+#include <eos_rtc_admin.h>
+
+#include <cstring>
+
+/** The mock platform, callbacks are queued with the time they are due and called from EOS_Platform_Tick */
+struct EOS_PlatformHandle
+{
+	struct FPendingCallback
+	{
+		ServerTimePoint DueAt;
+		std::function<void()> Callback;
+	};
+
+	std::chrono::milliseconds ResponseDelay;
+
+	/** All callbacks have the same delay, so the queue is in due order */
+	std::deque<FPendingCallback> PendingCallbacks;
+
+	/** Users of each token query, by QueryId, until its callback has returned */
+	std::unordered_map<uint32_t, std::vector<EOS_ProductUserId>> TokenQueries;
+	uint32_t NextQueryId = 1;
+};
+
+struct EOS_RTCAdminHandle
+{
+	EOS_PlatformHandle* Platform;
+};
+
+struct EOS_ProductUserIdDetails
+{
+	std::string Id;
+};
+
+namespace
+{
+	/** Product user ids are interned like the real SDK does, so the same string always gives the same handle.
+	  * FromString is called from the http thread as well as the main thread. */
+	class FProductUserIds
+	{
+	public:
+		EOS_ProductUserId FromString(const char* Id)
+		{
+			{
+				std::shared_lock<std::shared_timed_mutex> Lock(Mutex);
+				auto Itr = Ids.find(Id);
+				if (Itr != Ids.end())
+				{
+					return Itr->second.get();
+				}
+			}
+
+			std::unique_lock<std::shared_timed_mutex> Lock(Mutex);
+			std::unique_ptr<EOS_ProductUserIdDetails>& Details = Ids[Id];
+			if (Details == nullptr)
+			{
+				Details.reset(new EOS_ProductUserIdDetails{ Id });
+			}
+			return Details.get();
+		}
+
+	private:
+		std::shared_timed_mutex Mutex;
+		std::unordered_map<std::string, std::unique_ptr<EOS_ProductUserIdDetails>> Ids;
+	};
+
+	FProductUserIds ProductUserIds;
+
+	void QueueCallback(EOS_PlatformHandle* Platform, std::function<void()>&& Callback)
+	{
+		Platform->PendingCallbacks.push_back(EOS_PlatformHandle::FPendingCallback{ std::chrono::steady_clock::now() + Platform->ResponseDelay, std::move(Callback) });
+	}
+}
+
+FMockVoiceSdk::FMockVoiceSdk(std::chrono::milliseconds InResponseDelay) :
+	ResponseDelay(InResponseDelay)
+{
+}
+
+FMockVoiceSdk::~FMockVoiceSdk()
+{
+}
+
+EOS_Bool FMockVoiceSdk::LoadAndInitSdk()
+{
+	MockPlatform.reset(new EOS_PlatformHandle());
+	MockPlatform->ResponseDelay = ResponseDelay;
+	MockRTCAdmin.reset(new EOS_RTCAdminHandle{ MockPlatform.get() });
+
+	PlatformHandle = MockPlatform.get();
+	RTCAdminHandle = MockRTCAdmin.get();
+	return EOS_TRUE;
+}
+
+// The EOS SDK functions used by the voice server. Everything runs on the main thread, apart from EOS_ProductUserId_FromString.
+
+EOS_DECLARE_FUNC(EOS_EResult) EOS_Initialize(const EOS_InitializeOptions* /*Options*/)
+{
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_DECLARE_FUNC(EOS_EResult) EOS_Shutdown()
+{
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_DECLARE_FUNC(EOS_EResult) EOS_Logging_SetCallback(EOS_LogMessageFunc /*Callback*/)
+{
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_DECLARE_FUNC(EOS_EResult) EOS_Logging_SetLogLevel(EOS_ELogCategory /*LogCategory*/, EOS_ELogLevel /*LogLevel*/)
+{
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_DECLARE_FUNC(EOS_HPlatform) EOS_Platform_Create(const EOS_Platform_Options* /*Options*/)
+{
+	// FMockVoiceSdk sets up its own platform
+	return nullptr;
+}
+
+EOS_DECLARE_FUNC(EOS_HRTCAdmin) EOS_Platform_GetRTCAdminInterface(EOS_HPlatform /*Handle*/)
+{
+	return nullptr;
+}
+
+EOS_DECLARE_FUNC(void) EOS_Platform_Tick(EOS_HPlatform Handle)
+{
+	const ServerTimePoint Now = std::chrono::steady_clock::now();
+	while (!Handle->PendingCallbacks.empty() && Handle->PendingCallbacks.front().DueAt <= Now)
+	{
+		std::function<void()> Callback = std::move(Handle->PendingCallbacks.front().Callback);
+		Handle->PendingCallbacks.pop_front();
+		Callback();
+	}
+}
+
+EOS_DECLARE_FUNC(const char*) EOS_EResult_ToString(EOS_EResult Result)
+{
+	return Result == EOS_EResult::EOS_Success ? "EOS_Success" : "EOS_MockFailure";
+}
+
+EOS_DECLARE_FUNC(EOS_Bool) EOS_EResult_IsOperationComplete(EOS_EResult Result)
+{
+	return Result != EOS_EResult::EOS_OperationWillRetry;
+}
+
+EOS_DECLARE_FUNC(EOS_ProductUserId) EOS_ProductUserId_FromString(const char* ProductUserIdString)
+{
+	return ProductUserIds.FromString(ProductUserIdString);
+}
+
+EOS_DECLARE_FUNC(EOS_EResult) EOS_ProductUserId_ToString(EOS_ProductUserId AccountId, char* OutBuffer, int32_t* InOutBufferLength)
+{
+	const int32_t Length = static_cast<int32_t>(AccountId->Id.size()) + 1;
+	if (*InOutBufferLength < Length)
+	{
+		*InOutBufferLength = Length;
+		return EOS_EResult::EOS_LimitExceeded;
+	}
+
+	memcpy(OutBuffer, AccountId->Id.c_str(), Length);
+	*InOutBufferLength = Length;
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_DECLARE_FUNC(void) EOS_RTCAdmin_QueryJoinRoomToken(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_QueryJoinRoomTokenOptions* Options, void* ClientData, const EOS_RTCAdmin_OnQueryJoinRoomTokenCompleteCallback CompletionDelegate)
+{
+	EOS_PlatformHandle* Platform = Handle->Platform;
+
+	const uint32_t QueryId = Platform->NextQueryId++;
+	Platform->TokenQueries[QueryId].assign(Options->TargetUserIds, Options->TargetUserIds + Options->TargetUserIdsCount);
+
+	const std::string RoomName = Options->RoomName;
+	QueueCallback(Platform, [Platform, QueryId, RoomName, ClientData, CompletionDelegate]() {
+		EOS_RTCAdmin_QueryJoinRoomTokenCompleteCallbackInfo Data = {};
+		Data.ResultCode = EOS_EResult::EOS_Success;
+		Data.ClientData = ClientData;
+		Data.RoomName = RoomName.c_str();
+		Data.ClientBaseUrl = "wss://mock.voice.invalid";
+		Data.QueryId = QueryId;
+		Data.TokenCount = static_cast<uint32_t>(Platform->TokenQueries[QueryId].size());
+		CompletionDelegate(&Data);
+
+		Platform->TokenQueries.erase(QueryId);
+	});
+}
+
+EOS_DECLARE_FUNC(EOS_EResult) EOS_RTCAdmin_CopyUserTokenByIndex(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_CopyUserTokenByIndexOptions* Options, EOS_RTCAdmin_UserToken** OutUserToken)
+{
+	auto Itr = Handle->Platform->TokenQueries.find(Options->QueryId);
+	if (Itr == Handle->Platform->TokenQueries.end() || Options->UserTokenIndex >= Itr->second.size())
+	{
+		return EOS_EResult::EOS_NotFound;
+	}
+
+	const EOS_ProductUserId ProductUserId = Itr->second[Options->UserTokenIndex];
+	const std::string Token = "mock-token-" + ProductUserId->Id;
+
+	char* TokenCopy = new char[Token.size() + 1];
+	memcpy(TokenCopy, Token.c_str(), Token.size() + 1);
+
+	EOS_RTCAdmin_UserToken* UserToken = new EOS_RTCAdmin_UserToken();
+	UserToken->ApiVersion = EOS_RTCADMIN_USERTOKEN_API_LATEST;
+	UserToken->ProductUserId = ProductUserId;
+	UserToken->Token = TokenCopy;
+
+	*OutUserToken = UserToken;
+	return EOS_EResult::EOS_Success;
+}
+
+EOS_DECLARE_FUNC(void) EOS_RTCAdmin_UserToken_Release(EOS_RTCAdmin_UserToken* UserToken)
+{
+	if (UserToken != nullptr)
+	{
+		delete[] UserToken->Token;
+		delete UserToken;
+	}
+}
+
+EOS_DECLARE_FUNC(void) EOS_RTCAdmin_Kick(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_KickOptions* /*Options*/, void* ClientData, const EOS_RTCAdmin_OnKickCompleteCallback CompletionDelegate)
+{
+	QueueCallback(Handle->Platform, [ClientData, CompletionDelegate]() {
+		EOS_RTCAdmin_KickCompleteCallbackInfo Data = {};
+		Data.ResultCode = EOS_EResult::EOS_Success;
+		Data.ClientData = ClientData;
+		CompletionDelegate(&Data);
+	});
+}
+
+EOS_DECLARE_FUNC(void) EOS_RTCAdmin_SetParticipantHardMute(EOS_HRTCAdmin Handle, const EOS_RTCAdmin_SetParticipantHardMuteOptions* /*Options*/, void* ClientData, const EOS_RTCAdmin_OnSetParticipantHardMuteCompleteCallback CompletionDelegate)
+{
+	QueueCallback(Handle->Platform, [ClientData, CompletionDelegate]() {
+		EOS_RTCAdmin_SetParticipantHardMuteCompleteCallbackInfo Data = {};
+		Data.ResultCode = EOS_EResult::EOS_Success;
+		Data.ClientData = ClientData;
+		CompletionDelegate(&Data);
+	});
+}
@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "VoiceSdk.h"
+
+/** FVoiceSdk running against an in-process stand-in for the EOS SDK, so the voice server can be load tested without a deployment.
+  * MockVoiceSdk.cpp provides the EOS SDK functions the server uses. Every request succeeds, join requests with canned tokens,
+  * and completes from Tick once ResponseDelay has passed, just like a real SDK callback would.
+  */
+class FMockVoiceSdk : public FVoiceSdk
+{
+public:
+	explicit FMockVoiceSdk(std::chrono::milliseconds InResponseDelay);
+	virtual ~FMockVoiceSdk();
+
+	virtual EOS_Bool LoadAndInitSdk() override;
+
+private:
+	std::chrono::milliseconds ResponseDelay;
+
+	std::unique_ptr<EOS_PlatformHandle> MockPlatform;
+	std::unique_ptr<EOS_RTCAdminHandle> MockRTCAdmin;
+};
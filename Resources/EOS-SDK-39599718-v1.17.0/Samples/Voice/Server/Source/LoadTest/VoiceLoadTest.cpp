@@ -0,0 +1,479 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "MockVoiceSdk.h"
+#include "VoiceApi.h"
+#include "VoiceHost.h"
+
+#include "DebugLog.h"
+#include "StringUtils.h"
+#include "CommandLine.h"
+
+#include "httplib/httplib.h"
+#include "rapidjson/document.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+/** Load test for the voice server. Runs the real http api and session host in process, against FMockVoiceSdk,
+  * and drives it with many concurrent clients, each repeatedly creating a session, joining users, heartbeating, muting and kicking.
+  *
+  * Usage: VoiceServerLoadTest -clients 64 -duration 10 -delay 20 -tickms 5 -users 4 -port 18235 -voicerequestspertick 32
+  */
+namespace
+{
+	/** The requests a client makes, in the order it makes them */
+	enum class ELoadTestOp : uint8_t
+	{
+		CreateSession,
+		Join,
+		Heartbeat,
+		Mute,
+		Kick,
+		Count
+	};
+
+	const char* const OpNames[] = { "session", "join", "heartbeat", "mute", "kick" };
+
+	struct FLoadTestOptions
+	{
+		size_t NumClients = 64;
+		std::chrono::seconds Duration{ 10 };
+		std::chrono::milliseconds ResponseDelay{ 20 };
+		std::chrono::milliseconds TickInterval{ 5 };
+		size_t UsersPerSession = 4;
+		unsigned short Port = 18235;
+		size_t RequestsPerTick = 32;
+	};
+
+	/** Latencies and failures of each operation, recorded by one client thread and merged once it's done */
+	struct FLoadTestResults
+	{
+		std::vector<std::chrono::microseconds> Latencies[static_cast<size_t>(ELoadTestOp::Count)];
+		uint64_t NumErrors[static_cast<size_t>(ELoadTestOp::Count)] = {};
+
+		void Append(FLoadTestResults&& Other)
+		{
+			for (size_t Op = 0; Op < static_cast<size_t>(ELoadTestOp::Count); ++Op)
+			{
+				Latencies[Op].insert(Latencies[Op].end(), Other.Latencies[Op].begin(), Other.Latencies[Op].end());
+				NumErrors[Op] += Other.NumErrors[Op];
+			}
+		}
+	};
+
+	size_t GetSizeParam(const wchar_t* Name, size_t Default)
+	{
+		if (FCommandLine::Get().HasParam(Name))
+		{
+			try
+			{
+				return static_cast<size_t>(std::stoul(FCommandLine::Get().GetParamValue(Name)));
+			}
+			catch (const std::exception&)
+			{
+				FDebugLog::LogError(L"Error: Can't parse %ls, using %d", Name, static_cast<int>(Default));
+			}
+		}
+		return Default;
+	}
+
+	/** Product user ids are 32 hex digits */
+	std::string MakeProductUserId(size_t Client, uint64_t Iteration, size_t User)
+	{
+		char Buffer[33];
+		snprintf(Buffer, sizeof(Buffer), "%08x%016llx%08x", static_cast<unsigned>(Client), static_cast<unsigned long long>(Iteration), static_cast<unsigned>(User));
+		return Buffer;
+	}
+
+	/** Runs a single client until Deadline, one request at a time over a keep-alive connection */
+	FLoadTestResults RunClient(const FLoadTestOptions& Options, size_t Client, ServerTimePoint Deadline)
+	{
+		FLoadTestResults Results;
+
+		httplib::Client Http("127.0.0.1", Options.Port);
+		Http.set_keep_alive(true);
+		Http.set_tcp_nodelay(true);
+
+		// posts a request and records its latency, returns false (and counts an error) unless it's answered with ExpectedStatus
+		std::string ResponseBody;
+		auto Post = [&Http, &Results, &ResponseBody](ELoadTestOp Op, const std::string& Path, const std::string& Body, int ExpectedStatus) -> bool {
+			const ServerTimePoint Start = std::chrono::steady_clock::now();
+			httplib::Result Response = Http.Post(Path.c_str(), Body, "application/json");
+			const ServerTimePoint End = std::chrono::steady_clock::now();
+
+			const size_t OpIndex = static_cast<size_t>(Op);
+			Results.Latencies[OpIndex].push_back(std::chrono::duration_cast<std::chrono::microseconds>(End - Start));
+			if (!Response || Response->status != ExpectedStatus)
+			{
+				++Results.NumErrors[OpIndex];
+				return false;
+			}
+			ResponseBody = std::move(Response->body);
+			return true;
+		};
+
+		for (uint64_t Iteration = 0; std::chrono::steady_clock::now() < Deadline; ++Iteration)
+		{
+			const std::string OwnerId = MakeProductUserId(Client, Iteration, 0);
+
+			if (!Post(ELoadTestOp::CreateSession, "/session", "{\"puid\":\"" + OwnerId + "\"}", 200))
+			{
+				continue;
+			}
+
+			rapidjson::Document Doc;
+			Doc.Parse(ResponseBody.c_str());
+			if (Doc.HasParseError() || !Doc.HasMember("sessionId") || !Doc.HasMember("ownerLock"))
+			{
+				++Results.NumErrors[static_cast<size_t>(ELoadTestOp::CreateSession)];
+				continue;
+			}
+			const std::string SessionPath = std::string("/session/") + Doc["sessionId"].GetString();
+			const std::string LockBody = std::string("{\"lock\":\"") + Doc["ownerLock"].GetString() + "\"";
+
+			std::vector<std::string> UserIds;
+			for (size_t User = 1; User <= Options.UsersPerSession; ++User)
+			{
+				UserIds.push_back(MakeProductUserId(Client, Iteration, User));
+				Post(ELoadTestOp::Join, SessionPath + "/join/" + UserIds.back(), std::string(), 200);
+			}
+
+			Post(ELoadTestOp::Heartbeat, SessionPath + "/heartbeat", LockBody + "}", 204);
+
+			for (const std::string& UserId : UserIds)
+			{
+				Post(ELoadTestOp::Mute, SessionPath + "/mute/" + UserId, LockBody + ",\"mute\":true}", 204);
+			}
+
+			for (const std::string& UserId : UserIds)
+			{
+				Post(ELoadTestOp::Kick, SessionPath + "/kick/" + UserId, LockBody + "}", 204);
+			}
+		}
+
+		return Results;
+	}
+
+	/** Sends NumRequests pipelined requests for an unknown route on one connection, then half closes it.
+	  * The server must answer every one of them with a 404 before closing its side. Returns false otherwise.
+	  */
+	bool CheckPipelinedRequests(unsigned short Port, size_t NumRequests)
+	{
+#ifdef _WIN32
+		using FSocketHandle = SOCKET;
+		const FSocketHandle InvalidSocket = INVALID_SOCKET;
+		const int ShutdownSend = SD_SEND;
+		auto CloseSocket = [](FSocketHandle Socket) { closesocket(Socket); };
+#else
+		using FSocketHandle = int;
+		const FSocketHandle InvalidSocket = -1;
+		const int ShutdownSend = SHUT_WR;
+		auto CloseSocket = [](FSocketHandle Socket) { close(Socket); };
+#endif
+		FSocketHandle Socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (Socket == InvalidSocket)
+		{
+			return false;
+		}
+
+		sockaddr_in Address = {};
+		Address.sin_family = AF_INET;
+		Address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		Address.sin_port = htons(Port);
+		if (connect(Socket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0)
+		{
+			CloseSocket(Socket);
+			return false;
+		}
+
+		std::string Requests;
+		for (size_t Index = 0; Index < NumRequests; ++Index)
+		{
+			Requests += "POST /x HTTP/1.1\r\nContent-Length: 0\r\n\r\n";
+		}
+
+		// the server keeps reading while it answers, so all of it can be sent before anything is read back
+		bool bSent = true;
+		for (size_t Offset = 0; bSent && Offset < Requests.size(); )
+		{
+			const int BytesSent = static_cast<int>(send(Socket, Requests.data() + Offset, static_cast<int>(Requests.size() - Offset), 0));
+			bSent = BytesSent > 0;
+			Offset += bSent ? BytesSent : 0;
+		}
+		shutdown(Socket, ShutdownSend);
+
+		std::string Responses;
+		char Buffer[16 * 1024];
+		for (;;)
+		{
+			const int BytesRead = static_cast<int>(recv(Socket, Buffer, sizeof(Buffer), 0));
+			if (BytesRead <= 0)
+			{
+				break;
+			}
+			Responses.append(Buffer, BytesRead);
+		}
+		CloseSocket(Socket);
+
+		size_t NumAnswered = 0;
+		for (size_t Offset = Responses.find("HTTP/1.1 404"); Offset != std::string::npos; Offset = Responses.find("HTTP/1.1 404", Offset + 1))
+		{
+			++NumAnswered;
+		}
+		printf("Pipelined %d requests, %d answered before the server closed the connection\n", static_cast<int>(NumRequests), static_cast<int>(NumAnswered));
+		return bSent && NumAnswered == NumRequests;
+	}
+
+	/** Creates a session, then joins NumJoins users to it at once from as many connections, holding the main loop back until all the
+	  * join requests are queued. The joins are then made in the same ticks, and all but the first of each tick must be coalesced
+	  * into its token query. Returns false if a join fails or fewer were coalesced than that.
+	  */
+	bool CheckJoinCoalescing(const FLoadTestOptions& Options, FVoiceSdk& VoiceSdk, size_t NumJoins)
+	{
+		enum class EStage : int { Creating, Joining, Done };
+		std::atomic<EStage> Stage{ EStage::Creating };
+		std::atomic<size_t> NumJoined{ 0 };
+
+		// use a client index past the load test clients, so the user ids never clash with theirs
+		const size_t Client = Options.NumClients;
+		std::thread Driver([&Options, &Stage, &NumJoined, Client, NumJoins]() {
+			httplib::Client Http("127.0.0.1", Options.Port);
+			httplib::Result Response = Http.Post("/session", "{\"puid\":\"" + MakeProductUserId(Client, 0, 0) + "\"}", "application/json");
+
+			rapidjson::Document Doc;
+			if (Response && Response->status == 200)
+			{
+				Doc.Parse(Response->body.c_str());
+			}
+			if (!Response || Response->status != 200 || Doc.HasParseError() || !Doc.HasMember("sessionId"))
+			{
+				Stage = EStage::Done;
+				return;
+			}
+			const std::string SessionPath = std::string("/session/") + Doc["sessionId"].GetString();
+
+			Stage = EStage::Joining;
+			std::vector<std::thread> Joins;
+			for (size_t User = 1; User <= NumJoins; ++User)
+			{
+				Joins.emplace_back([&Options, &NumJoined, &SessionPath, Client, User]() {
+					httplib::Client JoinHttp("127.0.0.1", Options.Port);
+					httplib::Result JoinResponse = JoinHttp.Post((SessionPath + "/join/" + MakeProductUserId(Client, 0, User)).c_str(), std::string(), "application/json");
+					if (JoinResponse && JoinResponse->status == 200)
+					{
+						++NumJoined;
+					}
+				});
+			}
+			for (std::thread& Join : Joins)
+			{
+				Join.join();
+			}
+			Stage = EStage::Done;
+		});
+
+		const uint64_t CoalescedBefore = VoiceSdk.GetRequestStats().NumCoalesced;
+		const ServerTimePoint Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		bool bReleased = false;
+		while (Stage != EStage::Done && std::chrono::steady_clock::now() < Deadline)
+		{
+			if (Stage == EStage::Joining && !bReleased)
+			{
+				bReleased = VoiceSdk.GetRequestStats().QueueDepth >= NumJoins;
+				if (!bReleased)
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					continue;
+				}
+			}
+			VoiceSdk.Tick();
+			std::this_thread::sleep_for(Options.TickInterval);
+		}
+		Driver.join();
+
+		const uint64_t NumCoalesced = VoiceSdk.GetRequestStats().NumCoalesced - CoalescedBefore;
+		const size_t RequestsPerTick = std::max<size_t>(1, Options.RequestsPerTick);
+		const size_t NumExpected = NumJoins - (NumJoins + RequestsPerTick - 1) / RequestsPerTick;
+		printf("Joined %d users to one session at once, %d of %d join requests coalesced\n",
+			static_cast<int>(NumJoined.load()),
+			static_cast<int>(NumCoalesced),
+			static_cast<int>(NumJoins));
+		return NumJoined == NumJoins && NumCoalesced >= NumExpected;
+	}
+
+	std::chrono::microseconds GetPercentile(const std::vector<std::chrono::microseconds>& Sorted, double Percentile)
+	{
+		if (Sorted.empty())
+		{
+			return std::chrono::microseconds::zero();
+		}
+		const size_t Index = std::min(Sorted.size() - 1, static_cast<size_t>(Percentile * Sorted.size()));
+		return Sorted[Index];
+	}
+
+	void PrintLockStats(const char* Name, const FLockStats& Stats)
+	{
+		printf("%-24s %12llu acquired %10llu contended (%5.2f%%) %10.1fus avg wait\n",
+			Name,
+			static_cast<unsigned long long>(Stats.NumAcquired),
+			static_cast<unsigned long long>(Stats.NumContended),
+			Stats.NumAcquired > 0 ? 100.0 * Stats.NumContended / Stats.NumAcquired : 0.0,
+			Stats.NumContended > 0 ? Stats.TotalWait.count() / 1000.0 / Stats.NumContended : 0.0);
+	}
+
+	void PrintReport(FLoadTestResults& Results, std::chrono::duration<double> Elapsed, const FVoiceHost& VoiceHost, const FVoiceSdk& VoiceSdk)
+	{
+		printf("\n%-10s %10s %10s %8s %10s %10s %10s\n", "op", "requests", "req/s", "errors", "p50 ms", "p99 ms", "p999 ms");
+
+		uint64_t TotalRequests = 0;
+		for (size_t Op = 0; Op < static_cast<size_t>(ELoadTestOp::Count); ++Op)
+		{
+			std::vector<std::chrono::microseconds>& Latencies = Results.Latencies[Op];
+			std::sort(Latencies.begin(), Latencies.end());
+			TotalRequests += Latencies.size();
+
+			printf("%-10s %10llu %10.0f %8llu %10.2f %10.2f %10.2f\n",
+				OpNames[Op],
+				static_cast<unsigned long long>(Latencies.size()),
+				Latencies.size() / Elapsed.count(),
+				static_cast<unsigned long long>(Results.NumErrors[Op]),
+				GetPercentile(Latencies, 0.50).count() / 1000.0,
+				GetPercentile(Latencies, 0.99).count() / 1000.0,
+				GetPercentile(Latencies, 0.999).count() / 1000.0);
+		}
+		printf("%-10s %10llu %10.0f\n\n", "total", static_cast<unsigned long long>(TotalRequests), TotalRequests / Elapsed.count());
+
+		// the session index is sharded, so report the shards together and the one that was waited on most
+		const std::vector<FLockStats> ShardStats = VoiceHost.GetSessionShardLockStats();
+		FLockStats AllShards;
+		FLockStats BusiestShard;
+		for (const FLockStats& Stats : ShardStats)
+		{
+			AllShards += Stats;
+			if (Stats.TotalWait > BusiestShard.TotalWait || (Stats.TotalWait == BusiestShard.TotalWait && Stats.NumAcquired > BusiestShard.NumAcquired))
+			{
+				BusiestShard = Stats;
+			}
+		}
+		printf("Session index: %d shards\n", static_cast<int>(ShardStats.size()));
+		PrintLockStats("Session shards (sum)", AllShards);
+		PrintLockStats("Busiest session shard", BusiestShard);
+		PrintLockStats("VoiceSdk::RequestsMutex", VoiceSdk.GetRequestsLockStats());
+
+		const FVoiceRequestStats Stats = VoiceSdk.GetRequestStats();
+		printf("\nVoice requests: %llu made (%llu coalesced), peak queue %d, wait avg %.2fms max %.2fms\n",
+			static_cast<unsigned long long>(Stats.NumProcessed),
+			static_cast<unsigned long long>(Stats.NumCoalesced),
+			static_cast<int>(Stats.PeakQueueDepth),
+			Stats.NumProcessed > 0 ? Stats.TotalQueueWait.count() / 1000.0 / Stats.NumProcessed : 0.0,
+			Stats.MaxQueueWait.count() / 1000.0);
+	}
+}
+
+int main(int argc, const char* argv[])
+{
+	std::vector<std::wstring> CommandLineParams;
+	for (int i = 1; i < argc; ++i)
+	{
+		CommandLineParams.push_back(FStringUtils::Widen(argv[i]));
+	}
+	FCommandLine::Get().Init(CommandLineParams);
+
+	FLoadTestOptions Options;
+	Options.NumClients = std::max<size_t>(1, GetSizeParam(L"clients", Options.NumClients));
+	Options.Duration = std::chrono::seconds(GetSizeParam(L"duration", Options.Duration.count()));
+	Options.ResponseDelay = std::chrono::milliseconds(GetSizeParam(L"delay", Options.ResponseDelay.count()));
+	Options.TickInterval = std::chrono::milliseconds(GetSizeParam(L"tickms", Options.TickInterval.count()));
+	Options.UsersPerSession = GetSizeParam(L"users", Options.UsersPerSession);
+	Options.Port = static_cast<unsigned short>(GetSizeParam(CommandLineConstants::ServerPort, Options.Port));
+	Options.RequestsPerTick = GetSizeParam(CommandLineConstants::VoiceRequestsPerTick, Options.RequestsPerTick);
+
+	std::shared_ptr<FMockVoiceSdk> VoiceSdk = std::make_shared<FMockVoiceSdk>(Options.ResponseDelay);
+	VoiceSdk->LoadAndInitSdk();
+	VoiceSdk->SetMaxRequestsPerTick(Options.RequestsPerTick);
+
+	FVoiceHostPtr VoiceHost = FVoiceHostPtr(new FVoiceHost());
+	FVoiceApi Api(VoiceHost, VoiceSdk);
+	if (Api.Listen(Options.Port) == false)
+	{
+		fprintf(stderr, "Unable to listen on port %d\n", Options.Port);
+		return 1;
+	}
+
+	// enough requests to fill several reads, which used to answer each one a stack frame deeper than the last
+	if (!CheckPipelinedRequests(Options.Port, 4096))
+	{
+		fprintf(stderr, "Pipelined requests weren't all answered\n");
+		Api.Stop();
+		VoiceSdk->Shutdown();
+		return 1;
+	}
+
+	if (!CheckJoinCoalescing(Options, *VoiceSdk, 8))
+	{
+		fprintf(stderr, "Concurrent joins to one session weren't coalesced\n");
+		Api.Stop();
+		VoiceSdk->Shutdown();
+		return 1;
+	}
+
+	printf("%d clients for %ds, %d users per session, sdk delay %dms, tick %dms, %d requests per tick\n",
+		static_cast<int>(Options.NumClients),
+		static_cast<int>(Options.Duration.count()),
+		static_cast<int>(Options.UsersPerSession),
+		static_cast<int>(Options.ResponseDelay.count()),
+		static_cast<int>(Options.TickInterval.count()),
+		static_cast<int>(Options.RequestsPerTick));
+
+	const ServerTimePoint Start = std::chrono::steady_clock::now();
+	const ServerTimePoint Deadline = Start + Options.Duration;
+
+	std::vector<FLoadTestResults> ClientResults(Options.NumClients);
+	std::atomic<size_t> NumClientsRunning{ Options.NumClients };
+	std::vector<std::thread> Clients;
+	for (size_t Client = 0; Client < Options.NumClients; ++Client)
+	{
+		Clients.emplace_back([&Options, &ClientResults, &NumClientsRunning, Client, Deadline]() {
+			ClientResults[Client] = RunClient(Options, Client, Deadline);
+			--NumClientsRunning;
+		});
+	}
+
+	// main loop, as the server runs it, until every client is done
+	while (NumClientsRunning > 0)
+	{
+		VoiceSdk->Tick();
+		VoiceHost->RemoveExpiredSessions();
+		std::this_thread::sleep_for(Options.TickInterval);
+	}
+	const std::chrono::duration<double> Elapsed = std::chrono::steady_clock::now() - Start;
+
+	for (std::thread& Client : Clients)
+	{
+		Client.join();
+	}
+
+	Api.Stop();
+	VoiceSdk->Shutdown();
+
+	FLoadTestResults Results;
+	for (FLoadTestResults& Result : ClientResults)
+	{
+		Results.Append(std::move(Result));
+	}
+	PrintReport(Results, Elapsed, *VoiceHost, *VoiceSdk);
+
+	return 0;
+}
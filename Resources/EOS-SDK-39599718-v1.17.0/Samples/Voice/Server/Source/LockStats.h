@@ -0,0 +1,90 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+/** Contention counters of a TStatsMutex */
+struct FLockStats
+{
+	uint64_t NumAcquired = 0;
+	uint64_t NumContended = 0;
+	std::chrono::nanoseconds TotalWait = std::chrono::nanoseconds::zero();
+
+	FLockStats& operator+=(const FLockStats& Rhs)
+	{
+		NumAcquired += Rhs.NumAcquired;
+		NumContended += Rhs.NumContended;
+		TotalWait += Rhs.TotalWait;
+		return *this;
+	}
+};
+
+/** A mutex that counts how often it was found locked, and how long it was waited for.
+  * Counting is only compiled in with VOICESERVER_LOCK_STATS (as the load test is), otherwise this is just the wrapped mutex and GetStats returns zeros.
+  * Works with the standard lock guards, the shared lock functions are available when wrapping a shared mutex.
+  */
+template <typename MutexType>
+class TStatsMutex
+{
+public:
+	void lock()
+	{
+#if VOICESERVER_LOCK_STATS
+		if (!Mutex.try_lock())
+		{
+			const auto WaitStart = std::chrono::steady_clock::now();
+			Mutex.lock();
+			RecordWait(WaitStart);
+		}
+		NumAcquired.fetch_add(1, std::memory_order_relaxed);
+#else
+		Mutex.lock();
+#endif
+	}
+
+	bool try_lock() { return Mutex.try_lock(); }
+	void unlock() { Mutex.unlock(); }
+
+	void lock_shared()
+	{
+#if VOICESERVER_LOCK_STATS
+		if (!Mutex.try_lock_shared())
+		{
+			const auto WaitStart = std::chrono::steady_clock::now();
+			Mutex.lock_shared();
+			RecordWait(WaitStart);
+		}
+		NumAcquired.fetch_add(1, std::memory_order_relaxed);
+#else
+		Mutex.lock_shared();
+#endif
+	}
+
+	bool try_lock_shared() { return Mutex.try_lock_shared(); }
+	void unlock_shared() { Mutex.unlock_shared(); }
+
+	FLockStats GetStats() const
+	{
+		FLockStats Stats;
+#if VOICESERVER_LOCK_STATS
+		Stats.NumAcquired = NumAcquired.load(std::memory_order_relaxed);
+		Stats.NumContended = NumContended.load(std::memory_order_relaxed);
+		Stats.TotalWait = std::chrono::nanoseconds(WaitNs.load(std::memory_order_relaxed));
+#endif
+		return Stats;
+	}
+
+private:
+	MutexType Mutex;
+
+#if VOICESERVER_LOCK_STATS
+	void RecordWait(std::chrono::steady_clock::time_point WaitStart)
+	{
+		NumContended.fetch_add(1, std::memory_order_relaxed);
+		WaitNs.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - WaitStart).count()), std::memory_order_relaxed);
+	}
+
+	std::atomic<uint64_t> NumAcquired{ 0 };
+	std::atomic<uint64_t> NumContended{ 0 };
+	std::atomic<uint64_t> WaitNs{ 0 };
+#endif
+};
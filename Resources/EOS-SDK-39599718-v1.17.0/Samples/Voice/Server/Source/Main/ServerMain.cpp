@@ -110,6 +110,19 @@ int MasterMain(int Argc, const char* Args[])
 		return 1;
 	}
 
+	// parse how many voice requests are made per tick
+	if (FCommandLine::Get().HasParam(CommandLineConstants::VoiceRequestsPerTick))
+	{
+		try
+		{
+			EosVoiceSdk->SetMaxRequestsPerTick(static_cast<size_t>(std::stoul(FCommandLine::Get().GetParamValue(CommandLineConstants::VoiceRequestsPerTick))));
+		}
+		catch (const std::exception&)
+		{
+			FDebugLog::LogError(L"Error: Can't parse voice requests per tick.");
+		}
+	}
+
 	// start voice host on its own thread
 	FVoiceHostPtr VoiceHost = FVoiceHostPtr(new FVoiceHost());
 	FVoiceApi Api(VoiceHost, EosVoiceSdk);
@@ -123,6 +136,11 @@ int MasterMain(int Argc, const char* Args[])
 	FDebugLog::Log(L"Listening on port %d", Port);
 	FDebugLog::Log(L"(ctrl - c) to exit");
 
+	// report the voice request queue every so often while it's in use
+	const std::chrono::seconds RequestStatsInterval(10);
+	ServerTimePoint NextRequestStatsTime = std::chrono::steady_clock::now() + RequestStatsInterval;
+	uint64_t LastNumProcessed = 0;
+
 	// main loop
 	while (bIsRunning)
 	{
@@ -135,6 +153,24 @@ int MasterMain(int Argc, const char* Args[])
 		{
 			FDebugLog::Log(L"Removed %d expired sessions", NumRemoved);
 		}
+
+		if (std::chrono::steady_clock::now() >= NextRequestStatsTime)
+		{
+			NextRequestStatsTime += RequestStatsInterval;
+
+			const FVoiceRequestStats Stats = EosVoiceSdk->GetRequestStats();
+			if (Stats.NumProcessed != LastNumProcessed)
+			{
+				LastNumProcessed = Stats.NumProcessed;
+				FDebugLog::Log(L"Voice requests: %llu made (%llu coalesced), %d queued (peak %d), wait avg %.1fms max %.1fms",
+					static_cast<unsigned long long>(Stats.NumProcessed),
+					static_cast<unsigned long long>(Stats.NumCoalesced),
+					Stats.QueueDepth,
+					Stats.PeakQueueDepth,
+					Stats.TotalQueueWait.count() / 1000.0 / Stats.NumProcessed,
+					Stats.MaxQueueWait.count() / 1000.0);
+			}
+		}
 		
 		// simulate other server activity
 		std::this_thread::sleep_for(std::chrono::milliseconds(30));
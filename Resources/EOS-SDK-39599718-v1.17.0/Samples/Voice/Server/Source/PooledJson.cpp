@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pch.h"
+
+#include "PooledJson.h"
+
+#include <cstddef>
+
+constexpr size_t FPooledJsonDocument::ValueBufferSize;
+constexpr size_t FPooledJsonDocument::StackBufferSize;
+
+namespace
+{
+	/** Buffers shared by the pooled documents of one thread */
+	struct FThreadJsonBuffers
+	{
+		alignas(std::max_align_t) char ValueBuffer[FPooledJsonDocument::ValueBufferSize];
+		alignas(std::max_align_t) char StackBuffer[FPooledJsonDocument::StackBufferSize];
+
+		/** Keeps its capacity, so parsing only allocates when a request is larger than any before it on this thread */
+		std::vector<char> Text;
+
+		bool bInUse = false;
+	};
+
+	FThreadJsonBuffers& GetThreadJsonBuffers()
+	{
+		thread_local static FThreadJsonBuffers Buffers;
+		return Buffers;
+	}
+
+	/** Rapidjson output stream appending to a std::string */
+	class FStringOutputStream
+	{
+	public:
+		typedef char Ch;
+
+		explicit FStringOutputStream(std::string& InOut) : Out(InOut) {}
+
+		void Put(Ch Char) { Out.push_back(Char); }
+		void Flush() {}
+
+	private:
+		std::string& Out;
+	};
+
+	FJsonAllocator* CreateValueAllocator(bool bUsesThreadBuffers)
+	{
+		return bUsesThreadBuffers ?
+			new FJsonAllocator(GetThreadJsonBuffers().ValueBuffer, FPooledJsonDocument::ValueBufferSize) :
+			new FJsonAllocator();
+	}
+
+	FJsonAllocator* CreateStackAllocator(bool bUsesThreadBuffers)
+	{
+		return bUsesThreadBuffers ?
+			new FJsonAllocator(GetThreadJsonBuffers().StackBuffer, FPooledJsonDocument::StackBufferSize) :
+			new FJsonAllocator();
+	}
+}
+
+FPooledJsonDocument::FPooledJsonDocument() :
+	bUsesThreadBuffers(!GetThreadJsonBuffers().bInUse),
+	ValueAllocator(CreateValueAllocator(bUsesThreadBuffers)),
+	StackAllocator(CreateStackAllocator(bUsesThreadBuffers)),
+	Document(ValueAllocator.get(), FPooledJsonDocument::StackBufferSize / 2, StackAllocator.get())
+{
+	GetThreadJsonBuffers().bInUse = true;
+}
+
+FPooledJsonDocument::~FPooledJsonDocument()
+{
+	if (bUsesThreadBuffers)
+	{
+		GetThreadJsonBuffers().bInUse = false;
+	}
+}
+
+FJsonDocument& FPooledJsonDocument::ParseInsitu(const std::string& Text)
+{
+	std::vector<char>& Buffer = bUsesThreadBuffers ? GetThreadJsonBuffers().Text : OwnText;
+	Buffer.assign(Text.begin(), Text.end());
+	Buffer.push_back('\0');
+
+	Document.ParseInsitu(Buffer.data());
+	return Document;
+}
+
+void FPooledJsonDocument::Write(std::string& Out) const
+{
+	Out.clear();
+
+	// the writer's nesting stack comes out of the parser stack buffer
+	FStringOutputStream Stream(Out);
+	rapidjson::Writer<FStringOutputStream, rapidjson::UTF8<>, rapidjson::UTF8<>, FJsonAllocator> Writer(Stream, StackAllocator.get());
+	Document.Accept(Writer);
+}
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "NonCopyable.h"
+
+#include "rapidjson/document.h"
+#include "rapidjson/writer.h"
+
+using FJsonAllocator = rapidjson::MemoryPoolAllocator<rapidjson::CrtAllocator>;
+using FJsonDocument = rapidjson::GenericDocument<rapidjson::UTF8<>, FJsonAllocator, FJsonAllocator>;
+using FJsonValue = FJsonDocument::ValueType;
+
+/** A json document allocating from buffers owned by the calling thread, so parsing a request or building a response doesn't touch the heap.
+  * The buffers are reused by the next document on the same thread. Only one pooled document uses them at a time,
+  * a nested one falls back to heap allocations. Documents that outgrow the buffers spill over onto the heap too.
+  * The document must be destroyed on the thread that created it.
+  */
+class FPooledJsonDocument : public FNonCopyable
+{
+public:
+	FPooledJsonDocument();
+	~FPooledJsonDocument();
+
+	/** Parses Text in situ on a copy held in the thread's text buffer, string values point into that copy until the document is destroyed */
+	FJsonDocument& ParseInsitu(const std::string& Text);
+
+	FJsonDocument& GetDocument() { return Document; }
+	FJsonAllocator& GetAllocator() { return Document.GetAllocator(); }
+
+	/** Writes the document into Out, replacing its contents */
+	void Write(std::string& Out) const;
+
+	/** Values are allocated from this buffer first, sized for the largest requests and responses of the voice api */
+	static constexpr size_t ValueBufferSize = 16 * 1024;
+
+	/** Parser stack */
+	static constexpr size_t StackBufferSize = 4 * 1024;
+
+private:
+	/** Whether this document owns the thread's buffers */
+	bool bUsesThreadBuffers;
+
+	std::unique_ptr<FJsonAllocator> ValueAllocator;
+	std::unique_ptr<FJsonAllocator> StackAllocator;
+	FJsonDocument Document;
+
+	/** Text parsed in situ when not using the thread's buffers */
+	std::vector<char> OwnText;
+};
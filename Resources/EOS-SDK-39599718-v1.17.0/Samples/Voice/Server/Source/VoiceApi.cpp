@@ -3,12 +3,9 @@
 #include "pch.h"
 
 #define RAPIDJSON_HAS_STDSTRING 1
-#include "rapidjson/document.h"
-#include "rapidjson/stringbuffer.h"
-#include "rapidjson/writer.h"
-#include "rapidjson/error/en.h"
 
 #include "ApiParams.h"
+#include "PooledJson.h"
 #include "VoiceApi.h"
 #include "VoiceHost.h"
 #include "VoiceUser.h"
@@ -23,24 +20,33 @@
 
 namespace
 {
-	std::string JsonDocToString(const rapidjson::Document& Document)
+	/** Serializes the document straight into a response body */
+	std::string JsonDocToString(const FPooledJsonDocument& Document)
 	{
-		rapidjson::StringBuffer Buffer;
-		Buffer.Clear();
-
-		rapidjson::Writer<rapidjson::StringBuffer> Writer(Buffer);
-		Document.Accept(Writer);
-
-		return std::string(Buffer.GetString());
+		std::string Body;
+		Document.Write(Body);
+		return Body;
 	}
 
 	std::string FormatBadRequest(const std::string& Message)
 	{
-		rapidjson::Document Doc;
+		FPooledJsonDocument Response;
+		FJsonDocument& Doc = Response.GetDocument();
 		Doc.SetObject();
 		Doc.AddMember("error", "bad request", Doc.GetAllocator());
 		Doc.AddMember("description", Message, Doc.GetAllocator());
-		return JsonDocToString(Doc);
+		return JsonDocToString(Response);
+	}
+
+	/** Adds the tokens of a join room result to a response, as an object of tokens by product user id */
+	void AddJoinTokens(FJsonDocument& Doc, const FJoinRoomResult& Result)
+	{
+		FJsonValue TokenObj(rapidjson::kObjectType);
+		for (const auto& TokenPair : Result.Tokens)
+		{
+			TokenObj.AddMember(rapidjson::StringRef(TokenPair.ProductUserId), TokenPair.Token, Doc.GetAllocator());
+		}
+		Doc.AddMember("joinTokens", TokenObj, Doc.GetAllocator());
 	}
 }
 
@@ -61,264 +67,223 @@ FVoiceApi::FVoiceApi(const FVoiceHostPtr& InVoiceHost, const FVoiceSdkPtr& InVoi
 	assert(VoiceSdk != nullptr);
 
 	// setup logging
-	Api.set_logger([](const Request& Req, const Response& Res) {
+	Api.SetLogger([](const FHttpRequest& Req, int Status) {
 		FDebugLog::Log(L"%d | %ls | %ls (%ls)",
-			Res.status,
-			FStringUtils::Widen(Req.method).c_str(),
-			FStringUtils::Widen(Req.path).c_str(),
-			FStringUtils::Widen(Req.remote_addr).c_str());
+			Status,
+			FStringUtils::Widen(Req.Method).c_str(),
+			FStringUtils::Widen(Req.Path).c_str(),
+			FStringUtils::Widen(Req.RemoteAddr).c_str());
 	});
 
+	// Handlers are called on the http event loop thread and must not block.
+	// All EOS SDK calls must originate from the same thread, so requests are queued in the VoiceSdk and processed by the main loop.
+	// The response is sent from the request's completion callback, which the VoiceSdk calls on the main thread.
+
 	// create voice session
-	Api.Post("/session", [&](const Request& Req, Response &Res) {
+	Api.Post("/session", [this](const FHttpRequest& Req, const FHttpResponderPtr& Responder) {
 		FCreateSessionParams Params;
-		FParseResult ParseResult = FCreateSessionParams::FromRequestBody(Req.body, Params);
+		FParseResult ParseResult = FCreateSessionParams::FromRequestBody(Req.Body, Params);
 		if (ParseResult.IsOk())
 		{
 			// create a random roomId and request a roomToken
 			const std::string RoomId = FUtils::GenerateRandomId(16);
+			const FVoiceUser Owner(Params.GetPuid(), Req.RemoteAddr);
+			const std::string Password = Params.GetPassword();
 
-			// This http request callback is called on one of the http threadpool threads.
-			// All EOS SDK calls must originate from the same thread.
-			// To handle this we enqueue a request in the VoiceSdk and wait for its promised result on this thread
-			// The main loop will process all EOS SDK requests on the main thread.
-			FJoinRoomReceiptPtr Receipt = VoiceSdk->CreateJoinRoomTokens(RoomId.c_str(), { FVoiceUser(Params.GetPuid(), Req.remote_addr) });
-
-			// blocks until the request has been completed
-			Receipt->WaitForResult();
-			
-			const FJoinRoomResult TokenResult = Receipt->GetResult();
-			if (TokenResult.Result == EOS_EResult::EOS_Success)
-			{
-				// generate a lock key that is required for owner-level operations, such as kick or mute.
-				const std::string OwnerLock = FUtils::GenerateRandomId(8);
+			FVoiceHostPtr Host = VoiceHost;
+			VoiceSdk->CreateJoinRoomTokens(RoomId.c_str(), { Owner }, [Host, Responder, RoomId, Owner, Password](const FJoinRoomResult& TokenResult) {
+				if (TokenResult.Result == EOS_EResult::EOS_Success)
+				{
+					// generate a lock key that is required for owner-level operations, such as kick or mute.
+					const std::string OwnerLock = FUtils::GenerateRandomId(8);
 
-				// add the session and create the json response
-				FVoiceSessionPtr Session = FVoiceSessionPtr(new FVoiceSession(RoomId, OwnerLock, Params.GetPassword(), { FVoiceUser(Params.GetPuid(), Req.remote_addr) }));
-				VoiceHost->AddSession(Session);
+					// add the session and create the json response
+					FVoiceSessionPtr Session = FVoiceSessionPtr(new FVoiceSession(RoomId, OwnerLock, Password, { Owner }));
+					Host->AddSession(Session);
+
+					FPooledJsonDocument Response;
+					FJsonDocument& Doc = Response.GetDocument();
+					Doc.SetObject();
 
-				rapidjson::Document Doc;
-				Doc.SetObject();
+					Doc.AddMember("sessionId", RoomId, Doc.GetAllocator());
+					Doc.AddMember("ownerLock", OwnerLock, Doc.GetAllocator());
+					Doc.AddMember("clientBaseUrl", TokenResult.ClientBaseUrl, Doc.GetAllocator());
+					AddJoinTokens(Doc, TokenResult);
 
-				Doc.AddMember("sessionId", RoomId, Doc.GetAllocator());
-				Doc.AddMember("ownerLock", OwnerLock, Doc.GetAllocator());
-				Doc.AddMember("clientBaseUrl", TokenResult.ClientBaseUrl, Doc.GetAllocator());
+					Responder->Respond(200, JsonDocToString(Response), FVoiceApi::ContentTypeJson);
 
-				rapidjson::Document TokenObj;
-				TokenObj.SetObject();
-				for (const auto& TokenPair : TokenResult.Tokens)
+					FDebugLog::Log(L"Created session %ls", FStringUtils::Widen(RoomId).c_str());
+				}
+				else if (TokenResult.Result == EOS_EResult::EOS_TimedOut)
 				{
-					TokenObj.AddMember(rapidjson::StringRef(TokenPair.ProductUserId), TokenPair.Token, TokenObj.GetAllocator());
+					Responder->Respond(408, FVoiceApi::ErrorTimedOut, FVoiceApi::ContentTypeJson);
 				}
-				Doc.AddMember("joinTokens", TokenObj, Doc.GetAllocator());
-
-				Res.status = 200;
-				Res.set_content(JsonDocToString(Doc).c_str(), FVoiceApi::ContentTypeJson);
-
-				FDebugLog::Log(L"Created session %ls", FStringUtils::Widen(RoomId).c_str());
-			}
-			else if (TokenResult.Result == EOS_EResult::EOS_TimedOut)
-			{
-				Res.status = 408;
-				Res.set_content(FVoiceApi::ErrorTimedOut, FVoiceApi::ContentTypeJson);
-			}
-			else
-			{
-				Res.status = 500;
-			}
+				else
+				{
+					Responder->Respond(500);
+				}
+			});
 		}
 		else
 		{
-			Res.status = 400;
-			Res.set_content(FormatBadRequest(ParseResult.GetError()).c_str(), FVoiceApi::ContentTypeJson);
+			Responder->Respond(400, FormatBadRequest(ParseResult.GetError()), FVoiceApi::ContentTypeJson);
 		}
 	});
 
 	// join session
-	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/join/([a-zA-Z0-9\-]+))", [&](const Request& Req, Response& Res) {
-		const std::string& SessionId = Req.matches[1];
-		const std::string& Puid = Req.matches[2];
+	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/join/([a-zA-Z0-9\-]+))", [this](const FHttpRequest& Req, const FHttpResponderPtr& Responder) {
+		const std::string& SessionId = Req.Matches[1];
+		const std::string& Puid = Req.Matches[2];
 
 		FVoiceSessionPtr Session = VoiceHost->FindSession(SessionId);
 		if (Session.get() != nullptr)
 		{
-			const FVoiceUser NewUser(Puid, Req.remote_addr);
+			const FVoiceUser NewUser(Puid, Req.RemoteAddr);
 
 			// authenticate optional password and check banned list
-			const std::string Password = Req.has_param("password") ? Req.get_param_value("password") : "";
+			const std::string Password = Req.HasParam("password") ? Req.GetParamValue("password") : "";
 			if (!Session->MatchesPassword(Password) || Session->IsUserBanned(NewUser))
 			{
-				Res.status = 403;
-				Res.set_content(FVoiceApi::ErrorUnauthorized, FVoiceApi::ContentTypeJson);
+				Responder->Respond(403, FVoiceApi::ErrorUnauthorized, FVoiceApi::ContentTypeJson);
 			}
 			else
 			{
 				// request token to join the session
-				FJoinRoomReceiptPtr Receipt = VoiceSdk->CreateJoinRoomTokens(SessionId.c_str(), { NewUser });
-
-				// blocks until the request has been completed
-				Receipt->WaitForResult();
-				
-				const FJoinRoomResult Result = Receipt->GetResult();
-				if (Result.Result == EOS_EResult::EOS_TimedOut)
-				{
-					Res.status = 408;
-					Res.set_content(FVoiceApi::ErrorTimedOut, FVoiceApi::ContentTypeJson);
-				}
-				else
-				{
-					Session->AddUser(FVoiceUser{ Puid, Req.remote_addr });
-
-					rapidjson::Document Doc;
-					Doc.SetObject();
-					Doc.AddMember("sessionId", SessionId, Doc.GetAllocator());
-					Doc.AddMember("clientBaseUrl", Result.ClientBaseUrl, Doc.GetAllocator());
-
-					rapidjson::Document TokenObj;
-					TokenObj.SetObject();
-					for (const auto& TokenPair : Result.Tokens)
+				VoiceSdk->CreateJoinRoomTokens(SessionId.c_str(), { NewUser }, [Responder, Session, SessionId, NewUser](const FJoinRoomResult& Result) {
+					if (Result.Result == EOS_EResult::EOS_TimedOut)
 					{
-						TokenObj.AddMember(rapidjson::StringRef(TokenPair.ProductUserId), TokenPair.Token, TokenObj.GetAllocator());
+						Responder->Respond(408, FVoiceApi::ErrorTimedOut, FVoiceApi::ContentTypeJson);
 					}
-					Doc.AddMember("joinTokens", TokenObj, Doc.GetAllocator());
+					else
+					{
+						Session->AddUser(NewUser);
 
-					Res.status = 200;
-					Res.set_content(JsonDocToString(Doc).c_str(), FVoiceApi::ContentTypeJson);
-				}
+						FPooledJsonDocument Response;
+						FJsonDocument& Doc = Response.GetDocument();
+						Doc.SetObject();
+						Doc.AddMember("sessionId", SessionId, Doc.GetAllocator());
+						Doc.AddMember("clientBaseUrl", Result.ClientBaseUrl, Doc.GetAllocator());
+						AddJoinTokens(Doc, Result);
+
+						Responder->Respond(200, JsonDocToString(Response), FVoiceApi::ContentTypeJson);
+					}
+				});
 			}
 		}
 		else
 		{
-			Res.status = 404;
-			Res.set_content(FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
+			Responder->Respond(404, FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
 		}
 	});
 
 	// kickUser
-	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/kick/([a-zA-Z0-9\-]+))", [&](const Request& Req, Response& Res) {
-		const std::string RoomId = Req.matches[1];
-		const std::string UserId = Req.matches[2];
+	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/kick/([a-zA-Z0-9\-]+))", [this](const FHttpRequest& Req, const FHttpResponderPtr& Responder) {
+		const std::string RoomId = Req.Matches[1];
+		const std::string UserId = Req.Matches[2];
 
 		FVoiceSessionPtr Session = VoiceHost->FindSession(RoomId);
 		if (Session.get() != nullptr)
 		{
 			FKickUserParams Params;
-			FParseResult Result = FKickUserParams::FromRequestBody(Req.body, Params);
+			FParseResult Result = FKickUserParams::FromRequestBody(Req.Body, Params);
 			if (Result.IsOk())
 			{
 				// check lock
 				if (Session->GetLock() != Params.GetLock())
 				{
-					Res.status = 403;
-					Res.set_content(FVoiceApi::ErrorForbidden, FVoiceApi::ContentTypeJson);
+					Responder->Respond(403, FVoiceApi::ErrorForbidden, FVoiceApi::ContentTypeJson);
 				}
 				else
 				{
 					FVoiceUser User{ UserId, std::string() };
 
 					// kick user
-					FVoiceRequestReceiptPtr Receipt = VoiceSdk->KickUser(RoomId.c_str(), EOS_ProductUserId_FromString(UserId.c_str()));
-
-					// blocks until the request has been completed
-					Receipt->WaitForResult();
-					EOS_EResult KickResult = Receipt->GetResult();
-
-					if (KickResult == EOS_EResult::EOS_Success)
-					{
-						// remove user and ban from rejoining
-						Session->RemoveUser(User);
-						Session->BanUser(User);
-						Res.status = 204;
-					}
-					else if (KickResult == EOS_EResult::EOS_TimedOut)
-					{
-						Res.status = 408;
-						Res.set_content(FVoiceApi::ErrorTimedOut, FVoiceApi::ContentTypeJson);
-					}					
-					else
-					{
-						Res.status = 500;
-					}
+					VoiceSdk->KickUser(RoomId.c_str(), EOS_ProductUserId_FromString(UserId.c_str()), [Responder, Session, User](EOS_EResult KickResult) {
+						if (KickResult == EOS_EResult::EOS_Success)
+						{
+							// remove user and ban from rejoining
+							Session->RemoveUser(User);
+							Session->BanUser(User);
+							Responder->Respond(204);
+						}
+						else if (KickResult == EOS_EResult::EOS_TimedOut)
+						{
+							Responder->Respond(408, FVoiceApi::ErrorTimedOut, FVoiceApi::ContentTypeJson);
+						}
+						else
+						{
+							Responder->Respond(500);
+						}
+					});
 				}
 			}
 			else
 			{
-				Res.status = 400;
-				Res.set_content(FormatBadRequest(Result.GetError()).c_str(), FVoiceApi::ContentTypeJson);
+				Responder->Respond(400, FormatBadRequest(Result.GetError()), FVoiceApi::ContentTypeJson);
 			}
 		}
 		else
 		{
-			Res.status = 404;
-			Res.set_content(FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
+			Responder->Respond(404, FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
 		}
 	});
 
 	// muteUser
-	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/mute/([a-zA-Z0-9\-]+))", [&](const Request& Req, Response& Res) {
-		const std::string RoomId = Req.matches[1];
-		const std::string UserId = Req.matches[2];
+	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/mute/([a-zA-Z0-9\-]+))", [this](const FHttpRequest& Req, const FHttpResponderPtr& Responder) {
+		const std::string RoomId = Req.Matches[1];
+		const std::string UserId = Req.Matches[2];
 
 		FVoiceSessionPtr Session = VoiceHost->FindSession(RoomId);
 		if (Session.get() != nullptr)
 		{
 			FMuteUserParams Params;
-			FParseResult Result = FMuteUserParams::FromRequestBody(Req.body, Params);
+			FParseResult Result = FMuteUserParams::FromRequestBody(Req.Body, Params);
 			if (Result.IsOk())
 			{
 				// check lock
 				if (Session->GetLock() != Params.GetLock())
 				{
-					Res.status = 403;
-					Res.set_content(FVoiceApi::ErrorForbidden, FVoiceApi::ContentTypeJson);
+					Responder->Respond(403, FVoiceApi::ErrorForbidden, FVoiceApi::ContentTypeJson);
 				}
 				else
 				{
 					// hard mute/unmute user
-					FVoiceRequestReceiptPtr Receipt = VoiceSdk->MuteUser(RoomId.c_str(), EOS_ProductUserId_FromString(UserId.c_str()) , Params.ShouldMute());
-
-					// blocks until the request has been completed
-					Receipt->WaitForResult();
-					EOS_EResult MuteResult = Receipt->GetResult();
-
-					if (MuteResult == EOS_EResult::EOS_Success)
-					{
-						Res.status = 204;
-					}
-					else if (MuteResult == EOS_EResult::EOS_TimedOut)
-					{
-						Res.status = 408;
-						Res.set_content("Request Timeout", FVoiceApi::ContentTypeJson);
-					}
-					else
-					{
-						Res.status = 500;
-					}
-					
+					VoiceSdk->MuteUser(RoomId.c_str(), EOS_ProductUserId_FromString(UserId.c_str()), Params.ShouldMute(), [Responder](EOS_EResult MuteResult) {
+						if (MuteResult == EOS_EResult::EOS_Success)
+						{
+							Responder->Respond(204);
+						}
+						else if (MuteResult == EOS_EResult::EOS_TimedOut)
+						{
+							Responder->Respond(408, "Request Timeout", FVoiceApi::ContentTypeJson);
+						}
+						else
+						{
+							Responder->Respond(500);
+						}
+					});
 				}
 			}
 			else
 			{
-				Res.status = 400;
-				Res.set_content(FormatBadRequest(Result.GetError()).c_str(), FVoiceApi::ContentTypeJson);
+				Responder->Respond(400, FormatBadRequest(Result.GetError()), FVoiceApi::ContentTypeJson);
 			}
 		}
 		else
 		{
-			Res.status = 404;
-			Res.set_content(FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
+			Responder->Respond(404, FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
 		}
 	});
 
 	// heartbeat session
-	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/heartbeat)", [&](const Request& Req, Response& Res) {
-		const std::string RoomId = Req.matches[1];
+	Api.Post(R"(/session/([a-zA-Z0-9\-]+)/heartbeat)", [this](const FHttpRequest& Req, const FHttpResponderPtr& Responder) {
+		const std::string RoomId = Req.Matches[1];
 
 		FVoiceSessionPtr Session = VoiceHost->FindSession(RoomId);
 		if (Session.get() != nullptr)
 		{
 			FHeartbeatParams Params;
-			FParseResult Result = FHeartbeatParams::FromRequestBody(Req.body, Params);
+			FParseResult Result = FHeartbeatParams::FromRequestBody(Req.Body, Params);
 			if (Result.IsOk())
 			{
 				// Heartbeating requires the session lock from the session owner
@@ -327,27 +292,34 @@ FVoiceApi::FVoiceApi(const FVoiceHostPtr& InVoiceHost, const FVoiceSdkPtr& InVoi
 				if (Params.GetLock() == Session->GetLock())
 				{
 					Session->ResetHeartbeat();
-					Res.status = 204;
+					Responder->Respond(204);
 				}
 				else
 				{
-					Res.status = 403;
-					Res.set_content(FVoiceApi::ErrorForbidden, FVoiceApi::ContentTypeJson);
+					Responder->Respond(403, FVoiceApi::ErrorForbidden, FVoiceApi::ContentTypeJson);
 				}
 			}
+			else
+			{
+				Responder->Respond(400, FormatBadRequest(Result.GetError()), FVoiceApi::ContentTypeJson);
+			}
 		}
 		else
 		{
-			Res.status = 404;
-			Res.set_content(FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
+			Responder->Respond(404, FVoiceApi::ErrorSessionNotFound, FVoiceApi::ContentTypeJson);
 		}
 	});
 }
 
 bool FVoiceApi::Listen(unsigned short Port)
 {	
-	// start api on a new thread to not block main thread
-	ApiThread = std::thread{ [this, Port]() { Api.listen("0.0.0.0", Port); } };
+	if (!Api.Bind("0.0.0.0", Port))
+	{
+		return false;
+	}
+
+	// run the api event loop on a new thread to not block main thread
+	ApiThread = std::thread{ [this]() { Api.Run(); } };
 	return true;
 }
 
@@ -356,7 +328,7 @@ void FVoiceApi::Stop()
 	// stop the Api thread and wait for it to complete
 	if (ApiThread.joinable())
 	{
-		Api.stop();
+		Api.Stop();
 		ApiThread.join();
 	}
 }
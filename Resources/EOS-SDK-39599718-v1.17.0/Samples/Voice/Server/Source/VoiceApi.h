@@ -2,16 +2,13 @@
 
 #pragma once
 
+#include "AsyncHttpServer.h"
 #include "NonCopyable.h"
 #include "VoiceSdk.h"
 
-#include "httplib/httplib.h"
-
-using namespace httplib;
-
 class UserActionParams;
 
-/** Api hosting http endpoints and threadpool */
+/** Api hosting http endpoints on an event loop thread */
 class FVoiceApi : public FNonCopyable
 {
 public:
@@ -31,10 +28,10 @@ public:
 private:
 	
 	/** Note: The VoiceServer sample uses a simple http api to demonstrate communication between clients and the trusted server application.
-	  * The http framework used here was chosen for its simplicity, not scalability. 
-	  * Real-world applications should consider high-performance asynchronous frameworks or utilize their existing client-server network messaging (e.g. when using dedicated servers).
+	  * Requests are handled on a single event loop thread that never waits for the EOS SDK, responses to SDK requests are sent from their completion callbacks.
+	  * Real-world applications should consider a full featured asynchronous http framework or utilize their existing client-server network messaging (e.g. when using dedicated servers).
 	*/
-	Server Api;
+	FAsyncHttpServer Api;
 	std::thread ApiThread;
 
 	FVoiceHostPtr VoiceHost;
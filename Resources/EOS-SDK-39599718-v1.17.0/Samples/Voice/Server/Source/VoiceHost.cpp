@@ -4,40 +4,135 @@
 
 #include "VoiceHost.h"
 
+constexpr size_t FVoiceHost::kNumShards;
+
+FVoiceHost::FShard& FVoiceHost::GetShard(const std::string& Id)
+{
+	return Shards[std::hash<std::string>{}(Id) & (kNumShards - 1)];
+}
+
+const FVoiceHost::FShard& FVoiceHost::GetShard(const std::string& Id) const
+{
+	return Shards[std::hash<std::string>{}(Id) & (kNumShards - 1)];
+}
+
 bool FVoiceHost::AddSession(const FVoiceSessionPtr& Session)
 {
-	FScopedLock Lock(SessionMutex);
+	{
+		FShard& Shard = GetShard(Session->GetId());
+		FExclusiveLock Lock(Shard.SessionMutex);
+		if (!Shard.Sessions.emplace(Session->GetId(), Session).second)
+		{
+			return false;
+		}
+	}
 
-	Sessions.push_back(Session);
+	FScopedLock Lock(ExpiryMutex);
+	ExpiryQueue.push(FExpiryEntry{ Session->GetExpiration(), Session });
 	return true;
 }
 
 bool FVoiceHost::RemoveSession(const std::string& Id)
 {
-	FScopedLock Lock(SessionMutex);
-	return erase_if(Sessions, [&Id](const FVoiceSessionPtr& VoiceSession) { return VoiceSession->GetId() == Id; }) != 0;
+	// The session's expiry entry stays queued and is dropped by the next sweep that reaches it.
+	FShard& Shard = GetShard(Id);
+	FExclusiveLock Lock(Shard.SessionMutex);
+	return Shard.Sessions.erase(Id) != 0;
 }
 
 FVoiceSessionPtr FVoiceHost::FindSession(const std::string& Id)
 {
-	for (std::vector<FVoiceSessionPtr>::iterator Itr = Sessions.begin(); Itr != Sessions.end(); ++Itr)
+	FShard& Shard = GetShard(Id);
+	FSharedLock Lock(Shard.SessionMutex);
+
+	auto Itr = Shard.Sessions.find(Id);
+	if (Itr != Shard.Sessions.end())
 	{
-		if ((*Itr)->GetId() == Id)
-		{
-			return *Itr;
-		}
+		return Itr->second;
 	}
 
 	return FVoiceSessionPtr(nullptr);
 }
 
 size_t FVoiceHost::RemoveExpiredSessions()
-{	
+{
 	// Removes all sessions that have expired due to lack of heartbeat.
 	// The sample leaves at that and future calls to e.g. join the session will result in Http 404 once expired and removed.
 	// Applications may want to include a notification pushed from the server to all room participants or have the client deal with it accordingly.
 
 	const auto Now = std::chrono::steady_clock::now();
-	FScopedLock Lock(SessionMutex);
-	return erase_if(Sessions, [&Now](const FVoiceSessionPtr& VoiceSession) { return VoiceSession->IsExpired(Now); });
+
+	// Pop every entry that was due as of when it was queued. Sessions that have since heartbeated go back in with their new expiration.
+	std::vector<FVoiceSessionPtr> Expired;
+	{
+		FScopedLock Lock(ExpiryMutex);
+		while (!ExpiryQueue.empty() && Now > ExpiryQueue.top().Expiration)
+		{
+			FVoiceSessionPtr Session = ExpiryQueue.top().Session.lock();
+			ExpiryQueue.pop();
+
+			if (Session == nullptr)
+			{
+				continue;
+			}
+
+			if (Session->IsExpired(Now))
+			{
+				Expired.push_back(std::move(Session));
+			}
+			else
+			{
+				ExpiryQueue.push(FExpiryEntry{ Session->GetExpiration(), Session });
+			}
+		}
+	}
+
+	size_t NumRemoved = 0;
+	for (const FVoiceSessionPtr& Session : Expired)
+	{
+		// Only remove the session if it's still the one indexed under its id and nothing heartbeated it in the meantime.
+		FShard& Shard = GetShard(Session->GetId());
+		FExclusiveLock Lock(Shard.SessionMutex);
+
+		auto Itr = Shard.Sessions.find(Session->GetId());
+		if (Itr == Shard.Sessions.end() || Itr->second != Session)
+		{
+			continue;
+		}
+
+		if (Session->IsExpired(Now))
+		{
+			Shard.Sessions.erase(Itr);
+			++NumRemoved;
+		}
+		else
+		{
+			FScopedLock ExpiryLock(ExpiryMutex);
+			ExpiryQueue.push(FExpiryEntry{ Session->GetExpiration(), Session });
+		}
+	}
+
+	return NumRemoved;
+}
+
+size_t FVoiceHost::GetNumSessions() const
+{
+	size_t NumSessions = 0;
+	for (const FShard& Shard : Shards)
+	{
+		FSharedLock Lock(Shard.SessionMutex);
+		NumSessions += Shard.Sessions.size();
+	}
+	return NumSessions;
+}
+
+std::vector<FLockStats> FVoiceHost::GetSessionShardLockStats() const
+{
+	std::vector<FLockStats> Stats;
+	Stats.reserve(kNumShards);
+	for (const FShard& Shard : Shards)
+	{
+		Stats.push_back(Shard.SessionMutex.GetStats());
+	}
+	return Stats;
 }
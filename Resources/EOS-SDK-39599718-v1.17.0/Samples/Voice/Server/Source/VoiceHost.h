@@ -4,22 +4,53 @@
 
 #include "VoiceSession.h"
 
-/** Container for multiple voice sessions, managing synchronization */
+/**
+ * Container for multiple voice sessions, managing synchronization.
+ * Sessions are indexed by id across a fixed number of shards, each guarded by its own reader-writer lock, so lookups from the http threads
+ * run in parallel and only wait for writers to the same shard. Expiry is tracked in a min-heap of expiration times, so a sweep only visits sessions that are due.
+ */
 class FVoiceHost
 {
 public:
 	FVoiceHost() {}
 
-	bool AddSession(const FVoiceSessionPtr& Session);	
+	bool AddSession(const FVoiceSessionPtr& Session);
 	bool RemoveSession(const std::string& Id);
-	
+
 	FVoiceSessionPtr FindSession(const std::string& Id);
 
 	/** Compares expiration timestamps of sessions and removes expired ones, clients heartbeat to keep sessions alive. */
 	size_t RemoveExpiredSessions();
 
+	size_t GetNumSessions() const;
+
+	/** Contention of each session shard lock, in shard order */
+	std::vector<FLockStats> GetSessionShardLockStats() const;
 
 private:
-	std::mutex SessionMutex;
-	std::vector<FVoiceSessionPtr> Sessions;
-};
\ No newline at end of file
+	/** A power of two, so that picking a shard is a mask of the id hash. */
+	static constexpr size_t kNumShards = 64;
+
+	struct FShard
+	{
+		mutable TStatsMutex<std::shared_timed_mutex> SessionMutex;
+		std::unordered_map<std::string, FVoiceSessionPtr> Sessions;
+	};
+
+	/** The expiration a session had when it was queued. Heartbeats don't touch the queue; a sweep re-queues sessions whose expiration has moved on. */
+	struct FExpiryEntry
+	{
+		ServerTimePoint Expiration;
+		std::weak_ptr<FVoiceSession> Session;
+
+		bool operator>(const FExpiryEntry& Rhs) const { return Expiration > Rhs.Expiration; }
+	};
+
+	FShard& GetShard(const std::string& Id);
+	const FShard& GetShard(const std::string& Id) const;
+
+	std::array<FShard, kNumShards> Shards;
+
+	std::mutex ExpiryMutex;
+	std::priority_queue<FExpiryEntry, std::vector<FExpiryEntry>, std::greater<FExpiryEntry>> ExpiryQueue;
+};
@@ -1,21 +0,0 @@
-// Copyright Epic Games, Inc. All Rights Reserved.
-
-#include "pch.h"
-
-#include "VoiceRequest.h"
-#include "VoiceSdk.h"
-
-#include "Utils.h"
-
-FVoiceRequestReceipt::~FVoiceRequestReceipt()
-{
-	if (VoiceSdk && VoiceRequestHandle)
-	{
-		VoiceSdk->ReleaseRequest(VoiceRequestHandle);
-	}
-}
-
-void FVoiceRequestReceipt::WaitForResult()
-{
-	ResultFuture.wait();
-}
\ No newline at end of file
@@ -6,34 +6,27 @@
 
 #include <eos_rtc_admin.h>
 
+/** Called on the main thread once a request is complete */
+using FOnVoiceRequestComplete = std::function<void(EOS_EResult)>;
+
 class FVoiceRequest
 {
 public:
 	virtual ~FVoiceRequest() { }
 	virtual EOS_EResult MakeRequest(EOS_HRTCAdmin RTCAdminHandle) = 0;
-};
-
-using FVoiceRequestPtr = std::unique_ptr<FVoiceRequest>;
-using FVoiceRequestHandle = FVoiceRequest*;
 
-class FVoiceRequestReceipt : public FNonCopyable
-{
-public:
-	FVoiceRequestReceipt(std::future<EOS_EResult>&& InResultFuture, FVoiceRequestHandle InRequestHandle, FVoiceSdk* InVoiceSdk) :
-		ResultFuture(std::move(InResultFuture)),
-		VoiceRequestHandle(InRequestHandle),
-		VoiceSdk(InVoiceSdk)
-	{
-	}
+	/** Complete requests are released by FVoiceSdk after the sdk tick they completed in */
+	bool IsComplete() const { return bIsComplete; }
 
-	virtual ~FVoiceRequestReceipt();
+	/** Time the request was queued, used to measure how long requests wait for the main thread */
+	ServerTimePoint QueuedAt;
 
-	void WaitForResult();
-	EOS_EResult GetResult() { return ResultFuture.get(); }
+protected:
+	/** Called from the sdk callback once the operation is complete, after which the sdk no longer refers to the request */
+	void MarkComplete() { bIsComplete = true; }
 
 private:
-	std::future<EOS_EResult> ResultFuture;
-	FVoiceRequestHandle VoiceRequestHandle = nullptr;
-	FVoiceSdk* VoiceSdk = nullptr;
+	bool bIsComplete = false;
 };
-using FVoiceRequestReceiptPtr = std::unique_ptr<FVoiceRequestReceipt>;
\ No newline at end of file
+
+using FVoiceRequestPtr = std::unique_ptr<FVoiceRequest>;
@@ -10,45 +10,47 @@
 #include "Utils.h"
 #include "StringUtils.h"
 
-FJoinRoomReceipt::~FJoinRoomReceipt()
-{
-	if (VoiceSdk && VoiceRequestHandle)
-	{
-		VoiceSdk->ReleaseRequest(VoiceRequestHandle);
-	}
-}
-
-void FJoinRoomReceipt::WaitForResult()
-{
-	ResultFuture.wait();
-}
-
-FVoiceRequestJoin::FVoiceRequestJoin(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const std::vector<FVoiceUser>& InVoiceUsers) :
+FVoiceRequestJoin::FVoiceRequestJoin(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const std::vector<FVoiceUser>& InVoiceUsers, FOnJoinRoomComplete InOnComplete) :
 	RTCAdminHandle(InRTCAdminHandle),
 	RoomName(InRoomName),
-	VoiceUsers(InVoiceUsers)
+	NumUsers(InVoiceUsers.size())
 {
+	Waiters.push_back(FWaiter{ InVoiceUsers, std::move(InOnComplete) });
 }
 
-std::future<FJoinRoomResult> FVoiceRequestJoin::GetFuture()
+void FVoiceRequestJoin::Coalesce(FVoiceRequestJoin& Other)
 {
-	return ResultPromise.get_future();
+	assert(Other.RoomName == RoomName);
+
+	std::move(Other.Waiters.begin(), Other.Waiters.end(), std::back_inserter(Waiters));
+	NumUsers += Other.NumUsers;
+
+	Other.Waiters.clear();
+	Other.NumUsers = 0;
+	Other.MarkComplete();
 }
 
 EOS_EResult FVoiceRequestJoin::MakeRequest(EOS_HRTCAdmin RTCAdminHandle)
 {
-	FDebugLog::Log(L"FVoiceRequestJoin::MakeRequest (%x)", this);
+	FDebugLog::Log(L"FVoiceRequestJoin::MakeRequest (%x) for %d callers", this, Waiters.size());
 
 	EOS_RTCAdmin_QueryJoinRoomTokenOptions Options = {};
 	Options.ApiVersion = EOS_RTCADMIN_QUERYJOINROOMTOKEN_API_LATEST;
 	Options.RoomName = RoomName.c_str();
 
+	// coalesced receipts may ask for the same user, only query each user once
 	std::vector<EOS_ProductUserId> TargetUserIds;
 	std::vector<const char*> TargetUserIpAddresses;
-	for (const FVoiceUser& VoiceUser : VoiceUsers)
+	for (const FWaiter& Waiter : Waiters)
 	{
-		TargetUserIds.emplace_back(VoiceUser.GetPuid());
-		TargetUserIpAddresses.emplace_back(VoiceUser.GetIPAddress().c_str());
+		for (const FVoiceUser& VoiceUser : Waiter.VoiceUsers)
+		{
+			if (std::find(TargetUserIds.begin(), TargetUserIds.end(), VoiceUser.GetPuid()) == TargetUserIds.end())
+			{
+				TargetUserIds.emplace_back(VoiceUser.GetPuid());
+				TargetUserIpAddresses.emplace_back(VoiceUser.GetIPAddress().c_str());
+			}
+		}
 	}
 	Options.TargetUserIds = TargetUserIds.data();
 	Options.TargetUserIdsCount = static_cast<uint32_t>(TargetUserIds.size());
@@ -59,16 +61,19 @@ EOS_EResult FVoiceRequestJoin::MakeRequest(EOS_HRTCAdmin RTCAdminHandle)
 
 		// Wait for completion, SDK may retry
 		// The lifetime of this callback and its request must be guaranteed until EOS_EResult_IsOperationComplete is true.
-		// In this case, we fulfill the ResultPromise which unblocks the wait in VoiceApi. 
-		// As the receipt is destructed it releases the request from ActiveRequests in VoiceSdk.
+		// In this case, we call each caller's OnComplete to let VoiceApi respond, and mark the request complete so VoiceSdk releases it after this tick.
 		if (EOS_EResult_IsOperationComplete(Data->ResultCode))
 		{
+			FJoinRoomResult Result{ };
+			Result.Result = Data->ResultCode;
+
+			// tokens for all requested puids, each caller gets the ones for its own users
+			std::vector<std::pair<EOS_ProductUserId, FPuidToken>> UserTokens;
+
 			if (Data->ResultCode == EOS_EResult::EOS_Success)
 			{
 				FDebugLog::Log(L"FVoiceRequestJoin (%x) - Completed successfully for room %ls", Request, FStringUtils::Widen(Data->RoomName).c_str());
 
-				FJoinRoomResult Result{ };
-				Result.Result = Data->ResultCode;
 				Result.RoomName = Data->RoomName;
 				Result.ClientBaseUrl = Data->ClientBaseUrl;
 
@@ -91,7 +96,7 @@ EOS_EResult FVoiceRequestJoin::MakeRequest(EOS_HRTCAdmin RTCAdminHandle)
 
 							if (ToStringResult == EOS_EResult::EOS_Success)
 							{
-								Result.Tokens.push_back(FPuidToken(PuidBuffer, UserToken->Token));
+								UserTokens.emplace_back(UserToken->ProductUserId, FPuidToken(PuidBuffer, UserToken->Token));
 							}
 							else
 							{
@@ -106,17 +111,31 @@ EOS_EResult FVoiceRequestJoin::MakeRequest(EOS_HRTCAdmin RTCAdminHandle)
 						FDebugLog::LogError(L"EOS_RTCAdmin_CopyUserTokenByIndex Failure!");
 					}
 				}
-
-				// setting the promise value readies the future in the receipt.
-				Request->ResultPromise.set_value(Result);
 			}
 			else
 			{
 				FDebugLog::LogError(L"FVoiceRequestJoin (%x) failed: %ls", Request, FStringUtils::Widen(EOS_EResult_ToString(Data->ResultCode)).c_str());
-				FJoinRoomResult Result{ };
-				Result.Result = Data->ResultCode;
-				Request->ResultPromise.set_value(Result);
 			}
+
+			for (const FWaiter& Waiter : Request->Waiters)
+			{
+				FJoinRoomResult WaiterResult = Result;
+				for (const FVoiceUser& VoiceUser : Waiter.VoiceUsers)
+				{
+					for (const auto& UserToken : UserTokens)
+					{
+						if (UserToken.first == VoiceUser.GetPuid())
+						{
+							WaiterResult.Tokens.push_back(UserToken.second);
+							break;
+						}
+					}
+				}
+
+				Waiter.OnComplete(WaiterResult);
+			}
+
+			Request->MarkComplete();
 		}
 		else if (Data->ResultCode == EOS_EResult::EOS_OperationWillRetry)
 		{
@@ -129,11 +148,14 @@ EOS_EResult FVoiceRequestJoin::MakeRequest(EOS_HRTCAdmin RTCAdminHandle)
 
 bool FVoiceRequestJoin::ContainsPuid(const EOS_ProductUserId& ProductUserId)
 {	
-	for (const FVoiceUser& VoiceUser : VoiceUsers)
+	for (const FWaiter& Waiter : Waiters)
 	{
-		if (VoiceUser.GetPuid() == ProductUserId)
+		for (const FVoiceUser& VoiceUser : Waiter.VoiceUsers)
 		{
-			return true;
+			if (VoiceUser.GetPuid() == ProductUserId)
+			{
+				return true;
+			}
 		}
 	}
 	return false;
@@ -27,47 +27,42 @@ public:
 	std::vector<FPuidToken> Tokens;
 };
 
-/** Receipt for FVoiceRequestJoin */
-class FJoinRoomReceipt : public FNonCopyable
-{
-public:
-	FJoinRoomReceipt(std::future<FJoinRoomResult>&& InResultFuture, FVoiceRequestHandle InRequestHandle, FVoiceSdk* InVoiceSdk) :
-		ResultFuture(std::move(InResultFuture)),
-		VoiceRequestHandle(InRequestHandle),
-		VoiceSdk(InVoiceSdk)
-	{
-	}
-
-	~FJoinRoomReceipt();	
-	
-	void WaitForResult();
-	FJoinRoomResult GetResult() { return ResultFuture.get(); }
-
-private:
-	std::future<FJoinRoomResult> ResultFuture;
-	FVoiceRequestHandle VoiceRequestHandle = nullptr;
-	FVoiceSdk* VoiceSdk = nullptr;
-};
-using FJoinRoomReceiptPtr = std::unique_ptr<FJoinRoomReceipt>;
+/** Called on the main thread once a FVoiceRequestJoin is complete */
+using FOnJoinRoomComplete = std::function<void(const FJoinRoomResult&)>;
 
-/** A request for joinRoom tokens for a RoomId and a set of VoiceUsers */
+/** A request for joinRoom tokens for a RoomId and a set of VoiceUsers.
+  * Requests for the same room that are made in the same tick can be coalesced, so that a single token query answers all of them.
+  */
 class FVoiceRequestJoin : public FVoiceRequest, public FNonCopyable
 {
 public:
 	FVoiceRequestJoin() = delete;	
-	FVoiceRequestJoin(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const std::vector<FVoiceUser>& InVoiceUsers);
+	FVoiceRequestJoin(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const std::vector<FVoiceUser>& InVoiceUsers, FOnJoinRoomComplete InOnComplete);
 
 	~FVoiceRequestJoin() {}
 
 	virtual EOS_EResult MakeRequest(EOS_HRTCAdmin RTCAdminHandle) override;
 
 	bool ContainsPuid(const EOS_ProductUserId& ProductUserId);
-	std::future<FJoinRoomResult> GetFuture();
+
+	const std::string& GetRoomName() const { return RoomName; }
+	size_t GetNumUsers() const { return NumUsers; }
+
+	/** Takes over the users and completion of another request for the same room.
+	  * Other is left complete, without anything to request, and must not be made.
+	  */
+	void Coalesce(FVoiceRequestJoin& Other);
 
 private:
+	/** Users of a single caller, and its completion */
+	struct FWaiter
+	{
+		std::vector<FVoiceUser> VoiceUsers;
+		FOnJoinRoomComplete OnComplete;
+	};
+
 	EOS_HRTCAdmin RTCAdminHandle = 0;
 	std::string RoomName;
-	std::vector<FVoiceUser> VoiceUsers;
-	std::promise<FJoinRoomResult> ResultPromise;
+	std::vector<FWaiter> Waiters;
+	size_t NumUsers = 0;
 };
-
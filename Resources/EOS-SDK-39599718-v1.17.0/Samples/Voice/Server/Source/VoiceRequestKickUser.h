@@ -10,14 +10,13 @@ class FVoiceRequestKickUser : public FVoiceRequest, public FNonCopyable
 {
 public:
 	FVoiceRequestKickUser() = delete;
-	FVoiceRequestKickUser(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const EOS_ProductUserId& InProductUserId);
+	FVoiceRequestKickUser(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const EOS_ProductUserId& InProductUserId, FOnVoiceRequestComplete InOnComplete);
 
-	virtual EOS_EResult MakeRequest(EOS_HRTCAdmin RTCAdminHandle) override;	
-	std::future<EOS_EResult> GetFuture();
+	virtual EOS_EResult MakeRequest(EOS_HRTCAdmin RTCAdminHandle) override;
 
 private:
 	EOS_HRTCAdmin RTCAdminHandle = 0;
 	std::string RoomName;
 	EOS_ProductUserId ProductUserId;
-	std::promise<EOS_EResult> ResultPromise;
+	FOnVoiceRequestComplete OnComplete;
 };
\ No newline at end of file
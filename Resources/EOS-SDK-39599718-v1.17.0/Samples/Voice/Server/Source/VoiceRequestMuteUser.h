@@ -10,15 +10,14 @@ class FVoiceRequestMuteUser : public FVoiceRequest, public FNonCopyable
 {
 public:
 	FVoiceRequestMuteUser() = delete;
-	FVoiceRequestMuteUser(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const EOS_ProductUserId& InProductUserId, bool bMute);
+	FVoiceRequestMuteUser(EOS_HRTCAdmin InRTCAdminHandle, const std::string& InRoomName, const EOS_ProductUserId& InProductUserId, bool bMute, FOnVoiceRequestComplete InOnComplete);
 
 	virtual EOS_EResult MakeRequest(EOS_HRTCAdmin RTCAdminHandle) override;
-	std::future<EOS_EResult> GetFuture();
 
 private:
 	EOS_HRTCAdmin RTCAdminHandle = 0;
 	std::string RoomName;
 	EOS_ProductUserId ProductUserId;
 	bool bMute = false;
-	std::promise<EOS_EResult> ResultPromise;
+	FOnVoiceRequestComplete OnComplete;
 };
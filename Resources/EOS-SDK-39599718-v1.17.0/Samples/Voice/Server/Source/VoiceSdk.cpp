@@ -31,17 +31,34 @@ constexpr char SampleConstants::ClientCredentialsId[];
 constexpr char SampleConstants::ClientCredentialsSecret[];
 constexpr char SampleConstants::EncryptionKey[];
 constexpr char SampleConstants::GameName[];
+constexpr size_t FVoiceSdk::MaxUsersPerJoinQuery;
 
 FVoiceSdk::~FVoiceSdk()
 {
 }
 
-void FVoiceSdk::ReleaseRequest(FVoiceRequestHandle VoiceRequestHandle)
+void FVoiceSdk::QueueRequest(FVoiceRequestPtr&& Request)
 {
-	FScopedLock Lock(RequestsMutex);
+	Request->QueuedAt = std::chrono::steady_clock::now();
 
-	size_t NumErased = erase_if(ActiveRequests, [=](const FVoiceRequestPtr& VoiceRequest) { return VoiceRequest.get() == VoiceRequestHandle; });
-	assert(NumErased == 1);
+	FStatsLock Lock(RequestsMutex);
+	NewRequests.push_back(std::move(Request));
+	RequestStats.PeakQueueDepth = std::max(RequestStats.PeakQueueDepth, NewRequests.size());
+}
+
+void FVoiceSdk::SetMaxRequestsPerTick(size_t InMaxRequestsPerTick)
+{
+	FStatsLock Lock(RequestsMutex);
+	MaxRequestsPerTick = std::max<size_t>(InMaxRequestsPerTick, 1);
+}
+
+FVoiceRequestStats FVoiceSdk::GetRequestStats() const
+{
+	FStatsLock Lock(RequestsMutex);
+
+	FVoiceRequestStats Stats = RequestStats;
+	Stats.QueueDepth = NewRequests.size();
+	return Stats;
 }
 
 
@@ -229,12 +246,10 @@ EOS_Bool FVoiceSdk::Shutdown()
 
 	// wipe the queues
 	{
-		FScopedLock lock(RequestsMutex);
-
-		std::queue<FVoiceRequestPtr> empty;
-		std::swap(NewRequests, empty);
-		ActiveRequests.clear();
+		FStatsLock lock(RequestsMutex);
+		NewRequests.clear();
 	}
+	ActiveRequests.clear();
 
 	if (ShutdownResult != EOS_EResult::EOS_Success)
 	{
@@ -247,37 +262,19 @@ EOS_Bool FVoiceSdk::Shutdown()
 	return EOS_TRUE;
 }
 
-FJoinRoomReceiptPtr FVoiceSdk::CreateJoinRoomTokens(const char* RoomId, const std::vector<FVoiceUser>& Users)
+void FVoiceSdk::CreateJoinRoomTokens(const char* RoomId, const std::vector<FVoiceUser>& Users, FOnJoinRoomComplete OnComplete)
 {
-	FVoiceRequestJoin* QueryToken = new FVoiceRequestJoin(RTCAdminHandle, RoomId, Users);
-	FVoiceRequestPtr Request(QueryToken);
-
-	FScopedLock Lock(RequestsMutex);
-	NewRequests.push(std::move(Request));	
-	
-	return FJoinRoomReceiptPtr(new FJoinRoomReceipt(QueryToken->GetFuture(), QueryToken, this));
+	QueueRequest(FVoiceRequestPtr(new FVoiceRequestJoin(RTCAdminHandle, RoomId, Users, std::move(OnComplete))));
 }
 
-FVoiceRequestReceiptPtr FVoiceSdk::KickUser(const char* RoomId, const EOS_ProductUserId& ProductUserId)
+void FVoiceSdk::KickUser(const char* RoomId, const EOS_ProductUserId& ProductUserId, FOnVoiceRequestComplete OnComplete)
 {
-	FVoiceRequestKickUser* Kick = new FVoiceRequestKickUser(RTCAdminHandle, RoomId, ProductUserId);
-	FVoiceRequestPtr Request(Kick);
-
-	FScopedLock Lock(RequestsMutex);
-	NewRequests.push(std::move(Request));
-
-	return FVoiceRequestReceiptPtr(new FVoiceRequestReceipt(Kick->GetFuture(), Kick, this));
+	QueueRequest(FVoiceRequestPtr(new FVoiceRequestKickUser(RTCAdminHandle, RoomId, ProductUserId, std::move(OnComplete))));
 }
 
-FVoiceRequestReceiptPtr FVoiceSdk::MuteUser(const char* RoomId, const EOS_ProductUserId& ProductUserId, bool bMute)
+void FVoiceSdk::MuteUser(const char* RoomId, const EOS_ProductUserId& ProductUserId, bool bMute, FOnVoiceRequestComplete OnComplete)
 {
-	FVoiceRequestMuteUser* Mute = new FVoiceRequestMuteUser(RTCAdminHandle, RoomId, ProductUserId, bMute);
-	FVoiceRequestPtr Request(Mute);
-
-	FScopedLock Lock(RequestsMutex);
-	NewRequests.push(std::move(Request));
-
-	return FVoiceRequestReceiptPtr(new FVoiceRequestReceipt(Mute->GetFuture(), Mute, this));
+	QueueRequest(FVoiceRequestPtr(new FVoiceRequestMuteUser(RTCAdminHandle, RoomId, ProductUserId, bMute, std::move(OnComplete))));
 }
 
 
@@ -286,19 +283,64 @@ void FVoiceSdk::Tick()
 	/** VoiceReqeusts come in from the http api threadpool, but EOS SDK calls must all originate from the same thread.
 	  * Therefore the VoiceRequests are queued up by FVoiceSdk, which processes them on its main thread, right here as part of Tick.
 	  */
-	if (!NewRequests.empty())
-	{	
-		FScopedLock Lock(RequestsMutex);
+	std::vector<FVoiceRequest*> RequestsToMake;
+	{
+		FStatsLock Lock(RequestsMutex);
 
-		/** Currently just processing 1 request per Tick */
-		FDebugLog::Log(L"Processing voice request (%d more queued)", NewRequests.size() - 1);
+		const size_t NumToProcess = std::min(NewRequests.size(), MaxRequestsPerTick);
+		if (NumToProcess > 0)
+		{
+			FDebugLog::Log(L"Processing %d voice requests (%d more queued)", NumToProcess, NewRequests.size() - NumToProcess);
+		}
+
+		// join requests for the same room are answered by one token query
+		std::unordered_map<std::string, FVoiceRequestJoin*> JoinsByRoom;
+
+		const ServerTimePoint Now = std::chrono::steady_clock::now();
+		RequestsToMake.reserve(NumToProcess);
+		for (size_t Index = 0; Index < NumToProcess; ++Index)
+		{
+			FVoiceRequestPtr Request = std::move(NewRequests.front());
+			NewRequests.pop_front();
+
+			const auto QueueWait = std::chrono::duration_cast<std::chrono::microseconds>(Now - Request->QueuedAt);
+			RequestStats.TotalQueueWait += QueueWait;
+			RequestStats.MaxQueueWait = std::max(RequestStats.MaxQueueWait, QueueWait);
+			++RequestStats.NumProcessed;
+
+			bool bCoalesced = false;
+			if (FVoiceRequestJoin* Join = dynamic_cast<FVoiceRequestJoin*>(Request.get()))
+			{
+				auto Itr = JoinsByRoom.find(Join->GetRoomName());
+				if (Itr != JoinsByRoom.end() && Itr->second->GetNumUsers() + Join->GetNumUsers() <= MaxUsersPerJoinQuery)
+				{
+					Itr->second->Coalesce(*Join);
+					++RequestStats.NumCoalesced;
+					bCoalesced = true;
+				}
+				else
+				{
+					JoinsByRoom[Join->GetRoomName()] = Join;
+				}
+			}
 
-		FVoiceRequestPtr Request = std::move(NewRequests.back());
-		NewRequests.pop();
+			if (!bCoalesced)
+			{
+				RequestsToMake.push_back(Request.get());
+			}
+			ActiveRequests.push_back(std::move(Request));
+		}
+	}
 
+	// make the requests without holding the lock, so the http threads can keep queueing
+	for (FVoiceRequest* Request : RequestsToMake)
+	{
 		Request->MakeRequest(RTCAdminHandle);
-		ActiveRequests.push_back(std::move(Request));
 	}
 
+	// completion callbacks are called from here
 	EOS_Platform_Tick(PlatformHandle);
+
+	// requests can't be released from within their own sdk callback, so completed ones are released once the sdk tick is done
+	erase_if(ActiveRequests, [](const FVoiceRequestPtr& Request) { return Request->IsComplete(); });
 }
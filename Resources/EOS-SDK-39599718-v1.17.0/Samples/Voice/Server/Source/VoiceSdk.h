@@ -7,47 +7,79 @@
 
 #include <eos_sdk.h>
 
-/** Server VoiceSdk Wrapper to manage multiple requests originating from different threads. */
-class FVoiceSdk : public FNonCopyable
+/** Counters for the request queue, showing how far the main thread is behind the http threads */
+struct FVoiceRequestStats
 {
-	friend class FJoinRoomReceipt;
-	friend class FVoiceRequestReceipt;
+	/** Requests waiting to be made, now and at most since startup */
+	size_t QueueDepth = 0;
+	size_t PeakQueueDepth = 0;
+
+	/** Requests made since startup, and how many of them were join requests answered by another request's token query */
+	uint64_t NumProcessed = 0;
+	uint64_t NumCoalesced = 0;
+
+	/** Time requests spent queued before being made, in total and at most */
+	std::chrono::microseconds TotalQueueWait = std::chrono::microseconds::zero();
+	std::chrono::microseconds MaxQueueWait = std::chrono::microseconds::zero();
+};
 
+/** Server VoiceSdk Wrapper to manage multiple requests originating from different threads.
+  * Requests are made and completed on the main thread, completion callbacks are called from Tick and must not block.
+  */
+class FVoiceSdk : public FNonCopyable
+{
 public:
 	FVoiceSdk() noexcept(false) { }
 	virtual ~FVoiceSdk();
 
-	EOS_Bool LoadAndInitSdk();
+	virtual EOS_Bool LoadAndInitSdk();
 	EOS_Bool Shutdown();
 	
 	/** Queues up a request for a joinRoom token for each of the provided users */
-	FJoinRoomReceiptPtr CreateJoinRoomTokens(const char* RoomId, const std::vector<FVoiceUser>& Users);
+	void CreateJoinRoomTokens(const char* RoomId, const std::vector<FVoiceUser>& Users, FOnJoinRoomComplete OnComplete);
 
 	/** Queues up a request to kick a user from the session */
-	FVoiceRequestReceiptPtr KickUser(const char* RoomId, const EOS_ProductUserId& ProductUserId);
+	void KickUser(const char* RoomId, const EOS_ProductUserId& ProductUserId, FOnVoiceRequestComplete OnComplete);
 
 	/** Queues up a request to remote mute a user in the session */
-	FVoiceRequestReceiptPtr MuteUser(const char* RoomId, const EOS_ProductUserId& ProductUserId, bool bMute);
+	void MuteUser(const char* RoomId, const EOS_ProductUserId& ProductUserId, bool bMute, FOnVoiceRequestComplete OnComplete);
 
-	/** Processes queued requests */
+	/** Processes queued requests, oldest first, up to the per tick budget */
 	void Tick();
 
+	/** Sets how many queued requests are made per Tick */
+	void SetMaxRequestsPerTick(size_t InMaxRequestsPerTick);
+
+	FVoiceRequestStats GetRequestStats() const;
+
+	/** Contention of RequestsMutex between the http thread and the main thread */
+	FLockStats GetRequestsLockStats() const { return RequestsMutex.GetStats(); }
+
 private:
-	/** called by Receipt friend classes */
-	void ReleaseRequest(FVoiceRequestHandle VoiceRequestHandle);
+	/** Join requests for the same room are only coalesced up to this many users per token query */
+	static constexpr size_t MaxUsersPerJoinQuery = 16;
+
+	/** Stamps and queues a request to be made on the main thread */
+	void QueueRequest(FVoiceRequestPtr&& Request);
 
+protected:
 	/** Handle to EOS SDK Platform */
 	EOS_HPlatform PlatformHandle = 0;
 
 	/** Handle to EOS SDK RTC Admin system */
 	EOS_HRTCAdmin RTCAdminHandle = 0;
 
-	/** mutex for accessing NewRequests & ActiveRequests */
-	std::mutex RequestsMutex;
+private:
+	/** mutex for accessing NewRequests & RequestStats */
+	mutable TStatsMutex<std::mutex> RequestsMutex;
 	
-	/** new requests that need to be kicked off */
-	std::queue<FVoiceRequestPtr> NewRequests;
+	/** new requests that need to be kicked off, in the order they were queued */
+	std::deque<FVoiceRequestPtr> NewRequests;
 
-	/** active requests that are in flight */
+	/** active requests that are in flight, only used on the main thread */
 	std::vector<FVoiceRequestPtr> ActiveRequests;
+
+	size_t MaxRequestsPerTick = 32;
+
+	FVoiceRequestStats RequestStats;
 };
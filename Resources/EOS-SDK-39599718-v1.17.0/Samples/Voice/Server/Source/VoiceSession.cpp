@@ -8,8 +8,8 @@
 const uint32_t FVoiceSession::kSessionHeartbeatTimeout = 70;
 
 FVoiceSession::FVoiceSession(const std::string& InSessionId, const std::string& InSessionLock, const std::string& InSessionPassword, const std::initializer_list<FVoiceUser>& InSessionMembers) :
-	Expiration(std::chrono::steady_clock::now()),
 	SessionId(InSessionId),
+	Expiration(0),
 	SessionLock(InSessionLock),
 	SessionPassword(InSessionPassword),
 	SessionMembers(InSessionMembers)
@@ -71,15 +71,22 @@ bool FVoiceSession::BanUser(const FVoiceUser& InUser)
 
 bool FVoiceSession::IsUserBanned(const FVoiceUser& User) const
 {	
+	FScopedLock Lock(BanListMutex);
 	return PuidBanList.find(User.GetPuid()) != PuidBanList.end();
 }
 
 void FVoiceSession::ResetHeartbeat()
 {
-	Expiration = std::chrono::steady_clock::now() + std::chrono::seconds(FVoiceSession::kSessionHeartbeatTimeout);
+	const ServerTimePoint NewExpiration = std::chrono::steady_clock::now() + std::chrono::seconds(FVoiceSession::kSessionHeartbeatTimeout);
+	Expiration.store(NewExpiration.time_since_epoch().count(), std::memory_order_relaxed);
 }
 
 bool FVoiceSession::IsExpired(const ServerTimePoint& Now) const
 {
-	return Now > Expiration;
+	return Now > GetExpiration();
+}
+
+ServerTimePoint FVoiceSession::GetExpiration() const
+{
+	return ServerTimePoint(ServerTimePoint::duration(Expiration.load(std::memory_order_relaxed)));
 }
\ No newline at end of file
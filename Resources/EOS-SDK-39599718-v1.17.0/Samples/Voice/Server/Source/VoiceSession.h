@@ -21,13 +21,15 @@ public:
 
 	void ResetHeartbeat();
 	bool IsExpired(const ServerTimePoint& Now) const;
+	ServerTimePoint GetExpiration() const;
 
 private:
 	/** The unique identifier of the session, generated by the voiceServer. */
 	std::string SessionId;
 
-	/** Expiration time of the session, heartbeat the session to keep it alive. Used to remove unused sessions */	  
-	ServerTimePoint Expiration;
+	/** Expiration time of the session (steady_clock ticks), heartbeat the session to keep it alive. Used to remove unused sessions.
+	  * Atomic since heartbeats arrive on the http threads while the main thread sweeps expired sessions. */
+	std::atomic<ServerTimePoint::rep> Expiration;
 
 	/** The Lock represents a private key, initially only shared with the creator of the session to perform owner-level operations such as kick or remoteMute. */
 	std::string SessionLock;
@@ -39,7 +41,7 @@ private:
 	std::vector<FVoiceUser> SessionMembers;
 
 	/** Once members get kicked, they land on the ban list to prevent them from rejoining using previously issued tokens. */
-	std::mutex BanListMutex;
+	mutable std::mutex BanListMutex;
 	std::unordered_set<EOS_ProductUserId> PuidBanList;
 
 	/** Sessions expire after N seconds without any activity or heartbeat */
@@ -11,9 +11,16 @@
 #include <fstream>
 #include <cassert>
 #include <future>
+#include <functional>
+#include <thread>
 #include <iterator>
 #include <queue>
+#include <deque>
 #include <unordered_set>
+#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <shared_mutex>
 #include <chrono>
 #include <random>
 
@@ -81,7 +88,12 @@ using FVoiceHostPtr = std::shared_ptr<FVoiceHost>;
 class FVoiceSdk;
 using FVoiceSdkPtr = std::shared_ptr<FVoiceSdk>;
 
+#include "LockStats.h"
+
 using FScopedLock = std::lock_guard<std::mutex>;
+using FStatsLock = std::lock_guard<TStatsMutex<std::mutex>>;
+using FSharedLock = std::shared_lock<TStatsMutex<std::shared_timed_mutex>>;
+using FExclusiveLock = std::unique_lock<TStatsMutex<std::shared_timed_mutex>>;
 
 using ServerTimePoint = std::chrono::time_point<std::chrono::steady_clock>;
 